@@ -23,7 +23,8 @@
 #include <dali-test-suite-utils.h>
 
 // Internal headers are allowed here
-
+#include <dali/internal/common/thread-pool.h>
+#include <dali/internal/render/common/performance-monitor.h>
 
 using namespace Dali;
 
@@ -66,3 +67,124 @@ int UtcDaliCoreTopMargin(void)
 
   END_TEST;
 }
+
+namespace
+{
+
+void UpdateAlwaysConstraint( Vector3& current, const PropertyInputContainer& /* inputs */ )
+{
+  current.x += 1.0f;
+}
+
+/**
+ * Increases a counter once for every item it processes
+ */
+class CountingTask : public Internal::ThreadPool::Task
+{
+public:
+
+  virtual void Process( unsigned int begin, unsigned int end )
+  {
+    INCREASE_BY( Internal::PerformanceMonitor::CONSTRAINTS_APPLIED, end - begin );
+  }
+};
+
+} // unnamed namespace
+
+int UtcDaliCoreGetFrameStatistics(void)
+{
+  TestApplication application;
+  tet_infoline("Testing Dali::Integration::Core::GetFrameStatistics");
+
+  Actor actor = Actor::New();
+  Stage::GetCurrent().Add( actor );
+
+  Animation animation = Animation::New( 1.0f );
+  animation.AnimateTo( Property( actor, Actor::Property::POSITION_Y ), 100.0f );
+  animation.Play();
+
+  Constraint constraint = Constraint::New< Vector3 >( actor, Actor::Property::POSITION, &UpdateAlwaysConstraint );
+  constraint.Apply();
+
+  // Nothing is recorded by default
+  application.SendNotification();
+  application.Render( 16 );
+
+  Dali::Vector< Integration::FrameStatistics > frames;
+  application.GetCore().GetFrameStatistics( frames );
+  DALI_TEST_EQUALS( frames.Count(), 0u, TEST_LOCATION );
+
+  application.GetCore().EnablePerformanceMonitor( true );
+  for( unsigned int i = 0u; i < 3u; ++i )
+  {
+    application.SendNotification();
+    application.Render( 16 );
+  }
+
+  application.GetCore().GetFrameStatistics( frames );
+  DALI_TEST_EQUALS( frames.Count(), 6u, TEST_LOCATION );
+
+  for( unsigned int i = 0u; i < 3u; ++i )
+  {
+    const Integration::FrameStatistics& update = frames[i];
+    const Integration::FrameStatistics& render = frames[i + 3u];
+    DALI_TEST_EQUALS( update.thread, Integration::FrameStatistics::UPDATE_THREAD, TEST_LOCATION );
+    DALI_TEST_EQUALS( render.thread, Integration::FrameStatistics::RENDER_THREAD, TEST_LOCATION );
+    DALI_TEST_EQUALS( update.frameNumber, frames[0].frameNumber + i, TEST_LOCATION );
+    DALI_TEST_EQUALS( render.frameNumber, update.frameNumber, TEST_LOCATION );
+    DALI_TEST_CHECK( update.animatorsApplied > 0u );
+    DALI_TEST_CHECK( update.constraintsApplied > 0u );
+    DALI_TEST_CHECK( update.frameTime >= update.animateTime + update.updateNodesTime );
+    DALI_TEST_CHECK( render.frameTime >= render.drawNodesTime );
+    DALI_TEST_CHECK( render.startTime >= update.startTime );
+  }
+
+  // The frames are only retrieved once
+  frames.Clear();
+  application.GetCore().GetFrameStatistics( frames );
+  DALI_TEST_EQUALS( frames.Count(), 0u, TEST_LOCATION );
+
+  // Frames are dropped when the buffers are full
+  for( unsigned int i = 0u; i < 200u; ++i )
+  {
+    application.SendNotification();
+    application.Render( 16 );
+  }
+  application.GetCore().GetFrameStatistics( frames );
+  DALI_TEST_EQUALS( frames.Count(), 256u, TEST_LOCATION );
+
+  application.GetCore().EnablePerformanceMonitor( false );
+  application.SendNotification();
+  application.Render( 16 );
+
+  frames.Clear();
+  application.GetCore().GetFrameStatistics( frames );
+  DALI_TEST_EQUALS( frames.Count(), 0u, TEST_LOCATION );
+
+  END_TEST;
+}
+
+int UtcDaliCorePerformanceMonitorWorkerThreads(void)
+{
+  TestApplication application;
+  tet_infoline("Testing that counters increased on worker threads are recorded in the update thread's frame");
+
+  Internal::ThreadPool threadPool;
+  threadPool.Initialize( 3u );
+
+  Internal::PerformanceMonitor monitor;
+  monitor.SetEnabled( true );
+  monitor.FrameStart( Internal::PerformanceMonitor::UPDATE_THREAD );
+
+  CountingTask task;
+  threadPool.ParallelProcess( task, 0u, 1000u, 10u );
+  INCREASE_COUNTER( Internal::PerformanceMonitor::CONSTRAINTS_APPLIED );
+
+  monitor.FrameEnd( Internal::PerformanceMonitor::UPDATE_THREAD );
+
+  Integration::FrameStatistics statistics;
+  DALI_TEST_CHECK( monitor.PopFrame( Internal::PerformanceMonitor::UPDATE_THREAD, statistics ) );
+  DALI_TEST_EQUALS( statistics.constraintsApplied, 1001u, TEST_LOCATION );
+
+  END_TEST;
+}
@@ -18,6 +18,7 @@
 // EXTERNAL INCLUDES
 #include <dali/public-api/dali-core.h>
 #include <dali/devel-api/images/texture-set-image.h>
+#include <dali/devel-api/actors/layer-devel.h>
 #include <iostream>
 #include <algorithm>
 #include <stdlib.h>
@@ -26,7 +27,12 @@
 #include <dali-test-suite-utils.h>
 #include <mesh-builder.h>
 
+// Internal headers are allowed here
+#include <dali/internal/update/manager/transform-manager.h>
+
 using namespace Dali;
+using Dali::Internal::SceneGraph::TransformManager;
+using Dali::Internal::SceneGraph::TransformId;
 
 #define MAKE_SHADER(A)#A
 
@@ -107,6 +113,80 @@ bool GetCameraDepths( TestApplication& application, float& nearPlane, float& far
   return !!cameraActor;
 }
 
+Actor CreateRendererActor( Geometry& geometry, Shader& shader, const Vector2& size )
+{
+  Renderer renderer = Renderer::New( geometry, shader );
+  Actor actor = Actor::New();
+  actor.AddRenderer( renderer );
+  actor.SetSize( size );
+  return actor;
+}
+
+/**
+ * Creates a list of items stacked from the top of the stage down, like a scrolled list
+ * Each item has a renderer, and a row of children with renderers.
+ */
+Actor CreateList( unsigned int itemCount, unsigned int childCount )
+{
+  Geometry geometry = CreateQuadGeometry();
+  Shader shader = Shader::New( VERTEX_SHADER, FRAGMENT_SHADER );
+
+  Actor list = Actor::New();
+  list.SetParentOrigin( ParentOrigin::TOP_CENTER );
+  list.SetAnchorPoint( AnchorPoint::TOP_CENTER );
+  for( unsigned int i = 0; i < itemCount; ++i )
+  {
+    Actor item = CreateRendererActor( geometry, shader, Vector2( 400.0f, 100.0f ) );
+    item.SetParentOrigin( ParentOrigin::TOP_CENTER );
+    item.SetAnchorPoint( AnchorPoint::TOP_CENTER );
+    item.SetPosition( 0.0f, static_cast<float>( i ) * 100.0f );
+    for( unsigned int j = 0; j < childCount; ++j )
+    {
+      Actor child = CreateRendererActor( geometry, shader, Vector2( 30.0f, 30.0f ) );
+      child.SetPosition( 20.0f + static_cast<float>( j ) * 40.0f, 50.0f );
+      item.Add( child );
+    }
+    list.Add( item );
+  }
+
+  return list;
+}
+
+/**
+ * Renders a frame and counts the draw calls
+ */
+int CountDraws( TestApplication& application )
+{
+  TraceCallStack& drawTrace = application.GetGlAbstraction().GetDrawTrace();
+  drawTrace.Enable( true );
+  drawTrace.Reset();
+  application.SendNotification();
+  application.Render( 16 );
+  return drawTrace.CountMethod( "DrawElements" );
+}
+
+/**
+ * Scrolls a list by a few pixels and renders a frame each time it is called, for timing with TimeRepeatedMilliseconds()
+ */
+struct ScrollFrame
+{
+  ScrollFrame( TestApplication& application, Actor list )
+  : mApplication( application ),
+    mList( list )
+  {
+  }
+
+  void operator()( unsigned int frame )
+  {
+    mList.SetY( -10.0f * static_cast<float>( frame ) );
+    mApplication.SendNotification();
+    mApplication.Render( 16 );
+  }
+
+  TestApplication& mApplication;
+  Actor mList;
+};
+
 int UtcFrustumCullN(void)
 {
   TestApplication application;
@@ -431,3 +511,172 @@ int UtcFrustumCullDisabledP(void)
 
   END_TEST;
 }
+
+int UtcFrustumCullManyRenderersP(void)
+{
+  TestApplication application;
+
+  Geometry geometry = CreateQuadGeometry();
+  Shader shader = Shader::New( VERTEX_SHADER, FRAGMENT_SHADER );
+
+  // The spheres are checked in batches; use a count which leaves a partial batch
+  const unsigned int actorCount = 23u;
+  int onStageCount = 0;
+  for( unsigned int i = 0; i < actorCount; ++i )
+  {
+    Actor actor = CreateRendererActor( geometry, shader, Vector2( 10.0f, 10.0f ) );
+    actor.SetParentOrigin( ParentOrigin::CENTER );
+    if( i % 3u == 0u )
+    {
+      actor.SetPosition( 1000.0f, static_cast<float>( i ) * 10.0f );
+    }
+    else
+    {
+      actor.SetPosition( 0.0f, static_cast<float>( i ) * 10.0f - 200.0f );
+      ++onStageCount;
+    }
+    Stage::GetCurrent().Add( actor );
+  }
+
+  DALI_TEST_EQUALS( CountDraws( application ), onStageCount, TEST_LOCATION );
+
+  END_TEST;
+}
+
+int UtcFrustumHierarchicalCullingProperty(void)
+{
+  TestApplication application;
+
+  Layer layer = Layer::New();
+  DALI_TEST_EQUALS( layer.GetProperty< bool >( DevelLayer::Property::HIERARCHICAL_CULLING ), false, TEST_LOCATION );
+  DALI_TEST_EQUALS( layer.GetPropertyIndex( "hierarchicalCulling" ), static_cast< Property::Index >( DevelLayer::Property::HIERARCHICAL_CULLING ), TEST_LOCATION );
+
+  layer.SetProperty( DevelLayer::Property::HIERARCHICAL_CULLING, true );
+  DALI_TEST_EQUALS( layer.GetProperty< bool >( DevelLayer::Property::HIERARCHICAL_CULLING ), true, TEST_LOCATION );
+
+  END_TEST;
+}
+
+int UtcFrustumHierarchicalCullP(void)
+{
+  TestApplication application;
+
+  Stage::GetCurrent().GetRootLayer().SetProperty( DevelLayer::Property::HIERARCHICAL_CULLING, true );
+
+  Actor list = CreateList( 4u, 3u );
+  list.SetX( 2000.0f );
+  Stage::GetCurrent().Add( list );
+
+  // The whole list is off-stage
+  DALI_TEST_EQUALS( CountDraws( application ), 0, TEST_LOCATION );
+
+  // A child which is on-stage is drawn, though its parent is not
+  Actor child = list.GetChildAt( 1u ).GetChildAt( 2u );
+  child.SetX( -2000.0f );
+  DALI_TEST_EQUALS( CountDraws( application ), 1, TEST_LOCATION );
+
+  // Scrolling the list on-stage draws every item
+  list.SetX( 0.0f );
+  DALI_TEST_EQUALS( CountDraws( application ), 15, TEST_LOCATION );
+
+  END_TEST;
+}
+
+int UtcFrustumHierarchicalCullMatchesLeafCullP(void)
+{
+  TestApplication application;
+
+  Actor list = CreateList( 40u, 5u );
+  Stage::GetCurrent().Add( list );
+
+  for( unsigned int frame = 0; frame < 5u; ++frame )
+  {
+    list.SetY( static_cast<float>( frame ) * -700.0f );
+
+    Stage::GetCurrent().GetRootLayer().SetProperty( DevelLayer::Property::HIERARCHICAL_CULLING, false );
+    const int leafDraws = CountDraws( application );
+
+    Stage::GetCurrent().GetRootLayer().SetProperty( DevelLayer::Property::HIERARCHICAL_CULLING, true );
+    const int hierarchicalDraws = CountDraws( application );
+
+    DALI_TEST_EQUALS( hierarchicalDraws, leafDraws, TEST_LOCATION );
+    DALI_TEST_CHECK( leafDraws > 0 );
+    DALI_TEST_CHECK( leafDraws < 240 );
+  }
+
+  END_TEST;
+}
+
+int UtcFrustumSubtreeBoundingSphereP(void)
+{
+  TestApplication application;
+
+  TransformManager manager;
+  const TransformId parent = manager.CreateTransform();
+  const TransformId child1 = manager.CreateTransform();
+  const TransformId child2 = manager.CreateTransform();
+  const TransformId grandChild = manager.CreateTransform();
+  manager.SetParent( child1, parent );
+  manager.SetParent( child2, parent );
+  manager.SetParent( grandChild, child1 );
+
+  manager.SetVector3PropertyValue( parent, Internal::SceneGraph::TRANSFORM_PROPERTY_SIZE, Vector3( 10.0f, 10.0f, 0.0f ) );
+  manager.SetVector3PropertyValue( child1, Internal::SceneGraph::TRANSFORM_PROPERTY_SIZE, Vector3( 20.0f, 20.0f, 0.0f ) );
+  manager.SetVector3PropertyValue( child1, Internal::SceneGraph::TRANSFORM_PROPERTY_POSITION, Vector3( -100.0f, 0.0f, 0.0f ) );
+  manager.SetVector3PropertyValue( child2, Internal::SceneGraph::TRANSFORM_PROPERTY_SIZE, Vector3( 40.0f, 40.0f, 0.0f ) );
+  manager.SetVector3PropertyValue( child2, Internal::SceneGraph::TRANSFORM_PROPERTY_POSITION, Vector3( 200.0f, 50.0f, 0.0f ) );
+
+  // The grand child has no size, so it does not grow the bounds of its ancestors
+  manager.SetVector3PropertyValue( grandChild, Internal::SceneGraph::TRANSFORM_PROPERTY_POSITION, Vector3( -1000.0f, 0.0f, 0.0f ) );
+  manager.Update();
+
+  DALI_TEST_EQUALS( manager.GetSubtreeBoundingSphere( child2 ), manager.GetBoundingSphere( child2 ), TEST_LOCATION );
+  DALI_TEST_EQUALS( manager.GetSubtreeBoundingSphere( child1 ), manager.GetBoundingSphere( child1 ), TEST_LOCATION );
+
+  const TransformId ids[] = { parent, child1, child2 };
+  for( unsigned int frame = 0; frame < 2u; ++frame )
+  {
+    const Vector4 subtree = manager.GetSubtreeBoundingSphere( parent );
+    for( unsigned int i = 0; i < sizeof( ids ) / sizeof( ids[0] ); ++i )
+    {
+      const Vector4& sphere = manager.GetBoundingSphere( ids[i] );
+      const float distance = ( Vector3( sphere ) - Vector3( subtree ) ).Length();
+      DALI_TEST_CHECK( distance + sphere.w <= subtree.w );
+    }
+
+    // Moving a child grows the bounds of the subtree after the next update
+    manager.SetVector3PropertyValue( child2, Internal::SceneGraph::TRANSFORM_PROPERTY_POSITION, Vector3( 500.0f * static_cast<float>( frame + 1u ), -300.0f, 0.0f ) );
+    manager.Update();
+    DALI_TEST_CHECK( manager.GetSubtreeBoundingSphere( parent ).w > subtree.w );
+  }
+
+  END_TEST;
+}
+
+int UtcFrustumHierarchicalCullBenchmark(void)
+{
+  TestApplication application;
+  tet_infoline( "Measure scrolling a list, culling each renderer and then culling subtrees" );
+
+  const unsigned int itemCount = IsBenchmarkEnabled() ? 200u : 10u;
+  const unsigned int childCount = 9u;
+  const unsigned int frames = IsBenchmarkEnabled() ? 20u : 2u;
+  Actor list = CreateList( itemCount, childCount );
+  Stage::GetCurrent().Add( list );
+  application.SendNotification();
+  application.Render( 16 );
+
+  ScrollFrame scrollFrame( application, list );
+  const double leafTime = TimeRepeatedMilliseconds( scrollFrame, frames );
+  const int leafDraws = CountDraws( application );
+  tet_printf( "Scrolling a list of %u renderers, culling each renderer: %.3f ms per frame\n", itemCount * ( childCount + 1u ), leafTime );
+
+  Stage::GetCurrent().GetRootLayer().SetProperty( DevelLayer::Property::HIERARCHICAL_CULLING, true );
+  const double hierarchicalTime = TimeRepeatedMilliseconds( scrollFrame, frames );
+  const int hierarchicalDraws = CountDraws( application );
+  tet_printf( "Scrolling a list of %u renderers, culling subtrees: %.3f ms per frame\n", itemCount * ( childCount + 1u ), hierarchicalTime );
+
+  DALI_TEST_EQUALS( hierarchicalDraws, leafDraws, TEST_LOCATION );
+
+  END_TEST;
+}
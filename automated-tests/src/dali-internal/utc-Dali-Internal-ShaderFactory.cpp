@@ -0,0 +1,281 @@
+/*
+ * Copyright (c) 2017 Samsung Electronics Co., Ltd.
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ * http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ *
+ */
+
+#include <iostream>
+#include <map>
+
+#include <stdlib.h>
+#include <pthread.h>
+#include <dali/public-api/dali-core.h>
+#include <dali/devel-api/threading/mutex.h>
+
+#include <dali-test-suite-utils.h>
+
+// Internal headers are allowed here
+#include <dali/internal/common/shader-data.h>
+#include <dali/internal/event/effects/shader-factory.h>
+
+using namespace Dali;
+
+void utc_dali_internal_shader_factory_startup()
+{
+  test_return_value = TET_UNDEF;
+}
+
+void utc_dali_internal_shader_factory_cleanup()
+{
+  test_return_value = TET_PASS;
+}
+
+namespace
+{
+
+const char* const VERTEX_SOURCE = "vertex";
+
+/**
+ * Keeps the shader binary files in memory, so that they outlive the ShaderFactory
+ */
+class FileStorePlatformAbstraction : public TestPlatformAbstraction
+{
+public:
+
+  FileStorePlatformAbstraction()
+  : mMutex(),
+    mFiles(),
+    mLoadCount( 0u ),
+    mWatchedThread(),
+    mWatching( false ),
+    mWatchedThreadFileCount( 0u )
+  {
+  }
+
+  virtual bool LoadShaderBinaryFile( const std::string& filename, Dali::Vector< unsigned char >& buffer ) const
+  {
+    Mutex::ScopedLock lock( mMutex );
+    ++mLoadCount;
+    CountWatchedThread();
+    std::map< std::string, Dali::Vector< unsigned char > >::const_iterator iter = mFiles.find( filename );
+    if( iter == mFiles.end() )
+    {
+      return false;
+    }
+    buffer = iter->second;
+    return true;
+  }
+
+  virtual bool SaveShaderBinaryFile( const std::string& filename, const unsigned char * buffer, unsigned int numBytes ) const
+  {
+    Mutex::ScopedLock lock( mMutex );
+    CountWatchedThread();
+    Dali::Vector< unsigned char >& file = mFiles[ filename ];
+    file.Resize( numBytes );
+    if( numBytes > 0u )
+    {
+      memcpy( file.Begin(), buffer, numBytes );
+    }
+    return true;
+  }
+
+  /**
+   * @return The number of non-empty files
+   */
+  unsigned int GetFileCount() const
+  {
+    unsigned int count = 0u;
+    for( std::map< std::string, Dali::Vector< unsigned char > >::const_iterator iter = mFiles.begin(); iter != mFiles.end(); ++iter )
+    {
+      count += iter->second.Empty() ? 0u : 1u;
+    }
+    return count;
+  }
+
+  /**
+   * Starts or stops counting the files loaded and saved by the calling thread
+   */
+  void WatchThisThread( bool watch )
+  {
+    Mutex::ScopedLock lock( mMutex );
+    mWatchedThread = pthread_self();
+    mWatching = watch;
+  }
+
+  /**
+   * Counts a file loaded or saved by the watched thread; mMutex must be locked
+   */
+  void CountWatchedThread() const
+  {
+    if( mWatching && pthread_equal( pthread_self(), mWatchedThread ) )
+    {
+      ++mWatchedThreadFileCount;
+    }
+  }
+
+  mutable Mutex mMutex;
+  mutable std::map< std::string, Dali::Vector< unsigned char > > mFiles;
+  mutable unsigned int mLoadCount;
+  pthread_t mWatchedThread;
+  bool mWatching;
+  mutable unsigned int mWatchedThreadFileCount;
+};
+
+/**
+ * Loads a shader, and saves a binary for it as the render thread would
+ */
+Internal::ShaderDataPtr CompileShader( Internal::ShaderFactory& factory, const std::string& fragmentSource, unsigned int binarySize )
+{
+  size_t hash = 0u;
+  Internal::ShaderDataPtr shaderData = factory.Load( VERTEX_SOURCE, fragmentSource, Shader::Hint::NONE, hash );
+  if( !shaderData->HasBinary() )
+  {
+    shaderData->AllocateBuffer( binarySize );
+    memset( shaderData->GetBufferData(), 0x5a, binarySize );
+    factory.SaveBinary( shaderData );
+  }
+  return shaderData;
+}
+
+} // unnamed namespace
+
+int UtcDaliShaderFactoryPreloadP(void)
+{
+  TestApplication application;
+  tet_infoline("Testing that binaries saved by one ShaderFactory are preloaded by the next");
+
+  FileStorePlatformAbstraction platform;
+  platform.mLoadCount = 0u;
+  {
+    Internal::ShaderFactory factory( platform );
+    factory.ContextCreated( "vendor", "renderer", "version" );
+    CompileShader( factory, "fragment1", 100u );
+    CompileShader( factory, "fragment2", 100u );
+  }
+  DALI_TEST_EQUALS( platform.GetFileCount(), 3u, TEST_LOCATION ); // Two binaries and the index
+
+  Internal::ShaderFactory factory( platform );
+  factory.ContextCreated( "vendor", "renderer", "version" );
+  factory.WaitForPreload();
+
+  // The binaries are in memory, so loading the shaders reads no files
+  platform.mLoadCount = 0u;
+  size_t hash = 0u;
+  Internal::ShaderDataPtr shaderData = factory.Load( VERTEX_SOURCE, "fragment1", Shader::Hint::NONE, hash );
+  DALI_TEST_CHECK( shaderData->HasBinary() );
+  DALI_TEST_EQUALS( shaderData->GetBufferSize(), 100u, TEST_LOCATION );
+  DALI_TEST_EQUALS( static_cast< unsigned int >( shaderData->GetBufferData()[ 99 ] ), 0x5au, TEST_LOCATION );
+  DALI_TEST_EQUALS( std::string( shaderData->GetFragmentShader() ), std::string( "fragment1" ), TEST_LOCATION );
+
+  shaderData = factory.Load( VERTEX_SOURCE, "fragment2", Shader::Hint::NONE, hash );
+  DALI_TEST_CHECK( shaderData->HasBinary() );
+
+  // A shader missing from the index is not looked for on disk
+  shaderData = factory.Load( VERTEX_SOURCE, "fragment3", Shader::Hint::NONE, hash );
+  DALI_TEST_CHECK( !shaderData->HasBinary() );
+  DALI_TEST_EQUALS( platform.mLoadCount, 0u, TEST_LOCATION );
+  END_TEST;
+}
+
+int UtcDaliShaderFactoryDriverChangedP(void)
+{
+  TestApplication application;
+  tet_infoline("Testing that binaries compiled by another driver are discarded");
+
+  FileStorePlatformAbstraction platform;
+  {
+    Internal::ShaderFactory factory( platform );
+    factory.ContextCreated( "vendor", "renderer", "version 1" );
+    CompileShader( factory, "fragment1", 100u );
+  }
+  DALI_TEST_EQUALS( platform.GetFileCount(), 2u, TEST_LOCATION );
+
+  Internal::ShaderFactory factory( platform );
+  factory.ContextCreated( "vendor", "renderer", "version 2" );
+  factory.WaitForPreload();
+
+  // Only the index is left
+  DALI_TEST_EQUALS( platform.GetFileCount(), 1u, TEST_LOCATION );
+
+  size_t hash = 0u;
+  Internal::ShaderDataPtr shaderData = factory.Load( VERTEX_SOURCE, "fragment1", Shader::Hint::NONE, hash );
+  DALI_TEST_CHECK( !shaderData->HasBinary() );
+  END_TEST;
+}
+
+int UtcDaliShaderFactoryEvictionP(void)
+{
+  TestApplication application;
+  tet_infoline("Testing that the least recently used binaries are evicted to keep within the cache size");
+
+  FileStorePlatformAbstraction platform;
+  Internal::ShaderFactory factory( platform );
+  factory.ContextCreated( "vendor", "renderer", "version" );
+  factory.WaitForPreload();
+  factory.SetCacheSize( 2500u );
+
+  CompileShader( factory, "fragment1", 1000u );
+  CompileShader( factory, "fragment2", 1000u );
+
+  // Use the first shader, so that the second is the least recently used
+  CompileShader( factory, "fragment1", 1000u );
+  CompileShader( factory, "fragment3", 1000u );
+  DALI_TEST_EQUALS( platform.GetFileCount(), 3u, TEST_LOCATION ); // Two binaries and the index
+
+  size_t hash = 0u;
+  DALI_TEST_CHECK( factory.Load( VERTEX_SOURCE, "fragment1", Shader::Hint::NONE, hash )->HasBinary() );
+  DALI_TEST_CHECK( !factory.Load( VERTEX_SOURCE, "fragment2", Shader::Hint::NONE, hash )->HasBinary() );
+  DALI_TEST_CHECK( factory.Load( VERTEX_SOURCE, "fragment3", Shader::Hint::NONE, hash )->HasBinary() );
+
+  // Shrinking the cache evicts binaries immediately
+  factory.SetCacheSize( 0u );
+  DALI_TEST_EQUALS( platform.GetFileCount(), 1u, TEST_LOCATION );
+  END_TEST;
+}
+
+int UtcDaliShaderFactoryContextCreatedWithoutFileAccessP(void)
+{
+  TestApplication application;
+  tet_infoline("Testing that the files are read and written by the preload thread, rather than by the thread creating the context");
+
+  FileStorePlatformAbstraction platform;
+  {
+    Internal::ShaderFactory factory( platform );
+    factory.ContextCreated( "vendor", "renderer", "version 1" );
+    CompileShader( factory, "fragment1", 100u );
+  }
+  DALI_TEST_EQUALS( platform.GetFileCount(), 2u, TEST_LOCATION );
+
+  Internal::ShaderFactory factory( platform );
+  platform.WatchThisThread( true );
+  factory.ContextCreated( "vendor", "renderer", "version 2" );
+  platform.WatchThisThread( false );
+  factory.WaitForPreload();
+
+  // The index was read and saved, and the binary of the other driver was discarded, by the preload thread
+  DALI_TEST_EQUALS( platform.mWatchedThreadFileCount, 0u, TEST_LOCATION );
+  DALI_TEST_EQUALS( platform.GetFileCount(), 1u, TEST_LOCATION );
+
+  // The preload thread also handles the next context
+  CompileShader( factory, "fragment2", 100u );
+  platform.WatchThisThread( true );
+  factory.ContextCreated( "vendor", "renderer", "version 2" );
+  platform.WatchThisThread( false );
+  factory.WaitForPreload();
+
+  DALI_TEST_EQUALS( platform.mWatchedThreadFileCount, 0u, TEST_LOCATION );
+  size_t hash = 0u;
+  DALI_TEST_CHECK( factory.Load( VERTEX_SOURCE, "fragment2", Shader::Hint::NONE, hash )->HasBinary() );
+  END_TEST;
+}
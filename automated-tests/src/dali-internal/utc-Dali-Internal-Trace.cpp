@@ -0,0 +1,140 @@
+/*
+ * Copyright (c) 2017 Samsung Electronics Co., Ltd.
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ * http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ *
+ */
+
+#include <iostream>
+#include <sstream>
+
+#include <stdlib.h>
+#include <dali/public-api/dali-core.h>
+#include <dali/integration-api/trace.h>
+
+#include <dali-test-suite-utils.h>
+
+// Internal headers are allowed here
+#include <dali/internal/common/trace-impl.h>
+
+using namespace Dali;
+
+void utc_dali_internal_trace_startup()
+{
+  test_return_value = TET_UNDEF;
+}
+
+void utc_dali_internal_trace_cleanup()
+{
+  test_return_value = TET_PASS;
+}
+
+namespace
+{
+
+const char* const EMPTY_TRACE = "{\"traceEvents\":[],\"displayTimeUnit\":\"ms\"}";
+
+unsigned int CountEvents( const std::string& trace )
+{
+  unsigned int count = 0u;
+  for( std::string::size_type position = trace.find( "\"ph\":\"X\"" ); position != std::string::npos; position = trace.find( "\"ph\":\"X\"", position + 1u ) )
+  {
+    ++count;
+  }
+  return count;
+}
+
+} // unnamed namespace
+
+int UtcDaliTraceWriteChromeTraceP(void)
+{
+  TestApplication application;
+  tet_infoline("Testing Dali::Integration::Trace::WriteChromeTrace");
+
+  Integration::Trace::ClearTrace();
+
+  std::ostringstream empty;
+  Integration::Trace::WriteChromeTrace( empty );
+  DALI_TEST_EQUALS( empty.str(), std::string( EMPTY_TRACE ), TEST_LOCATION );
+
+  Internal::Trace::Record( Internal::Trace::UPDATE_NODES, 1000000u, 3500000u );
+  Internal::Trace::Record( Internal::Trace::RENDER, 2000000u, 2000100u );
+
+  std::ostringstream trace;
+  Integration::Trace::WriteChromeTrace( trace );
+  tet_printf( "%s\n", trace.str().c_str() );
+
+  DALI_TEST_EQUALS( CountEvents( trace.str() ), 2u, TEST_LOCATION );
+  DALI_TEST_CHECK( trace.str().find( "{\"traceEvents\":[{\"name\":\"UpdateNodes\",\"cat\":\"dali\",\"ph\":\"X\",\"ts\":1000.0,\"dur\":2500.0," ) == 0u );
+  DALI_TEST_CHECK( trace.str().find( "{\"name\":\"RenderManager::Render\",\"cat\":\"dali\",\"ph\":\"X\",\"ts\":2000.0,\"dur\":0.1," ) != std::string::npos );
+
+  // Writing does not consume the markers
+  std::ostringstream again;
+  Integration::Trace::WriteChromeTrace( again );
+  DALI_TEST_EQUALS( again.str(), trace.str(), TEST_LOCATION );
+
+  Integration::Trace::ClearTrace();
+  std::ostringstream cleared;
+  Integration::Trace::WriteChromeTrace( cleared );
+  DALI_TEST_EQUALS( cleared.str(), std::string( EMPTY_TRACE ), TEST_LOCATION );
+
+  END_TEST;
+}
+
+int UtcDaliTraceRingBufferOverwritesOldestP(void)
+{
+  TestApplication application;
+  tet_infoline("Testing the trace ring buffer keeps the most recent markers");
+
+  Integration::Trace::ClearTrace();
+
+  for( unsigned int i = 0u; i < 20000u; ++i )
+  {
+    Internal::Trace::Record( Internal::Trace::ANIMATE, i * 1000u, i * 1000u + 500u );
+  }
+
+  std::ostringstream trace;
+  Integration::Trace::WriteChromeTrace( trace );
+
+  DALI_TEST_EQUALS( CountEvents( trace.str() ), 16384u, TEST_LOCATION );
+  DALI_TEST_CHECK( trace.str().find( "\"ts\":3616.0," ) != std::string::npos );  // Oldest kept marker
+  DALI_TEST_CHECK( trace.str().find( "\"ts\":3615.0," ) == std::string::npos );  // Overwritten marker
+  DALI_TEST_CHECK( trace.str().find( "\"ts\":19999.0," ) != std::string::npos ); // Newest marker
+
+  Integration::Trace::ClearTrace();
+  END_TEST;
+}
+
+int UtcDaliTraceScopedMarkerP(void)
+{
+  TestApplication application;
+  tet_infoline("Testing Dali::Internal::Trace::ScopedMarker records its scope");
+
+  Integration::Trace::ClearTrace();
+
+  const uint64_t before = Internal::Trace::GetTime();
+  {
+    Internal::Trace::ScopedMarker marker( Internal::Trace::PROCESS_EVENTS );
+  }
+  const uint64_t after = Internal::Trace::GetTime();
+  DALI_TEST_CHECK( after >= before );
+
+  std::ostringstream trace;
+  Integration::Trace::WriteChromeTrace( trace );
+
+  DALI_TEST_EQUALS( CountEvents( trace.str() ), 1u, TEST_LOCATION );
+  DALI_TEST_CHECK( trace.str().find( "\"name\":\"Core::ProcessEvents\"" ) != std::string::npos );
+
+  Integration::Trace::ClearTrace();
+  END_TEST;
+}
@@ -0,0 +1,408 @@
+/*
+ * Copyright (c) 2017 Samsung Electronics Co., Ltd.
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ * http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ *
+ */
+
+#include <cstring>
+
+#include <dali/public-api/dali-core.h>
+#include <dali-test-suite-utils.h>
+
+// Internal headers are allowed here
+
+#include <dali/internal/common/thread-pool.h>
+#include <dali/internal/update/manager/transform-manager.h>
+
+using namespace Dali;
+using Dali::Internal::ThreadPool;
+using Dali::Internal::SceneGraph::TransformManager;
+using Dali::Internal::SceneGraph::TransformId;
+
+void utc_dali_internal_transform_manager_startup(void)
+{
+  test_return_value = TET_UNDEF;
+}
+
+void utc_dali_internal_transform_manager_cleanup(void)
+{
+  test_return_value = TET_PASS;
+}
+
+namespace
+{
+
+/**
+ * Marks every item it processes, counting how many times each was seen
+ */
+class CountingTask : public ThreadPool::Task
+{
+public:
+
+  CountingTask( unsigned int itemCount )
+  : mCounts( itemCount, 0u )
+  {
+  }
+
+  virtual ~CountingTask()
+  {
+  }
+
+  virtual void Process( unsigned int begin, unsigned int end )
+  {
+    for( unsigned int i = begin; i < end; ++i )
+    {
+      __sync_fetch_and_add( &mCounts[i], 1u );
+    }
+  }
+
+  std::vector< unsigned int > mCounts;
+};
+
+/**
+ * Deterministic pseudo-random numbers so both managers get the same values
+ */
+float Random( unsigned int& seed )
+{
+  seed = seed * 1664525u + 1013904223u;
+  return static_cast<float>( seed >> 8 ) / static_cast<float>( 1u << 24 );
+}
+
+void SetRandomTransform( TransformManager& manager, TransformId id, unsigned int& seed )
+{
+  manager.SetVector3PropertyValue( id, Internal::SceneGraph::TRANSFORM_PROPERTY_POSITION, Vector3( Random( seed ) * 100.0f, Random( seed ) * 100.0f, Random( seed ) ) );
+  manager.SetVector3PropertyValue( id, Internal::SceneGraph::TRANSFORM_PROPERTY_SCALE, Vector3( 0.5f + Random( seed ), 0.5f + Random( seed ), 1.0f ) );
+  manager.SetVector3PropertyValue( id, Internal::SceneGraph::TRANSFORM_PROPERTY_SIZE, Vector3( Random( seed ) * 50.0f, Random( seed ) * 50.0f, 0.0f ) );
+  manager.SetQuaternionPropertyValue( id, Quaternion( Radian( Random( seed ) * Math::PI ), Vector3::ZAXIS ) );
+}
+
+/**
+ * Builds a scene with a wide part (root -> branches -> leaves) and a deep chain
+ */
+void BuildScene( TransformManager& manager, std::vector< TransformId >& ids, unsigned int branchCount, unsigned int leafCount, unsigned int depth )
+{
+  unsigned int seed = 1u;
+
+  TransformId root = manager.CreateTransform();
+  ids.push_back( root );
+  SetRandomTransform( manager, root, seed );
+
+  for( unsigned int branch = 0u; branch < branchCount; ++branch )
+  {
+    TransformId branchId = manager.CreateTransform();
+    ids.push_back( branchId );
+    manager.SetParent( branchId, root );
+    SetRandomTransform( manager, branchId, seed );
+
+    for( unsigned int leaf = 0u; leaf < leafCount; ++leaf )
+    {
+      TransformId leafId = manager.CreateTransform();
+      ids.push_back( leafId );
+      manager.SetParent( leafId, branchId );
+      SetRandomTransform( manager, leafId, seed );
+
+      // Exercise the partial inheritance path as well
+      if( leaf % 7u == 0u )
+      {
+        manager.SetInheritScale( leafId, false );
+      }
+      if( leaf % 11u == 0u )
+      {
+        manager.SetInheritPosition( leafId, false );
+      }
+    }
+  }
+
+  TransformId parent = root;
+  for( unsigned int level = 0u; level < depth; ++level )
+  {
+    TransformId child = manager.CreateTransform();
+    ids.push_back( child );
+    manager.SetParent( child, parent );
+    SetRandomTransform( manager, child, seed );
+    parent = child;
+  }
+}
+
+bool WorldTransformsMatch( const TransformManager& serial, const TransformManager& parallel, const std::vector< TransformId >& ids )
+{
+  for( std::vector< TransformId >::const_iterator iter = ids.begin(); iter != ids.end(); ++iter )
+  {
+    if( memcmp( serial.GetWorldMatrix( *iter ).AsFloat(), parallel.GetWorldMatrix( *iter ).AsFloat(), sizeof( float ) * 16u ) != 0 ||
+        memcmp( serial.GetBoundingSphere( *iter ).AsFloat(), parallel.GetBoundingSphere( *iter ).AsFloat(), sizeof( float ) * 4u ) != 0 )
+    {
+      return false;
+    }
+  }
+  return true;
+}
+
+/**
+ * Dirties the root each time it is called, so that every world matrix is recomputed by the update
+ */
+struct UpdateFrame
+{
+  UpdateFrame( TransformManager& manager, TransformId root )
+  : mManager( manager ),
+    mRoot( root )
+  {
+  }
+
+  void operator()( unsigned int frame )
+  {
+    mManager.SetVector3PropertyValue( mRoot, Internal::SceneGraph::TRANSFORM_PROPERTY_POSITION, Vector3( static_cast<float>( frame ), 0.0f, 0.0f ) );
+    mManager.Update();
+  }
+
+  TransformManager& mManager;
+  TransformId mRoot;
+};
+
+double TimeUpdates( TransformManager& manager, const std::vector< TransformId >& ids, unsigned int frames )
+{
+  UpdateFrame updateFrame( manager, ids[0] );
+  return TimeRepeatedMilliseconds( updateFrame, frames );
+}
+
+} // unnamed namespace
+
+int UtcDaliThreadPoolParallelProcessP(void)
+{
+  TestApplication application;
+
+  ThreadPool threadPool;
+  threadPool.Initialize( 3u );
+  DALI_TEST_EQUALS( threadPool.GetWorkerCount(), 3u, TEST_LOCATION );
+
+  for( unsigned int run = 0u; run < 20u; ++run )
+  {
+    CountingTask task( 1000u );
+    threadPool.ParallelProcess( task, 10u, 990u, 7u );
+
+    bool processedOnce = true;
+    for( unsigned int i = 0u; i < 1000u; ++i )
+    {
+      const unsigned int expected = ( i >= 10u && i < 990u ) ? 1u : 0u;
+      processedOnce = processedOnce && ( task.mCounts[i] == expected );
+    }
+    DALI_TEST_CHECK( processedOnce );
+  }
+
+  // Restarting the pool with no workers processes everything on the calling thread
+  threadPool.Initialize( 0u );
+  DALI_TEST_EQUALS( threadPool.GetWorkerCount(), 0u, TEST_LOCATION );
+
+  CountingTask task( 100u );
+  threadPool.ParallelProcess( task, 0u, 100u, 7u );
+  DALI_TEST_EQUALS( task.mCounts[0], 1u, TEST_LOCATION );
+  DALI_TEST_EQUALS( task.mCounts[99], 1u, TEST_LOCATION );
+
+  END_TEST;
+}
+
+int UtcDaliTransformManagerParallelUpdateP(void)
+{
+  TestApplication application;
+
+  TransformManager serial;
+  TransformManager parallel;
+  std::vector< TransformId > serialIds;
+  std::vector< TransformId > parallelIds;
+  BuildScene( serial, serialIds, 20u, 600u, 50u );
+  BuildScene( parallel, parallelIds, 20u, 600u, 50u );
+  DALI_TEST_CHECK( serialIds == parallelIds );
+
+  ThreadPool threadPool;
+  threadPool.Initialize( 3u );
+  parallel.SetThreadPool( &threadPool );
+
+  serial.Update();
+  parallel.Update();
+  DALI_TEST_CHECK( WorldTransformsMatch( serial, parallel, serialIds ) );
+
+  // Change a few components and make sure the dirty propagation matches too
+  unsigned int serialSeed = 42u;
+  unsigned int parallelSeed = 42u;
+  for( unsigned int i = 1u; i < serialIds.size(); i += 97u )
+  {
+    SetRandomTransform( serial, serialIds[i], serialSeed );
+    SetRandomTransform( parallel, parallelIds[i], parallelSeed );
+  }
+
+  serial.Update();
+  parallel.Update();
+  DALI_TEST_CHECK( WorldTransformsMatch( serial, parallel, serialIds ) );
+
+  // Components added after the last reorder have no parent yet
+  TransformId serialOrphan = serial.CreateTransform();
+  TransformId parallelOrphan = parallel.CreateTransform();
+  serialIds.push_back( serialOrphan );
+  SetRandomTransform( serial, serialOrphan, serialSeed );
+  SetRandomTransform( parallel, parallelOrphan, parallelSeed );
+
+  serial.Update();
+  parallel.Update();
+  DALI_TEST_CHECK( WorldTransformsMatch( serial, parallel, serialIds ) );
+
+  parallel.SetThreadPool( NULL );
+
+  END_TEST;
+}
+
+int UtcDaliTransformManagerBatchedUpdateP(void)
+{
+  TestApplication application;
+
+  // Children per parent is not a multiple of the batch size, so some batches are partly filled
+  TransformManager manager;
+  std::vector< TransformId > children;
+  std::vector< TransformId > parents;
+  unsigned int seed = 7u;
+
+  TransformId root = manager.CreateTransform();
+  SetRandomTransform( manager, root, seed );
+  for( unsigned int i = 0u; i < 10u; ++i )
+  {
+    TransformId child = manager.CreateTransform();
+    manager.SetParent( child, root );
+    SetRandomTransform( manager, child, seed );
+    children.push_back( child );
+    parents.push_back( root );
+
+    for( unsigned int j = 0u; j < 7u; ++j )
+    {
+      TransformId grandChild = manager.CreateTransform();
+      manager.SetParent( grandChild, child );
+      SetRandomTransform( manager, grandChild, seed );
+      if( j % 3u == 0u )
+      {
+        manager.SetQuaternionPropertyValue( grandChild, Quaternion::IDENTITY );
+      }
+      children.push_back( grandChild );
+      parents.push_back( child );
+    }
+  }
+
+  manager.Update();
+
+  // Compare against the public Matrix API, anchor point is CENTER and parent origin is TOP_LEFT
+  Matrix rootWorld( false );
+  rootWorld.SetTransformComponents( manager.GetVector3PropertyValue( root, Internal::SceneGraph::TRANSFORM_PROPERTY_SCALE ),
+                                    manager.GetQuaternionPropertyValue( root ),
+                                    manager.GetVector3PropertyValue( root, Internal::SceneGraph::TRANSFORM_PROPERTY_POSITION ) );
+  DALI_TEST_EQUALS( manager.GetWorldMatrix( root ), rootWorld, TEST_LOCATION );
+
+  for( unsigned int i = 0u; i < children.size(); ++i )
+  {
+    const TransformId id = children[i];
+    const Vector3& parentSize = manager.GetVector3PropertyValue( parents[i], Internal::SceneGraph::TRANSFORM_PROPERTY_SIZE );
+    const Vector3 localPosition = manager.GetVector3PropertyValue( id, Internal::SceneGraph::TRANSFORM_PROPERTY_POSITION ) +
+                                  ( ParentOrigin::TOP_LEFT - ParentOrigin::CENTER ) * parentSize;
+
+    Matrix local( false );
+    local.SetTransformComponents( manager.GetVector3PropertyValue( id, Internal::SceneGraph::TRANSFORM_PROPERTY_SCALE ),
+                                  manager.GetQuaternionPropertyValue( id ),
+                                  localPosition );
+    Matrix world( false );
+    Matrix::Multiply( world, local, manager.GetWorldMatrix( parents[i] ) );
+    DALI_TEST_EQUALS( manager.GetWorldMatrix( id ), world, TEST_LOCATION );
+
+    const float radius = manager.GetVector3PropertyValue( id, Internal::SceneGraph::TRANSFORM_PROPERTY_SIZE ).Length() * 0.5f * world.GetXAxis().Length();
+    const Vector4 boundingSphere( world.GetTranslation().x, world.GetTranslation().y, world.GetTranslation().z, radius );
+    DALI_TEST_EQUALS( manager.GetBoundingSphere( id ), boundingSphere, 0.001f, TEST_LOCATION );
+  }
+
+  END_TEST;
+}
+
+int UtcDaliTransformManagerParallelUpdateBenchmark(void)
+{
+  TestApplication application;
+
+  const unsigned int frames = IsBenchmarkEnabled() ? 20u : 2u;
+  const unsigned int workerCounts[] = { 1u, 3u, 7u };
+
+  TransformManager serial;
+  std::vector< TransformId > ids;
+  BuildScene( serial, ids, 100u, 200u, 500u );
+  serial.Update();
+
+  const double serialTime = TimeUpdates( serial, ids, frames );
+  tet_printf( "TransformManager::Update() %u components, serial: %.3f ms\n", static_cast<unsigned int>( ids.size() ), serialTime );
+
+  for( unsigned int i = 0u; i < sizeof( workerCounts ) / sizeof( workerCounts[0] ); ++i )
+  {
+    TransformManager parallel;
+    std::vector< TransformId > parallelIds;
+    BuildScene( parallel, parallelIds, 100u, 200u, 500u );
+
+    ThreadPool threadPool;
+    threadPool.Initialize( workerCounts[i] );
+    parallel.SetThreadPool( &threadPool );
+    parallel.Update();
+
+    const double parallelTime = TimeUpdates( parallel, parallelIds, frames );
+    tet_printf( "TransformManager::Update() %u components, %u workers: %.3f ms\n", static_cast<unsigned int>( parallelIds.size() ), workerCounts[i], parallelTime );
+
+    DALI_TEST_CHECK( WorldTransformsMatch( serial, parallel, ids ) );
+    parallel.SetThreadPool( NULL );
+  }
+
+  END_TEST;
+}
+
+int UtcDaliCoreSetUpdateWorkerThreadCountP(void)
+{
+  TestApplication application;
+
+  Actor parent = Actor::New();
+  parent.SetPosition( 10.0f, 20.0f );
+  Stage::GetCurrent().Add( parent );
+
+  std::vector< Actor > actors;
+  for( unsigned int i = 0u; i < 600u; ++i )
+  {
+    Actor actor = Actor::New();
+    actor.SetSize( 10.0f, 10.0f );
+    actor.SetPosition( static_cast<float>( i ), static_cast<float>( i * 2u ) );
+    parent.Add( actor );
+    actors.push_back( actor );
+  }
+
+  application.SendNotification();
+  application.Render();
+
+  std::vector< Matrix > serialMatrices;
+  for( unsigned int i = 0u; i < actors.size(); ++i )
+  {
+    serialMatrices.push_back( actors[i].GetCurrentWorldMatrix() );
+  }
+
+  application.GetCore().SetUpdateWorkerThreadCount( 3u );
+  parent.SetPosition( 10.0f, 20.0f, 0.0f );
+
+  application.SendNotification();
+  application.Render();
+
+  for( unsigned int i = 0u; i < actors.size(); ++i )
+  {
+    DALI_TEST_EQUALS( actors[i].GetCurrentWorldMatrix(), serialMatrices[i], TEST_LOCATION );
+  }
+
+  application.GetCore().SetUpdateWorkerThreadCount( 0u );
+  application.SendNotification();
+  application.Render();
+
+  END_TEST;
+}
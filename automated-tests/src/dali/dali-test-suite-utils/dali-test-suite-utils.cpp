@@ -20,6 +20,8 @@
 
 // EXTERNAL INCLUDES
 #include <ostream>
+#include <stdlib.h>
+#include <time.h>
 
 // INTERNAL INCLUDES
 #include <dali/public-api/dali-core.h>
@@ -353,6 +355,26 @@ void PrepareResourceImage( TestApplication& application, unsigned int imageWidth
   platform.SetSynchronouslyLoadedResource( resourcePtr );
 }
 
+void UseOpenGlEs3( TestApplication& application )
+{
+  static GLubyte version[] = "OpenGL ES 3.0";
+  application.GetGlAbstraction().SetGetStringResult( version );
+  application.GetCore().ContextDestroyed();
+  application.GetCore().ContextCreated();
+}
+
+bool IsBenchmarkEnabled()
+{
+  return getenv( "DALI_TEST_BENCHMARKS" ) != NULL;
+}
+
+double GetTimeMilliseconds()
+{
+  timespec time;
+  clock_gettime( CLOCK_MONOTONIC, &time );
+  return static_cast<double>( time.tv_sec ) * 1000.0 + static_cast<double>( time.tv_nsec ) / 1000000.0;
+}
+
 namespace Test
 {
 
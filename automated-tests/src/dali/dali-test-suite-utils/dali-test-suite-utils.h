@@ -351,6 +351,39 @@ BufferImage CreateBufferImage(int width, int height, const Vector4& color);
 // Prepare a resource image to be loaded. Should be called before creating the ResourceImage
 void PrepareResourceImage( TestApplication& application, unsigned int imageWidth, unsigned int imageHeight, Pixel::Format pixelFormat );
 
+// Recreate the GL context reporting OpenGL ES 3.0, for testing features which need it
+void UseOpenGlEs3( TestApplication& application );
+
+/**
+ * Whether benchmark test cases should run their full workload.
+ * Benchmarks are kept out of the default run; set the DALI_TEST_BENCHMARKS environment variable to run them.
+ * @return true if benchmarks are enabled
+ */
+bool IsBenchmarkEnabled();
+
+/**
+ * Get a monotonic time stamp, for timing benchmarks
+ * @return The time in milliseconds
+ */
+double GetTimeMilliseconds();
+
+/**
+ * Time repeated calls of an operation
+ * @param[in] operation A functor called with the number of the repetition, from zero
+ * @param[in] repetitions The number of times to call the operation
+ * @return The average time of a call in milliseconds
+ */
+template< typename Operation >
+double TimeRepeatedMilliseconds( Operation& operation, unsigned int repetitions )
+{
+  const double start = GetTimeMilliseconds();
+  for( unsigned int repetition = 0u; repetition < repetitions; ++repetition )
+  {
+    operation( repetition );
+  }
+  return ( GetTimeMilliseconds() - start ) / static_cast<double>( repetitions );
+}
+
 // Test namespace to prevent pollution of Dali namespace, add Test helper functions here
 namespace Test
 {
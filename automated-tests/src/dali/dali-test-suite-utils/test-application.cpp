@@ -204,6 +204,11 @@ bool TestApplication::GetRenderNeedsUpdate()
   return mRenderStatus.NeedsUpdate();
 }
 
+unsigned int TestApplication::GetRenderCompilingProgramCount()
+{
+  return mRenderStatus.GetCompilingProgramCount();
+}
+
 bool TestApplication::RenderOnly( )
 {
   // Update Time values
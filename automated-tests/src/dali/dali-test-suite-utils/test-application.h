@@ -82,6 +82,7 @@ public:
   bool RenderOnly( );
   void ResetContext();
   bool GetRenderNeedsUpdate();
+  unsigned int GetRenderCompilingProgramCount();
   unsigned int Wait( unsigned int durationToWait );
 
 private:
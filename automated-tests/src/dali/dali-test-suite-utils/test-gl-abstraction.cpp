@@ -32,7 +32,12 @@ void TestGlAbstraction::Initialize()
   mCurrentProgram = 0;
   mCompileStatus = GL_TRUE;
   mLinkStatus = GL_TRUE;
+  mCompletionStatus = GL_TRUE;
   mNumberOfActiveUniforms = 0;
+  mUniformBlockName.clear();
+  mUniformBlockSize = 0;
+  mUniformBlockMembers.clear();
+  mLastUniformBufferData.clear();
   mGetAttribLocationResult = 0;
   mGetErrorResult = 0;
   mGetStringResult = NULL;
@@ -67,6 +72,7 @@ void TestGlAbstraction::Initialize()
   mLastBlendFuncSrcAlpha  = 0;
   mLastBlendFuncDstAlpha  = 0;
   mLastAutoTextureIdUsed = 0;
+  mLastVertexArrayIdUsed = 0;
   mLastShaderIdUsed = 0;
   mLastProgramIdUsed = 0;
   mLastUniformIdUsed = 0;
@@ -87,6 +93,7 @@ void TestGlAbstraction::Initialize()
   mTextureTrace.Reset();
   mTexParamaterTrace.Reset();
   mDrawTrace.Reset();
+  mBufferTrace.Reset();
 
   for( unsigned int i=0; i<MAX_ATTRIBUTE_CACHE_SIZE; ++i )
   {
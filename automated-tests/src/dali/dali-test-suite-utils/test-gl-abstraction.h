@@ -88,6 +88,12 @@ public:
 
   inline void BindBuffer( GLenum target, GLuint buffer )
   {
+    std::stringstream out;
+    out << target << ", " << buffer;
+    TraceCallStack::NamedParams namedParams;
+    namedParams["target"] = ToString(target);
+    namedParams["buffer"] = ToString(buffer);
+    mBufferTrace.PushCall("BindBuffer", out.str(), namedParams);
   }
 
   inline void BindFramebuffer( GLenum target, GLuint framebuffer )
@@ -234,6 +240,11 @@ public:
   inline void BufferSubData(GLenum target, GLintptr offset, GLsizeiptr size, const void* data)
   {
      mBufferSubDataCalls.push_back(size);
+     if( target == GL_UNIFORM_BUFFER && data )
+     {
+       const unsigned char* bytes = static_cast< const unsigned char* >( data );
+       mLastUniformBufferData.assign( bytes, bytes + size );
+     }
   }
 
   inline GLenum CheckFramebufferStatus(GLenum target)
@@ -504,6 +515,12 @@ public:
   inline void DisableVertexAttribArray(GLuint index)
   {
     SetVertexAttribArray( index, false );
+
+    std::stringstream out;
+    out << index;
+    TraceCallStack::NamedParams namedParams;
+    namedParams["index"] = ToString(index);
+    mBufferTrace.PushCall("DisableVertexAttribArray", out.str(), namedParams);
   }
 
   inline void DrawArrays(GLenum mode, GLint first, GLsizei count)
@@ -542,6 +559,12 @@ public:
   inline void EnableVertexAttribArray(GLuint index)
   {
     SetVertexAttribArray( index, true);
+
+    std::stringstream out;
+    out << index;
+    TraceCallStack::NamedParams namedParams;
+    namedParams["index"] = ToString(index);
+    mBufferTrace.PushCall("EnableVertexAttribArray", out.str(), namedParams);
   }
 
   inline void Finish(void)
@@ -687,7 +710,16 @@ public:
         *size = 1;
         break;
       default:
+      {
+        const GLint member = static_cast< GLint >( index ) - mNumberOfActiveUniforms;
+        if( member >= 0 && member < static_cast< GLint >( mUniformBlockMembers.size() ) )
+        {
+          *length = snprintf(name, bufsize, "%s", mUniformBlockMembers[member].name.c_str());
+          *type = GL_FLOAT;
+          *size = 1;
+        }
         break;
+      }
     }
   }
 
@@ -758,6 +790,9 @@ public:
       case GL_LINK_STATUS:
         *params = mLinkStatus;
         break;
+      case GL_COMPLETION_STATUS_KHR:
+        *params = mCompletionStatus;
+        break;
       case GL_PROGRAM_BINARY_LENGTH_OES:
         *params = mProgramBinaryLength;
         break;
@@ -767,6 +802,9 @@ public:
       case GL_ACTIVE_UNIFORM_MAX_LENGTH:
         *params = 100;
         break;
+      case GL_ACTIVE_UNIFORM_BLOCKS:
+        *params = mUniformBlockMembers.empty() ? 0 : 1;
+        break;
     }
   }
 
@@ -826,6 +864,15 @@ public:
       return -1;
     }
 
+    for( std::vector< UniformBlockMember >::const_iterator iter = mUniformBlockMembers.begin(); iter != mUniformBlockMembers.end(); ++iter )
+    {
+      if( iter->name == name || mUniformBlockName + "." + iter->name == name )
+      {
+        // Uniforms in a block do not have a location
+        return -1;
+      }
+    }
+
     UniformIDMap& uniformIDs = it->second;
     UniformIDMap::iterator it2 = uniformIDs.find( name );
     if( it2 == uniformIDs.end() )
@@ -1408,6 +1455,12 @@ public:
 
   inline void VertexAttribPointer(GLuint indx, GLint size, GLenum type, GLboolean normalized, GLsizei stride, const void* ptr)
   {
+    std::stringstream out;
+    out << indx << ", " << size << ", " << type << ", " << stride;
+    TraceCallStack::NamedParams namedParams;
+    namedParams["index"] = ToString(indx);
+    namedParams["size"] = ToString(size);
+    mBufferTrace.PushCall("VertexAttribPointer", out.str(), namedParams);
   }
 
   inline void Viewport(GLint x, GLint y, GLsizei width, GLsizei height)
@@ -1533,19 +1586,42 @@ public:
 
   inline void BindVertexArray(GLuint array)
   {
+    std::stringstream out;
+    out << array;
+    TraceCallStack::NamedParams namedParams;
+    namedParams["array"] = ToString(array);
+    mBufferTrace.PushCall("BindVertexArray", out.str(), namedParams);
   }
 
   inline void DeleteVertexArrays(GLsizei n, const GLuint* arrays)
   {
+    for( GLsizei i = 0; i < n; ++i )
+    {
+      std::stringstream out;
+      out << arrays[i];
+      TraceCallStack::NamedParams namedParams;
+      namedParams["array"] = ToString(arrays[i]);
+      mBufferTrace.PushCall("DeleteVertexArrays", out.str(), namedParams);
+    }
   }
 
   inline void GenVertexArrays(GLsizei n, GLuint* arrays)
   {
+    for( GLsizei i = 0; i < n; ++i )
+    {
+      arrays[i] = ++mLastVertexArrayIdUsed;
+
+      std::stringstream out;
+      out << arrays[i];
+      TraceCallStack::NamedParams namedParams;
+      namedParams["array"] = ToString(arrays[i]);
+      mBufferTrace.PushCall("GenVertexArrays", out.str(), namedParams);
+    }
   }
 
   inline GLboolean IsVertexArray(GLuint array)
   {
-    return false;
+    return array != 0 && array <= mLastVertexArrayIdUsed;
   }
 
   inline void GetIntegeri_v(GLenum target, GLuint index, GLint* data)
@@ -1562,6 +1638,17 @@ public:
 
   inline void BindBufferRange(GLenum target, GLuint index, GLuint buffer, GLintptr offset, GLsizeiptr size)
   {
+    std::stringstream out;
+    out << target << ", " << index << ", " << buffer << ", " << offset << ", " << size;
+
+    TraceCallStack::NamedParams namedParams;
+    namedParams["target"] = ToString(target);
+    namedParams["index"] = ToString(index);
+    namedParams["buffer"] = ToString(buffer);
+    namedParams["offset"] = ToString(offset);
+    namedParams["size"] = ToString(size);
+
+    mBufferTrace.PushCall("BindBufferRange", out.str(), namedParams);
   }
 
   inline void BindBufferBase(GLenum target, GLuint index, GLuint buffer)
@@ -1676,6 +1763,22 @@ public:
 
   inline void GetActiveUniformsiv(GLuint program, GLsizei uniformCount, const GLuint* uniformIndices, GLenum pname, GLint* params)
   {
+    for( GLsizei i = 0; i < uniformCount; ++i )
+    {
+      const GLint member = static_cast< GLint >( uniformIndices[i] ) - mNumberOfActiveUniforms;
+      if( member >= 0 && member < static_cast< GLint >( mUniformBlockMembers.size() ) )
+      {
+        switch( pname )
+        {
+          case GL_UNIFORM_OFFSET:
+            params[i] = mUniformBlockMembers[member].offset;
+            break;
+          case GL_UNIFORM_MATRIX_STRIDE:
+            params[i] = mUniformBlockMembers[member].matrixStride;
+            break;
+        }
+      }
+    }
   }
 
   inline GLuint GetUniformBlockIndex(GLuint program, const GLchar* uniformBlockName)
@@ -1685,22 +1788,59 @@ public:
 
   inline void GetActiveUniformBlockiv(GLuint program, GLuint uniformBlockIndex, GLenum pname, GLint* params)
   {
+    switch( pname )
+    {
+      case GL_UNIFORM_BLOCK_DATA_SIZE:
+        *params = mUniformBlockSize;
+        break;
+      case GL_UNIFORM_BLOCK_ACTIVE_UNIFORMS:
+        *params = mUniformBlockMembers.size();
+        break;
+      case GL_UNIFORM_BLOCK_ACTIVE_UNIFORM_INDICES:
+        for( size_t i = 0; i < mUniformBlockMembers.size(); ++i )
+        {
+          params[i] = mNumberOfActiveUniforms + i;
+        }
+        break;
+    }
   }
 
   inline void GetActiveUniformBlockName(GLuint program, GLuint uniformBlockIndex, GLsizei bufSize, GLsizei* length, GLchar* uniformBlockName)
   {
+    *length = snprintf(uniformBlockName, bufSize, "%s", mUniformBlockName.c_str());
   }
 
   inline void UniformBlockBinding(GLuint program, GLuint uniformBlockIndex, GLuint uniformBlockBinding)
   {
+    std::stringstream out;
+    out << program << ", " << uniformBlockIndex << ", " << uniformBlockBinding;
+    mBufferTrace.PushCall("UniformBlockBinding", out.str());
   }
 
   inline void DrawArraysInstanced(GLenum mode, GLint first, GLsizei count, GLsizei instanceCount)
   {
+    std::stringstream out;
+    out << mode << ", " << first << ", " << count << ", " << instanceCount;
+
+    TraceCallStack::NamedParams namedParams;
+    namedParams["mode"] = ToString(mode);
+    namedParams["first"] = ToString(first);
+    namedParams["count"] = ToString(count);
+    namedParams["instanceCount"] = ToString(instanceCount);
+    mDrawTrace.PushCall("DrawArraysInstanced", out.str(), namedParams);
   }
 
   inline void DrawElementsInstanced(GLenum mode, GLsizei count, GLenum type, const GLvoid* indices, GLsizei instanceCount)
   {
+    std::stringstream out;
+    out << mode << ", " << count << ", " << type << ", indices, " << instanceCount;
+
+    TraceCallStack::NamedParams namedParams;
+    namedParams["mode"] = ToString(mode);
+    namedParams["count"] = ToString(count);
+    namedParams["type"] = ToString(type);
+    namedParams["instanceCount"] = ToString(instanceCount);
+    mDrawTrace.PushCall("DrawElementsInstanced", out.str(), namedParams);
   }
 
   inline GLsync FenceSync(GLenum condition, GLbitfield flags)
@@ -1785,6 +1925,9 @@ public:
 
   inline void VertexAttribDivisor(GLuint index, GLuint divisor)
   {
+    std::stringstream out;
+    out << index << ", " << divisor;
+    mBufferTrace.PushCall("VertexAttribDivisor", out.str());
   }
 
   inline void BindTransformFeedback(GLenum target, GLuint id)
@@ -1873,6 +2016,7 @@ private:
 public: // TEST FUNCTIONS
   inline void SetCompileStatus( GLuint value ) { mCompileStatus = value; }
   inline void SetLinkStatus( GLuint value ) { mLinkStatus = value; }
+  inline void SetCompletionStatus( GLuint value ) { mCompletionStatus = value; }
   inline void SetGetAttribLocationResult(  int result) { mGetAttribLocationResult = result; }
   inline void SetGetErrorResult(  GLenum result) { mGetErrorResult = result; }
   inline void SetGetStringResult(  GLubyte* result) { mGetStringResult = result; }
@@ -1925,6 +2069,11 @@ public: // TEST FUNCTIONS
   inline void ResetTexParameterCallStack() { mTexParamaterTrace.Reset(); }
   inline TraceCallStack& GetTexParameterTrace() { return mTexParamaterTrace; }
 
+  //Methods for buffer binding and vertex attribute verification
+  inline void EnableBufferCallTrace(bool enable) { mBufferTrace.Enable(enable); }
+  inline void ResetBufferCallStack() { mBufferTrace.Reset(); }
+  inline TraceCallStack& GetBufferTrace() { return mBufferTrace; }
+
   //Methods for Draw verification
   inline void EnableDrawCallTrace(bool enable) { mDrawTrace.Enable(enable); }
   inline void ResetDrawCallStack() { mDrawTrace.Reset(); }
@@ -2111,12 +2260,32 @@ public: // TEST FUNCTIONS
   inline const BufferSubDataCalls& GetBufferSubDataCalls() const { return mBufferSubDataCalls; }
   inline void ResetBufferSubDataCalls() { mBufferSubDataCalls.clear(); }
 
+  // Uniform block reported by the next linked programs
+  inline void SetUniformBlock( const std::string& name, GLint size ) { mUniformBlockName = name; mUniformBlockSize = size; }
+  inline void AddUniformBlockMember( const std::string& name, GLint offset, GLint matrixStride = 0 )
+  {
+    UniformBlockMember member = { name, offset, matrixStride };
+    mUniformBlockMembers.push_back( member );
+  }
+  inline const std::vector<unsigned char>& GetLastUniformBufferData() const { return mLastUniformBufferData; }
+
 private:
   GLuint     mCurrentProgram;
   GLuint     mCompileStatus;
   BufferDataCalls mBufferDataCalls;
   BufferSubDataCalls mBufferSubDataCalls;
+  struct UniformBlockMember
+  {
+    std::string name;
+    GLint offset;
+    GLint matrixStride;
+  };
+  std::string mUniformBlockName;
+  GLint      mUniformBlockSize;
+  std::vector<UniformBlockMember> mUniformBlockMembers;
+  std::vector<unsigned char> mLastUniformBufferData;
   GLuint     mLinkStatus;
+  GLuint     mCompletionStatus;
   GLint      mNumberOfActiveUniforms;
   GLint      mGetAttribLocationResult;
   GLenum     mGetErrorResult;
@@ -2178,6 +2347,8 @@ private:
   TraceCallStack mDepthFunctionTrace;
   TraceCallStack mStencilFunctionTrace;
   TraceCallStack mSetUniformTrace;
+  TraceCallStack mBufferTrace;
+  GLuint mLastVertexArrayIdUsed;
 
   // Shaders & Uniforms
   GLuint mLastShaderIdUsed;
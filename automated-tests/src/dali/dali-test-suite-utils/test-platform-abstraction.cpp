@@ -23,13 +23,18 @@ namespace Dali
 {
 
 TestPlatformAbstraction::TestPlatformAbstraction()
-: mTrace(),
+: mLoadWait(),
+  mBlockedWait(),
+  mTrace(),
   mIsLoadingResult( false ),
   mSize(),
   mClosestSize(),
   mLoadFileResult(),
   mSaveFileResult( false ),
-  mSynchronouslyLoadedResource()
+  mSynchronouslyLoadedResource(),
+  mDecodedBitmap(),
+  mLoadCallCount( 0u ),
+  mLoadingBlocked( false )
 {
   Initialize();
 }
@@ -44,6 +49,7 @@ ImageDimensions TestPlatformAbstraction::GetClosestImageSize( const std::string&
                                                               SamplingMode::Type samplingMode,
                                                               bool orientationCorrection )
 {
+  ConditionalWait::ScopedLock lock( mLoadWait );
   ImageDimensions closestSize = ImageDimensions( mClosestSize.x, mClosestSize.y );
   mTrace.PushCall("GetClosestImageSize", "");
   return closestSize;
@@ -55,6 +61,7 @@ ImageDimensions TestPlatformAbstraction::GetClosestImageSize( Integration::Resou
                                                    SamplingMode::Type samplingMode,
                                                    bool orientationCorrection )
 {
+  ConditionalWait::ScopedLock lock( mLoadWait );
   ImageDimensions closestSize = ImageDimensions( mClosestSize.x, mClosestSize.y );
   mTrace.PushCall("GetClosestImageSize", "");
   return closestSize;
@@ -62,18 +69,37 @@ ImageDimensions TestPlatformAbstraction::GetClosestImageSize( Integration::Resou
 
 Integration::ResourcePointer TestPlatformAbstraction::LoadResourceSynchronously( const Integration::ResourceType& resourceType, const std::string& resourcePath )
 {
-  mTrace.PushCall("LoadResourceSynchronously", "");
+  // Called by the image decode workers
+  {
+    ConditionalWait::ScopedLock lock( mLoadWait );
+    mTrace.PushCall( "LoadResourceSynchronously", resourcePath );
+    ++mLoadCallCount;
+    mLoadWait.Notify( lock );
+  }
+  WaitWhileLoadingBlocked();
+
+  ConditionalWait::ScopedLock lock( mLoadWait );
   return mSynchronouslyLoadedResource;
 }
 
 Integration::BitmapPtr TestPlatformAbstraction::DecodeBuffer( const Integration::ResourceType& resourceType, uint8_t * buffer, size_t size )
 {
-  mTrace.PushCall("DecodeBuffer", "");
+  // Called by the image decode workers
+  {
+    ConditionalWait::ScopedLock lock( mLoadWait );
+    mTrace.PushCall( "DecodeBuffer", "" );
+    ++mLoadCallCount;
+    mLoadWait.Notify( lock );
+  }
+  WaitWhileLoadingBlocked();
+
+  ConditionalWait::ScopedLock lock( mLoadWait );
   return mDecodedBitmap;
 }
 
 bool TestPlatformAbstraction::LoadShaderBinaryFile( const std::string& filename, Dali::Vector< unsigned char >& buffer ) const
 {
+  ConditionalWait::ScopedLock lock( mLoadWait );
   mTrace.PushCall("LoadShaderBinaryFile", "");
   if( mLoadFileResult.loadResult )
   {
@@ -87,15 +113,23 @@ bool TestPlatformAbstraction::LoadShaderBinaryFile( const std::string& filename,
 /** Call this every test */
 void TestPlatformAbstraction::Initialize()
 {
+  {
+    ConditionalWait::ScopedLock lock( mBlockedWait );
+    mLoadingBlocked = false;
+  }
+
+  ConditionalWait::ScopedLock lock( mLoadWait );
   mTrace.Reset();
   mTrace.Enable(true);
   mIsLoadingResult=false;
   mSynchronouslyLoadedResource.Reset();
   mDecodedBitmap.Reset();
+  mLoadCallCount = 0u;
 }
 
 bool TestPlatformAbstraction::WasCalled(TestFuncEnum func)
 {
+  ConditionalWait::ScopedLock lock( mLoadWait );
   switch(func)
   {
     case LoadResourceSynchronouslyFunc:       return mTrace.FindMethod("LoadResourceSynchronously");
@@ -112,12 +146,14 @@ void TestPlatformAbstraction::SetIsLoadingResult(bool result)
 
 void TestPlatformAbstraction::ClearReadyResources()
 {
+  ConditionalWait::ScopedLock lock( mLoadWait );
   mSynchronouslyLoadedResource.Reset();
   mDecodedBitmap.Reset();
 }
 
 void TestPlatformAbstraction::SetClosestImageSize(const Vector2& size)
 {
+  ConditionalWait::ScopedLock lock( mLoadWait );
   mClosestSize = size;
 }
 
@@ -137,12 +173,40 @@ void TestPlatformAbstraction::SetSaveFileResult( bool result )
 
 void TestPlatformAbstraction::SetSynchronouslyLoadedResource( Integration::ResourcePointer resource )
 {
+  ConditionalWait::ScopedLock lock( mLoadWait );
   mSynchronouslyLoadedResource = resource;
 }
 
 void TestPlatformAbstraction::SetDecodedBitmap( Integration::BitmapPtr bitmap )
 {
+  ConditionalWait::ScopedLock lock( mLoadWait );
   mDecodedBitmap = bitmap;
 }
 
+void TestPlatformAbstraction::SetLoadingBlocked( bool blocked )
+{
+  ConditionalWait::ScopedLock lock( mBlockedWait );
+  mLoadingBlocked = blocked;
+  mBlockedWait.Notify( lock );
+}
+
+void TestPlatformAbstraction::WaitForLoadCalls( unsigned int count )
+{
+  ConditionalWait::ScopedLock lock( mLoadWait );
+  while( mLoadCallCount < count )
+  {
+    mLoadWait.Wait( lock );
+  }
+}
+
+void TestPlatformAbstraction::WaitWhileLoadingBlocked()
+{
+  // The workers wait on their own ConditionalWait, as a waiting worker would stop WaitForLoadCalls() being woken
+  ConditionalWait::ScopedLock lock( mBlockedWait );
+  while( mLoadingBlocked )
+  {
+    mBlockedWait.Wait( lock );
+  }
+}
+
 } // namespace Dali
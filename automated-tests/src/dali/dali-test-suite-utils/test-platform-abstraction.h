@@ -25,6 +25,7 @@
 #include <vector>
 
 // INTERNAL INCLUDES
+#include <dali/devel-api/threading/conditional-wait.h>
 #include <dali/integration-api/platform-abstraction.h>
 
 #include "test-trace-call-stack.h"
@@ -104,6 +105,12 @@ public: // TEST FUNCTIONS
 
   inline void EnableTrace(bool enable) { mTrace.Enable(enable); }
   inline void ResetTrace() { mTrace.Reset(); }
+
+  /**
+   * @brief Gets the trace of the calls.
+   * Image decode workers add to the trace, so they must have been stopped before it is read.
+   * @return The trace
+   */
   inline TraceCallStack& GetTrace() { return mTrace; }
 
   /**
@@ -155,8 +162,27 @@ public: // TEST FUNCTIONS
    */
   void SetDecodedBitmap( Integration::BitmapPtr bitmap );
 
+  /**
+   * @brief Sets whether LoadResourceSynchronously() and DecodeBuffer() wait until loading is unblocked.
+   * This lets a test queue several images before a decode worker starts on any of them.
+   * @param[in] blocked Whether loading is blocked
+   */
+  void SetLoadingBlocked( bool blocked );
+
+  /**
+   * @brief Waits until LoadResourceSynchronously() and DecodeBuffer() have been called,
+   * by any thread, a number of times in total since Initialize().
+   * @param[in] count The number of calls to wait for
+   */
+  void WaitForLoadCalls( unsigned int count );
+
 private:
 
+  /**
+   * @brief Called by the decode workers to wait until loading is unblocked.
+   */
+  void WaitWhileLoadingBlocked();
+
   TestPlatformAbstraction( const TestPlatformAbstraction& ); ///< Undefined
   TestPlatformAbstraction& operator=( const TestPlatformAbstraction& ); ///< Undefined
 
@@ -174,6 +200,8 @@ private:
     Dali::Vector< unsigned char> buffer;
   };
 
+  mutable ConditionalWait       mLoadWait;          ///< Guards the members used by the decode workers, and wakes WaitForLoadCalls()
+  ConditionalWait               mBlockedWait;       ///< Guards mLoadingBlocked, and wakes the blocked decode workers
   mutable TraceCallStack        mTrace;
   bool                          mIsLoadingResult;
   Vector2                       mSize;
@@ -184,6 +212,8 @@ private:
 
   Integration::ResourcePointer  mSynchronouslyLoadedResource;
   Integration::BitmapPtr        mDecodedBitmap;
+  unsigned int                  mLoadCallCount;     ///< Calls to LoadResourceSynchronously() and DecodeBuffer()
+  bool                          mLoadingBlocked;    ///< Whether the decode workers wait before loading, guarded by mBlockedWait
 };
 
 } // Dali
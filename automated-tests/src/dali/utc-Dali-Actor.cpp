@@ -5695,3 +5695,197 @@ int utcDaliActorPositionUsesAnchorPointOnlyInheritPosition(void)
   END_TEST;
 }
 
+
+int UtcDaliActorWorldColorInCleanSubtree(void)
+{
+  tet_infoline( "Check that changes deep inside a subtree which has been clean for several frames are updated" );
+  TestApplication application;
+
+  Actor parent = Actor::New();
+  Actor child = Actor::New();
+  Actor grandChild = Actor::New();
+  Actor sibling = Actor::New();
+  Stage::GetCurrent().Add( parent );
+  parent.Add( child );
+  parent.Add( sibling );
+  child.Add( grandChild );
+
+  // Let the subtree become clean
+  for( int i = 0; i < 4; ++i )
+  {
+    application.SendNotification();
+    application.Render();
+  }
+  DALI_TEST_EQUALS( grandChild.GetCurrentWorldColor(), Color::WHITE, TEST_LOCATION );
+
+  tet_infoline( "Change the color of a leaf, both buffers should be updated" );
+  grandChild.SetColor( Color::RED );
+  for( int i = 0; i < 4; ++i )
+  {
+    application.SendNotification();
+    application.Render();
+    DALI_TEST_EQUALS( grandChild.GetCurrentWorldColor(), Color::RED, TEST_LOCATION );
+    DALI_TEST_EQUALS( sibling.GetCurrentWorldColor(), Color::WHITE, TEST_LOCATION );
+  }
+
+  tet_infoline( "Change the opacity of the root of the subtree, the clean descendants should inherit it" );
+  parent.SetOpacity( 0.5f );
+  for( int i = 0; i < 4; ++i )
+  {
+    application.SendNotification();
+    application.Render();
+    DALI_TEST_EQUALS( grandChild.GetCurrentWorldColor(), Vector4( 1.0f, 0.0f, 0.0f, 0.5f ), TEST_LOCATION );
+    DALI_TEST_EQUALS( sibling.GetCurrentWorldColor(), Vector4( 1.0f, 1.0f, 1.0f, 0.5f ), TEST_LOCATION );
+  }
+
+  tet_infoline( "Change a leaf whilst its parent is hidden, the change should be applied when it is shown" );
+  child.SetVisible( false );
+  application.SendNotification();
+  application.Render();
+  grandChild.SetColor( Color::BLUE );
+  for( int i = 0; i < 4; ++i )
+  {
+    application.SendNotification();
+    application.Render();
+  }
+  child.SetVisible( true );
+  for( int i = 0; i < 4; ++i )
+  {
+    application.SendNotification();
+    application.Render();
+    DALI_TEST_EQUALS( grandChild.GetCurrentWorldColor(), Vector4( 0.0f, 0.0f, 1.0f, 0.5f ), TEST_LOCATION );
+  }
+
+  END_TEST;
+}
+
+int UtcDaliActorConstraintInCleanSubtree(void)
+{
+  tet_infoline( "Check that constraints and animations deep inside a clean subtree are applied every frame" );
+  TestApplication application;
+
+  Actor parent = Actor::New();
+  Actor child = Actor::New();
+  Stage::GetCurrent().Add( parent );
+  parent.Add( child );
+
+  for( int i = 0; i < 4; ++i )
+  {
+    application.SendNotification();
+    application.Render();
+  }
+
+  Constraint constraint = Constraint::New<Vector4>( child, Actor::Property::COLOR, TestConstraint() );
+  constraint.Apply();
+  gTestConstraintCalled = false;
+  application.SendNotification();
+  application.Render();
+  DALI_TEST_CHECK( gTestConstraintCalled );
+
+  for( int i = 0; i < 4; ++i )
+  {
+    application.SendNotification();
+    application.Render();
+  }
+
+  // The constraint is applied whenever the scene is updated, even when only another actor has changed
+  Actor other = Actor::New();
+  Stage::GetCurrent().Add( other );
+  for( int i = 0; i < 4; ++i )
+  {
+    application.SendNotification();
+    application.Render();
+  }
+  gTestConstraintCalled = false;
+  other.SetColor( Color::RED );
+  application.SendNotification();
+  application.Render();
+  DALI_TEST_CHECK( gTestConstraintCalled );
+  constraint.Remove();
+
+  for( int i = 0; i < 4; ++i )
+  {
+    application.SendNotification();
+    application.Render();
+  }
+
+  Animation animation = Animation::New( 1.0f );
+  animation.AnimateTo( Property( child, Actor::Property::COLOR_ALPHA ), 0.0f, AlphaFunction::LINEAR );
+  animation.Play();
+  application.SendNotification();
+  application.Render( 500 );
+  DALI_TEST_EQUALS( child.GetCurrentWorldColor().a, 0.5f, Math::MACHINE_EPSILON_10, TEST_LOCATION );
+  application.Render( 250 );
+  DALI_TEST_EQUALS( child.GetCurrentWorldColor().a, 0.25f, Math::MACHINE_EPSILON_10, TEST_LOCATION );
+  application.Render( 250 );
+  application.SendNotification();
+  application.Render();
+  DALI_TEST_EQUALS( child.GetCurrentWorldColor().a, 0.0f, Math::MACHINE_EPSILON_10, TEST_LOCATION );
+
+  END_TEST;
+}
+
+int UtcDaliActorWorldColorParallelUpdate(void)
+{
+  tet_infoline( "Check that the world colors are the same when sibling subtrees are updated on worker threads" );
+  TestApplication application;
+  application.GetCore().SetUpdateWorkerThreadCount( 3u );
+
+  Actor parent = Actor::New();
+  Stage::GetCurrent().Add( parent );
+
+  std::vector< Actor > leaves;
+  for( unsigned int i = 0u; i < 4u; ++i )
+  {
+    Actor group = ( i == 0u ) ? Layer::New() : Actor::New();
+    group.SetOpacity( 0.5f + 0.1f * static_cast<float>( i ) );
+    parent.Add( group );
+
+    for( unsigned int j = 0u; j < 200u; ++j )
+    {
+      Actor leaf = Actor::New();
+      leaf.SetColor( Vector4( static_cast<float>( j ) / 200.0f, 0.5f, 0.25f, 1.0f ) );
+      group.Add( leaf );
+      leaves.push_back( leaf );
+    }
+  }
+
+  application.SendNotification();
+  application.Render();
+
+  for( unsigned int i = 0u; i < leaves.size(); ++i )
+  {
+    const float alpha = 0.5f + 0.1f * static_cast<float>( i / 200u );
+    DALI_TEST_EQUALS( leaves[i].GetCurrentWorldColor(), Vector4( static_cast<float>( i % 200u ) / 200.0f, 0.5f, 0.25f, alpha ), TEST_LOCATION );
+  }
+
+  tet_infoline( "Change the opacity of the parent, the subtrees inherit it" );
+  parent.SetOpacity( 0.5f );
+  for( unsigned int frame = 0u; frame < 2u; ++frame )
+  {
+    application.SendNotification();
+    application.Render();
+
+    for( unsigned int i = 0u; i < leaves.size(); ++i )
+    {
+      const float alpha = 0.5f * ( 0.5f + 0.1f * static_cast<float>( i / 200u ) );
+      DALI_TEST_EQUALS( leaves[i].GetCurrentWorldColor().a, alpha, Math::MACHINE_EPSILON_10, TEST_LOCATION );
+    }
+  }
+
+  tet_infoline( "Constrain a leaf, the subtrees are then updated in order" );
+  Constraint constraint = Constraint::New<Vector4>( leaves[250], Actor::Property::COLOR, TestConstraint() );
+  constraint.Apply();
+  gTestConstraintCalled = false;
+  parent.SetOpacity( 1.0f );
+  application.SendNotification();
+  application.Render();
+  DALI_TEST_CHECK( gTestConstraintCalled );
+  DALI_TEST_EQUALS( leaves[799].GetCurrentWorldColor().a, 0.8f, Math::MACHINE_EPSILON_10, TEST_LOCATION );
+
+  application.GetCore().SetUpdateWorkerThreadCount( 0u );
+  application.SendNotification();
+  application.Render();
+
+  END_TEST;
+}
@@ -908,3 +908,27 @@ int UtcDaliEncodedBufferImageNewN2(void)
   }
   END_TEST;
 }
+
+int UtcDaliEncodedBufferImageNewAsynchronouslyP(void)
+{
+  TestApplication application;
+  application.GetCore().SetImageDecodeThreadCount( 1u );
+
+  tet_infoline( "UtcDaliEncodedBufferImageNewAsynchronouslyP - the buffer is decoded by a worker" );
+
+  PrepareDecodeBuffer( application, 16u, 16u, Pixel::RGBA8888 );
+  EncodedBufferImage image = EncodedBufferImage::New( sEncodedBufferImageDataPNG, sEncodedBufferImageDataPNGLength, ImageDimensions(), FittingMode::DEFAULT, SamplingMode::DEFAULT );
+  DALI_TEST_CHECK( image );
+
+  // The size is not known until the buffer has been decoded
+  DALI_TEST_EQUALS( image.GetWidth(), 0u, TEST_LOCATION );
+
+  // Stopping the worker makes it finish decoding the buffer first
+  application.GetPlatform().WaitForLoadCalls( 1u );
+  application.GetCore().SetImageDecodeThreadCount( 0u );
+  application.SendNotification();
+
+  DALI_TEST_EQUALS( image.GetWidth(), 16u, TEST_LOCATION );
+  DALI_TEST_EQUALS( image.GetHeight(), 16u, TEST_LOCATION );
+  END_TEST;
+}
@@ -16,6 +16,7 @@
  */
 
 #include <dali/public-api/dali-core.h>
+#include <dali/devel-api/rendering/geometry-devel.h>
 #include <dali-test-suite-utils.h>
 
 using namespace Dali;
@@ -56,6 +57,46 @@ PropertyBuffer CreateVertexBuffer( const std::string& aPosition, const std::stri
   return vertexData;
 }
 
+/**
+ * Adds an actor drawing a quad with the given 32 bit indices
+ */
+Geometry AddActorWithIndices( const uint32_t* indices, size_t count )
+{
+  PropertyBuffer vertexBuffer = CreateVertexBuffer( "aPosition", "aTexCoord" );
+  Geometry geometry = Geometry::New();
+  geometry.AddVertexBuffer( vertexBuffer );
+  DevelGeometry::SetIndexBuffer( geometry, indices, count );
+
+  Shader shader = CreateShader();
+  Renderer renderer = Renderer::New( geometry, shader );
+  Actor actor = Actor::New();
+  actor.SetSize( Vector3::ONE * 100.f );
+  actor.AddRenderer( renderer );
+  Stage::GetCurrent().Add( actor );
+
+  return geometry;
+}
+
+Geometry CreateQuadsForVertexArrayTest( unsigned int count )
+{
+  PropertyBuffer vertexBuffer = CreateVertexBuffer( "aPosition", "aTexCoord" );
+  Geometry geometry = Geometry::New();
+  geometry.AddVertexBuffer( vertexBuffer );
+  unsigned short indices[] = { 0, 3, 1, 0, 2, 3 };
+  geometry.SetIndexBuffer( indices, sizeof( indices ) / sizeof( indices[0] ) );
+
+  Shader shader = CreateShader();
+  for( unsigned int i = 0; i < count; ++i )
+  {
+    Renderer renderer = Renderer::New( geometry, shader );
+    Actor actor = Actor::New();
+    actor.SetSize( Vector3::ONE * 100.f );
+    actor.AddRenderer( renderer );
+    Stage::GetCurrent().Add( actor );
+  }
+
+  return geometry;
+}
 
 }
 
@@ -549,3 +590,334 @@ int UtcDaliGeometrySetGetGeometryType02(void)
 
   END_TEST;
 }
+
+int UtcDaliGeometryVertexArrayObjectNotSupported(void)
+{
+  TestApplication application;
+  tet_infoline( "Test that the attributes are set up for every draw without vertex array objects" );
+
+  CreateQuadsForVertexArrayTest( 10u );
+
+  TestGlAbstraction& glAbstraction = application.GetGlAbstraction();
+  TraceCallStack& bufferTrace = glAbstraction.GetBufferTrace();
+  bufferTrace.Enable( true );
+
+  application.SendNotification();
+  application.Render( 0 );
+
+  bufferTrace.Reset();
+  application.SendNotification();
+  application.Render( 0 );
+
+  DALI_TEST_EQUALS( bufferTrace.CountMethod( "GenVertexArrays" ), 0, TEST_LOCATION );
+  DALI_TEST_EQUALS( bufferTrace.CountMethod( "BindVertexArray" ), 0, TEST_LOCATION );
+  DALI_TEST_EQUALS( bufferTrace.CountMethod( "VertexAttribPointer" ), 20, TEST_LOCATION );
+
+  END_TEST;
+}
+
+int UtcDaliGeometryVertexArrayObject(void)
+{
+  TestApplication application;
+  tet_infoline( "Test that a vertex array object replaces the attribute setup of each draw" );
+
+  UseOpenGlEs3( application );
+  CreateQuadsForVertexArrayTest( 10u );
+
+  TestGlAbstraction& glAbstraction = application.GetGlAbstraction();
+  TraceCallStack& bufferTrace = glAbstraction.GetBufferTrace();
+  TraceCallStack& drawTrace = glAbstraction.GetDrawTrace();
+  bufferTrace.Enable( true );
+  drawTrace.Enable( true );
+
+  // The first frame sets up one vertex array object shared by the renderers
+  application.SendNotification();
+  application.Render( 0 );
+
+  DALI_TEST_EQUALS( bufferTrace.CountMethod( "GenVertexArrays" ), 1, TEST_LOCATION );
+  DALI_TEST_EQUALS( bufferTrace.CountMethod( "VertexAttribPointer" ), 2, TEST_LOCATION );
+  DALI_TEST_EQUALS( drawTrace.CountMethod( "DrawElements" ), 10, TEST_LOCATION );
+
+  // The following frames only draw
+  bufferTrace.Reset();
+  drawTrace.Reset();
+  application.SendNotification();
+  application.Render( 0 );
+
+  DALI_TEST_EQUALS( bufferTrace.CountMethod( "GenVertexArrays" ), 0, TEST_LOCATION );
+  DALI_TEST_CHECK( bufferTrace.CountMethod( "BindVertexArray" ) <= 1 );
+  DALI_TEST_EQUALS( bufferTrace.CountMethod( "BindBuffer" ), 0, TEST_LOCATION );
+  DALI_TEST_EQUALS( bufferTrace.CountMethod( "VertexAttribPointer" ), 0, TEST_LOCATION );
+  DALI_TEST_EQUALS( bufferTrace.CountMethod( "EnableVertexAttribArray" ), 0, TEST_LOCATION );
+  DALI_TEST_EQUALS( bufferTrace.CountMethod( "DisableVertexAttribArray" ), 0, TEST_LOCATION );
+  DALI_TEST_EQUALS( drawTrace.CountMethod( "DrawElements" ), 10, TEST_LOCATION );
+
+  END_TEST;
+}
+
+int UtcDaliGeometryVertexArrayObjectRecreated(void)
+{
+  TestApplication application;
+  tet_infoline( "Test that the vertex array object is recreated when the vertex buffers change" );
+
+  UseOpenGlEs3( application );
+  Geometry geometry = CreateQuadsForVertexArrayTest( 1u );
+
+  TraceCallStack& bufferTrace = application.GetGlAbstraction().GetBufferTrace();
+  bufferTrace.Enable( true );
+
+  application.SendNotification();
+  application.Render( 0 );
+  DALI_TEST_EQUALS( bufferTrace.CountMethod( "GenVertexArrays" ), 1, TEST_LOCATION );
+  DALI_TEST_EQUALS( bufferTrace.CountMethod( "DeleteVertexArrays" ), 0, TEST_LOCATION );
+
+  bufferTrace.Reset();
+  PropertyBuffer vertexBuffer = CreateVertexBuffer( "aPosition2", "aTexCoord2" );
+  geometry.AddVertexBuffer( vertexBuffer );
+  application.SendNotification();
+  application.Render( 0 );
+
+  DALI_TEST_EQUALS( bufferTrace.CountMethod( "DeleteVertexArrays" ), 1, TEST_LOCATION );
+  DALI_TEST_EQUALS( bufferTrace.CountMethod( "GenVertexArrays" ), 1, TEST_LOCATION );
+  DALI_TEST_EQUALS( bufferTrace.CountMethod( "VertexAttribPointer" ), 4, TEST_LOCATION );
+
+  // Removing the geometry deletes its vertex array object
+  bufferTrace.Reset();
+  Layer rootLayer = Stage::GetCurrent().GetRootLayer();
+  for( unsigned int i = rootLayer.GetChildCount(); i > 0u; --i )
+  {
+    Actor actor = rootLayer.GetChildAt( i - 1u );
+    if( actor.GetRendererCount() > 0u )
+    {
+      actor.Unparent();
+    }
+  }
+  geometry.Reset();
+  for( int i = 0; i < 3; ++i )
+  {
+    application.SendNotification();
+    application.Render( 0 );
+  }
+
+  DALI_TEST_EQUALS( bufferTrace.CountMethod( "DeleteVertexArrays" ), 1, TEST_LOCATION );
+
+  END_TEST;
+}
+
+int UtcDaliGeometrySetIndexBuffer32BitInShortRange(void)
+{
+  TestApplication application;
+  tet_infoline( "Test that 32 bit indices within the 16 bit range are drawn as 16 bit indices" );
+
+  const uint32_t indexData[6] = { 0, 3, 1, 0, 2, 3 };
+  AddActorWithIndices( indexData, sizeof( indexData ) / sizeof( indexData[0] ) );
+
+  TraceCallStack& drawTrace = application.GetGlAbstraction().GetDrawTrace();
+  drawTrace.Enable( true );
+
+  application.SendNotification();
+  application.Render(0);
+
+  const TestGlAbstraction::BufferDataCalls& bufferDataCalls = application.GetGlAbstraction().GetBufferDataCalls();
+  DALI_TEST_EQUALS( bufferDataCalls.size(), 2u, TEST_LOCATION );
+  DALI_TEST_EQUALS( bufferDataCalls[0], 6 * sizeof( unsigned short ), TEST_LOCATION );
+
+  TraceCallStack::NamedParams params;
+  params["type"] = ToString( GL_UNSIGNED_SHORT );
+  DALI_TEST_CHECK( drawTrace.FindMethodAndParams( "DrawElements", params ) );
+
+  END_TEST;
+}
+
+int UtcDaliGeometrySetIndexBuffer32Bit(void)
+{
+  TestApplication application;
+  tet_infoline( "Test that indices beyond the 16 bit range are drawn as 32 bit indices" );
+
+  UseOpenGlEs3( application );
+
+  const uint32_t indexData[6] = { 0, 70000, 1, 0, 2, 70000 };
+  AddActorWithIndices( indexData, sizeof( indexData ) / sizeof( indexData[0] ) );
+
+  TraceCallStack& drawTrace = application.GetGlAbstraction().GetDrawTrace();
+  drawTrace.Enable( true );
+
+  application.SendNotification();
+  application.Render(0);
+
+  const TestGlAbstraction::BufferDataCalls& bufferDataCalls = application.GetGlAbstraction().GetBufferDataCalls();
+  DALI_TEST_EQUALS( bufferDataCalls.size(), 2u, TEST_LOCATION );
+  DALI_TEST_EQUALS( bufferDataCalls[0], 6 * sizeof( uint32_t ), TEST_LOCATION );
+
+  TraceCallStack::NamedParams params;
+  params["count"] = ToString( 6 );
+  params["type"] = ToString( GL_UNSIGNED_INT );
+  DALI_TEST_CHECK( drawTrace.FindMethodAndParams( "DrawElements", params ) );
+
+  END_TEST;
+}
+
+int UtcDaliGeometrySetIndexBuffer32BitExtension(void)
+{
+  TestApplication application;
+  tet_infoline( "Test that 32 bit indices are drawn when the GL_OES_element_index_uint extension is supported" );
+
+  static GLubyte extensions[] = "GL_OES_vertex_half_float GL_OES_element_index_uint";
+  application.GetGlAbstraction().SetGetStringResult( extensions );
+  application.GetCore().ContextDestroyed();
+  application.GetCore().ContextCreated();
+
+  const uint32_t indexData[6] = { 0, 70000, 1, 0, 2, 70000 };
+  AddActorWithIndices( indexData, sizeof( indexData ) / sizeof( indexData[0] ) );
+
+  TraceCallStack& drawTrace = application.GetGlAbstraction().GetDrawTrace();
+  drawTrace.Enable( true );
+
+  application.SendNotification();
+  application.Render(0);
+
+  TraceCallStack::NamedParams params;
+  params["type"] = ToString( GL_UNSIGNED_INT );
+  DALI_TEST_CHECK( drawTrace.FindMethodAndParams( "DrawElements", params ) );
+
+  END_TEST;
+}
+
+int UtcDaliGeometrySetIndexBuffer32BitNotSupported(void)
+{
+  TestApplication application;
+  tet_infoline( "Test that 32 bit indices are not drawn when the context does not support them" );
+
+  const uint32_t indexData[6] = { 0, 70000, 1, 0, 2, 70000 };
+  AddActorWithIndices( indexData, sizeof( indexData ) / sizeof( indexData[0] ) );
+
+  TraceCallStack& drawTrace = application.GetGlAbstraction().GetDrawTrace();
+  drawTrace.Enable( true );
+
+  application.SendNotification();
+  application.Render(0);
+
+  DALI_TEST_EQUALS( drawTrace.CountMethod( "DrawElements" ), 0, TEST_LOCATION );
+  DALI_TEST_EQUALS( drawTrace.CountMethod( "DrawArrays" ), 0, TEST_LOCATION );
+
+  END_TEST;
+}
+
+int UtcDaliGeometrySetIndexBufferUnset(void)
+{
+  TestApplication application;
+  tet_infoline( "Test that setting a null index buffer draws the geometry without indices" );
+
+  const uint32_t indexData[6] = { 0, 3, 1, 0, 2, 3 };
+  Geometry geometry = AddActorWithIndices( indexData, sizeof( indexData ) / sizeof( indexData[0] ) );
+
+  TraceCallStack& drawTrace = application.GetGlAbstraction().GetDrawTrace();
+  drawTrace.Enable( true );
+
+  application.SendNotification();
+  application.Render(0);
+  DALI_TEST_EQUALS( drawTrace.CountMethod( "DrawElements" ), 1, TEST_LOCATION );
+
+  geometry.SetIndexBuffer( NULL, 0 );
+  drawTrace.Reset();
+  application.SendNotification();
+  application.Render(0);
+
+  DALI_TEST_EQUALS( drawTrace.CountMethod( "DrawElements" ), 0, TEST_LOCATION );
+  DALI_TEST_EQUALS( drawTrace.CountMethod( "DrawArrays" ), 1, TEST_LOCATION );
+
+  END_TEST;
+}
+
+int UtcDaliGeometrySetIndexBufferVector(void)
+{
+  TestApplication application;
+  tet_infoline( "Test that the contents of an index vector are taken by the geometry" );
+
+  Geometry geometry = AddActorWithIndices( NULL, 0u );
+
+  Dali::Vector<unsigned short> indices;
+  indices.PushBack( 0 );
+  indices.PushBack( 3 );
+  indices.PushBack( 1 );
+  indices.PushBack( 0 );
+  indices.PushBack( 2 );
+  indices.PushBack( 3 );
+  DevelGeometry::SetIndexBuffer( geometry, indices );
+  DALI_TEST_CHECK( indices.Empty() );
+
+  TraceCallStack& drawTrace = application.GetGlAbstraction().GetDrawTrace();
+  drawTrace.Enable( true );
+
+  application.SendNotification();
+  application.Render(0);
+
+  const TestGlAbstraction::BufferDataCalls& bufferDataCalls = application.GetGlAbstraction().GetBufferDataCalls();
+  DALI_TEST_EQUALS( bufferDataCalls.size(), 2u, TEST_LOCATION );
+  DALI_TEST_EQUALS( bufferDataCalls[0], 6 * sizeof( unsigned short ), TEST_LOCATION );
+
+  TraceCallStack::NamedParams params;
+  params["count"] = ToString( 6 );
+  params["type"] = ToString( GL_UNSIGNED_SHORT );
+  DALI_TEST_CHECK( drawTrace.FindMethodAndParams( "DrawElements", params ) );
+
+  END_TEST;
+}
+
+int UtcDaliGeometrySetIndexBufferVector32Bit(void)
+{
+  TestApplication application;
+  tet_infoline( "Test that the contents of a 32 bit index vector are taken by the geometry" );
+
+  UseOpenGlEs3( application );
+
+  Geometry geometry = AddActorWithIndices( NULL, 0u );
+
+  const uint32_t indexData[6] = { 0, 70000, 1, 0, 2, 70000 };
+  Dali::Vector<uint32_t> indices;
+  indices.Resize( 6u );
+  std::copy( indexData, indexData + 6u, indices.Begin() );
+  DevelGeometry::SetIndexBuffer( geometry, indices );
+  DALI_TEST_CHECK( indices.Empty() );
+
+  TraceCallStack& drawTrace = application.GetGlAbstraction().GetDrawTrace();
+  drawTrace.Enable( true );
+
+  application.SendNotification();
+  application.Render(0);
+
+  const TestGlAbstraction::BufferDataCalls& bufferDataCalls = application.GetGlAbstraction().GetBufferDataCalls();
+  DALI_TEST_EQUALS( bufferDataCalls.size(), 2u, TEST_LOCATION );
+  DALI_TEST_EQUALS( bufferDataCalls[0], 6 * sizeof( uint32_t ), TEST_LOCATION );
+
+  TraceCallStack::NamedParams params;
+  params["count"] = ToString( 6 );
+  params["type"] = ToString( GL_UNSIGNED_INT );
+  DALI_TEST_CHECK( drawTrace.FindMethodAndParams( "DrawElements", params ) );
+
+  END_TEST;
+}
+
+int UtcDaliGeometrySetIndexBufferVector32BitInShortRange(void)
+{
+  TestApplication application;
+  tet_infoline( "Test that a 32 bit index vector within the 16 bit range is drawn as 16 bit indices" );
+
+  Geometry geometry = AddActorWithIndices( NULL, 0u );
+
+  const uint32_t indexData[6] = { 0, 3, 1, 0, 2, 3 };
+  Dali::Vector<uint32_t> indices;
+  indices.Resize( 6u );
+  std::copy( indexData, indexData + 6u, indices.Begin() );
+  DevelGeometry::SetIndexBuffer( geometry, indices );
+  DALI_TEST_CHECK( indices.Empty() );
+
+  application.SendNotification();
+  application.Render(0);
+
+  const TestGlAbstraction::BufferDataCalls& bufferDataCalls = application.GetGlAbstraction().GetBufferDataCalls();
+  DALI_TEST_EQUALS( bufferDataCalls.size(), 2u, TEST_LOCATION );
+  DALI_TEST_EQUALS( bufferDataCalls[0], 6 * sizeof( unsigned short ), TEST_LOCATION );
+
+  END_TEST;
+}
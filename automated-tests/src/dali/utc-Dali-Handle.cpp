@@ -16,8 +16,10 @@
  */
 
 #include <iostream>
+#include <vector>
 
 #include <stdlib.h>
+#include <stdio.h>
 #include <dali/public-api/dali-core.h>
 #include <dali/devel-api/actors/actor-devel.h>
 #include <dali/devel-api/object/handle-devel.h>
@@ -925,3 +927,120 @@ int UtcDaliHandleSetTypeInfo(void)
   END_TEST;
 }
 
+
+int UtcDaliHandleCustomPropertyManyP(void)
+{
+  TestApplication application;
+  tet_infoline( "Test that the indices of many custom properties are found by name and by key" );
+
+  const int count = 40;
+  const Property::Index KEY_START_INDEX = 1000;
+
+  Actor actor = Actor::New();
+  Stage::GetCurrent().Add( actor );
+
+  std::vector< Property::Index > indices;
+  for( int i = 0; i < count; ++i )
+  {
+    char name[32];
+    snprintf( name, sizeof( name ), "property%d", i );
+    indices.push_back( DevelHandle::RegisterProperty( actor, KEY_START_INDEX + i, name, static_cast<float>( i ) ) );
+  }
+
+  for( int i = 0; i < count; ++i )
+  {
+    char name[32];
+    snprintf( name, sizeof( name ), "property%d", i );
+    DALI_TEST_EQUALS( actor.GetPropertyIndex( name ), indices[i], TEST_LOCATION );
+    DALI_TEST_EQUALS( DevelHandle::GetPropertyIndex( actor, KEY_START_INDEX + i ), indices[i], TEST_LOCATION );
+    DALI_TEST_EQUALS( DevelHandle::GetPropertyIndex( actor, Property::Key( name ) ), indices[i], TEST_LOCATION );
+    DALI_TEST_EQUALS( actor.GetProperty< float >( indices[i] ), static_cast<float>( i ), TEST_LOCATION );
+  }
+  DALI_TEST_EQUALS( actor.GetPropertyIndex( "unknown" ), Property::INVALID_INDEX, TEST_LOCATION );
+  DALI_TEST_EQUALS( DevelHandle::GetPropertyIndex( actor, KEY_START_INDEX + count ), Property::INVALID_INDEX, TEST_LOCATION );
+
+  // Registering an existing name sets the value of the existing property
+  DALI_TEST_EQUALS( actor.RegisterProperty( "property7", 100.0f ), indices[7], TEST_LOCATION );
+  application.SendNotification();
+  application.Render( 0 );
+  DALI_TEST_EQUALS( actor.GetProperty< float >( indices[7] ), 100.0f, TEST_LOCATION );
+
+  for( int i = 0; i < count; ++i )
+  {
+    actor.SetProperty( indices[i], static_cast<float>( i * 2 ) );
+  }
+  application.SendNotification();
+  application.Render( 0 );
+
+  for( int i = 0; i < count; ++i )
+  {
+    DALI_TEST_EQUALS( actor.GetProperty< float >( indices[i] ), static_cast<float>( i * 2 ), TEST_LOCATION );
+  }
+
+  END_TEST;
+}
+
+int UtcDaliHandleCustomPropertyBenchmark(void)
+{
+  TestApplication application;
+  tet_infoline( "Measure registering, setting and getting custom properties on many actors" );
+
+  const unsigned int actorCount = IsBenchmarkEnabled() ? 10000u : 100u;
+  const unsigned int propertyCount = IsBenchmarkEnabled() ? 100u : 20u;
+
+  std::vector< std::string > names;
+  for( unsigned int i = 0u; i < propertyCount; ++i )
+  {
+    char name[32];
+    snprintf( name, sizeof( name ), "customProperty%u", i );
+    names.push_back( name );
+  }
+
+  std::vector< Actor > actors;
+  actors.reserve( actorCount );
+  for( unsigned int i = 0u; i < actorCount; ++i )
+  {
+    actors.push_back( Actor::New() );
+  }
+
+  double start = GetTimeMilliseconds();
+  for( unsigned int i = 0u; i < actorCount; ++i )
+  {
+    for( unsigned int j = 0u; j < propertyCount; ++j )
+    {
+      actors[i].RegisterProperty( names[j], static_cast<float>( j ) );
+    }
+  }
+  const double registerTime = GetTimeMilliseconds() - start;
+
+  start = GetTimeMilliseconds();
+  for( unsigned int i = 0u; i < actorCount; ++i )
+  {
+    for( unsigned int j = 0u; j < propertyCount; ++j )
+    {
+      actors[i].SetProperty( actors[i].GetPropertyIndex( names[j] ), static_cast<float>( i ) );
+    }
+  }
+  const double setTime = GetTimeMilliseconds() - start;
+
+  application.SendNotification();
+  application.Render( 0 );
+
+  float sum = 0.0f;
+  start = GetTimeMilliseconds();
+  for( unsigned int i = 0u; i < actorCount; ++i )
+  {
+    for( unsigned int j = 0u; j < propertyCount; ++j )
+    {
+      sum += actors[i].GetProperty< float >( actors[i].GetPropertyIndex( names[j] ) );
+    }
+  }
+  const double getTime = GetTimeMilliseconds() - start;
+
+  tet_printf( "%u actors x %u custom properties: register %.3f ms, find & set %.3f ms, find & get %.3f ms (checksum %f)\n",
+              actorCount, propertyCount, registerTime, setTime, getTime, sum );
+
+  DALI_TEST_EQUALS( actors[actorCount - 1u].GetProperty< float >( actors[actorCount - 1u].GetPropertyIndex( names[propertyCount - 1u] ) ),
+                    static_cast<float>( actorCount - 1u ), TEST_LOCATION );
+  END_TEST;
+}
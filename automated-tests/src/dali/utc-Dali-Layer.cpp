@@ -20,6 +20,7 @@
 #include <stdlib.h>
 
 #include <dali/public-api/dali-core.h>
+#include <dali/devel-api/actors/layer-devel.h>
 
 #include <dali-test-suite-utils.h>
 
@@ -445,6 +446,7 @@ int UtcDaliLayerDefaultProperties(void)
   indices.push_back(Layer::Property::CLIPPING_ENABLE);
   indices.push_back(Layer::Property::CLIPPING_BOX);
   indices.push_back(Layer::Property::BEHAVIOR);
+  indices.push_back(DevelLayer::Property::HIERARCHICAL_CULLING);
 
   DALI_TEST_CHECK(actor.GetPropertyCount() == ( Actor::New().GetPropertyCount() + indices.size() ) );
 
@@ -19,6 +19,7 @@
 #include <sstream>
 
 #include <stdlib.h>
+#include <string.h>
 #include <dali/public-api/dali-core.h>
 #include <dali-test-suite-utils.h>
 
@@ -35,6 +36,103 @@ void utc_dali_matrix_cleanup(void)
   test_return_value = TET_PASS;
 }
 
+namespace
+{
+
+// Scalar reference implementations, any vectorised code path in Matrix must give identical results
+
+void ReferenceMultiply( float* result, const float* lhs, const float* rhs )
+{
+  for( int i = 0; i < 16; i += 4 )
+  {
+    for( int j = 0; j < 4; ++j )
+    {
+      result[i + j] = lhs[i] * rhs[j] + lhs[i + 1] * rhs[4 + j] + lhs[i + 2] * rhs[8 + j] + lhs[i + 3] * rhs[12 + j];
+    }
+  }
+}
+
+void ReferenceTransform( float* result, const float* matrix, const float* vector )
+{
+  for( int j = 0; j < 4; ++j )
+  {
+    result[j] = vector[0] * matrix[j] + vector[1] * matrix[4 + j] + vector[2] * matrix[8 + j] + vector[3] * matrix[12 + j];
+  }
+}
+
+void ReferenceRotation( float* m, const Vector3& scale, const Quaternion& rotation )
+{
+  const float xx = rotation.mVector.x * rotation.mVector.x;
+  const float yy = rotation.mVector.y * rotation.mVector.y;
+  const float zz = rotation.mVector.z * rotation.mVector.z;
+  const float xy = rotation.mVector.x * rotation.mVector.y;
+  const float xz = rotation.mVector.x * rotation.mVector.z;
+  const float wx = rotation.mVector.w * rotation.mVector.x;
+  const float wy = rotation.mVector.w * rotation.mVector.y;
+  const float wz = rotation.mVector.w * rotation.mVector.z;
+  const float yz = rotation.mVector.y * rotation.mVector.z;
+
+  m[0] = scale.x * ( 1.0f - 2.0f * ( yy + zz ) );
+  m[1] = scale.x * (        2.0f * ( xy + wz ) );
+  m[2] = scale.x * (        2.0f * ( xz - wy ) );
+  m[3] = 0.0f;
+  m[4] = scale.y * (        2.0f * ( xy - wz ) );
+  m[5] = scale.y * ( 1.0f - 2.0f * ( xx + zz ) );
+  m[6] = scale.y * (        2.0f * ( yz + wx ) );
+  m[7] = 0.0f;
+  m[8] = scale.z * (        2.0f * ( xz + wy ) );
+  m[9] = scale.z * (        2.0f * ( yz - wx ) );
+  m[10]= scale.z * ( 1.0f - 2.0f * ( xx + yy ) );
+  m[11]= 0.0f;
+  m[12]= 0.0f;
+  m[13]= 0.0f;
+  m[14]= 0.0f;
+  m[15]= 1.0f;
+}
+
+void ReferenceMultiplyQuaternion( float* result, const float* lhs, const Quaternion& rhs )
+{
+  float rotation[16];
+  ReferenceRotation( rotation, Vector3::ONE, rhs );
+  for( int i = 0; i < 16; i += 4 )
+  {
+    for( int j = 0; j < 3; ++j )
+    {
+      result[i + j] = lhs[i] * rotation[j] + lhs[i + 1] * rotation[4 + j] + lhs[i + 2] * rotation[8 + j] + 0.0f;
+    }
+    result[i + 3] = 0.0f + 0.0f + 0.0f + lhs[i + 3];
+  }
+}
+
+float RandomFloat()
+{
+  return static_cast<float>( rand() ) / static_cast<float>( RAND_MAX ) * 20.0f - 10.0f;
+}
+
+Matrix RandomMatrix()
+{
+  Matrix matrix( false );
+  for( int i = 0; i < 16; ++i )
+  {
+    matrix.AsFloat()[i] = RandomFloat();
+  }
+  return matrix;
+}
+
+Quaternion RandomQuaternion()
+{
+  Vector3 axis( RandomFloat(), RandomFloat(), RandomFloat() );
+  axis.Normalize();
+  return Quaternion( Radian( RandomFloat() ), axis );
+}
+
+bool BitwiseEqual( const float* lhs, const float* rhs, size_t count )
+{
+  return memcmp( lhs, rhs, count * sizeof( float ) ) == 0;
+}
+
+} // unnamed namespace
+
 
 int UtcDaliMatrixConstructor01P(void)
 {
@@ -800,3 +898,141 @@ int UtcDaliMatrixOStreamOperator(void)
   DALI_TEST_EQUALS( oss.str(), expectedOutput, TEST_LOCATION);
   END_TEST;
 }
+
+int UtcDaliMatrixMultiplyMatchesReferenceP(void)
+{
+  srand( 1 );
+  bool match = true;
+  for( int i = 0; i < 1000; ++i )
+  {
+    const Matrix lhs = RandomMatrix();
+    const Matrix rhs = RandomMatrix();
+    float expected[16];
+    ReferenceMultiply( expected, lhs.AsFloat(), rhs.AsFloat() );
+
+    Matrix result( false );
+    Matrix::Multiply( result, lhs, rhs );
+    match = match && BitwiseEqual( result.AsFloat(), expected, 16 );
+
+    // The result can be one of the inputs
+    Matrix aliasLhs( lhs );
+    Matrix::Multiply( aliasLhs, aliasLhs, rhs );
+    match = match && BitwiseEqual( aliasLhs.AsFloat(), expected, 16 );
+
+    Matrix aliasRhs( rhs );
+    Matrix::Multiply( aliasRhs, lhs, aliasRhs );
+    match = match && BitwiseEqual( aliasRhs.AsFloat(), expected, 16 );
+  }
+  DALI_TEST_CHECK( match );
+  END_TEST;
+}
+
+int UtcDaliMatrixMultiplyQuaternionMatchesReferenceP(void)
+{
+  srand( 2 );
+  bool match = true;
+  for( int i = 0; i < 1000; ++i )
+  {
+    const Matrix lhs = RandomMatrix();
+    const Quaternion rhs = RandomQuaternion();
+    float expected[16];
+    ReferenceMultiplyQuaternion( expected, lhs.AsFloat(), rhs );
+
+    Matrix result( false );
+    Matrix::Multiply( result, lhs, rhs );
+    match = match && BitwiseEqual( result.AsFloat(), expected, 16 );
+
+    Matrix alias( lhs );
+    Matrix::Multiply( alias, alias, rhs );
+    match = match && BitwiseEqual( alias.AsFloat(), expected, 16 );
+  }
+  DALI_TEST_CHECK( match );
+  END_TEST;
+}
+
+int UtcDaliMatrixMultiplyVector4MatchesReferenceP(void)
+{
+  srand( 3 );
+  bool match = true;
+  for( int i = 0; i < 1000; ++i )
+  {
+    const Matrix matrix = RandomMatrix();
+    const Vector4 vector( RandomFloat(), RandomFloat(), RandomFloat(), RandomFloat() );
+    float expected[4];
+    ReferenceTransform( expected, matrix.AsFloat(), vector.AsFloat() );
+
+    const Vector4 result = matrix * vector;
+    match = match && BitwiseEqual( result.AsFloat(), expected, 4 );
+  }
+  DALI_TEST_CHECK( match );
+  END_TEST;
+}
+
+int UtcDaliMatrixSetTransformComponentsMatchesReferenceP(void)
+{
+  srand( 4 );
+  bool match = true;
+  for( int i = 0; i < 1000; ++i )
+  {
+    const Vector3 scale( RandomFloat(), RandomFloat(), RandomFloat() );
+    const Quaternion rotation = RandomQuaternion();
+    const Vector3 translation( RandomFloat(), RandomFloat(), RandomFloat() );
+    float expected[16];
+    ReferenceRotation( expected, scale, rotation );
+    expected[12] = translation.x;
+    expected[13] = translation.y;
+    expected[14] = translation.z;
+
+    Matrix result( false );
+    result.SetTransformComponents( scale, rotation, translation );
+    match = match && BitwiseEqual( result.AsFloat(), expected, 16 );
+  }
+  DALI_TEST_CHECK( match );
+  END_TEST;
+}
+
+int UtcDaliMatrixMultiplyBenchmark(void)
+{
+  const int count = IsBenchmarkEnabled() ? 200000 : 1000;
+  srand( 5 );
+  Matrix matrices[16];
+  for( int i = 0; i < 16; ++i )
+  {
+    matrices[i] = RandomMatrix();
+  }
+
+  float sum = 0.0f;
+
+  double start = GetTimeMilliseconds();
+  for( int i = 0; i < count; ++i )
+  {
+    float result[16];
+    ReferenceMultiply( result, matrices[i & 15].AsFloat(), matrices[( i + 1 ) & 15].AsFloat() );
+    sum += result[i & 15];
+  }
+  const double referenceTime = GetTimeMilliseconds() - start;
+
+  start = GetTimeMilliseconds();
+  for( int i = 0; i < count; ++i )
+  {
+    Matrix result( false );
+    Matrix::Multiply( result, matrices[i & 15], matrices[( i + 1 ) & 15] );
+    sum += result.AsFloat()[i & 15];
+  }
+  const double multiplyTime = GetTimeMilliseconds() - start;
+
+  start = GetTimeMilliseconds();
+  for( int i = 0; i < count; ++i )
+  {
+    Matrix result( false );
+    result.SetTransformComponents( Vector3( 1.0f, 2.0f, 3.0f ), Quaternion( Radian( static_cast<float>( i ) ), Vector3::ZAXIS ), Vector3::ZERO );
+    sum += result.AsFloat()[i & 15];
+  }
+  const double transformTime = GetTimeMilliseconds() - start;
+
+  tet_printf( "%d matrix multiplies, reference: %.3f ms, Matrix::Multiply: %.3f ms\n", count, referenceTime, multiplyTime );
+  tet_printf( "%d Matrix::SetTransformComponents: %.3f ms (checksum %f)\n", count, transformTime, sum );
+
+  DALI_TEST_CHECK( sum == sum ); // Not NaN
+  END_TEST;
+}
@@ -16,12 +16,51 @@
  */
 
 #include <dali/public-api/dali-core.h>
+#include <dali/devel-api/rendering/property-buffer-devel.h>
 #include <dali-test-suite-utils.h>
 
 using namespace Dali;
 
 #include <mesh-builder.h>
 
+namespace
+{
+
+struct TexturedQuadVertex { Vector2 position; Vector2 textureCoordinates; };
+
+/**
+ * Creates a property buffer with four vertices, and an actor drawing it
+ */
+PropertyBuffer CreateRenderedPropertyBuffer( DevelPropertyBuffer::Usage::Type usage )
+{
+  Property::Map texturedQuadVertexFormat;
+  texturedQuadVertexFormat["aPosition"] = Property::VECTOR2;
+  texturedQuadVertexFormat["aVertexCoord"] = Property::VECTOR2;
+
+  PropertyBuffer propertyBuffer = DevelPropertyBuffer::New( texturedQuadVertexFormat, usage );
+
+  TexturedQuadVertex texturedQuadVertexData[4] = {
+    { Vector2(-0.5f, -0.5f), Vector2(0.f, 0.f) },
+    { Vector2( 0.5f, -0.5f), Vector2(1.f, 0.f) },
+    { Vector2(-0.5f,  0.5f), Vector2(0.f, 1.f) },
+    { Vector2( 0.5f,  0.5f), Vector2(1.f, 1.f) } };
+  propertyBuffer.SetData( texturedQuadVertexData, 4 );
+
+  Geometry geometry = Geometry::New();
+  geometry.AddVertexBuffer( propertyBuffer );
+
+  Shader shader = CreateShader();
+  Renderer renderer = Renderer::New(geometry, shader);
+  Actor actor = Actor::New();
+  actor.SetSize(Vector3::ONE * 100.f);
+  actor.AddRenderer(renderer);
+  Stage::GetCurrent().Add(actor);
+
+  return propertyBuffer;
+}
+
+} // unnamed namespace
+
 void propertyBuffer_test_startup(void)
 {
   test_return_value = TET_UNDEF;
@@ -248,3 +287,191 @@ int UtcDaliPropertyBufferInvalidTypeN(void)
   END_TEST;
 }
 
+
+int UtcDaliPropertyBufferNewWithUsage(void)
+{
+  TestApplication application;
+
+  Property::Map texturedQuadVertexFormat;
+  texturedQuadVertexFormat["aPosition"] = Property::VECTOR2;
+
+  PropertyBuffer propertyBuffer = PropertyBuffer::New( texturedQuadVertexFormat );
+  DALI_TEST_EQUALS( DevelPropertyBuffer::GetUsage( propertyBuffer ), DevelPropertyBuffer::Usage::STATIC, TEST_LOCATION );
+
+  propertyBuffer = DevelPropertyBuffer::New( texturedQuadVertexFormat, DevelPropertyBuffer::Usage::DYNAMIC );
+  DALI_TEST_CHECK( propertyBuffer );
+  DALI_TEST_EQUALS( DevelPropertyBuffer::GetUsage( propertyBuffer ), DevelPropertyBuffer::Usage::DYNAMIC, TEST_LOCATION );
+
+  propertyBuffer = DevelPropertyBuffer::New( texturedQuadVertexFormat, DevelPropertyBuffer::Usage::STREAM );
+  DALI_TEST_EQUALS( DevelPropertyBuffer::GetUsage( propertyBuffer ), DevelPropertyBuffer::Usage::STREAM, TEST_LOCATION );
+
+  END_TEST;
+}
+
+int UtcDaliPropertyBufferSetDataRangeDynamic(void)
+{
+  TestApplication application;
+  tet_infoline( "Test that only the updated range of a dynamic buffer is uploaded" );
+
+  PropertyBuffer propertyBuffer = CreateRenderedPropertyBuffer( DevelPropertyBuffer::Usage::DYNAMIC );
+
+  application.SendNotification();
+  application.Render(0);
+
+  TestGlAbstraction& gl = application.GetGlAbstraction();
+  DALI_TEST_EQUALS( gl.GetBufferDataCalls().size(), 1u, TEST_LOCATION );
+  gl.ResetBufferDataCalls();
+  gl.ResetBufferSubDataCalls();
+
+  TexturedQuadVertex vertices[2] = {
+    { Vector2( 1.0f, -0.5f), Vector2(1.f, 0.f) },
+    { Vector2(-0.5f,  1.0f), Vector2(0.f, 1.f) } };
+  DevelPropertyBuffer::SetDataRange( propertyBuffer, vertices, 1u, 2u );
+
+  application.SendNotification();
+  application.Render(0);
+
+  DALI_TEST_EQUALS( gl.GetBufferDataCalls().size(), 0u, TEST_LOCATION );
+  DALI_TEST_EQUALS( gl.GetBufferSubDataCalls().size(), 1u, TEST_LOCATION );
+  DALI_TEST_EQUALS( gl.GetBufferSubDataCalls()[0], sizeof( vertices ), TEST_LOCATION );
+  DALI_TEST_EQUALS( propertyBuffer.GetSize(), 4u, TEST_LOCATION );
+
+  // Nothing is uploaded when the buffer does not change
+  gl.ResetBufferSubDataCalls();
+  application.SendNotification();
+  application.Render(0);
+  DALI_TEST_EQUALS( gl.GetBufferSubDataCalls().size(), 0u, TEST_LOCATION );
+
+  END_TEST;
+}
+
+int UtcDaliPropertyBufferSetDataRangeMerged(void)
+{
+  TestApplication application;
+  tet_infoline( "Test that ranges updated in the same frame are uploaded together" );
+
+  PropertyBuffer propertyBuffer = CreateRenderedPropertyBuffer( DevelPropertyBuffer::Usage::DYNAMIC );
+
+  application.SendNotification();
+  application.Render(0);
+
+  TestGlAbstraction& gl = application.GetGlAbstraction();
+  gl.ResetBufferDataCalls();
+  gl.ResetBufferSubDataCalls();
+
+  TexturedQuadVertex vertex = { Vector2( 0.0f, 0.0f ), Vector2( 0.5f, 0.5f ) };
+  DevelPropertyBuffer::SetDataRange( propertyBuffer, &vertex, 0u, 1u );
+  DevelPropertyBuffer::SetDataRange( propertyBuffer, &vertex, 2u, 1u );
+
+  application.SendNotification();
+  application.Render(0);
+
+  DALI_TEST_EQUALS( gl.GetBufferDataCalls().size(), 0u, TEST_LOCATION );
+  DALI_TEST_EQUALS( gl.GetBufferSubDataCalls().size(), 1u, TEST_LOCATION );
+  DALI_TEST_EQUALS( gl.GetBufferSubDataCalls()[0], 3u * sizeof( TexturedQuadVertex ), TEST_LOCATION );
+
+  END_TEST;
+}
+
+int UtcDaliPropertyBufferSetDataRangeStream(void)
+{
+  TestApplication application;
+  tet_infoline( "Test that a stream buffer is respecified whenever it is updated" );
+
+  PropertyBuffer propertyBuffer = CreateRenderedPropertyBuffer( DevelPropertyBuffer::Usage::STREAM );
+
+  application.SendNotification();
+  application.Render(0);
+
+  TestGlAbstraction& gl = application.GetGlAbstraction();
+  gl.ResetBufferDataCalls();
+  gl.ResetBufferSubDataCalls();
+
+  TexturedQuadVertex vertex = { Vector2( 0.0f, 0.0f ), Vector2( 0.5f, 0.5f ) };
+  DevelPropertyBuffer::SetDataRange( propertyBuffer, &vertex, 3u, 1u );
+
+  application.SendNotification();
+  application.Render(0);
+
+  DALI_TEST_EQUALS( gl.GetBufferSubDataCalls().size(), 0u, TEST_LOCATION );
+  DALI_TEST_EQUALS( gl.GetBufferDataCalls().size(), 1u, TEST_LOCATION );
+  DALI_TEST_EQUALS( gl.GetBufferDataCalls()[0], 4u * sizeof( TexturedQuadVertex ), TEST_LOCATION );
+
+  END_TEST;
+}
+
+int UtcDaliPropertyBufferSetDataRangeN(void)
+{
+  TestApplication application;
+
+  PropertyBuffer propertyBuffer = CreateRenderedPropertyBuffer( DevelPropertyBuffer::Usage::DYNAMIC );
+
+  TexturedQuadVertex vertices[2];
+  try
+  {
+    DevelPropertyBuffer::SetDataRange( propertyBuffer, vertices, 3u, 2u );
+    tet_result(TET_FAIL);
+  }
+  catch ( Dali::DaliException& e )
+  {
+    DALI_TEST_ASSERT( e, "Range exceeds the size of the buffer", TEST_LOCATION );
+  }
+  END_TEST;
+}
+
+int UtcDaliPropertyBufferSetDataVector(void)
+{
+  TestApplication application;
+  tet_infoline( "Test that the contents of a data vector are taken by the buffer" );
+
+  PropertyBuffer propertyBuffer = CreateRenderedPropertyBuffer( DevelPropertyBuffer::Usage::STATIC );
+
+  application.SendNotification();
+  application.Render(0);
+
+  TestGlAbstraction& gl = application.GetGlAbstraction();
+  gl.ResetBufferDataCalls();
+  gl.ResetBufferSubDataCalls();
+
+  TexturedQuadVertex vertices[3] = {
+    { Vector2(-0.5f, -0.5f), Vector2(0.f, 0.f) },
+    { Vector2( 0.5f, -0.5f), Vector2(1.f, 0.f) },
+    { Vector2(-0.5f,  0.5f), Vector2(0.f, 1.f) } };
+  Dali::Vector<char> data;
+  data.Resize( sizeof( vertices ) );
+  memcpy( data.Begin(), vertices, sizeof( vertices ) );
+
+  DevelPropertyBuffer::SetData( propertyBuffer, data );
+  DALI_TEST_CHECK( data.Empty() );
+  DALI_TEST_EQUALS( propertyBuffer.GetSize(), 3u, TEST_LOCATION );
+
+  application.SendNotification();
+  application.Render(0);
+
+  // The smaller data fits in the existing GPU buffer
+  DALI_TEST_EQUALS( gl.GetBufferDataCalls().size(), 0u, TEST_LOCATION );
+  DALI_TEST_EQUALS( gl.GetBufferSubDataCalls().size(), 1u, TEST_LOCATION );
+  DALI_TEST_EQUALS( gl.GetBufferSubDataCalls()[0], sizeof( vertices ), TEST_LOCATION );
+
+  END_TEST;
+}
+
+int UtcDaliPropertyBufferSetDataVectorN(void)
+{
+  TestApplication application;
+
+  PropertyBuffer propertyBuffer = CreateRenderedPropertyBuffer( DevelPropertyBuffer::Usage::STATIC );
+
+  Dali::Vector<char> data;
+  data.Resize( sizeof( TexturedQuadVertex ) + 1u );
+  try
+  {
+    DevelPropertyBuffer::SetData( propertyBuffer, data );
+    tet_result(TET_FAIL);
+  }
+  catch ( Dali::DaliException& e )
+  {
+    DALI_TEST_ASSERT( e, "Data size is not a multiple of the element size", TEST_LOCATION );
+  }
+  END_TEST;
+}
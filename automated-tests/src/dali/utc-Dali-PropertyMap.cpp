@@ -503,6 +503,78 @@ int UtcDaliPropertyMapAnonymousAddChainP(void)
 }
 
 
+int UtcDaliPropertyMapInsertMoveP(void)
+{
+#ifdef _CPP11
+  Property::Map nestedMap;
+  nestedMap.Insert( "nested", 1 );
+  Property::Value mapValue( nestedMap );
+  const Property::Map* mapPointer = mapValue.GetMap();
+
+  Property::Array nestedArray;
+  nestedArray.PushBack( 2 );
+  Property::Value arrayValue( nestedArray );
+  const Property::Array* arrayPointer = arrayValue.GetArray();
+
+  Property::Value indexValue( nestedMap );
+  const Property::Map* indexPointer = indexValue.GetMap();
+
+  // The nested Map and Array are handed over rather than copied
+  Property::Map map;
+  map.Insert( "map", std::move( mapValue ) );
+  map.Insert( std::string( "array" ), std::move( arrayValue ) );
+  map.Insert( 10, std::move( indexValue ) );
+  DALI_TEST_EQUALS( map.Count(), static_cast<Property::Map::SizeType>( 3 ), TEST_LOCATION );
+
+  DALI_TEST_CHECK( map.Find( "map" )->GetMap() == mapPointer );
+  DALI_TEST_CHECK( map.Find( "array" )->GetArray() == arrayPointer );
+  DALI_TEST_CHECK( map.Find( 10 )->GetMap() == indexPointer );
+  DALI_TEST_EQUALS( map.Find( "map" )->GetMap()->Find( "nested" )->Get<int>(), 1, TEST_LOCATION );
+  DALI_TEST_EQUALS( map.Find( "array" )->GetArray()->GetElementAt( 0 ).Get<int>(), 2, TEST_LOCATION );
+
+  DALI_TEST_EQUALS( mapValue.GetType(), Property::NONE, TEST_LOCATION );
+  DALI_TEST_EQUALS( arrayValue.GetType(), Property::NONE, TEST_LOCATION );
+  DALI_TEST_EQUALS( indexValue.GetType(), Property::NONE, TEST_LOCATION );
+#else
+  tet_infoline( "Move semantics need C++11" );
+  DALI_TEST_CHECK( true );
+#endif
+  END_TEST;
+}
+
+int UtcDaliPropertyMapAddMoveP(void)
+{
+#ifdef _CPP11
+  Property::Array nestedArray;
+  nestedArray.PushBack( 1 );
+  Property::Value arrayValue( nestedArray );
+  const Property::Array* arrayPointer = arrayValue.GetArray();
+
+  Property::Map nestedMap;
+  nestedMap.Insert( "nested", 2 );
+  Property::Value mapValue( nestedMap );
+  const Property::Map* mapPointer = mapValue.GetMap();
+
+  Property::Map map;
+  map.Add( "array", std::move( arrayValue ) )
+     .Add( 20, std::move( mapValue ) )
+     .Add( std::string( "value" ), Property::Value( 3 ) );
+  DALI_TEST_EQUALS( map.Count(), static_cast<Property::Map::SizeType>( 3 ), TEST_LOCATION );
+
+  // The nested Map and Array are handed over rather than copied
+  DALI_TEST_CHECK( map.Find( "array" )->GetArray() == arrayPointer );
+  DALI_TEST_CHECK( map.Find( 20 )->GetMap() == mapPointer );
+  DALI_TEST_EQUALS( map.Find( "value" )->Get<int>(), 3, TEST_LOCATION );
+  DALI_TEST_CHECK( arrayValue.GetArray() == NULL );
+  DALI_TEST_CHECK( mapValue.GetMap() == NULL );
+#else
+  tet_infoline( "Move semantics need C++11" );
+  DALI_TEST_CHECK( true );
+#endif
+  END_TEST;
+}
+
+
 int UtcDaliPropertyMapMerge(void)
 {
   Property::Map map;
@@ -686,3 +758,120 @@ int UtcDaliPropertyKeyOutputStream(void)
 
   END_TEST;
 }
+
+int UtcDaliPropertyMapFindLargeMapP(void)
+{
+  // Large maps are searched through a hash index, which must give the same results as a linear search
+  Property::Map map;
+  const int count = 200;
+  for( int i = 0; i < count; ++i )
+  {
+    std::ostringstream key;
+    key << "key" << i;
+    map.Insert( key.str(), i );
+    map.Insert( i * 7, i );
+  }
+
+  for( int i = 0; i < count; ++i )
+  {
+    std::ostringstream key;
+    key << "key" << i;
+    Property::Value* value = map.Find( key.str() );
+    DALI_TEST_CHECK( value );
+    DALI_TEST_EQUALS( value->Get<int>(), i, TEST_LOCATION );
+    DALI_TEST_EQUALS( map[ key.str() ].Get<int>(), i, TEST_LOCATION );
+
+    value = map.Find( i * 7 );
+    DALI_TEST_CHECK( value );
+    DALI_TEST_EQUALS( value->Get<int>(), i, TEST_LOCATION );
+  }
+  DALI_TEST_CHECK( !map.Find( "key" ) );
+  DALI_TEST_CHECK( !map.Find( 1 ) );
+
+  // Keys added after the index was built are found as well
+  map.Insert( "late", 1000 );
+  map[ 5000 ] = 2000;
+  DALI_TEST_EQUALS( map.Find( "late" )->Get<int>(), 1000, TEST_LOCATION );
+  DALI_TEST_EQUALS( map.Find( 5000 )->Get<int>(), 2000, TEST_LOCATION );
+  DALI_TEST_EQUALS( map.Count(), static_cast<Property::Map::SizeType>( count * 2 + 2 ), TEST_LOCATION );
+
+  // Iteration order is unchanged
+  DALI_TEST_EQUALS( map.GetKeyAt( 0 ).stringKey, "key0", TEST_LOCATION );
+  DALI_TEST_EQUALS( map.GetKeyAt( count ).stringKey, "late", TEST_LOCATION );
+  DALI_TEST_EQUALS( map.GetKeyAt( count + 1 ).indexKey, 0, TEST_LOCATION );
+  END_TEST;
+}
+
+int UtcDaliPropertyMapFindLargeMapDuplicatesP(void)
+{
+  Property::Map map;
+  for( int i = 0; i < 50; ++i )
+  {
+    std::ostringstream key;
+    key << "key" << i;
+    map.Insert( key.str(), i );
+  }
+
+  // The first of duplicate keys is found
+  map.Insert( "key10", "duplicate" );
+  DALI_TEST_EQUALS( map.Find( "key10" )->Get<int>(), 10, TEST_LOCATION );
+  DALI_TEST_EQUALS( map.Find( "key10", Property::STRING )->Get<std::string>(), "duplicate", TEST_LOCATION );
+  DALI_TEST_CHECK( !map.Find( "key10", Property::VECTOR2 ) );
+
+  // Keys changed through the deprecated GetPair are found
+  map.GetPair( 3 ).first = "renamed";
+  DALI_TEST_EQUALS( map.Find( "renamed" )->Get<int>(), 3, TEST_LOCATION );
+  DALI_TEST_CHECK( !map.Find( "key3" ) );
+
+  // Maps are reusable after being cleared
+  map.Clear();
+  DALI_TEST_CHECK( !map.Find( "key10" ) );
+  for( int i = 0; i < 50; ++i )
+  {
+    std::ostringstream key;
+    key << "other" << i;
+    map.Insert( key.str(), i );
+  }
+  DALI_TEST_CHECK( !map.Find( "key10" ) );
+  DALI_TEST_EQUALS( map.Find( "other10" )->Get<int>(), 10, TEST_LOCATION );
+
+  // Copies find the same values
+  Property::Map copy( map );
+  DALI_TEST_EQUALS( copy.Find( "other49" )->Get<int>(), 49, TEST_LOCATION );
+  END_TEST;
+}
+
+int UtcDaliPropertyMapFindLargeMapCopyP(void)
+{
+  // The index is built when entries are added, so const searches of copies and after GetPair() work too
+  Property::Map map;
+  const int count = 50;
+  for( int i = 0; i < count; ++i )
+  {
+    std::ostringstream key;
+    key << "key" << i;
+    map.Insert( key.str(), i );
+  }
+
+  const Property::Map copy( map );
+  Property::Map assigned;
+  assigned = map;
+  for( int i = 0; i < count; ++i )
+  {
+    std::ostringstream key;
+    key << "key" << i;
+    DALI_TEST_EQUALS( copy.Find( key.str() )->Get<int>(), i, TEST_LOCATION );
+    DALI_TEST_EQUALS( assigned.Find( key.str() )->Get<int>(), i, TEST_LOCATION );
+  }
+
+  // Changing a key through GetPair() is seen by later searches
+  map.GetPair( 10 ).first = "changed";
+  DALI_TEST_CHECK( !map.Find( "key10" ) );
+  DALI_TEST_EQUALS( map.Find( "changed" )->Get<int>(), 10, TEST_LOCATION );
+
+  map.Insert( "added", 100 );
+  DALI_TEST_EQUALS( map.Find( "changed" )->Get<int>(), 10, TEST_LOCATION );
+  DALI_TEST_EQUALS( map.Find( "added" )->Get<int>(), 100, TEST_LOCATION );
+  DALI_TEST_EQUALS( map.Find( "key49" )->Get<int>(), 49, TEST_LOCATION );
+  END_TEST;
+}
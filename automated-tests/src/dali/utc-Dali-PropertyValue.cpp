@@ -17,7 +17,7 @@
 
 #include <iostream>
 #include <iomanip>
-#include <stdlib.h>
+#include <malloc.h>
 #include <dali/public-api/dali-core.h>
 #include <dali-test-suite-utils.h>
 
@@ -26,6 +26,48 @@ using namespace Dali;
 namespace
 {
 
+/**
+ * Measures how much the heap in use grows during its lifetime, without replacing the global allocator.
+ */
+class ScopedHeapUsage
+{
+public:
+  ScopedHeapUsage()
+  : mStart( GetHeapInUse() )
+  {
+  }
+
+  size_t GetGrowth() const
+  {
+    const size_t inUse = GetHeapInUse();
+    return inUse > mStart ? inUse - mStart : 0u;
+  }
+
+private:
+  static size_t GetHeapInUse()
+  {
+#if defined( __GLIBC__ ) && __GLIBC_PREREQ( 2, 33 )
+    return mallinfo2().uordblks;
+#else
+    return static_cast< size_t >( mallinfo().uordblks );
+#endif
+  }
+
+  size_t mStart;
+};
+
+/**
+ * Fills a map with five values
+ */
+void FillMap( Property::Map& map, int i )
+{
+  map.Insert( "size", Vector3( 1.0f, 2.0f, 3.0f ) );
+  map.Insert( "color", Vector4( 1.0f, 1.0f, 1.0f, 1.0f ) );
+  map.Insert( "opacity", 0.5f );
+  map.Insert( "visible", true );
+  map.Insert( "index", i );
+}
+
 template <typename T>
 struct CheckCopyCtorP
 {
@@ -1266,3 +1308,187 @@ int UtcDaliPropertyValueOutputStream(void)
 
   END_TEST;
 }
+
+int UtcDaliPropertyValueAssignmentOperatorChangeTypeP(void)
+{
+  // Assign values which are stored inline over allocated values and vice versa
+  Property::Value value( std::string( "string" ) );
+  DALI_TEST_EQUALS( value.GetType(), Property::STRING, TEST_LOCATION );
+
+  value = Property::Value( Vector4( 1.0f, 2.0f, 3.0f, 4.0f ) );
+  DALI_TEST_EQUALS( value.GetType(), Property::VECTOR4, TEST_LOCATION );
+  DALI_TEST_EQUALS( value.Get<Vector4>(), Vector4( 1.0f, 2.0f, 3.0f, 4.0f ), TEST_LOCATION );
+
+  value = Property::Value( Matrix::IDENTITY );
+  DALI_TEST_EQUALS( value.GetType(), Property::MATRIX, TEST_LOCATION );
+  DALI_TEST_EQUALS( value.Get<Matrix>(), Matrix::IDENTITY, TEST_LOCATION );
+
+  value = Property::Value( Rect<int>( 1, 2, 3, 4 ) );
+  DALI_TEST_EQUALS( value.GetType(), Property::RECTANGLE, TEST_LOCATION );
+  DALI_TEST_EQUALS( value.Get< Rect<int> >(), Rect<int>( 1, 2, 3, 4 ), TEST_LOCATION );
+
+  value = Property::Value( Quaternion( Radian( 1.0f ), Vector3::YAXIS ) );
+  DALI_TEST_EQUALS( value.GetType(), Property::ROTATION, TEST_LOCATION );
+  DALI_TEST_EQUALS( value.Get<Quaternion>(), Quaternion( Radian( 1.0f ), Vector3::YAXIS ), 0.001f, TEST_LOCATION );
+
+  value = Property::Value();
+  DALI_TEST_EQUALS( value.GetType(), Property::NONE, TEST_LOCATION );
+  std::ostringstream stream;
+  stream << value;
+  DALI_TEST_EQUALS( stream.str(), "empty type", TEST_LOCATION );
+
+  value = Property::Value( Property::NONE );
+  DALI_TEST_EQUALS( value.GetType(), Property::NONE, TEST_LOCATION );
+  std::ostringstream undefinedStream;
+  undefinedStream << value;
+  DALI_TEST_EQUALS( undefinedStream.str(), "undefined type", TEST_LOCATION );
+  END_TEST;
+}
+
+int UtcDaliPropertyValueInlineTypesDoNotAllocateP(void)
+{
+  {
+    ScopedHeapUsage heapUsage;
+    Property::Value boolean( true );
+    Property::Value integer( 10 );
+    Property::Value floatingPoint( 1.5f );
+    Property::Value vector2( Vector2( 1.0f, 2.0f ) );
+    Property::Value vector3( Vector3( 1.0f, 2.0f, 3.0f ) );
+    Property::Value vector4( Vector4( 1.0f, 2.0f, 3.0f, 4.0f ) );
+    Property::Value rect( Rect<int>( 1, 2, 3, 4 ) );
+    Property::Value rotation( Quaternion( Radian( 1.0f ), Vector3::ZAXIS ) );
+    Property::Value angleAxis( AngleAxis( Radian( 1.0f ), Vector3::XAXIS ) );
+
+    Property::Value copy( vector4 );
+    copy = rect;
+    copy = rotation;
+    copy = boolean;
+
+    // Measure while the values are still alive
+    const size_t growth = heapUsage.GetGrowth();
+    DALI_TEST_EQUALS( growth, static_cast< size_t >( 0u ), TEST_LOCATION );
+    DALI_TEST_EQUALS( copy.Get<bool>(), true, TEST_LOCATION );
+    DALI_TEST_EQUALS( vector3.Get<Vector3>(), Vector3( 1.0f, 2.0f, 3.0f ), TEST_LOCATION );
+  }
+
+  // Larger types are still allocated; use a string too large for the allocator to reuse a cached chunk
+  {
+    ScopedHeapUsage heapUsage;
+    Property::Value string( std::string( 4096u, 'a' ) );
+    const size_t growth = heapUsage.GetGrowth();
+    DALI_TEST_CHECK( growth >= 4096u );
+  }
+  END_TEST;
+}
+
+int UtcDaliPropertyValueMoveConstructorP(void)
+{
+#ifdef _CPP11
+  Property::Value vector( Vector3( 1.0f, 2.0f, 3.0f ) );
+  Property::Value movedVector( std::move( vector ) );
+  DALI_TEST_EQUALS( movedVector.Get<Vector3>(), Vector3( 1.0f, 2.0f, 3.0f ), TEST_LOCATION );
+  DALI_TEST_EQUALS( vector.GetType(), Property::NONE, TEST_LOCATION );
+
+  Property::Map map;
+  map.Insert( "key", 1 );
+  Property::Value mapValue( map );
+  const Property::Map* mapPointer = mapValue.GetMap();
+
+  // The map is handed over rather than copied
+  Property::Value movedMap( std::move( mapValue ) );
+  DALI_TEST_CHECK( movedMap.GetMap() == mapPointer );
+  DALI_TEST_CHECK( mapValue.GetMap() == NULL );
+  DALI_TEST_EQUALS( mapValue.GetType(), Property::NONE, TEST_LOCATION );
+#else
+  tet_infoline( "Move semantics need C++11" );
+  DALI_TEST_CHECK( true );
+#endif
+  END_TEST;
+}
+
+int UtcDaliPropertyValueMoveAssignmentOperatorP(void)
+{
+#ifdef _CPP11
+  Property::Value value( std::string( "old" ) );
+  Property::Value string( std::string( 4096u, 'a' ) );
+
+  {
+    // The string is handed over rather than copied
+    ScopedHeapUsage heapUsage;
+    value = std::move( string );
+    DALI_TEST_EQUALS( heapUsage.GetGrowth(), static_cast< size_t >( 0u ), TEST_LOCATION );
+  }
+  DALI_TEST_EQUALS( value.Get<std::string>(), std::string( 4096u, 'a' ), TEST_LOCATION );
+  DALI_TEST_EQUALS( string.GetType(), Property::NONE, TEST_LOCATION );
+
+  value = Property::Value( 5 );
+  DALI_TEST_EQUALS( value.Get<int>(), 5, TEST_LOCATION );
+#else
+  tet_infoline( "Move semantics need C++11" );
+  DALI_TEST_CHECK( true );
+#endif
+  END_TEST;
+}
+
+int UtcDaliPropertyValueBenchmark(void)
+{
+  const int count = IsBenchmarkEnabled() ? 100000 : 1000;
+  const int measuredCount = 1000;
+  float sum = 0.0f;
+
+  double start = GetTimeMilliseconds();
+  for( int i = 0; i < count; ++i )
+  {
+    Property::Value integer( i );
+    Property::Value floatingPoint( static_cast<float>( i ) );
+    Property::Value vector( Vector4( 1.0f, 2.0f, 3.0f, static_cast<float>( i ) ) );
+    Property::Value copy( vector );
+    copy = floatingPoint;
+    sum += copy.Get<float>() + vector.Get<Vector4>().w + static_cast<float>( integer.Get<int>() );
+  }
+  const double valueTime = GetTimeMilliseconds() - start;
+
+  start = GetTimeMilliseconds();
+  for( int i = 0; i < count / 10; ++i )
+  {
+    Property::Map map;
+    FillMap( map, i );
+    sum += static_cast<float>( map.Count() );
+  }
+  const double mapTime = GetTimeMilliseconds() - start;
+
+  // Measure the heap used by many values and maps kept alive together, so that the allocator cannot serve them
+  // from the freed chunks it caches, which mallinfo() counts as in use
+  std::vector< Property::Value > values;
+  values.reserve( measuredCount * 4 );
+  std::vector< Property::Map > maps( measuredCount );
+  size_t valueHeapGrowth = 0u;
+  size_t mapHeapGrowth = 0u;
+  {
+    ScopedHeapUsage heapUsage;
+    for( int i = 0; i < measuredCount; ++i )
+    {
+      values.push_back( Property::Value( i ) );
+      values.push_back( Property::Value( static_cast<float>( i ) ) );
+      values.push_back( Property::Value( Vector4( 1.0f, 2.0f, 3.0f, static_cast<float>( i ) ) ) );
+      values.push_back( values.back() );
+      values.back() = values[ values.size() - 3u ];
+    }
+    valueHeapGrowth = heapUsage.GetGrowth();
+  }
+  {
+    ScopedHeapUsage heapUsage;
+    for( int i = 0; i < measuredCount; ++i )
+    {
+      FillMap( maps[i], i );
+    }
+    mapHeapGrowth = heapUsage.GetGrowth();
+  }
+
+  tet_printf( "%d x 4 inline values: %.3f ms, %.1f bytes of heap per 4 values\n", count, valueTime, static_cast<double>( valueHeapGrowth ) / measuredCount );
+  tet_printf( "%d maps of 5 values: %.3f ms, %.1f bytes of heap per map (checksum %f)\n", count / 10, mapTime, static_cast<double>( mapHeapGrowth ) / measuredCount, sum );
+
+  DALI_TEST_EQUALS( valueHeapGrowth, static_cast< size_t >( 0u ), TEST_LOCATION );
+  DALI_TEST_CHECK( mapHeapGrowth > 0u );
+  END_TEST;
+}
@@ -20,7 +20,9 @@
 
 #include <dali/public-api/dali-core.h>
 #include <dali/devel-api/images/texture-set-image.h>
+#include <algorithm>
 #include <cstdio>
+#include <cstring>
 #include <string>
 
 // INTERNAL INCLUDES
@@ -76,6 +78,176 @@ void TestConstraintNoBlue( Vector4& current, const PropertyInputContainer& input
   current.b = 0.0f;
 }
 
+/**
+ * Renders a frame each time it is called, for timing with TimeRepeatedMilliseconds()
+ */
+struct RenderFrame
+{
+  RenderFrame( TestApplication& application )
+  : mApplication( application )
+  {
+  }
+
+  void operator()( unsigned int frame )
+  {
+    mApplication.SendNotification();
+    mApplication.Render( 16 );
+  }
+
+  TestApplication& mApplication;
+};
+
+/**
+ * Adds actors which each have their own renderer, sharing the geometry and shader
+ */
+void AddActorsForInstancing( unsigned int count, Geometry& geometry, Shader& shader )
+{
+  for( unsigned int i = 0; i < count; ++i )
+  {
+    Renderer renderer = Renderer::New( geometry, shader );
+    Actor actor = Actor::New();
+    actor.AddRenderer( renderer );
+    actor.SetSize( 100.0f, 100.0f );
+    actor.SetPosition( 10.0f * i, 0.0f );
+    Stage::GetCurrent().Add( actor );
+  }
+}
+
+/**
+ * Retrieves the number of render items reused by the latest update frame
+ */
+unsigned int GetRenderItemsReused( TestApplication& application )
+{
+  Dali::Vector< Integration::FrameStatistics > frames;
+  application.GetCore().GetFrameStatistics( frames );
+
+  unsigned int reused = 0u;
+  for( Dali::Vector< Integration::FrameStatistics >::ConstIterator iter = frames.Begin(); iter != frames.End(); ++iter )
+  {
+    if( iter->thread == Integration::FrameStatistics::UPDATE_THREAD )
+    {
+      reused = iter->renderItemsReused;
+    }
+  }
+  return reused;
+}
+
+/**
+ * The attributes which order the renderers of a 2D layer, after the clipping
+ */
+struct SortedAttributes
+{
+  int depthIndex;
+  unsigned int shader;
+  unsigned int textureSet;
+  unsigned int geometry;
+};
+
+/**
+ * Adds renderers to an actor which often have the same depth index, shader, texture set and geometry as each other.
+ * Each renderer has a "uRendererIndex" uniform, one more than its index, so that the order they are drawn in can be found from the uniform trace.
+ * @param[in] actor The actor to add the renderers to
+ * @param[in] count The number of renderers to add
+ * @param[in] shaders Two shaders
+ * @param[in] textureSets Three texture sets
+ * @param[in] geometries Two geometries
+ * @param[in,out] attributes The attributes of the added renderers are appended, their index is the renderer index
+ */
+void AddRenderersWithTies( Actor& actor, unsigned int count, Shader* shaders, TextureSet* textureSets, Geometry* geometries, std::vector< SortedAttributes >& attributes )
+{
+  for( unsigned int i = 0u; i < count; ++i )
+  {
+    // Shuffle the attributes, so that the renderers are not added in their sorted order
+    const unsigned int shuffled = ( i * 73u ) % count;
+    SortedAttributes rendererAttributes;
+    rendererAttributes.depthIndex = static_cast< int >( shuffled % 3u ) - 1;
+    rendererAttributes.shader = ( shuffled / 3u ) % 2u;
+    rendererAttributes.textureSet = ( shuffled / 6u ) % 3u;
+    rendererAttributes.geometry = ( shuffled / 18u ) % 2u;
+
+    Renderer renderer = Renderer::New( geometries[ rendererAttributes.geometry ], shaders[ rendererAttributes.shader ] );
+    renderer.SetTextures( textureSets[ rendererAttributes.textureSet ] );
+    renderer.SetProperty( Renderer::Property::DEPTH_INDEX, rendererAttributes.depthIndex );
+    // The index is counted from one, as a uniform is not set when it already has its value and the cached values start at zero
+    renderer.RegisterProperty( "uRendererIndex", static_cast< float >( attributes.size() + 1u ) );
+    actor.AddRenderer( renderer );
+
+    attributes.push_back( rendererAttributes );
+  }
+}
+
+/**
+ * Retrieves the order in which renderers were drawn from the trace of their "uRendererIndex" uniform
+ * @param[in] trace The uniform trace of a frame
+ * @param[in] rendererCount The number of renderers
+ * @return The renderer indices in the order they were drawn
+ */
+std::vector< unsigned int > GetDrawOrder( TraceCallStack& trace, unsigned int rendererCount )
+{
+  std::vector< std::pair< int, unsigned int > > draws;
+  for( unsigned int i = 0u; i < rendererCount; ++i )
+  {
+    std::stringstream params;
+    params << static_cast< float >( i + 1u );
+    draws.push_back( std::make_pair( trace.FindIndexFromMethodAndParams( "uRendererIndex", params.str() ), i ) );
+  }
+  std::sort( draws.begin(), draws.end() );
+
+  std::vector< unsigned int > order;
+  for( unsigned int i = 0u; i < rendererCount; ++i )
+  {
+    order.push_back( draws[i].second );
+  }
+  return order;
+}
+
+/**
+ * Checks that each value of a sequence only occurs in one run of neighbouring elements
+ * @param[in] values The sequence
+ * @return True if every value is in a single run
+ */
+bool IsGroupedInRuns( const std::vector< unsigned int >& values )
+{
+  std::vector< unsigned int > finished;
+  for( unsigned int i = 1u; i < values.size(); ++i )
+  {
+    if( values[i] != values[i - 1u] )
+    {
+      if( std::find( finished.begin(), finished.end(), values[i] ) != finished.end() )
+      {
+        return false;
+      }
+      finished.push_back( values[i - 1u] );
+    }
+  }
+  return true;
+}
+
+/**
+ * Moves an actor and renders a frame each time it is called, so that every render item is recalculated and sorted
+ */
+struct MoveAndRenderFrame
+{
+  MoveAndRenderFrame( TestApplication& application, Actor& actor )
+  : mApplication( application ),
+    mActor( actor ),
+    mMoveCount( 0u )
+  {
+  }
+
+  void operator()( unsigned int frame )
+  {
+    ++mMoveCount;
+    mActor.SetPosition( static_cast< float >( mMoveCount ), 0.0f );
+    mApplication.SendNotification();
+    mApplication.Render( 16 );
+  }
+
+  TestApplication& mApplication;
+  Actor& mActor;
+  unsigned int mMoveCount;
+};
+
 } // unnamed namespace
 
 void renderer_test_startup(void)
@@ -1647,6 +1819,510 @@ int UtcDaliRendererRenderOrder2DLayerMultipleRenderers(void)
   END_TEST;
 }
 
+int UtcDaliRendererRenderOrder2DLayerManyRenderers(void)
+{
+  TestApplication application;
+  tet_infoline("Test the rendering order in a 2D layer is correct when it has many renderers");
+
+  /*
+   * Adds 200 renderers to an actor, alternating between two shaders.
+   * The depth indices are a permutation of [-100, 100), so the renderers must be drawn in the order of their depth index
+   */
+  const unsigned int rendererCount = 200u;
+  Shader shaders[2] = { Shader::New( "VertexSource", "FragmentSource" ), Shader::New( "VertexSource2", "FragmentSource2" ) };
+  Geometry geometry = CreateQuadGeometry();
+
+  Actor actor = Actor::New();
+  actor.SetAnchorPoint( AnchorPoint::CENTER );
+  actor.SetParentOrigin( AnchorPoint::CENTER );
+  actor.SetSize( 1, 1 );
+  Stage::GetCurrent().Add( actor );
+
+  std::vector< int > depthIndices;
+  for( unsigned int i = 0u; i < rendererCount; ++i )
+  {
+    Texture texture = Texture::New( TextureType::TEXTURE_2D, Pixel::RGBA8888, 4u, 4u );
+    TextureSet textureSet = TextureSet::New();
+    textureSet.SetTexture( 0u, texture );
+
+    Renderer renderer = Renderer::New( geometry, shaders[ i % 2u ] );
+    renderer.SetTextures( textureSet );
+    depthIndices.push_back( static_cast<int>( ( i * 73u ) % rendererCount ) - 100 );
+    renderer.SetProperty( Renderer::Property::DEPTH_INDEX, depthIndices.back() );
+    actor.AddRenderer( renderer );
+  }
+
+  application.SendNotification();
+  application.Render(0);
+
+  TestGlAbstraction& gl = application.GetGlAbstraction();
+  gl.EnableTextureCallTrace(true);
+  application.SendNotification();
+  application.Render(0);
+
+  // The texture of the i-th renderer has the id i + 1
+  std::vector< int > textureBindIndex( rendererCount );
+  for( unsigned int i = 0u; i < rendererCount; ++i )
+  {
+    std::stringstream params;
+    params << GL_TEXTURE_2D << ", " << i + 1u;
+    textureBindIndex[ depthIndices[i] + 100 ] = gl.GetTextureTrace().FindIndexFromMethodAndParams( "BindTexture", params.str() );
+  }
+
+  for( unsigned int depth = 1u; depth < rendererCount; ++depth )
+  {
+    DALI_TEST_GREATER( textureBindIndex[ depth ], textureBindIndex[ depth - 1u ], TEST_LOCATION );
+  }
+
+  END_TEST;
+}
+
+int UtcDaliRendererRenderOrder2DLayerManyRenderersWithTies(void)
+{
+  TestApplication application;
+  tet_infoline("Test the rendering order in a 2D layer with many renderers, which often have the same depth index, shader, texture set and geometry");
+
+  /*
+   * Adds 200 renderers to an actor, with three depth indices, two shaders, three texture sets and two geometries.
+   * The items are sorted by key in the first frame. In a later frame all of the items are reused, and they are only kept
+   * in their order if the comparitors agree with it, so both frames must draw the renderers in the same order.
+   */
+  const unsigned int rendererCount = 200u;
+  Shader shaders[2] = { Shader::New( "VertexSource", "FragmentSource" ), Shader::New( "VertexSource2", "FragmentSource2" ) };
+  Geometry geometries[2] = { CreateQuadGeometry(), CreateQuadGeometry() };
+  TextureSet textureSets[3];
+  for( unsigned int i = 0u; i < 3u; ++i )
+  {
+    textureSets[i] = TextureSet::New();
+    textureSets[i].SetTexture( 0u, Texture::New( TextureType::TEXTURE_2D, Pixel::RGBA8888, 4u, 4u ) );
+  }
+
+  Actor actor = Actor::New();
+  actor.SetAnchorPoint( AnchorPoint::CENTER );
+  actor.SetParentOrigin( AnchorPoint::CENTER );
+  actor.SetSize( 1, 1 );
+  Property::Index frameIndex = actor.RegisterProperty( "uFrame", 0.0f );
+  Stage::GetCurrent().Add( actor );
+
+  std::vector< SortedAttributes > attributes;
+  AddRenderersWithTies( actor, rendererCount, shaders, textureSets, geometries, attributes );
+
+  application.GetCore().EnablePerformanceMonitor( true );
+  TestGlAbstraction& gl = application.GetGlAbstraction();
+  gl.EnableSetUniformCallTrace( true );
+
+  // The renderers are only ready to be sorted once the render thread has set them up in the first frame.
+  // The actor is then moved, so that all of its items are recalculated and sorted by key.
+  application.SendNotification();
+  application.Render(0);
+  actor.SetPosition( 1.0f, 0.0f );
+  gl.ResetSetUniformCallStack();
+  application.SendNotification();
+  application.Render(0);
+
+  DALI_TEST_EQUALS( GetRenderItemsReused( application ), 0u, TEST_LOCATION );
+  const std::vector< unsigned int > keyOrder = GetDrawOrder( gl.GetSetUniformTrace(), rendererCount );
+
+  // The renderers are drawn in the order of their depth index. Those at the same depth index are grouped by shader,
+  // then by texture set, then by geometry. Those which are the same in all of these are drawn in the order they were added.
+  std::vector< unsigned int > groups[3];
+  for( unsigned int i = 0u; i < rendererCount; ++i )
+  {
+    const SortedAttributes& drawn = attributes[ keyOrder[i] ];
+    groups[0].push_back( ( drawn.depthIndex + 1 ) * 2 + drawn.shader );
+    groups[1].push_back( groups[0].back() * 3u + drawn.textureSet );
+    groups[2].push_back( groups[1].back() * 2u + drawn.geometry );
+
+    if( i > 0u )
+    {
+      const SortedAttributes& previous = attributes[ keyOrder[i - 1u] ];
+      DALI_TEST_CHECK( previous.depthIndex <= drawn.depthIndex );
+      if( groups[2][i] == groups[2][i - 1u] )
+      {
+        DALI_TEST_GREATER( keyOrder[i], keyOrder[i - 1u], TEST_LOCATION );
+      }
+    }
+  }
+  for( unsigned int i = 0u; i < 3u; ++i )
+  {
+    DALI_TEST_CHECK( IsGroupedInRuns( groups[i] ) );
+  }
+
+  // Update without moving the actor until all of its items are reused
+  for( unsigned int frame = 1u; frame < 3u; ++frame )
+  {
+    actor.SetProperty( frameIndex, static_cast< float >( frame ) );
+    gl.ResetSetUniformCallStack();
+    application.SendNotification();
+    application.Render(0);
+  }
+
+  DALI_TEST_EQUALS( GetRenderItemsReused( application ), rendererCount, TEST_LOCATION );
+  const std::vector< unsigned int > comparitorOrder = GetDrawOrder( gl.GetSetUniformTrace(), rendererCount );
+  DALI_TEST_CHECK( keyOrder == comparitorOrder );
+
+  END_TEST;
+}
+
+int UtcDaliRendererRenderOrder2DLayerManyRenderersWithClipping(void)
+{
+  TestApplication application;
+  tet_infoline("Test the rendering order in a 2D layer with many renderers and clipping actors");
+
+  /*
+   * Two clipping actors each have a renderer, and a child with 100 renderers which often have the same depth index, shader,
+   * texture set and geometry. The items of each clipping actor are drawn together, and the order of the key sort in the
+   * first frame must be the same as the order of the comparitors once all of the items are reused.
+   */
+  const unsigned int childRendererCount = 100u;
+  Shader shaders[2] = { Shader::New( "VertexSource", "FragmentSource" ), Shader::New( "VertexSource2", "FragmentSource2" ) };
+  Geometry geometries[2] = { CreateQuadGeometry(), CreateQuadGeometry() };
+  TextureSet textureSets[3];
+  for( unsigned int i = 0u; i < 3u; ++i )
+  {
+    textureSets[i] = TextureSet::New();
+    textureSets[i].SetTexture( 0u, Texture::New( TextureType::TEXTURE_2D, Pixel::RGBA8888, 4u, 4u ) );
+  }
+
+  Actor root = Actor::New();
+  root.SetAnchorPoint( AnchorPoint::CENTER );
+  root.SetParentOrigin( AnchorPoint::CENTER );
+  root.SetSize( 100, 100 );
+  Property::Index frameIndex = root.RegisterProperty( "uFrame", 0.0f );
+  Stage::GetCurrent().Add( root );
+
+  std::vector< SortedAttributes > attributes;
+  std::vector< unsigned int > clippingGroups;
+  for( unsigned int i = 0u; i < 2u; ++i )
+  {
+    Actor clippingActor = Actor::New();
+    clippingActor.SetAnchorPoint( AnchorPoint::CENTER );
+    clippingActor.SetParentOrigin( AnchorPoint::CENTER );
+    clippingActor.SetSize( 50, 50 );
+    clippingActor.SetProperty( Actor::Property::CLIPPING_MODE, ClippingMode::CLIP_CHILDREN );
+    root.Add( clippingActor );
+
+    Actor child = Actor::New();
+    child.SetAnchorPoint( AnchorPoint::CENTER );
+    child.SetParentOrigin( AnchorPoint::CENTER );
+    child.SetSize( 50, 50 );
+    clippingActor.Add( child );
+
+    AddRenderersWithTies( clippingActor, 1u, shaders, textureSets, geometries, attributes );
+    AddRenderersWithTies( child, childRendererCount, shaders, textureSets, geometries, attributes );
+    clippingGroups.resize( attributes.size(), i );
+  }
+  const unsigned int rendererCount = attributes.size();
+
+  application.GetCore().EnablePerformanceMonitor( true );
+  TestGlAbstraction& gl = application.GetGlAbstraction();
+  gl.EnableSetUniformCallTrace( true );
+
+  // The renderers are only ready to be sorted once the render thread has set them up in the first frame.
+  // The actor is then moved, so that all of its items are recalculated and sorted by key.
+  application.SendNotification();
+  application.Render(0);
+  root.SetPosition( 1.0f, 0.0f );
+  gl.ResetSetUniformCallStack();
+  application.SendNotification();
+  application.Render(0);
+
+  DALI_TEST_EQUALS( GetRenderItemsReused( application ), 0u, TEST_LOCATION );
+  const std::vector< unsigned int > keyOrder = GetDrawOrder( gl.GetSetUniformTrace(), rendererCount );
+
+  std::vector< unsigned int > drawnGroups;
+  for( unsigned int i = 0u; i < rendererCount; ++i )
+  {
+    drawnGroups.push_back( clippingGroups[ keyOrder[i] ] );
+  }
+  DALI_TEST_CHECK( IsGroupedInRuns( drawnGroups ) );
+
+  // Update without moving the actors until all of their items are reused
+  for( unsigned int frame = 1u; frame < 3u; ++frame )
+  {
+    root.SetProperty( frameIndex, static_cast< float >( frame ) );
+    gl.ResetSetUniformCallStack();
+    application.SendNotification();
+    application.Render(0);
+  }
+
+  DALI_TEST_EQUALS( GetRenderItemsReused( application ), rendererCount, TEST_LOCATION );
+  const std::vector< unsigned int > comparitorOrder = GetDrawOrder( gl.GetSetUniformTrace(), rendererCount );
+  DALI_TEST_CHECK( keyOrder == comparitorOrder );
+
+  END_TEST;
+}
+
+int UtcDaliRendererSortBenchmark(void)
+{
+  TestApplication application;
+  tet_infoline( "Measure preparing the render instructions of a 2D layer, sorted by key, and of a 3D layer, sorted with the comparitors" );
+
+  const unsigned int rendererCount = IsBenchmarkEnabled() ? 10000u : 200u;
+  const unsigned int frameCount = IsBenchmarkEnabled() ? 20u : 2u;
+
+  Shader shaders[2] = { Shader::New( "VertexSource", "FragmentSource" ), Shader::New( "VertexSource2", "FragmentSource2" ) };
+  Geometry geometries[2] = { CreateQuadGeometry(), CreateQuadGeometry() };
+  TextureSet textureSets[3];
+  for( unsigned int i = 0u; i < 3u; ++i )
+  {
+    textureSets[i] = TextureSet::New();
+    textureSets[i].SetTexture( 0u, Texture::New( TextureType::TEXTURE_2D, Pixel::RGBA8888, 4u, 4u ) );
+  }
+
+  Actor actor = Actor::New();
+  actor.SetAnchorPoint( AnchorPoint::CENTER );
+  actor.SetParentOrigin( AnchorPoint::CENTER );
+  actor.SetSize( 1, 1 );
+  Stage::GetCurrent().Add( actor );
+
+  std::vector< SortedAttributes > attributes;
+  AddRenderersWithTies( actor, rendererCount, shaders, textureSets, geometries, attributes );
+
+  application.GetCore().EnablePerformanceMonitor( true );
+  MoveAndRenderFrame moveAndRenderFrame( application, actor );
+  const Dali::Layer::Behavior behaviors[2] = { Dali::Layer::LAYER_2D, Dali::Layer::LAYER_3D };
+  for( unsigned int i = 0u; i < 2u; ++i )
+  {
+    Stage::GetCurrent().GetRootLayer().SetBehavior( behaviors[i] );
+
+    // The first frames build the render items; their statistics are discarded
+    Dali::Vector< Integration::FrameStatistics > frames;
+    application.SendNotification();
+    application.Render( 0 );
+    application.GetCore().GetFrameStatistics( frames );
+
+    // The actor moves in every frame, so none of the items are reused and they are all sorted
+    const double frameTime = TimeRepeatedMilliseconds( moveAndRenderFrame, frameCount );
+
+    frames.Clear();
+    application.GetCore().GetFrameStatistics( frames );
+    double processRenderTasksTime = 0.0;
+    unsigned int updateFrameCount = 0u;
+    for( Dali::Vector< Integration::FrameStatistics >::ConstIterator iter = frames.Begin(); iter != frames.End(); ++iter )
+    {
+      if( iter->thread == Integration::FrameStatistics::UPDATE_THREAD )
+      {
+        DALI_TEST_EQUALS( iter->renderItemsReused, 0u, TEST_LOCATION );
+        processRenderTasksTime += iter->processRenderTasksTime;
+        ++updateFrameCount;
+      }
+    }
+    DALI_TEST_EQUALS( updateFrameCount, frameCount, TEST_LOCATION );
+
+    tet_printf( "%s layer, %u renderers: %.3f ms per frame, %.3f ms preparing the render instructions\n",
+                i == 0u ? "2D" : "3D", rendererCount, frameTime, processRenderTasksTime / updateFrameCount );
+  }
+
+  END_TEST;
+}
+
+int UtcDaliRendererRenderOrderReusedRenderItems(void)
+{
+  TestApplication application;
+  tet_infoline("Test the rendering order is correct when the render items of static actors are reused");
+
+  /*
+   * Three static actors, with renderers at depth indices 0, 2 and 4, are rendered for a few frames so that their items are reused.
+   * A fourth actor is then added at depth index 3, and the depth index of the first renderer is changed to 5.
+   * Expected rendering order: renderer1 - renderer3 - renderer2 - renderer0
+   */
+  Shader shader = Shader::New( "VertexSource", "FragmentSource" );
+  Geometry geometry = CreateQuadGeometry();
+
+  Renderer renderers[4];
+  Actor actors[4];
+  const int depthIndices[4] = { 0, 2, 4, 3 };
+  for( unsigned int i = 0u; i < 4u; ++i )
+  {
+    TextureSet textureSet = TextureSet::New();
+    textureSet.SetTexture( 0u, Texture::New( TextureType::TEXTURE_2D, Pixel::RGBA8888, 4u, 4u ) );
+
+    renderers[i] = Renderer::New( geometry, shader );
+    renderers[i].SetTextures( textureSet );
+    renderers[i].SetProperty( Renderer::Property::DEPTH_INDEX, depthIndices[i] );
+
+    actors[i] = Actor::New();
+    actors[i].SetAnchorPoint( AnchorPoint::CENTER );
+    actors[i].SetParentOrigin( AnchorPoint::CENTER );
+    actors[i].SetSize( 1, 1 );
+    actors[i].AddRenderer( renderers[i] );
+  }
+
+  for( unsigned int i = 0u; i < 3u; ++i )
+  {
+    Stage::GetCurrent().Add( actors[i] );
+  }
+
+  for( unsigned int frame = 0u; frame < 4u; ++frame )
+  {
+    application.SendNotification();
+    application.Render(0);
+  }
+
+  Stage::GetCurrent().Add( actors[3] );
+  renderers[0].SetProperty( Renderer::Property::DEPTH_INDEX, 5 );
+
+  application.GetCore().EnablePerformanceMonitor( true );
+  TestGlAbstraction& gl = application.GetGlAbstraction();
+  for( unsigned int frame = 0u; frame < 3u; ++frame )
+  {
+    gl.EnableTextureCallTrace(true);
+    application.SendNotification();
+    application.Render(0);
+
+    // The items of the three static actors are reused. The transform of the added actor is recalculated
+    // in the two frames after it is added, so its item is only reused from the third frame
+    DALI_TEST_EQUALS( GetRenderItemsReused( application ), frame < 2u ? 3u : 4u, TEST_LOCATION );
+
+    // The texture of the i-th renderer has the id i + 1
+    int textureBindIndex[4];
+    for( unsigned int i = 0u; i < 4u; ++i )
+    {
+      std::stringstream params;
+      params << GL_TEXTURE_2D << ", " << i + 1u;
+      textureBindIndex[i] = gl.GetTextureTrace().FindIndexFromMethodAndParams( "BindTexture", params.str() );
+    }
+
+    DALI_TEST_GREATER( textureBindIndex[3], textureBindIndex[1], TEST_LOCATION );
+    DALI_TEST_GREATER( textureBindIndex[2], textureBindIndex[3], TEST_LOCATION );
+    DALI_TEST_GREATER( textureBindIndex[0], textureBindIndex[2], TEST_LOCATION );
+
+    gl.GetTextureTrace().Reset();
+  }
+
+  END_TEST;
+}
+
+int UtcDaliRendererRenderOrderReusedRenderItems3DLayer(void)
+{
+  TestApplication application;
+  tet_infoline("Test the rendering order is correct when the render items of static actors in a 3D layer are reused");
+
+  /*
+   * Three static, transparent actors in a 3D layer, with renderers at depth indices 0, 2 and 4, are rendered for a few frames so
+   * that their items are reused. A fourth actor is then added at depth index 3, and the depth index of the first renderer is changed to 5.
+   * The actors are at the same Z, so the depth indices order them.
+   * Expected rendering order: renderer1 - renderer3 - renderer2 - renderer0, as the items with larger Z values, less the depth index, are drawn first
+   */
+  Stage::GetCurrent().GetRootLayer().SetBehavior( Layer::LAYER_3D );
+
+  Shader shader = Shader::New( "VertexSource", "FragmentSource" );
+  Geometry geometry = CreateQuadGeometry();
+
+  Renderer renderers[4];
+  Actor actors[4];
+  const int depthIndices[4] = { 0, 2, 4, 3 };
+  for( unsigned int i = 0u; i < 4u; ++i )
+  {
+    TextureSet textureSet = TextureSet::New();
+    textureSet.SetTexture( 0u, Texture::New( TextureType::TEXTURE_2D, Pixel::RGBA8888, 4u, 4u ) );
+
+    renderers[i] = Renderer::New( geometry, shader );
+    renderers[i].SetTextures( textureSet );
+    renderers[i].SetProperty( Renderer::Property::DEPTH_INDEX, depthIndices[i] );
+    renderers[i].SetProperty( Renderer::Property::BLEND_MODE, BlendMode::ON );
+
+    actors[i] = Actor::New();
+    actors[i].SetAnchorPoint( AnchorPoint::CENTER );
+    actors[i].SetParentOrigin( AnchorPoint::CENTER );
+    actors[i].SetSize( 1, 1 );
+    actors[i].AddRenderer( renderers[i] );
+  }
+
+  for( unsigned int i = 0u; i < 3u; ++i )
+  {
+    Stage::GetCurrent().Add( actors[i] );
+  }
+
+  for( unsigned int frame = 0u; frame < 4u; ++frame )
+  {
+    application.SendNotification();
+    application.Render(0);
+  }
+
+  Stage::GetCurrent().Add( actors[3] );
+  renderers[0].SetProperty( Renderer::Property::DEPTH_INDEX, 5 );
+
+  application.GetCore().EnablePerformanceMonitor( true );
+  TestGlAbstraction& gl = application.GetGlAbstraction();
+  for( unsigned int frame = 0u; frame < 3u; ++frame )
+  {
+    gl.EnableTextureCallTrace(true);
+    application.SendNotification();
+    application.Render(0);
+
+    DALI_TEST_EQUALS( GetRenderItemsReused( application ), frame < 2u ? 3u : 4u, TEST_LOCATION );
+
+    // The texture of the i-th renderer has the id i + 1
+    int textureBindIndex[4];
+    for( unsigned int i = 0u; i < 4u; ++i )
+    {
+      std::stringstream params;
+      params << GL_TEXTURE_2D << ", " << i + 1u;
+      textureBindIndex[i] = gl.GetTextureTrace().FindIndexFromMethodAndParams( "BindTexture", params.str() );
+    }
+
+    DALI_TEST_GREATER( textureBindIndex[3], textureBindIndex[1], TEST_LOCATION );
+    DALI_TEST_GREATER( textureBindIndex[2], textureBindIndex[3], TEST_LOCATION );
+    DALI_TEST_GREATER( textureBindIndex[0], textureBindIndex[2], TEST_LOCATION );
+
+    gl.GetTextureTrace().Reset();
+  }
+
+  END_TEST;
+}
+
+int UtcDaliRendererReusedRenderItemsMovedActor(void)
+{
+  TestApplication application;
+  tet_infoline("Test the render items of actors which move in an otherwise static layer are recalculated");
+
+  Geometry geometry = CreateQuadGeometry();
+  Shader staticShader = Shader::New( "VertexSource", "FragmentSource" );
+  Shader movingShader = Shader::New( "VertexSource2", "FragmentSource2" );
+
+  Actor staticActor = Actor::New();
+  staticActor.SetSize( 100, 100 );
+  Renderer staticRenderer = Renderer::New( geometry, staticShader );
+  staticActor.AddRenderer( staticRenderer );
+  Stage::GetCurrent().Add( staticActor );
+
+  Actor movingActor = Actor::New();
+  movingActor.SetSize( 100, 100 );
+  Renderer movingRenderer = Renderer::New( geometry, movingShader );
+  movingActor.AddRenderer( movingRenderer );
+  Stage::GetCurrent().Add( movingActor );
+
+  for( unsigned int frame = 0u; frame < 4u; ++frame )
+  {
+    application.SendNotification();
+    application.Render(0);
+  }
+
+  application.GetCore().EnablePerformanceMonitor( true );
+  TestGlAbstraction& gl = application.GetGlAbstraction();
+  for( unsigned int frame = 0u; frame < 3u; ++frame )
+  {
+    movingActor.SetPosition( 10.0f * ( frame + 1u ), 20.0f, 0.0f );
+    application.SendNotification();
+    application.Render(0);
+
+    // Only the item of the static actor is reused
+    DALI_TEST_EQUALS( GetRenderItemsReused( application ), 1u, TEST_LOCATION );
+
+    Matrix movingModelMatrix( Matrix::IDENTITY );
+    movingModelMatrix.SetTranslation( movingActor.GetCurrentWorldPosition() );
+    DALI_TEST_CHECK( gl.CheckUniformValue( "uModelMatrix", movingModelMatrix ) );
+
+    Matrix staticModelMatrix( Matrix::IDENTITY );
+    staticModelMatrix.SetTranslation( staticActor.GetCurrentWorldPosition() );
+    DALI_TEST_CHECK( gl.CheckUniformValue( "uModelMatrix", staticModelMatrix ) );
+  }
+
+  END_TEST;
+}
+
 int UtcDaliRendererRenderOrder2DLayerSiblingOrder(void)
 {
   TestApplication application;
@@ -2786,3 +3462,266 @@ int UtcDaliRendererWrongNumberOfTextures(void)
 
   END_TEST;
 }
+
+int UtcDaliRendererInstancedDraw(void)
+{
+  TestApplication application;
+  tet_infoline( "Test that renderers sharing geometry and an instanced shader are drawn with one instanced draw call" );
+
+  UseOpenGlEs3( application );
+
+  Geometry geometry = CreateQuadGeometry();
+  Shader shader = Shader::New( "VertexSource", "FragmentSource", Shader::Hint::INSTANCED );
+  AddActorsForInstancing( 10u, geometry, shader );
+
+  TestGlAbstraction& gl = application.GetGlAbstraction();
+  TraceCallStack& drawTrace = gl.GetDrawTrace();
+  TraceCallStack& bufferTrace = gl.GetBufferTrace();
+  drawTrace.Enable( true );
+  bufferTrace.Enable( true );
+
+  application.SendNotification();
+  application.Render( 0 );
+
+  DALI_TEST_EQUALS( drawTrace.CountMethod( "DrawElements" ), 0, TEST_LOCATION );
+  DALI_TEST_EQUALS( drawTrace.CountMethod( "DrawElementsInstanced" ), 1, TEST_LOCATION );
+
+  std::string params;
+  DALI_TEST_CHECK( drawTrace.FindMethodAndGetParameters( "DrawElementsInstanced", params ) );
+  DALI_TEST_EQUALS( params.substr( params.rfind( ", " ) ), std::string( ", 10" ), TEST_LOCATION );
+
+  // The divisors are set for the instanced draw and reset afterwards
+  DALI_TEST_CHECK( bufferTrace.FindMethodAndParams( "VertexAttribDivisor", "0, 1" ) );
+  DALI_TEST_CHECK( bufferTrace.FindMethodAndParams( "VertexAttribDivisor", "0, 0" ) );
+
+  // The instances of the next frame respecify the buffer rather than overwriting the data being drawn
+  const size_t instanceDataSize = 10u * 24u * sizeof( float );
+  gl.ResetBufferDataCalls();
+  gl.ResetBufferSubDataCalls();
+  application.SendNotification();
+  application.Render( 16 );
+
+  const TestGlAbstraction::BufferDataCalls& bufferDataCalls = gl.GetBufferDataCalls();
+  const TestGlAbstraction::BufferSubDataCalls& bufferSubDataCalls = gl.GetBufferSubDataCalls();
+  DALI_TEST_CHECK( std::find( bufferDataCalls.begin(), bufferDataCalls.end(), instanceDataSize ) != bufferDataCalls.end() );
+  DALI_TEST_CHECK( std::find( bufferSubDataCalls.begin(), bufferSubDataCalls.end(), instanceDataSize ) == bufferSubDataCalls.end() );
+
+  END_TEST;
+}
+
+int UtcDaliRendererInstancedDrawNeedsHint(void)
+{
+  TestApplication application;
+  tet_infoline( "Test that renderers are drawn one by one without the instanced shader hint" );
+
+  UseOpenGlEs3( application );
+
+  Geometry geometry = CreateQuadGeometry();
+  Shader shader = Shader::New( "VertexSource", "FragmentSource" );
+  AddActorsForInstancing( 10u, geometry, shader );
+
+  TraceCallStack& drawTrace = application.GetGlAbstraction().GetDrawTrace();
+  drawTrace.Enable( true );
+
+  application.SendNotification();
+  application.Render( 0 );
+
+  DALI_TEST_EQUALS( drawTrace.CountMethod( "DrawElements" ), 10, TEST_LOCATION );
+  DALI_TEST_EQUALS( drawTrace.CountMethod( "DrawElementsInstanced" ), 0, TEST_LOCATION );
+
+  END_TEST;
+}
+
+int UtcDaliRendererInstancedDrawNotSupported(void)
+{
+  TestApplication application;
+  tet_infoline( "Test that renderers are drawn one by one when the context does not support instancing" );
+
+  Geometry geometry = CreateQuadGeometry();
+  Shader shader = Shader::New( "VertexSource", "FragmentSource", Shader::Hint::INSTANCED );
+  AddActorsForInstancing( 10u, geometry, shader );
+
+  TraceCallStack& drawTrace = application.GetGlAbstraction().GetDrawTrace();
+  drawTrace.Enable( true );
+
+  application.SendNotification();
+  application.Render( 0 );
+
+  DALI_TEST_EQUALS( drawTrace.CountMethod( "DrawElements" ), 10, TEST_LOCATION );
+  DALI_TEST_EQUALS( drawTrace.CountMethod( "DrawElementsInstanced" ), 0, TEST_LOCATION );
+
+  END_TEST;
+}
+
+int UtcDaliRendererInstancedDrawDifferentState(void)
+{
+  TestApplication application;
+  tet_infoline( "Test that a renderer with different render state is not drawn with the others" );
+
+  UseOpenGlEs3( application );
+
+  Geometry geometry = CreateQuadGeometry();
+  Shader shader = Shader::New( "VertexSource", "FragmentSource", Shader::Hint::INSTANCED );
+  AddActorsForInstancing( 10u, geometry, shader );
+
+  Actor actor = Stage::GetCurrent().GetRootLayer().GetChildAt( Stage::GetCurrent().GetRootLayer().GetChildCount() - 1u );
+  actor.GetRendererAt( 0 ).SetProperty( Renderer::Property::FACE_CULLING_MODE, FaceCullingMode::BACK );
+
+  TraceCallStack& drawTrace = application.GetGlAbstraction().GetDrawTrace();
+  drawTrace.Enable( true );
+
+  application.SendNotification();
+  application.Render( 0 );
+
+  // The other renderers may be drawn before and after it, depending on the sort order
+  DALI_TEST_EQUALS( drawTrace.CountMethod( "DrawElements" ), 1, TEST_LOCATION );
+  DALI_TEST_CHECK( drawTrace.CountMethod( "DrawElementsInstanced" ) >= 1 );
+  DALI_TEST_CHECK( drawTrace.CountMethod( "DrawElementsInstanced" ) <= 2 );
+
+  END_TEST;
+}
+
+int UtcDaliRendererUniformBlock(void)
+{
+  TestApplication application;
+  tet_infoline( "Test that properties which are members of a uniform block are written to the uniform buffer" );
+
+  TestGlAbstraction& gl = application.GetGlAbstraction();
+  gl.SetUniformBlock( "Material", 32 );
+  gl.AddUniformBlockMember( "uTint", 0 );
+  gl.AddUniformBlockMember( "uScale", 16 );
+
+  UseOpenGlEs3( application );
+
+  Geometry geometry = CreateQuadGeometry();
+  Shader shader = Shader::New( "VertexSource", "FragmentSource" );
+  Renderer renderer = Renderer::New( geometry, shader );
+  renderer.RegisterProperty( "uTint", Vector4( 0.1f, 0.2f, 0.3f, 0.4f ) );
+  Property::Index scaleIndex = renderer.RegisterProperty( "uScale", 2.0f );
+
+  Actor actor = Actor::New();
+  actor.AddRenderer( renderer );
+  actor.SetSize( 100.0f, 100.0f );
+  Stage::GetCurrent().Add( actor );
+
+  TraceCallStack& bufferTrace = gl.GetBufferTrace();
+  bufferTrace.Enable( true );
+
+  application.SendNotification();
+  application.Render( 0 );
+
+  DALI_TEST_CHECK( bufferTrace.FindMethod( "UniformBlockBinding" ) );
+  DALI_TEST_CHECK( bufferTrace.FindMethod( "BindBufferRange" ) );
+
+  const std::vector< unsigned char >& data = gl.GetLastUniformBufferData();
+  DALI_TEST_EQUALS( data.size(), 32u, TEST_LOCATION );
+
+  float values[8];
+  memcpy( values, &data[0], sizeof( values ) );
+  DALI_TEST_EQUALS( Vector4( values[0], values[1], values[2], values[3] ), Vector4( 0.1f, 0.2f, 0.3f, 0.4f ), TEST_LOCATION );
+  DALI_TEST_EQUALS( values[4], 2.0f, TEST_LOCATION );
+
+  // Members of a block are not set as default block uniforms
+  Vector4 tint;
+  DALI_TEST_CHECK( !gl.GetUniformValue< Vector4 >( "uTint", tint ) );
+
+  renderer.SetProperty( scaleIndex, 3.0f );
+  application.SendNotification();
+  application.Render( 0 );
+
+  memcpy( values, &gl.GetLastUniformBufferData()[0], sizeof( values ) );
+  DALI_TEST_EQUALS( values[4], 3.0f, TEST_LOCATION );
+
+  END_TEST;
+}
+
+int UtcDaliRendererUniformBlockNotSupported(void)
+{
+  TestApplication application;
+  tet_infoline( "Test that uniform buffers are not used when the context does not support them" );
+
+  TestGlAbstraction& gl = application.GetGlAbstraction();
+  gl.SetUniformBlock( "Material", 32 );
+  gl.AddUniformBlockMember( "uTint", 0 );
+
+  Geometry geometry = CreateQuadGeometry();
+  Shader shader = Shader::New( "VertexSource", "FragmentSource" );
+  Renderer renderer = Renderer::New( geometry, shader );
+  renderer.RegisterProperty( "uTint", Vector4( 0.1f, 0.2f, 0.3f, 0.4f ) );
+
+  Actor actor = Actor::New();
+  actor.AddRenderer( renderer );
+  actor.SetSize( 100.0f, 100.0f );
+  Stage::GetCurrent().Add( actor );
+
+  TraceCallStack& bufferTrace = gl.GetBufferTrace();
+  bufferTrace.Enable( true );
+
+  application.SendNotification();
+  application.Render( 0 );
+
+  DALI_TEST_CHECK( !bufferTrace.FindMethod( "BindBufferRange" ) );
+  DALI_TEST_CHECK( gl.GetLastUniformBufferData().empty() );
+
+  END_TEST;
+}
+
+int UtcDaliRendererUniformBenchmark(void)
+{
+  TestApplication application;
+  tet_infoline( "Measure rendering many renderers with 10 custom uniforms each" );
+
+  const unsigned int rendererCount = IsBenchmarkEnabled() ? 5000u : 100u;
+  const unsigned int uniformCount = 10u;
+  const unsigned int frameCount = IsBenchmarkEnabled() ? 10u : 2u;
+
+  std::vector< std::string > names;
+  for( unsigned int i = 0u; i < uniformCount; ++i )
+  {
+    char name[32];
+    snprintf( name, sizeof( name ), "uCustom%u", i );
+    names.push_back( name );
+  }
+
+  Geometry geometry = CreateQuadGeometry();
+  Shader shader = Shader::New( "VertexSource", "FragmentSource" );
+  std::vector< Renderer > renderers;
+  renderers.reserve( rendererCount );
+  for( unsigned int i = 0u; i < rendererCount; ++i )
+  {
+    Renderer renderer = Renderer::New( geometry, shader );
+    for( unsigned int j = 0u; j < uniformCount; ++j )
+    {
+      // Alternate the types, so that every draw sets uniforms of different types
+      if( j % 2u )
+      {
+        renderer.RegisterProperty( names[j], Vector4( static_cast<float>( i ), static_cast<float>( j ), 0.0f, 1.0f ) );
+      }
+      else
+      {
+        renderer.RegisterProperty( names[j], static_cast<float>( i + j ) );
+      }
+    }
+    renderers.push_back( renderer );
+
+    Actor actor = Actor::New();
+    actor.AddRenderer( renderer );
+    actor.SetSize( 1.0f, 1.0f );
+    Stage::GetCurrent().Add( actor );
+  }
+
+  TestGlAbstraction& gl = application.GetGlAbstraction();
+
+  // The first frame builds the uniform maps
+  application.SendNotification();
+  application.Render( 0 );
+
+  RenderFrame renderFrame( application );
+  const double frameTime = TimeRepeatedMilliseconds( renderFrame, frameCount );
+
+  tet_printf( "%u renderers x %u uniforms: %.3f ms per frame\n", rendererCount, uniformCount, frameTime );
+
+  float value = 0.0f;
+  DALI_TEST_CHECK( gl.GetUniformValue< float >( names[0].c_str(), value ) );
+  END_TEST;
+}
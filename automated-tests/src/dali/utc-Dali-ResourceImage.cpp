@@ -16,10 +16,14 @@
  */
 
 #include <iostream>
+#include <sstream>
 #include <algorithm>
+#include <vector>
 #include <stdlib.h>
 #include <dali/public-api/dali-core.h>
+#include <dali/devel-api/images/resource-image-devel.h>
 #include <dali-test-suite-utils.h>
+#include <mesh-builder.h>
 
 using namespace Dali;
 
@@ -36,6 +40,17 @@ void utc_dali_resource_image_cleanup(void)
 namespace
 {
 const char* gTestImageFilename = "icon_wrt.png";
+
+/**
+ * Waits until the decode workers have loaded the given number of images, then delivers the images.
+ * The workers are stopped, which makes them finish the images they are loading first.
+ */
+void FinishLoading( TestApplication& application, unsigned int loadCount )
+{
+  application.GetPlatform().WaitForLoadCalls( loadCount );
+  application.GetCore().SetImageDecodeThreadCount( 0u );
+  application.SendNotification();
+}
 } // unnamed namespace
 
 
@@ -216,3 +231,211 @@ int UtcDaliResourceImageSignalLoadingFinished(void)
   DALI_TEST_CHECK( SignalLoadFlag == true );
   END_TEST;
 }
+
+int UtcDaliResourceImageLoadAsynchronously(void)
+{
+  TestApplication application;
+  application.GetCore().SetImageDecodeThreadCount( 1u );
+
+  tet_infoline("UtcDaliResourceImageLoadAsynchronously - the image is decoded by a worker and delivered by ProcessEvents()");
+
+  SignalLoadFlag = false;
+
+  PrepareResourceImage( application, 100u, 100u, Pixel::RGBA8888 );
+  ResourceImage image = ResourceImage::New(gTestImageFilename);
+  image.LoadingFinishedSignal().Connect( SignalLoadHandler );
+
+  // The size is known before the image has been decoded
+  DALI_TEST_CHECK( image.GetLoadingState() == ResourceLoading );
+  DALI_TEST_EQUALS( image.GetWidth(), 100u, TEST_LOCATION );
+  DALI_TEST_EQUALS( image.GetHeight(), 100u, TEST_LOCATION );
+
+  FinishLoading( application, 1u );
+
+  DALI_TEST_CHECK( SignalLoadFlag == true );
+  DALI_TEST_CHECK( image.GetLoadingState() == ResourceLoadingSucceeded );
+  DALI_TEST_EQUALS( image.GetWidth(), 100u, TEST_LOCATION );
+  DALI_TEST_EQUALS( image.GetHeight(), 100u, TEST_LOCATION );
+  END_TEST;
+}
+
+int UtcDaliResourceImageLoadAsynchronouslyFailed(void)
+{
+  TestApplication application;
+  application.GetCore().SetImageDecodeThreadCount( 1u );
+
+  tet_infoline("UtcDaliResourceImageLoadAsynchronouslyFailed");
+
+  SignalLoadFlag = false;
+
+  ResourceImage image = ResourceImage::New(gTestImageFilename);
+  image.LoadingFinishedSignal().Connect( SignalLoadHandler );
+  DALI_TEST_CHECK( image.GetLoadingState() == ResourceLoading );
+
+  FinishLoading( application, 1u );
+
+  DALI_TEST_CHECK( SignalLoadFlag == true );
+  DALI_TEST_CHECK( image.GetLoadingState() == ResourceLoadingFailed );
+  END_TEST;
+}
+
+int UtcDaliResourceImageLoadAsynchronouslyTextureSet(void)
+{
+  TestApplication application;
+  application.GetCore().SetImageDecodeThreadCount( 1u );
+
+  tet_infoline("UtcDaliResourceImageLoadAsynchronouslyTextureSet - a texture set made before decoding shows the decoded image");
+
+  // The decoded image is larger than the size expected when the image is created
+  PrepareResourceImage( application, 100u, 100u, Pixel::RGB888 );
+  TestPlatformAbstraction& platform = application.GetPlatform();
+  platform.SetClosestImageSize( Vector2( 50.0f, 50.0f ) );
+
+  // Render the placeholder before the image is decoded
+  platform.SetLoadingBlocked( true );
+  ResourceImage image = ResourceImage::New(gTestImageFilename);
+
+  TextureSet textureSet = CreateTextureSet( image );
+  Geometry geometry = CreateQuadGeometry();
+  Shader shader = CreateShader();
+  Renderer renderer = Renderer::New( geometry, shader );
+  renderer.SetTextures( textureSet );
+  Actor actor = Actor::New();
+  actor.AddRenderer( renderer );
+  actor.SetSize( 100.0f, 100.0f );
+  Stage::GetCurrent().Add( actor );
+
+  TestGlAbstraction& gl = application.GetGlAbstraction();
+  TraceCallStack& textureTrace = gl.GetTextureTrace();
+  textureTrace.Enable( true );
+
+  application.SendNotification();
+  application.Render(16);
+  DALI_TEST_EQUALS( textureTrace.CountMethod( "GenTextures" ), 1, TEST_LOCATION );
+  const GLuint textureId = gl.GetBoundTextures().back();
+
+  platform.SetLoadingBlocked( false );
+  FinishLoading( application, 1u );
+  textureTrace.Reset();
+  application.SendNotification();
+  application.Render(16);
+
+  // The decoded image is uploaded to the texture used by the texture set, rather than to a new texture
+  DALI_TEST_CHECK( image.GetLoadingState() == ResourceLoadingSucceeded );
+  DALI_TEST_EQUALS( textureTrace.CountMethod( "GenTextures" ), 0, TEST_LOCATION );
+  std::stringstream out;
+  out << GL_TEXTURE_2D << ", " << 0u << ", " << 100u << ", " << 100u;
+  DALI_TEST_CHECK( textureTrace.FindMethodAndParams( "TexImage2D", out.str() ) );
+  DALI_TEST_EQUALS( gl.GetBoundTextures().back(), textureId, TEST_LOCATION );
+  END_TEST;
+}
+
+int UtcDaliResourceImageDecodePriority(void)
+{
+  TestApplication application;
+  application.GetCore().SetImageDecodeThreadCount( 1u );
+
+  tet_infoline("UtcDaliResourceImageDecodePriority - images are decoded in order of priority, then in the order requested");
+
+  TestPlatformAbstraction& platform = application.GetPlatform();
+
+  // Keep the worker busy with the first image whilst the others are requested
+  platform.SetLoadingBlocked( true );
+  ResourceImage first = ResourceImage::New( "first.png" );
+  platform.WaitForLoadCalls( 1u );
+
+  ResourceImage low = ResourceImage::New( "low.png" );
+  DevelResourceImage::SetDecodePriority( low, 1 );
+  ResourceImage high = ResourceImage::New( "high.png" );
+  DevelResourceImage::SetDecodePriority( high, 3 );
+  ResourceImage medium = ResourceImage::New( "medium.png" );
+  DevelResourceImage::SetDecodePriority( medium, 2 );
+  ResourceImage highLater = ResourceImage::New( "high-later.png" );
+  DevelResourceImage::SetDecodePriority( highLater, 3 );
+
+  platform.SetLoadingBlocked( false );
+  FinishLoading( application, 5u );
+
+  TraceCallStack& trace = platform.GetTrace();
+  const int firstIndex = trace.FindIndexFromMethodAndParams( "LoadResourceSynchronously", "first.png" );
+  const int highIndex = trace.FindIndexFromMethodAndParams( "LoadResourceSynchronously", "high.png" );
+  const int highLaterIndex = trace.FindIndexFromMethodAndParams( "LoadResourceSynchronously", "high-later.png" );
+  const int mediumIndex = trace.FindIndexFromMethodAndParams( "LoadResourceSynchronously", "medium.png" );
+  const int lowIndex = trace.FindIndexFromMethodAndParams( "LoadResourceSynchronously", "low.png" );
+
+  DALI_TEST_CHECK( firstIndex >= 0 );
+  DALI_TEST_CHECK( firstIndex < highIndex );
+  DALI_TEST_CHECK( highIndex < highLaterIndex );
+  DALI_TEST_CHECK( highLaterIndex < mediumIndex );
+  DALI_TEST_CHECK( mediumIndex < lowIndex );
+  END_TEST;
+}
+
+int UtcDaliResourceImageCancelLoading(void)
+{
+  TestApplication application;
+  application.GetCore().SetImageDecodeThreadCount( 1u );
+
+  tet_infoline("UtcDaliResourceImageCancelLoading - the signal is not emitted for a cancelled image");
+
+  SignalLoadFlag = false;
+
+  PrepareResourceImage( application, 100u, 100u, Pixel::RGBA8888 );
+  TestPlatformAbstraction& platform = application.GetPlatform();
+
+  // Cancel the image whilst the worker is loading it
+  platform.SetLoadingBlocked( true );
+  ResourceImage image = ResourceImage::New(gTestImageFilename);
+  image.LoadingFinishedSignal().Connect( SignalLoadHandler );
+  platform.WaitForLoadCalls( 1u );
+
+  DevelResourceImage::CancelLoading( image );
+  DALI_TEST_CHECK( image.GetLoadingState() == ResourceLoadingFailed );
+
+  platform.SetLoadingBlocked( false );
+  FinishLoading( application, 1u );
+  application.Render(16);
+  DALI_TEST_CHECK( SignalLoadFlag == false );
+  DALI_TEST_CHECK( image.GetLoadingState() == ResourceLoadingFailed );
+
+  // Reloading the image requests it again
+  application.GetCore().SetImageDecodeThreadCount( 1u );
+  image.Reload();
+  DALI_TEST_CHECK( image.GetLoadingState() == ResourceLoading );
+  FinishLoading( application, 2u );
+
+  DALI_TEST_CHECK( SignalLoadFlag == true );
+  DALI_TEST_CHECK( image.GetLoadingState() == ResourceLoadingSucceeded );
+  END_TEST;
+}
+
+int UtcDaliResourceImageDestroyedWhilstLoading(void)
+{
+  TestApplication application;
+  application.GetCore().SetImageDecodeThreadCount( 2u );
+
+  tet_infoline("UtcDaliResourceImageDestroyedWhilstLoading - destroying images cancels their loading");
+
+  PrepareResourceImage( application, 100u, 100u, Pixel::RGBA8888 );
+  TestPlatformAbstraction& platform = application.GetPlatform();
+
+  // Both workers are loading an image when the images are destroyed, and the rest are waiting
+  platform.SetLoadingBlocked( true );
+  {
+    std::vector< ResourceImage > images;
+    for( unsigned int i = 0u; i < 10u; ++i )
+    {
+      images.push_back( ResourceImage::New(gTestImageFilename) );
+      DevelResourceImage::SetDecodePriority( images.back(), i );
+    }
+    platform.WaitForLoadCalls( 2u );
+  }
+
+  platform.SetLoadingBlocked( false );
+  FinishLoading( application, 2u );
+  application.Render(16);
+
+  // The waiting images were never loaded
+  DALI_TEST_EQUALS( platform.GetTrace().CountMethod( "LoadResourceSynchronously" ), 2, TEST_LOCATION );
+  END_TEST;
+}
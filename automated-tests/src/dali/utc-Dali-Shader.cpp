@@ -339,6 +339,13 @@ int UtcDaliShaderProgramProperty(void)
   hintGot = (*value.GetMap())["hints"].Get<std::string>();
   DALI_TEST_CHECK( hintGot == hintSet );
 
+  hintSet = "INSTANCED";
+  map["hints"] = hintSet;
+  shader.SetProperty( Shader::Property::PROGRAM, Property::Value(map) );
+  value = shader.GetProperty(Shader::Property::PROGRAM);
+  hintGot = (*value.GetMap())["hints"].Get<std::string>();
+  DALI_TEST_CHECK( hintGot == hintSet );
+
   hintSet = "OUTPUT_IS_TRANSPARENT";
   map["hints"] = hintSet;
   shader.SetProperty( Shader::Property::PROGRAM, Property::Value(map) );
@@ -362,3 +369,82 @@ int UtcDaliShaderProgramProperty(void)
 
   END_TEST;
 }
+
+int UtcDaliShaderParallelCompilationP(void)
+{
+  TestApplication application;
+  tet_infoline("Test that renderers are not drawn until their program has been compiled in parallel");
+
+  application.GetCore().EnableParallelShaderCompilation( true );
+
+  Geometry geometry = CreateQuadGeometry();
+  Shader shader = Shader::New( VertexSource, FragmentSource );
+  Renderer renderer = Renderer::New( geometry, shader );
+  Actor actor = Actor::New();
+  actor.AddRenderer( renderer );
+  actor.SetSize( 100.0f, 100.0f );
+  Stage::GetCurrent().Add( actor );
+
+  TraceCallStack& drawTrace = application.GetGlAbstraction().GetDrawTrace();
+  drawTrace.Enable( true );
+
+  application.SendNotification();
+  application.Render(0);
+
+  // The program has started compiling, so the renderer is skipped
+  DALI_TEST_EQUALS( drawTrace.CountMethod( "DrawElements" ), 0, TEST_LOCATION );
+  DALI_TEST_EQUALS( application.GetRenderCompilingProgramCount(), 1u, TEST_LOCATION );
+  DALI_TEST_CHECK( application.GetRenderNeedsUpdate() );
+
+  // Without GL_KHR_parallel_shader_compile the program is finished during the next frame
+  application.SendNotification();
+  application.Render(0);
+
+  DALI_TEST_EQUALS( drawTrace.CountMethod( "DrawElements" ), 1, TEST_LOCATION );
+  DALI_TEST_EQUALS( application.GetRenderCompilingProgramCount(), 0u, TEST_LOCATION );
+  DALI_TEST_CHECK( !application.GetRenderNeedsUpdate() );
+
+  END_TEST;
+}
+
+int UtcDaliShaderParallelCompilationCompletionStatusP(void)
+{
+  TestApplication application;
+  tet_infoline("Test that programs are finished once the driver reports their completion");
+
+  static GLubyte extensions[] = "GL_KHR_parallel_shader_compile";
+  application.GetGlAbstraction().SetGetStringResult( extensions );
+  application.GetCore().ContextDestroyed();
+  application.GetCore().ContextCreated();
+  application.GetCore().EnableParallelShaderCompilation( true );
+
+  Geometry geometry = CreateQuadGeometry();
+  Shader shader = Shader::New( VertexSource, FragmentSource );
+  Renderer renderer = Renderer::New( geometry, shader );
+  Actor actor = Actor::New();
+  actor.AddRenderer( renderer );
+  actor.SetSize( 100.0f, 100.0f );
+  Stage::GetCurrent().Add( actor );
+
+  TraceCallStack& drawTrace = application.GetGlAbstraction().GetDrawTrace();
+  drawTrace.Enable( true );
+  application.GetGlAbstraction().SetCompletionStatus( GL_FALSE );
+
+  application.SendNotification();
+  application.Render(0);
+  application.SendNotification();
+  application.Render(0);
+
+  // The driver is still compiling
+  DALI_TEST_EQUALS( drawTrace.CountMethod( "DrawElements" ), 0, TEST_LOCATION );
+  DALI_TEST_EQUALS( application.GetRenderCompilingProgramCount(), 1u, TEST_LOCATION );
+
+  application.GetGlAbstraction().SetCompletionStatus( GL_TRUE );
+  application.SendNotification();
+  application.Render(0);
+
+  DALI_TEST_EQUALS( drawTrace.CountMethod( "DrawElements" ), 1, TEST_LOCATION );
+  DALI_TEST_EQUALS( application.GetRenderCompilingProgramCount(), 0u, TEST_LOCATION );
+
+  END_TEST;
+}
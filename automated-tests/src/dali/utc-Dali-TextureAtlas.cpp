@@ -0,0 +1,250 @@
+/*
+ * Copyright (c) 2017 Samsung Electronics Co., Ltd.
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ * http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ *
+ */
+
+// EXTERNAL INCLUDES
+#include <stdlib.h>
+#include <dali/public-api/dali-core.h>
+#include <dali/devel-api/rendering/texture-atlas.h>
+
+// INTERNAL INCLUDES
+#include <dali-test-suite-utils.h>
+#include <mesh-builder.h>
+
+using namespace Dali;
+
+void utc_dali_texture_atlas_startup(void)
+{
+  test_return_value = TET_UNDEF;
+}
+
+void utc_dali_texture_atlas_cleanup(void)
+{
+  test_return_value = TET_PASS;
+}
+
+namespace
+{
+
+PixelData CreatePixelData( unsigned int width, unsigned int height, Pixel::Format format = Pixel::RGBA8888 )
+{
+  unsigned int bufferSize( width * height * Pixel::GetBytesPerPixel( format ) );
+  unsigned char* buffer = reinterpret_cast<unsigned char*>( malloc( bufferSize ) );
+  return PixelData::New( buffer, bufferSize, width, height, format, PixelData::FREE );
+}
+
+Renderer CreateRenderer()
+{
+  Geometry geometry = CreateQuadGeometry();
+  Shader shader = CreateShader();
+  return Renderer::New( geometry, shader );
+}
+
+} // unnamed namespace
+
+int UtcDaliTextureAtlasNew(void)
+{
+  TestApplication application;
+
+  TextureAtlas atlas = TextureAtlas::New( Pixel::RGBA8888, 64, 64 );
+  DALI_TEST_CHECK( atlas );
+  DALI_TEST_EQUALS( atlas.GetTexture().GetWidth(), 64u, TEST_LOCATION );
+  DALI_TEST_EQUALS( atlas.GetTexture().GetHeight(), 64u, TEST_LOCATION );
+  DALI_TEST_CHECK( atlas.GetTextureSet().GetTexture( 0u ) == atlas.GetTexture() );
+  END_TEST;
+}
+
+int UtcDaliTextureAtlasDownCast(void)
+{
+  TestApplication application;
+
+  TextureAtlas atlas = TextureAtlas::New( Pixel::RGBA8888, 64, 64 );
+  BaseHandle handle( atlas );
+  TextureAtlas atlas2 = TextureAtlas::DownCast( handle );
+  DALI_TEST_CHECK( atlas2 );
+  DALI_TEST_CHECK( atlas == atlas2 );
+
+  TextureAtlas atlas3 = TextureAtlas::DownCast( Handle::New() );
+  DALI_TEST_CHECK( !atlas3 );
+  END_TEST;
+}
+
+int UtcDaliTextureAtlasAddP(void)
+{
+  TestApplication application;
+
+  TextureAtlas atlas = TextureAtlas::New( Pixel::RGBA8888, 64, 64 );
+
+  TestGlAbstraction& gl = application.GetGlAbstraction();
+  TraceCallStack& callStack = gl.GetTextureTrace();
+  callStack.Enable( true );
+
+  unsigned int first = atlas.Add( CreatePixelData( 16, 16 ) );
+  unsigned int second = atlas.Add( CreatePixelData( 16, 8 ) );
+  DALI_TEST_CHECK( first != 0u );
+  DALI_TEST_CHECK( second != 0u );
+  DALI_TEST_CHECK( first != second );
+
+  // The regions are next to each other on the first shelf, with a texel of padding between them
+  DALI_TEST_EQUALS( atlas.GetTextureRect( first ), Vector4( 0.0f, 0.0f, 0.25f, 0.25f ), TEST_LOCATION );
+  DALI_TEST_EQUALS( atlas.GetTextureRect( second ), Vector4( 17.0f / 64.0f, 0.0f, 0.25f, 0.125f ), TEST_LOCATION );
+
+  application.SendNotification();
+  application.Render();
+
+  std::stringstream out;
+  out << GL_TEXTURE_2D << ", " << 0u << ", " << 17u << ", " << 0u << ", " << 16u << ", " << 8u;
+  DALI_TEST_CHECK( callStack.FindMethodAndParams( "TexSubImage2D", out.str() ) );
+
+  // The padding to the right of and below the second region is cleared
+  out.str( "" );
+  out << GL_TEXTURE_2D << ", " << 0u << ", " << 33u << ", " << 0u << ", " << 1u << ", " << 9u;
+  DALI_TEST_CHECK( callStack.FindMethodAndParams( "TexSubImage2D", out.str() ) );
+  out.str( "" );
+  out << GL_TEXTURE_2D << ", " << 0u << ", " << 17u << ", " << 8u << ", " << 16u << ", " << 1u;
+  DALI_TEST_CHECK( callStack.FindMethodAndParams( "TexSubImage2D", out.str() ) );
+  END_TEST;
+}
+
+int UtcDaliTextureAtlasAddN(void)
+{
+  TestApplication application;
+
+  TextureAtlas atlas = TextureAtlas::New( Pixel::RGBA8888, 32, 32 );
+
+  // Too large for the atlas
+  DALI_TEST_EQUALS( atlas.Add( CreatePixelData( 64, 8 ) ), 0u, TEST_LOCATION );
+
+  // Only one region fits, even after defragmenting
+  DALI_TEST_CHECK( atlas.Add( CreatePixelData( 24, 24 ) ) != 0u );
+  DALI_TEST_EQUALS( atlas.Add( CreatePixelData( 24, 24 ) ), 0u, TEST_LOCATION );
+
+  // Unknown regions are empty
+  DALI_TEST_EQUALS( atlas.GetTextureRect( 1000u ), Vector4::ZERO, TEST_LOCATION );
+  END_TEST;
+}
+
+int UtcDaliTextureAtlasAddWrongFormatN(void)
+{
+  TestApplication application;
+
+  TextureAtlas atlas = TextureAtlas::New( Pixel::RGBA8888, 32, 32 );
+
+  // Pixel data which the texture cannot take is not given a region
+  DALI_TEST_EQUALS( atlas.Add( CreatePixelData( 8, 8, Pixel::A8 ) ), 0u, TEST_LOCATION );
+
+  // The space is still free
+  unsigned int id = atlas.Add( CreatePixelData( 8, 8 ) );
+  DALI_TEST_CHECK( id != 0u );
+  DALI_TEST_EQUALS( atlas.GetTextureRect( id ), Vector4( 0.0f, 0.0f, 0.25f, 0.25f ), TEST_LOCATION );
+  END_TEST;
+}
+
+int UtcDaliTextureAtlasAssignP(void)
+{
+  TestApplication application;
+
+  TextureAtlas atlas = TextureAtlas::New( Pixel::RGBA8888, 64, 64 );
+  atlas.Add( CreatePixelData( 16, 16 ) );
+  unsigned int id = atlas.Add( CreatePixelData( 16, 16 ) );
+
+  Renderer renderer1 = CreateRenderer();
+  Renderer renderer2 = CreateRenderer();
+  DALI_TEST_CHECK( atlas.Assign( id, renderer1 ) );
+  DALI_TEST_CHECK( atlas.Assign( id, renderer2 ) );
+
+  // The renderers share the texture set, so they can be batched
+  DALI_TEST_CHECK( renderer1.GetTextures() == atlas.GetTextureSet() );
+  DALI_TEST_CHECK( renderer2.GetTextures() == atlas.GetTextureSet() );
+
+  Property::Index index = renderer1.GetPropertyIndex( "uAtlasRect" );
+  DALI_TEST_CHECK( index != Property::INVALID_INDEX );
+  DALI_TEST_EQUALS( renderer1.GetProperty< Vector4 >( index ), atlas.GetTextureRect( id ), TEST_LOCATION );
+
+  // Unknown regions cannot be assigned
+  DALI_TEST_CHECK( !atlas.Assign( 1000u, renderer1 ) );
+  END_TEST;
+}
+
+int UtcDaliTextureAtlasRemoveP(void)
+{
+  TestApplication application;
+
+  TextureAtlas atlas = TextureAtlas::New( Pixel::RGBA8888, 64, 64 );
+  unsigned int id = atlas.Add( CreatePixelData( 16, 16 ) );
+
+  Renderer renderer = CreateRenderer();
+  atlas.Assign( id, renderer );
+
+  // The region is kept whilst a renderer is assigned to it
+  atlas.Remove( id );
+  DALI_TEST_EQUALS( atlas.GetTextureRect( id ), Vector4( 0.0f, 0.0f, 0.25f, 0.25f ), TEST_LOCATION );
+  DALI_TEST_CHECK( !atlas.Assign( id, CreateRenderer() ) );
+
+  renderer.Reset();
+  DALI_TEST_EQUALS( atlas.GetTextureRect( id ), Vector4::ZERO, TEST_LOCATION );
+
+  // The space is reused
+  unsigned int newId = atlas.Add( CreatePixelData( 16, 16 ) );
+  DALI_TEST_EQUALS( atlas.GetTextureRect( newId ), Vector4( 0.0f, 0.0f, 0.25f, 0.25f ), TEST_LOCATION );
+  END_TEST;
+}
+
+int UtcDaliTextureAtlasDefragmentP(void)
+{
+  TestApplication application;
+
+  // Room for two rows of two regions
+  TextureAtlas atlas = TextureAtlas::New( Pixel::RGBA8888, 34, 34 );
+  unsigned int ids[4];
+  for( unsigned int i = 0; i < 4; ++i )
+  {
+    ids[i] = atlas.Add( CreatePixelData( 16, 16 ) );
+    DALI_TEST_CHECK( ids[i] != 0u );
+  }
+
+  Renderer renderer = CreateRenderer();
+  atlas.Assign( ids[1], renderer );
+  Property::Index index = renderer.GetPropertyIndex( "uAtlasRect" );
+  DALI_TEST_EQUALS( renderer.GetProperty< Vector4 >( index ).x, 17.0f / 34.0f, TEST_LOCATION );
+
+  // Leave a hole at the start of the first shelf, which does not fit the next region without defragmenting
+  atlas.Remove( ids[0] );
+  unsigned int id = atlas.Add( CreatePixelData( 16, 16 ) );
+  DALI_TEST_CHECK( id != 0u );
+
+  // The regions have been repacked into the hole, and the renderer follows its region
+  bool holeFilled = false;
+  for( unsigned int i = 1; i < 4; ++i )
+  {
+    holeFilled |= ( atlas.GetTextureRect( ids[i] ) == Vector4( 0.0f, 0.0f, 16.0f / 34.0f, 16.0f / 34.0f ) );
+  }
+  DALI_TEST_CHECK( holeFilled );
+
+  TestGlAbstraction& gl = application.GetGlAbstraction();
+  TraceCallStack& callStack = gl.GetTextureTrace();
+  callStack.Enable( true );
+  application.SendNotification();
+  application.Render();
+  DALI_TEST_EQUALS( renderer.GetProperty< Vector4 >( index ), atlas.GetTextureRect( ids[1] ), TEST_LOCATION );
+
+  // The padding of the region moved into the hole is cleared where it now lies
+  std::stringstream out;
+  out << GL_TEXTURE_2D << ", " << 0u << ", " << 16u << ", " << 0u << ", " << 1u << ", " << 17u;
+  DALI_TEST_CHECK( callStack.FindMethodAndParams( "TexSubImage2D", out.str() ) );
+  DALI_TEST_EQUALS( atlas.GetTextureRect( id ), Vector4( 17.0f / 34.0f, 17.0f / 34.0f, 16.0f / 34.0f, 16.0f / 34.0f ), TEST_LOCATION );
+  END_TEST;
+}
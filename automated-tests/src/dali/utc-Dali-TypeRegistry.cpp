@@ -16,6 +16,7 @@
  */
 
 #include <iostream>
+#include <sstream>
 #include <stdlib.h>
 #include <limits>
 #include <dali/public-api/dali-core.h>
@@ -1686,6 +1687,64 @@ int UtcDaliTypeRegistryChildPropertyRegistrationP(void)
   END_TEST;
 }
 
+int UtcDaliTypeRegistryChildPropertyManyP(void)
+{
+  TestApplication application;
+  tet_infoline( "Test that many child properties are found by index and by name when set repeatedly and reparented" );
+
+  const int count = 20;
+  const int firstIndex = CHILD_PROPERTY_REGISTRATION_START_INDEX + 100;
+
+  // The second parent registers the same names at other indices
+  for( int i = 0; i < count; ++i )
+  {
+    std::ostringstream name;
+    name << "manyChildProp" << i;
+    ChildPropertyRegistration( customType1, name.str(), firstIndex + i, Property::INTEGER );
+    ChildPropertyRegistration( namedActorType, name.str(), firstIndex + count + i, Property::INTEGER );
+  }
+
+  TypeRegistry typeRegistry = TypeRegistry::Get();
+  Actor parent = Actor::DownCast( typeRegistry.GetTypeInfo( typeid(MyTestCustomActor) ).CreateInstance() );
+  Actor parent2 = Actor::DownCast( typeRegistry.GetTypeInfo( "MyNamedActor" ).CreateInstance() );
+  DALI_TEST_CHECK( parent );
+  DALI_TEST_CHECK( parent2 );
+
+  Actor child = Actor::New();
+  parent.Add( child );
+
+  for( int repeat = 0; repeat < 3; ++repeat )
+  {
+    for( int i = 0; i < count; ++i )
+    {
+      child.SetProperty( firstIndex + i, i + repeat * 100 );
+    }
+    for( int i = 0; i < count; ++i )
+    {
+      std::ostringstream name;
+      name << "manyChildProp" << i;
+      DALI_TEST_EQUALS( child.GetProperty< int >( firstIndex + i ), i + repeat * 100, TEST_LOCATION );
+      DALI_TEST_EQUALS( child.GetPropertyIndex( name.str() ), firstIndex + i, TEST_LOCATION );
+      DALI_TEST_EQUALS( child.GetPropertyName( firstIndex + i ), name.str(), TEST_LOCATION );
+    }
+  }
+
+  // The child properties get the indices of the new parent
+  parent2.Add( child );
+  for( int i = 0; i < count; ++i )
+  {
+    std::ostringstream name;
+    name << "manyChildProp" << i;
+    DALI_TEST_EQUALS( child.GetPropertyIndex( name.str() ), firstIndex + count + i, TEST_LOCATION );
+    DALI_TEST_EQUALS( child.GetProperty< int >( firstIndex + count + i ), i + 200, TEST_LOCATION );
+
+    child.SetProperty( firstIndex + count + i, -i );
+    DALI_TEST_EQUALS( child.GetProperty< int >( firstIndex + count + i ), -i, TEST_LOCATION );
+  }
+
+  END_TEST;
+}
+
 int UtcDaliTypeRegistryChildPropertyRegistrationN(void)
 {
   TestApplication application;
@@ -2305,3 +2364,81 @@ int UtcDaliTypeInfoGetPropertyCountP2(void)
 
   END_TEST;
 }
+
+namespace
+{
+
+class HashedLookupBase : public Actor
+{
+};
+
+BaseHandle CreateHashedLookupActor()
+{
+  return Actor::New();
+}
+
+const int HASHED_LOOKUP_BASE_COUNT = 40;
+
+TypeRegistration hashedLookupBaseType( typeid(HashedLookupBase), typeid(Dali::Actor), CreateHashedLookupActor );
+TypeRegistration hashedLookupDerivedType( "HashedLookupDerived", typeid(HashedLookupBase), CreateHashedLookupActor );
+
+} // Anonymous namespace
+
+int UtcDaliTypeInfoPropertyLookupThroughBasesP(void)
+{
+  TestApplication application;
+  TypeRegistry typeRegistry = TypeRegistry::Get();
+
+  for( int i = 0; i < HASHED_LOOKUP_BASE_COUNT; ++i )
+  {
+    std::ostringstream name;
+    name << "baseProperty" << i;
+    PropertyRegistration( hashedLookupBaseType, name.str(), PROPERTY_REGISTRATION_START_INDEX + i, Property::BOOLEAN, &SetProperty, &GetProperty );
+  }
+  PropertyRegistration( hashedLookupBaseType, "shared", PROPERTY_REGISTRATION_START_INDEX + 100, Property::BOOLEAN, &SetProperty, &GetProperty );
+
+  // The derived type hides the base's property of the same name, and its first registration of a name wins
+  PropertyRegistration( hashedLookupDerivedType, "shared", PROPERTY_REGISTRATION_START_INDEX + 200, Property::INTEGER, &SetProperty, &GetProperty );
+  PropertyRegistration( hashedLookupDerivedType, "duplicate", PROPERTY_REGISTRATION_START_INDEX + 201, Property::FLOAT, &SetProperty, &GetProperty );
+  PropertyRegistration( hashedLookupDerivedType, "duplicate", PROPERTY_REGISTRATION_START_INDEX + 202, Property::FLOAT, &SetProperty, &GetProperty );
+
+  TypeInfo typeInfo = typeRegistry.GetTypeInfo( "HashedLookupDerived" );
+  DALI_TEST_CHECK( typeInfo );
+  DALI_TEST_EQUALS( typeInfo.GetPropertyCount(), static_cast<size_t>( HASHED_LOOKUP_BASE_COUNT + 4 ), TEST_LOCATION );
+
+  // The indices of the base come first, in registration order
+  Property::IndexContainer indices;
+  typeInfo.GetPropertyIndices( indices );
+  DALI_TEST_EQUALS( indices.Size(), static_cast<size_t>( HASHED_LOOKUP_BASE_COUNT + 4 ), TEST_LOCATION );
+  DALI_TEST_EQUALS( indices[0], static_cast<Property::Index>( PROPERTY_REGISTRATION_START_INDEX ), TEST_LOCATION );
+  DALI_TEST_EQUALS( indices[HASHED_LOOKUP_BASE_COUNT], PROPERTY_REGISTRATION_START_INDEX + 100, TEST_LOCATION );
+  DALI_TEST_EQUALS( indices[HASHED_LOOKUP_BASE_COUNT + 3], PROPERTY_REGISTRATION_START_INDEX + 202, TEST_LOCATION );
+
+  Actor actor = Actor::DownCast( typeInfo.CreateInstance() );
+  DALI_TEST_CHECK( actor );
+
+  for( int i = 0; i < HASHED_LOOKUP_BASE_COUNT; ++i )
+  {
+    std::ostringstream name;
+    name << "baseProperty" << i;
+    DALI_TEST_EQUALS( actor.GetPropertyIndex( name.str() ), PROPERTY_REGISTRATION_START_INDEX + i, TEST_LOCATION );
+    DALI_TEST_EQUALS( typeInfo.GetPropertyName( PROPERTY_REGISTRATION_START_INDEX + i ), name.str(), TEST_LOCATION );
+  }
+
+  DALI_TEST_EQUALS( actor.GetPropertyIndex( "shared" ), PROPERTY_REGISTRATION_START_INDEX + 200, TEST_LOCATION );
+  DALI_TEST_EQUALS( actor.GetPropertyType( PROPERTY_REGISTRATION_START_INDEX + 200 ), Property::INTEGER, TEST_LOCATION );
+  DALI_TEST_EQUALS( actor.GetPropertyType( PROPERTY_REGISTRATION_START_INDEX + 100 ), Property::BOOLEAN, TEST_LOCATION );
+  DALI_TEST_EQUALS( actor.GetPropertyIndex( "duplicate" ), PROPERTY_REGISTRATION_START_INDEX + 201, TEST_LOCATION );
+  DALI_TEST_EQUALS( actor.GetPropertyIndex( "unknown" ), Property::INVALID_INDEX, TEST_LOCATION );
+
+  // A property registered to the base after the lookup was first used is found through the derived type
+  PropertyRegistration( hashedLookupBaseType, "late", PROPERTY_REGISTRATION_START_INDEX + 300, Property::BOOLEAN, &SetProperty, &GetProperty );
+  DALI_TEST_EQUALS( actor.GetPropertyIndex( "late" ), PROPERTY_REGISTRATION_START_INDEX + 300, TEST_LOCATION );
+  DALI_TEST_EQUALS( typeInfo.GetPropertyCount(), static_cast<size_t>( HASHED_LOOKUP_BASE_COUNT + 5 ), TEST_LOCATION );
+
+  setPropertyCalled = false;
+  actor.SetProperty( PROPERTY_REGISTRATION_START_INDEX + 300, true );
+  DALI_TEST_CHECK( setPropertyCalled );
+
+  END_TEST;
+}
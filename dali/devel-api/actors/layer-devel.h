@@ -27,6 +27,28 @@ namespace Dali
 namespace DevelLayer
 {
 
+namespace Property
+{
+
+enum Type
+{
+  CLIPPING_ENABLE = Dali::Layer::Property::CLIPPING_ENABLE,
+  CLIPPING_BOX    = Dali::Layer::Property::CLIPPING_BOX,
+  BEHAVIOR        = Dali::Layer::Property::BEHAVIOR,
+
+  /**
+   * @brief Whether the renderers of the layer are culled a subtree at a time.
+   * @details Name "hierarchicalCulling", type Property::BOOLEAN.
+   * @note The initial value is false.
+   * @note When enabled, the renderers below an actor whose whole subtree lies outside the view frustum are culled
+   * without being checked one by one, which helps layers holding many off-screen actors, such as long scrolled lists.
+   * It only has an effect when the render task culls.
+   */
+  HIERARCHICAL_CULLING = BEHAVIOR + 1
+};
+
+} // namespace Property
+
   /**
    * @brief ACTOR_DEPTH_MULTIPLIER is used by the rendering sorting algorithm to decide which actors to render first.
    * @SINCE_1_0.0
@@ -0,0 +1,42 @@
+/*
+ * Copyright (c) 2017 Samsung Electronics Co., Ltd.
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ * http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ *
+ */
+
+// FILE HEADER
+#include <dali/devel-api/images/resource-image-devel.h>
+
+// INTERNAL INCLUDES
+#include <dali/internal/event/images/resource-image-impl.h>
+
+namespace Dali
+{
+
+namespace DevelResourceImage
+{
+
+void SetDecodePriority( ResourceImage& image, int priority )
+{
+  GetImplementation( image ).SetDecodePriority( priority );
+}
+
+void CancelLoading( ResourceImage& image )
+{
+  GetImplementation( image ).CancelLoading();
+}
+
+} // namespace DevelResourceImage
+
+} // namespace Dali
@@ -0,0 +1,57 @@
+#ifndef DALI_RESOURCE_IMAGE_DEVEL_H
+#define DALI_RESOURCE_IMAGE_DEVEL_H
+
+/*
+ * Copyright (c) 2017 Samsung Electronics Co., Ltd.
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ * http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ *
+ */
+
+// INTERNAL INCLUDES
+#include <dali/public-api/images/resource-image.h>
+
+namespace Dali
+{
+
+namespace DevelResourceImage
+{
+
+/**
+ * @brief Sets the priority with which the image is decoded.
+ *
+ * Only used when Core decodes images on worker threads. Images with a higher priority
+ * are decoded first; the default priority is zero.
+ *
+ * @param[in] image The image
+ * @param[in] priority The priority of the image
+ */
+DALI_IMPORT_API void SetDecodePriority( ResourceImage& image, int priority );
+
+/**
+ * @brief Cancels the loading of an image which is being decoded on a worker thread.
+ *
+ * This is meant for images which are no longer needed before they have been decoded,
+ * e.g. when the actor showing them has left the stage. The loading state becomes
+ * ResourceLoadingFailed and ResourceImage::LoadingFinishedSignal() is not emitted.
+ * ResourceImage::Reload() loads the image again. Destroying the image also cancels its loading.
+ *
+ * @param[in] image The image
+ */
+DALI_IMPORT_API void CancelLoading( ResourceImage& image );
+
+} // namespace DevelResourceImage
+
+} // namespace Dali
+
+#endif // DALI_RESOURCE_IMAGE_DEVEL_H
@@ -0,0 +1,73 @@
+#ifndef DALI_GEOMETRY_DEVEL_H
+#define DALI_GEOMETRY_DEVEL_H
+
+/*
+ * Copyright (c) 2017 Samsung Electronics Co., Ltd.
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ * http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ *
+ */
+
+// EXTERNAL INCLUDES
+#include <stdint.h> // uint32_t
+
+// INTERNAL INCLUDES
+#include <dali/public-api/common/dali-vector.h>
+#include <dali/public-api/rendering/geometry.h>
+
+namespace Dali
+{
+
+namespace DevelGeometry
+{
+
+/**
+ * @brief Sets 32 bit index data to be used as a source of indices for the geometry.
+ *
+ * Use this when the geometry has more vertices than can be addressed with 16 bit indices.
+ * If all the indices are within the 16 bit range they are stored as 16 bit indices.
+ * Otherwise drawing requires OpenGL ES 3.0 or the GL_OES_element_index_uint extension.
+ * To unset call Geometry::SetIndexBuffer() with a count of 0.
+ *
+ * @param[in] geometry The geometry to update
+ * @param[in] indices Array of indices
+ * @param[in] count Number of indices in the array
+ */
+DALI_IMPORT_API void SetIndexBuffer( Geometry& geometry, const uint32_t* indices, size_t count );
+
+/**
+ * @brief Sets the index data, taking the contents of the given vector.
+ *
+ * Unlike Geometry::SetIndexBuffer(), the indices are not copied. The vector is left empty.
+ *
+ * @param[in] geometry The geometry to update
+ * @param[in,out] indices The indices
+ */
+DALI_IMPORT_API void SetIndexBuffer( Geometry& geometry, Dali::Vector<unsigned short>& indices );
+
+/**
+ * @brief Sets 32 bit index data, taking the contents of the given vector.
+ *
+ * The indices are not copied, unless they all fit in 16 bits; they are then converted
+ * to 16 bit indices, as SetIndexBuffer( Geometry&, const uint32_t*, size_t ) does. The vector is left empty.
+ *
+ * @param[in] geometry The geometry to update
+ * @param[in,out] indices The indices
+ */
+DALI_IMPORT_API void SetIndexBuffer( Geometry& geometry, Dali::Vector<uint32_t>& indices );
+
+} // namespace DevelGeometry
+
+} // namespace Dali
+
+#endif // DALI_GEOMETRY_DEVEL_H
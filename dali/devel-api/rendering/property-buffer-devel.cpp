@@ -0,0 +1,54 @@
+/*
+ * Copyright (c) 2017 Samsung Electronics Co., Ltd.
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ * http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ *
+ */
+
+// FILE HEADER
+#include <dali/devel-api/rendering/property-buffer-devel.h>
+
+// INTERNAL INCLUDES
+#include <dali/internal/event/common/property-buffer-impl.h>
+
+namespace Dali
+{
+
+namespace DevelPropertyBuffer
+{
+
+PropertyBuffer New( Dali::Property::Map& bufferFormat, Usage::Type usage )
+{
+  Internal::PropertyBufferPtr propertyBuffer = Internal::PropertyBuffer::New( bufferFormat, usage );
+
+  return PropertyBuffer( propertyBuffer.Get() );
+}
+
+void SetData( PropertyBuffer& propertyBuffer, Dali::Vector<char>& data )
+{
+  GetImplementation( propertyBuffer ).SetData( data );
+}
+
+void SetDataRange( PropertyBuffer& propertyBuffer, const void* data, std::size_t firstElement, std::size_t count )
+{
+  GetImplementation( propertyBuffer ).SetDataRange( data, firstElement, count );
+}
+
+Usage::Type GetUsage( const PropertyBuffer& propertyBuffer )
+{
+  return GetImplementation( propertyBuffer ).GetUsage();
+}
+
+} // namespace DevelPropertyBuffer
+
+} // namespace Dali
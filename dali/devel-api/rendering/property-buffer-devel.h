@@ -0,0 +1,92 @@
+#ifndef DALI_PROPERTY_BUFFER_DEVEL_H
+#define DALI_PROPERTY_BUFFER_DEVEL_H
+
+/*
+ * Copyright (c) 2017 Samsung Electronics Co., Ltd.
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ * http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ *
+ */
+
+// INTERNAL INCLUDES
+#include <dali/public-api/common/dali-vector.h>
+#include <dali/public-api/rendering/property-buffer.h>
+
+namespace Dali
+{
+
+namespace DevelPropertyBuffer
+{
+
+/**
+ * @brief How often the data of a property buffer is expected to change.
+ */
+namespace Usage
+{
+
+enum Type
+{
+  STATIC,  ///< The data is set once, or rarely. This is the usage of PropertyBuffer::New()
+  DYNAMIC, ///< The data is updated often, in parts. Only the ranges set with SetDataRange() are uploaded
+  STREAM   ///< The data is replaced about every frame. The GPU buffer is respecified on every update, so that updating never waits for previous draw calls
+};
+
+} // namespace Usage
+
+/**
+ * @brief Creates a PropertyBuffer with the given usage.
+ *
+ * @param[in] bufferFormat Map of names and types that describes the components of the buffer
+ * @param[in] usage How often the data of the buffer is expected to change
+ * @return Handle to a newly allocated PropertyBuffer
+ */
+DALI_IMPORT_API PropertyBuffer New( Dali::Property::Map& bufferFormat, Usage::Type usage );
+
+/**
+ * @brief Sets the data of the buffer, taking the contents of the given vector.
+ *
+ * Unlike PropertyBuffer::SetData(), the data is not copied. The vector holds the
+ * elements laid out as described by the buffer format, and is left empty.
+ *
+ * @param[in] propertyBuffer The property buffer to update
+ * @param[in,out] data The bytes of the elements. Its size must be a multiple of the element size
+ */
+DALI_IMPORT_API void SetData( PropertyBuffer& propertyBuffer, Dali::Vector<char>& data );
+
+/**
+ * @brief Updates a range of elements of the buffer.
+ *
+ * The number of elements in the buffer does not change. Updates of a DYNAMIC buffer
+ * only upload the elements which changed since the previous frame.
+ *
+ * @pre PropertyBuffer::SetData() has been called and the range is within the size of the buffer
+ * @param[in] propertyBuffer The property buffer to update
+ * @param[in] data A pointer to the elements that will be copied to the buffer
+ * @param[in] firstElement The index of the first element to update
+ * @param[in] count The number of elements to update
+ */
+DALI_IMPORT_API void SetDataRange( PropertyBuffer& propertyBuffer, const void* data, std::size_t firstElement, std::size_t count );
+
+/**
+ * @brief Gets the usage of the buffer.
+ *
+ * @param[in] propertyBuffer The property buffer
+ * @return How often the data of the buffer is expected to change
+ */
+DALI_IMPORT_API Usage::Type GetUsage( const PropertyBuffer& propertyBuffer );
+
+} // namespace DevelPropertyBuffer
+
+} // namespace Dali
+
+#endif // DALI_PROPERTY_BUFFER_DEVEL_H
@@ -0,0 +1,100 @@
+/*
+ * Copyright (c) 2017 Samsung Electronics Co., Ltd.
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ * http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ *
+ */
+
+// CLASS HEADER
+#include <dali/devel-api/rendering/texture-atlas.h>
+
+// INTERNAL INCLUDES
+#include <dali/internal/event/images/pixel-data-impl.h>
+#include <dali/internal/event/rendering/renderer-impl.h>
+#include <dali/internal/event/rendering/texture-atlas-impl.h>
+
+namespace Dali
+{
+
+TextureAtlas TextureAtlas::New( Pixel::Format format, unsigned int width, unsigned int height )
+{
+  Internal::TextureAtlasPtr atlas = Internal::TextureAtlas::New( format, width, height );
+  return TextureAtlas( atlas.Get() );
+}
+
+TextureAtlas::TextureAtlas()
+{
+}
+
+TextureAtlas::~TextureAtlas()
+{
+}
+
+TextureAtlas::TextureAtlas( const TextureAtlas& handle )
+: BaseHandle( handle )
+{
+}
+
+TextureAtlas TextureAtlas::DownCast( BaseHandle handle )
+{
+  return TextureAtlas( dynamic_cast<Dali::Internal::TextureAtlas*>( handle.GetObjectPtr() ) );
+}
+
+TextureAtlas& TextureAtlas::operator=( const TextureAtlas& handle )
+{
+  BaseHandle::operator=( handle );
+  return *this;
+}
+
+unsigned int TextureAtlas::Add( PixelData pixelData )
+{
+  Internal::PixelData& internalPixelData = GetImplementation( pixelData );
+  return GetImplementation( *this ).Add( &internalPixelData );
+}
+
+void TextureAtlas::Remove( unsigned int id )
+{
+  GetImplementation( *this ).Remove( id );
+}
+
+Vector4 TextureAtlas::GetTextureRect( unsigned int id ) const
+{
+  return GetImplementation( *this ).GetTextureRect( id );
+}
+
+bool TextureAtlas::Assign( unsigned int id, Renderer renderer )
+{
+  return GetImplementation( *this ).Assign( id, GetImplementation( renderer ) );
+}
+
+void TextureAtlas::Defragment()
+{
+  GetImplementation( *this ).Defragment();
+}
+
+Texture TextureAtlas::GetTexture() const
+{
+  return Texture( GetImplementation( *this ).GetTexture() );
+}
+
+TextureSet TextureAtlas::GetTextureSet() const
+{
+  return TextureSet( GetImplementation( *this ).GetTextureSet() );
+}
+
+TextureAtlas::TextureAtlas( Internal::TextureAtlas* pointer )
+: BaseHandle( pointer )
+{
+}
+
+} // namespace Dali
@@ -0,0 +1,171 @@
+#ifndef DALI_TEXTURE_ATLAS_H
+#define DALI_TEXTURE_ATLAS_H
+
+/*
+ * Copyright (c) 2017 Samsung Electronics Co., Ltd.
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ * http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ *
+ */
+
+// INTERNAL INCLUDES
+#include <dali/public-api/images/pixel.h>
+#include <dali/public-api/images/pixel-data.h>
+#include <dali/public-api/math/vector4.h>
+#include <dali/public-api/object/base-handle.h>
+#include <dali/public-api/rendering/renderer.h>
+#include <dali/public-api/rendering/texture.h>
+#include <dali/public-api/rendering/texture-set.h>
+
+namespace Dali
+{
+
+namespace Internal DALI_INTERNAL
+{
+class TextureAtlas;
+}
+
+/**
+ * @brief TextureAtlas packs many small images into the regions of a single Texture.
+ *
+ * Renderers which draw from the same atlas share its TextureSet, so the textures are bound once
+ * and the renderers are sorted next to each other, where they would otherwise each need their own texture.
+ *
+ * A renderer assigned to a region has the "uAtlasRect" uniform, a Vector4 holding the x, y, width and height of
+ * the region in texture coordinates. Its shader should map the texture coordinates of the geometry into the region:
+ * @code
+ * vTexCoord = uAtlasRect.xy + aTexCoord * uAtlasRect.zw;
+ * @endcode
+ *
+ * A region is released once it has been removed and the renderers assigned to it have been destroyed or assigned
+ * elsewhere. The pixel data of each region is kept, so that the regions can be repacked when the atlas becomes fragmented.
+ */
+class DALI_IMPORT_API TextureAtlas : public BaseHandle
+{
+public:
+
+  /**
+   * @brief Creates a new TextureAtlas.
+   *
+   * @param[in] format The format of the texture, and of the pixel data added to the atlas
+   * @param[in] width The width of the texture
+   * @param[in] height The height of the texture
+   * @return A handle to a newly allocated TextureAtlas
+   */
+  static TextureAtlas New( Pixel::Format format, unsigned int width, unsigned int height );
+
+  /**
+   * @brief Default constructor, creates an empty handle
+   */
+  TextureAtlas();
+
+  /**
+   * @brief Destructor
+   */
+  ~TextureAtlas();
+
+  /**
+   * @brief Copy constructor, creates a new handle to the same object
+   *
+   * @param[in] handle Handle to an object
+   */
+  TextureAtlas( const TextureAtlas& handle );
+
+  /**
+   * @brief Downcasts to a TextureAtlas handle.
+   * If handle is not a TextureAtlas, the returned handle is left uninitialized.
+   *
+   * @param[in] handle Handle to an object
+   * @return TextureAtlas handle or an uninitialized handle
+   */
+  static TextureAtlas DownCast( BaseHandle handle );
+
+  /**
+   * @brief Assignment operator, changes this handle to point at the same object
+   *
+   * @param[in] handle Handle to an object
+   * @return Reference to the assigned object
+   */
+  TextureAtlas& operator=( const TextureAtlas& handle );
+
+  /**
+   * @brief Uploads the pixel data into a free region of the atlas.
+   *
+   * The atlas is defragmented if the region would not fit otherwise. The texel to the right of and below
+   * the region is cleared, so that linear filtering at the edges of the region does not sample other regions.
+   * @param[in] pixelData The pixel data, in the format of the atlas
+   * @return The identifier of the region, or zero if the pixel data does not fit or cannot be uploaded to the atlas
+   */
+  unsigned int Add( PixelData pixelData );
+
+  /**
+   * @brief Removes a region added by Add().
+   *
+   * The region is released once no renderer is assigned to it.
+   * @param[in] id The identifier of the region
+   */
+  void Remove( unsigned int id );
+
+  /**
+   * @brief Retrieves the area of a region in texture coordinates.
+   *
+   * @param[in] id The identifier of the region
+   * @return The x, y, width and height of the region, or zero if there is no such region
+   */
+  Vector4 GetTextureRect( unsigned int id ) const;
+
+  /**
+   * @brief Assigns a renderer to a region.
+   *
+   * The renderer is given the TextureSet of the atlas and the "uAtlasRect" uniform, which is kept
+   * up to date when the atlas is defragmented. The region is not released while the renderer is assigned to it.
+   * @param[in] id The identifier of the region
+   * @param[in] renderer The renderer
+   * @return True if the region exists
+   */
+  bool Assign( unsigned int id, Renderer renderer );
+
+  /**
+   * @brief Repacks the regions to make the free space of the atlas contiguous.
+   *
+   * The pixel data of the regions which move is uploaded again.
+   */
+  void Defragment();
+
+  /**
+   * @brief Retrieves the texture which holds the regions.
+   *
+   * @return The texture
+   */
+  Texture GetTexture() const;
+
+  /**
+   * @brief Retrieves the TextureSet given to the renderers assigned to regions.
+   *
+   * @return The texture set
+   */
+  TextureSet GetTextureSet() const;
+
+public:
+
+  /**
+   * @brief The constructor.
+   * @note  Not intended for application developers.
+   * @param[in] pointer A pointer to a newly allocated TextureAtlas
+   */
+  explicit DALI_INTERNAL TextureAtlas( Internal::TextureAtlas* pointer );
+};
+
+} // namespace Dali
+
+#endif // DALI_TEXTURE_ATLAS_H
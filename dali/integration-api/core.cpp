@@ -144,6 +144,36 @@ float Core::GetStereoBase() const
   return mImpl->GetStereoBase();
 }
 
+void Core::SetUpdateWorkerThreadCount( unsigned int count )
+{
+  mImpl->SetUpdateWorkerThreadCount( count );
+}
+
+void Core::SetImageDecodeThreadCount( unsigned int count )
+{
+  mImpl->SetImageDecodeThreadCount( count );
+}
+
+void Core::SetShaderBinaryCacheSize( unsigned int bytes )
+{
+  mImpl->SetShaderBinaryCacheSize( bytes );
+}
+
+void Core::EnableParallelShaderCompilation( bool enable )
+{
+  mImpl->EnableParallelShaderCompilation( enable );
+}
+
+void Core::EnablePerformanceMonitor( bool enable )
+{
+  mImpl->EnablePerformanceMonitor( enable );
+}
+
+void Core::GetFrameStatistics( Dali::Vector< FrameStatistics >& frames )
+{
+  mImpl->GetFrameStatistics( frames );
+}
+
 Core::Core()
 : mImpl( NULL )
 {
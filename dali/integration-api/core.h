@@ -20,6 +20,7 @@
 
 // EXTERNAL INCLUDES
 #include <dali/public-api/common/dali-common.h>
+#include <dali/public-api/common/dali-vector.h>
 #include <dali/public-api/common/view-mode.h>
 #include <dali/integration-api/context-notifier.h>
 #include <dali/integration-api/resource-policies.h>
@@ -57,7 +58,8 @@ enum Reasons
   STAGE_KEEP_RENDERING    = 1<<1, ///<  - Stage::KeepRendering() is being used
   ANIMATIONS_RUNNING      = 1<<2, ///< - Animations are ongoing
   MONITORING_PERFORMANCE  = 1<<3, ///< - The --enable-performance-monitor option is being used
-  RENDER_TASK_SYNC        = 1<<4  ///< - A render task is waiting for render sync
+  RENDER_TASK_SYNC        = 1<<4, ///< - A render task is waiting for render sync
+  IMAGE_DECODING          = 1<<5  ///< - Images are being decoded on worker threads
 };
 }
 
@@ -118,7 +120,8 @@ public:
    * Constructor
    */
   RenderStatus()
-  : needsUpdate(false)
+  : needsUpdate(false),
+    compilingProgramCount(0)
   {
   }
 
@@ -135,9 +138,77 @@ public:
    */
   bool NeedsUpdate() { return needsUpdate; }
 
+  /**
+   * Set the number of shader programs which are still compiling after rendering,
+   * see Core::EnableParallelShaderCompilation().
+   */
+  void SetCompilingProgramCount(unsigned int count) { compilingProgramCount = count; }
+
+  /**
+   * Query the number of shader programs still compiling following rendering of a frame.
+   * The renderers using them were not drawn; once the count returns to zero, every
+   * shader used so far is ready, e.g. to end a splash screen that warmed them up.
+   * @return The number of programs which are not ready to use.
+   */
+  unsigned int GetCompilingProgramCount() { return compilingProgramCount; }
+
 private:
 
   bool needsUpdate;
+  unsigned int compilingProgramCount;
+};
+
+/**
+ * The timings and counters of one frame of the update-thread or the render-thread,
+ * see Core::GetFrameStatistics(). Times are in milliseconds.
+ */
+struct FrameStatistics
+{
+  enum Thread
+  {
+    UPDATE_THREAD,
+    RENDER_THREAD
+  };
+
+  /**
+   * Constructor
+   */
+  FrameStatistics()
+  : thread( UPDATE_THREAD ),
+    frameNumber( 0u ),
+    startTime( 0.0 ),
+    frameTime( 0.0f ),
+    resetPropertiesTime( 0.0f ),
+    processMessagesTime( 0.0f ),
+    animateTime( 0.0f ),
+    applyConstraintsTime( 0.0f ),
+    updateNodesTime( 0.0f ),
+    prepareRenderablesTime( 0.0f ),
+    processRenderTasksTime( 0.0f ),
+    drawNodesTime( 0.0f ),
+    animatorsApplied( 0u ),
+    constraintsApplied( 0u ),
+    constraintsSkipped( 0u ),
+    renderItemsReused( 0u )
+  {
+  }
+
+  Thread thread;                ///< The thread which recorded the frame
+  unsigned int frameNumber;     ///< Counted by Core::Update(); a render frame has the number of the latest update
+  double startTime;             ///< Monotonic clock time at the start of the frame
+  float frameTime;              ///< Duration of Core::Update() or Core::Render()
+  float resetPropertiesTime;    ///< Update-thread: resetting double-buffered properties
+  float processMessagesTime;    ///< Update-thread: processing messages from the event-thread
+  float animateTime;            ///< Update-thread: applying animations
+  float applyConstraintsTime;   ///< Update-thread: applying constraints to custom objects, render-tasks and shaders
+  float updateNodesTime;        ///< Update-thread: updating the node hierarchy
+  float prepareRenderablesTime; ///< Update-thread: updating the renderers
+  float processRenderTasksTime; ///< Update-thread: preparing the render instructions
+  float drawNodesTime;          ///< Render-thread: executing the render instructions
+  unsigned int animatorsApplied;   ///< Update-thread: number of animators applied
+  unsigned int constraintsApplied; ///< Update-thread: number of constraints applied
+  unsigned int constraintsSkipped; ///< Update-thread: number of constraints skipped
+  unsigned int renderItemsReused;  ///< Update-thread: number of render items reused from the previous frame
 };
 
 /**
@@ -382,6 +453,72 @@ public:
    */
   float GetStereoBase() const;
 
+  // Threading
+
+  /**
+   * Set the number of worker threads used by the update-thread to parallelise the update,
+   * e.g. to compute the world transforms and update the nodes of large scenes. By default no worker threads are used.
+   * The results of the update are the same regardless of the number of worker threads.
+   * Multi-threading note: this method should be called from the main thread; it will take effect
+   * in the update following the next call to ProcessEvents().
+   * @param[in] count The number of worker threads; zero disables parallel updating
+   */
+  void SetUpdateWorkerThreadCount( unsigned int count );
+
+  /**
+   * Set the number of worker threads used to load and decode ResourceImages and EncodedBufferImages.
+   * By default no worker threads are used, and the images are loaded synchronously when they are created.
+   * With worker threads, the images are decoded in the background, uploaded to their textures
+   * and ResourceImage::LoadingFinishedSignal() is emitted during a later call to ProcessEvents().
+   * The PlatformAbstraction must then be able to load resources from several threads at once.
+   * Multi-threading note: this method should be called from the main thread.
+   * @param[in] count The number of worker threads; zero loads images synchronously
+   */
+  void SetImageDecodeThreadCount( unsigned int count );
+
+  // Shader binaries
+
+  /**
+   * Set the maximum total size of the program binaries kept on disk, 8MB by default.
+   * The least recently used binaries are evicted when compiling a program would exceed the size.
+   * The binaries are loaded and saved with PlatformAbstraction::LoadShaderBinaryFile() and SaveShaderBinaryFile(),
+   * which may be called from the main thread and from a background thread started by ContextCreated().
+   * Multi-threading note: this method should be called from the main thread.
+   * @param[in] bytes The maximum size of the binaries
+   */
+  void SetShaderBinaryCacheSize( unsigned int bytes );
+
+  /**
+   * Enable or disable parallel compilation of shader programs, disabled by default.
+   * When enabled, programs start compiling on the render thread as soon as their Shader is created,
+   * and renderers using a program are not drawn until the driver has finished compiling it, instead of
+   * blocking the frame. GL_KHR_parallel_shader_compile is used to poll for completion when available,
+   * otherwise the programs are finished during the next frame.
+   * RenderStatus::GetCompilingProgramCount() reports the number of programs which are not ready yet.
+   * Multi-threading note: this method should be called from the main thread.
+   * @param[in] enable True to compile programs in parallel
+   */
+  void EnableParallelShaderCompilation( bool enable );
+
+  // Performance monitoring
+
+  /**
+   * Enable or disable the recording of timings and counters for each frame of the update and render threads.
+   * Recording is disabled by default; when enabled it only adds a few clock reads per frame.
+   * Multi-threading note: this method can be called from any thread; it takes effect from the next frame of each thread.
+   * @param[in] enable True to start recording, false to stop
+   */
+  void EnablePerformanceMonitor( bool enable );
+
+  /**
+   * Retrieve the statistics of the frames recorded since the last call, oldest first; the update-thread frames
+   * are followed by the render-thread frames. Up to 128 frames are kept for each thread, after which new frames
+   * are dropped until this method is called.
+   * Multi-threading note: this method should be called from the main thread.
+   * @param[out] frames The frame statistics are appended to this vector
+   */
+  void GetFrameStatistics( Dali::Vector< FrameStatistics >& frames );
+
 private:
 
   /**
@@ -859,5 +859,11 @@
 #define GL_TEXTURE_EXTERNAL_OES                                 0x8D65
 #endif
 
+/* GL_KHR_parallel_shader_compile */
+#ifndef GL_COMPLETION_STATUS_KHR
+#define GL_MAX_SHADER_COMPILER_THREADS_KHR                      0x91B0
+#define GL_COMPLETION_STATUS_KHR                                0x91B1
+#endif
+
 
 #endif // __DALI_INTERNAL_GL_DEFINES_H__
@@ -0,0 +1,57 @@
+#ifndef __DALI_INTEGRATION_TRACE_H__
+#define __DALI_INTEGRATION_TRACE_H__
+
+/*
+ * Copyright (c) 2017 Samsung Electronics Co., Ltd.
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ * http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ *
+ */
+
+// EXTERNAL INCLUDES
+#include <iosfwd>
+
+// INTERNAL INCLUDES
+#include <dali/public-api/common/dali-common.h>
+
+namespace Dali
+{
+
+namespace Integration
+{
+
+namespace Trace
+{
+
+/**
+ * Writes the most recent update, render and event processing phases in the Chrome trace-event JSON format,
+ * which can be loaded into chrome://tracing or Perfetto.
+ *
+ * The phases are only recorded when Core is built with --enable-trace; otherwise an empty trace is written.
+ * Can be called from any thread.
+ * @param[in] output The stream to write to
+ */
+DALI_IMPORT_API void WriteChromeTrace( std::ostream& output );
+
+/**
+ * Discards the phases recorded so far, so that the next trace only contains the phases recorded after this call.
+ */
+DALI_IMPORT_API void ClearTrace();
+
+} // namespace Trace
+
+} // namespace Integration
+
+} // namespace Dali
+
+#endif // __DALI_INTEGRATION_TRACE_H__
@@ -23,10 +23,13 @@
 #include <dali/integration-api/core.h>
 #include <dali/integration-api/debug.h>
 #include <dali/integration-api/events/event.h>
+#include <dali/integration-api/gl-abstraction.h>
 #include <dali/integration-api/gl-sync-abstraction.h>
 #include <dali/integration-api/platform-abstraction.h>
 #include <dali/integration-api/render-controller.h>
 
+#include <dali/internal/common/trace-impl.h>
+
 #include <dali/internal/event/actors/actor-impl.h>
 #include <dali/internal/event/animation/animation-playlist.h>
 #include <dali/internal/event/common/notification-manager.h>
@@ -37,6 +40,7 @@
 #include <dali/internal/event/effects/shader-factory.h>
 #include <dali/internal/event/events/event-processor.h>
 #include <dali/internal/event/events/gesture-event-processor.h>
+#include <dali/internal/event/images/image-decode-queue.h>
 #include <dali/internal/event/render-tasks/render-task-list-impl.h>
 #include <dali/internal/event/size-negotiation/relayout-controller-impl.h>
 
@@ -83,6 +87,7 @@ Core::Core( RenderController& renderController, PlatformAbstraction& platform,
             GestureManager& gestureManager, ResourcePolicy::DataRetention dataRetentionPolicy)
 : mRenderController( renderController ),
   mPlatform(platform),
+  mGlAbstraction(glAbstraction),
   mGestureEventProcessor(NULL),
   mEventProcessor(NULL),
   mUpdateManager(NULL),
@@ -90,6 +95,7 @@ Core::Core( RenderController& renderController, PlatformAbstraction& platform,
   mDiscardQueue(NULL),
   mNotificationManager(NULL),
   mShaderFactory(NULL),
+  mImageDecodeQueue(NULL),
   mIsActive(true),
   mProcessingEvent(false)
 {
@@ -134,9 +140,11 @@ Core::Core( RenderController& renderController, PlatformAbstraction& platform,
   mGestureEventProcessor = new GestureEventProcessor(*mStage, gestureManager, mRenderController);
   mEventProcessor = new EventProcessor(*mStage, *mNotificationManager, *mGestureEventProcessor);
 
-  mShaderFactory = new ShaderFactory();
+  mShaderFactory = new ShaderFactory( platform );
   mUpdateManager->SetShaderSaver( *mShaderFactory );
 
+  mImageDecodeQueue = new ImageDecodeQueue( platform );
+
   GetImplementation(Dali::TypeRegistry::Get()).CallInitFunctions();
 }
 
@@ -156,6 +164,9 @@ Core::~Core()
     delete tls;
   }
 
+  // Join the decode workers; no decoded images will be delivered anymore
+  delete mImageDecodeQueue;
+
   // Stop relayout requests being raised on stage destruction
   mRelayoutController.Reset();
 
@@ -190,6 +201,12 @@ void Core::RecoverFromContextLoss()
 void Core::ContextCreated()
 {
   mRenderManager->ContextCreated();
+
+  // Identify the driver, so that binaries compiled by another driver are not used
+  const char* vendor = reinterpret_cast< const char* >( mGlAbstraction.GetString( GL_VENDOR ) );
+  const char* renderer = reinterpret_cast< const char* >( mGlAbstraction.GetString( GL_RENDERER ) );
+  const char* version = reinterpret_cast< const char* >( mGlAbstraction.GetString( GL_VERSION ) );
+  mShaderFactory->ContextCreated( vendor ? vendor : "", renderer ? renderer : "", version ? version : "" );
 }
 
 void Core::ContextDestroyed()
@@ -226,6 +243,8 @@ void Core::Update( float elapsedSeconds, unsigned int lastVSyncTimeMilliseconds,
   // it is cached by frametime
   status.secondsFromLastFrame = elapsedSeconds;
 
+  mPerformanceMonitor.FrameStart( PerformanceMonitor::UPDATE_THREAD );
+
   // Render returns true when there are updates on the stage or one or more animations are completed.
   // Use the estimated time diff till we render as the elapsed time.
   status.keepUpdating = mUpdateManager->Update( elapsedSeconds,
@@ -233,7 +252,16 @@ void Core::Update( float elapsedSeconds, unsigned int lastVSyncTimeMilliseconds,
                                                 nextVSyncTimeMilliseconds );
 
   // Check the Notification Manager message queue to set needsNotification
-  status.needsNotification = mNotificationManager->MessagesToProcess();
+  // or decoded images to deliver
+  status.needsNotification = mNotificationManager->MessagesToProcess() || mImageDecodeQueue->HasCompletedRequests();
+
+  // Keep updating whilst images are being decoded, so that their completion is noticed
+  if( mImageDecodeQueue->HasPendingRequests() )
+  {
+    status.keepUpdating |= Integration::KeepUpdating::IMAGE_DECODING;
+  }
+
+  mPerformanceMonitor.FrameEnd( PerformanceMonitor::UPDATE_THREAD );
 
   // No need to keep update running if there are notifications to process.
   // Any message to update will wake it up anyways
@@ -241,8 +269,12 @@ void Core::Update( float elapsedSeconds, unsigned int lastVSyncTimeMilliseconds,
 
 void Core::Render( RenderStatus& status )
 {
+  mPerformanceMonitor.FrameStart( PerformanceMonitor::RENDER_THREAD );
+
   bool updateRequired = mRenderManager->Render( status );
 
+  mPerformanceMonitor.FrameEnd( PerformanceMonitor::RENDER_THREAD );
+
   status.SetNeedsUpdate( updateRequired );
 }
 
@@ -273,6 +305,8 @@ void Core::QueueEvent( const Integration::Event& event )
 
 void Core::ProcessEvents()
 {
+  DALI_TRACE_SCOPE( PROCESS_EVENTS );
+
   // Guard against calls to ProcessEvents() during ProcessEvents()
   if( mProcessingEvent )
   {
@@ -291,6 +325,8 @@ void Core::ProcessEvents()
 
   mNotificationManager->ProcessMessages();
 
+  mImageDecodeQueue->ProcessCompletedRequests();
+
   // Avoid allocating MessageBuffers, triggering size-negotiation or sending any other spam whilst paused
   if( mIsActive )
   {
@@ -349,6 +385,45 @@ float Core::GetStereoBase() const
   return mStage->GetStereoBase();
 }
 
+void Core::SetUpdateWorkerThreadCount( unsigned int count )
+{
+  SetWorkerThreadCountMessage( *mUpdateManager, count );
+}
+
+void Core::SetImageDecodeThreadCount( unsigned int count )
+{
+  mImageDecodeQueue->SetWorkerCount( count );
+}
+
+void Core::SetShaderBinaryCacheSize( unsigned int bytes )
+{
+  mShaderFactory->SetCacheSize( bytes );
+}
+
+void Core::EnableParallelShaderCompilation( bool enable )
+{
+  EnableParallelShaderCompilationMessage( *mUpdateManager, enable );
+}
+
+void Core::EnablePerformanceMonitor( bool enable )
+{
+  mPerformanceMonitor.SetEnabled( enable );
+}
+
+void Core::GetFrameStatistics( Dali::Vector< Integration::FrameStatistics >& frames )
+{
+  Integration::FrameStatistics statistics;
+  while( mPerformanceMonitor.PopFrame( PerformanceMonitor::UPDATE_THREAD, statistics ) )
+  {
+    frames.PushBack( statistics );
+  }
+
+  while( mPerformanceMonitor.PopFrame( PerformanceMonitor::RENDER_THREAD, statistics ) )
+  {
+    frames.PushBack( statistics );
+  }
+}
+
 StagePtr Core::GetCurrentStage()
 {
   return mStage.Get();
@@ -379,6 +454,11 @@ ShaderFactory& Core::GetShaderFactory()
   return *(mShaderFactory);
 }
 
+ImageDecodeQueue& Core::GetImageDecodeQueue()
+{
+  return *(mImageDecodeQueue);
+}
+
 GestureEventProcessor& Core::GetGestureEventProcessor()
 {
   return *(mGestureEventProcessor);
@@ -20,10 +20,12 @@
 
 // INTERNAL INCLUDES
 #include <dali/public-api/object/ref-object.h>
+#include <dali/integration-api/core.h>
 #include <dali/integration-api/context-notifier.h>
 #include <dali/internal/common/owner-pointer.h>
 #include <dali/internal/event/animation/animation-playlist-declarations.h>
 #include <dali/internal/event/common/stage-def.h>
+#include <dali/internal/render/common/performance-monitor.h>
 #include <dali/public-api/common/view-mode.h>
 #include <dali/integration-api/resource-policies.h>
 
@@ -53,6 +55,7 @@ class PropertyNotificationManager;
 class EventProcessor;
 class GestureEventProcessor;
 class ShaderFactory;
+class ImageDecodeQueue;
 class TouchResampler;
 class RelayoutController;
 
@@ -193,6 +196,36 @@ public:
    */
   float GetStereoBase() const;
 
+  /**
+   * @copydoc Dali::Integration::Core::SetUpdateWorkerThreadCount()
+   */
+  void SetUpdateWorkerThreadCount( unsigned int count );
+
+  /**
+   * @copydoc Dali::Integration::Core::SetImageDecodeThreadCount()
+   */
+  void SetImageDecodeThreadCount( unsigned int count );
+
+  /**
+   * @copydoc Dali::Integration::Core::SetShaderBinaryCacheSize()
+   */
+  void SetShaderBinaryCacheSize( unsigned int bytes );
+
+  /**
+   * @copydoc Dali::Integration::Core::EnableParallelShaderCompilation()
+   */
+  void EnableParallelShaderCompilation( bool enable );
+
+  /**
+   * @copydoc Dali::Integration::Core::EnablePerformanceMonitor()
+   */
+  void EnablePerformanceMonitor( bool enable );
+
+  /**
+   * @copydoc Dali::Integration::Core::GetFrameStatistics()
+   */
+  void GetFrameStatistics( Dali::Vector< Integration::FrameStatistics >& frames );
+
 private:  // for use by ThreadLocalStorage
 
   /**
@@ -231,6 +264,12 @@ private:  // for use by ThreadLocalStorage
    */
   ShaderFactory& GetShaderFactory();
 
+  /**
+   * Returns the image decode queue
+   * @return A reference to the image decode queue.
+   */
+  ImageDecodeQueue& GetImageDecodeQueue();
+
   /**
    * Returns the gesture event processor.
    * @return A reference to the gesture event processor.
@@ -260,6 +299,7 @@ private:
 
   Integration::RenderController&            mRenderController;            ///< Reference to Render controller to tell it to keep rendering
   Integration::PlatformAbstraction&         mPlatform;                    ///< The interface providing platform specific services.
+  Integration::GlAbstraction&               mGlAbstraction;               ///< The interface to GL, used by the render thread
 
   IntrusivePtr<Stage>                       mStage;                       ///< The current stage
   GestureEventProcessor*                    mGestureEventProcessor;       ///< The gesture event processor
@@ -271,8 +311,10 @@ private:
   AnimationPlaylistOwner                    mAnimationPlaylist;           ///< For 'Fire and forget' animation support
   OwnerPointer<PropertyNotificationManager> mPropertyNotificationManager; ///< For safe signal emmision of property changed notifications
   ShaderFactory*                            mShaderFactory;               ///< Shader resource factory
+  ImageDecodeQueue*                         mImageDecodeQueue;            ///< Decodes images on worker threads
   IntrusivePtr< RelayoutController >        mRelayoutController;          ///< Size negotiation relayout controller
   SceneGraph::RenderTaskProcessor*          mRenderTaskProcessor;         ///< Handles the processing of render tasks
+  PerformanceMonitor                        mPerformanceMonitor;          ///< Records the frame statistics of the update and render threads
   bool                                      mIsActive         : 1;        ///< Whether Core is active or suspended
   bool                                      mProcessingEvent  : 1;        ///< True during ProcessEvents()
 
@@ -0,0 +1,269 @@
+/*
+ * Copyright (c) 2017 Samsung Electronics Co., Ltd.
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ * http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ *
+ */
+
+// CLASS HEADER
+#include <dali/internal/common/thread-pool.h>
+
+// EXTERNAL INCLUDES
+#include <cstddef>
+
+// INTERNAL INCLUDES
+#include <dali/devel-api/common/owner-container.h>
+#include <dali/devel-api/threading/conditional-wait.h>
+#include <dali/devel-api/threading/thread.h>
+
+namespace Dali
+{
+
+namespace Internal
+{
+
+/**
+ * @brief Private implementation class
+ */
+struct ThreadPool::Impl
+{
+  /**
+   * @brief A thread which processes chunks whenever a new job is started.
+   *
+   * Each worker has its own ConditionalWait as a ConditionalWait is only meant to be waited on by a single thread.
+   */
+  class WorkerThread : public Thread
+  {
+  public:
+
+    WorkerThread( Impl& impl )
+    : mImpl( impl ),
+      mWait(),
+      mGeneration( 0u ),
+      mTerminate( false )
+    {
+    }
+
+    virtual ~WorkerThread()
+    {
+    }
+
+    /**
+     * @brief Wake the worker to process a job
+     * @param[in] generation The id of the job
+     */
+    void StartJob( unsigned int generation )
+    {
+      ConditionalWait::ScopedLock lock( mWait );
+      mGeneration = generation;
+      mWait.Notify( lock );
+    }
+
+    /**
+     * @brief Ask the worker to exit its loop
+     */
+    void Terminate()
+    {
+      ConditionalWait::ScopedLock lock( mWait );
+      mTerminate = true;
+      mWait.Notify( lock );
+    }
+
+  protected:
+
+    virtual void Run()
+    {
+      unsigned int processedGeneration = 0u;
+      for( ;; )
+      {
+        {
+          ConditionalWait::ScopedLock lock( mWait );
+          while( processedGeneration == mGeneration && !mTerminate )
+          {
+            mWait.Wait( lock );
+          }
+
+          if( mTerminate )
+          {
+            return;
+          }
+          processedGeneration = mGeneration;
+        }
+
+        mImpl.ProcessChunks();
+        mImpl.WorkerFinished();
+      }
+    }
+
+  private:
+
+    Impl&           mImpl;
+    ConditionalWait mWait;        ///< Used to wake the worker
+    unsigned int    mGeneration;  ///< The latest job, guarded by mWait
+    bool            mTerminate;   ///< Set to stop the worker, guarded by mWait
+  };
+
+  Impl()
+  : task( NULL ),
+    begin( 0u ),
+    end( 0u ),
+    chunkSize( 1u ),
+    chunkCount( 0u ),
+    nextChunk( 0u ),
+    pendingWorkers( 0u ),
+    generation( 0u )
+  {
+  }
+
+  ~Impl()
+  {
+    Stop();
+  }
+
+  /**
+   * @brief Grab chunks of the current job until none are left
+   */
+  void ProcessChunks()
+  {
+    for( ;; )
+    {
+      const unsigned int chunk = __sync_fetch_and_add( &nextChunk, 1u );
+      if( chunk >= chunkCount )
+      {
+        break;
+      }
+
+      const unsigned int chunkBegin = begin + chunk * chunkSize;
+      const unsigned int chunkEnd = ( end - chunkBegin > chunkSize ) ? chunkBegin + chunkSize : end;
+      task->Process( chunkBegin, chunkEnd );
+    }
+  }
+
+  /**
+   * @brief Called by each worker when it has run out of chunks.
+   * Every worker checks in once per job, so none can still be looking at the job when the next one starts.
+   */
+  void WorkerFinished()
+  {
+    ConditionalWait::ScopedLock lock( finishedWait );
+    if( --pendingWorkers == 0u )
+    {
+      finishedWait.Notify( lock );
+    }
+  }
+
+  /**
+   * @brief Stop and destroy all the worker threads
+   */
+  void Stop()
+  {
+    for( OwnerContainer< WorkerThread* >::Iterator iter = workers.Begin(), endIter = workers.End(); iter != endIter; ++iter )
+    {
+      (*iter)->Terminate();
+      (*iter)->Join();
+    }
+    workers.Clear();
+  }
+
+  OwnerContainer< WorkerThread* > workers;       ///< The worker threads
+  ConditionalWait                 finishedWait;  ///< Used to wake the caller when all the workers have finished a job
+
+  Task*                           task;          ///< The task of the current job
+  unsigned int                    begin;         ///< The first item of the current job
+  unsigned int                    end;           ///< One past the last item of the current job
+  unsigned int                    chunkSize;     ///< Number of items in each chunk
+  unsigned int                    chunkCount;    ///< Number of chunks in the current job
+  volatile unsigned int           nextChunk;     ///< The next chunk to be processed, incremented atomically
+  unsigned int                    pendingWorkers;///< Workers which have not yet finished the current job, guarded by finishedWait
+  unsigned int                    generation;    ///< Incremented for every job
+};
+
+ThreadPool::ThreadPool()
+: mImpl( new Impl )
+{
+}
+
+ThreadPool::~ThreadPool()
+{
+  delete mImpl;
+}
+
+void ThreadPool::Initialize( unsigned int workerCount )
+{
+  mImpl->Stop();
+
+  for( unsigned int i = 0u; i < workerCount; ++i )
+  {
+    Impl::WorkerThread* worker = new Impl::WorkerThread( *mImpl );
+    mImpl->workers.PushBack( worker );
+    worker->Start();
+  }
+}
+
+unsigned int ThreadPool::GetWorkerCount() const
+{
+  return mImpl->workers.Count();
+}
+
+void ThreadPool::ParallelProcess( Task& task, unsigned int begin, unsigned int end, unsigned int chunkSize )
+{
+  if( begin >= end )
+  {
+    return;
+  }
+
+  if( chunkSize == 0u )
+  {
+    chunkSize = 1u;
+  }
+
+  const unsigned int workerCount = mImpl->workers.Count();
+  if( workerCount == 0u || end - begin <= chunkSize )
+  {
+    // Not worth waking the workers
+    task.Process( begin, end );
+    return;
+  }
+
+  {
+    ConditionalWait::ScopedLock lock( mImpl->finishedWait );
+    mImpl->pendingWorkers = workerCount;
+  }
+
+  // The job is published to each worker by the lock taken in StartJob()
+  mImpl->task = &task;
+  mImpl->begin = begin;
+  mImpl->end = end;
+  mImpl->chunkSize = chunkSize;
+  mImpl->chunkCount = ( end - begin + chunkSize - 1u ) / chunkSize;
+  mImpl->nextChunk = 0u;
+  ++mImpl->generation;
+
+  for( OwnerContainer< Impl::WorkerThread* >::Iterator iter = mImpl->workers.Begin(), endIter = mImpl->workers.End(); iter != endIter; ++iter )
+  {
+    (*iter)->StartJob( mImpl->generation );
+  }
+
+  // The calling thread takes part too
+  mImpl->ProcessChunks();
+
+  ConditionalWait::ScopedLock lock( mImpl->finishedWait );
+  while( mImpl->pendingWorkers != 0u )
+  {
+    mImpl->finishedWait.Wait( lock );
+  }
+}
+
+} // namespace Internal
+
+} // namespace Dali
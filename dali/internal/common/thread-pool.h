@@ -0,0 +1,112 @@
+#ifndef DALI_INTERNAL_THREAD_POOL_H
+#define DALI_INTERNAL_THREAD_POOL_H
+
+/*
+ * Copyright (c) 2017 Samsung Electronics Co., Ltd.
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ * http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ *
+ */
+
+namespace Dali
+{
+
+namespace Internal
+{
+
+/**
+ * @brief A small pool of worker threads used to split a range of independent items into chunks
+ * and process them in parallel.
+ *
+ * ParallelProcess() blocks the calling thread until every chunk has been processed, so
+ * consecutive calls act as a barrier; the calling thread also processes chunks whilst it waits.
+ * The pool is designed to be driven from a single thread (e.g. the update-thread) at a time.
+ */
+class ThreadPool
+{
+public:
+
+  /**
+   * @brief Interface for work which can be split over the pool
+   */
+  class Task
+  {
+  public:
+
+    /**
+     * @brief Process the items in the range [begin, end).
+     * Called concurrently from several threads with non-overlapping ranges.
+     * @param[in] begin The index of the first item to process
+     * @param[in] end One past the index of the last item to process
+     */
+    virtual void Process( unsigned int begin, unsigned int end ) = 0;
+
+  protected:
+
+    /**
+     * @brief Protected destructor, Task is not owned by the pool
+     */
+    virtual ~Task() {}
+  };
+
+  /**
+   * @brief Constructor. The pool starts with no worker threads.
+   */
+  ThreadPool();
+
+  /**
+   * @brief Destructor. Stops and joins all the worker threads.
+   */
+  ~ThreadPool();
+
+  /**
+   * @brief Stops any existing workers and starts the given number of new ones.
+   * @param[in] workerCount The number of worker threads; zero means all work is done on the calling thread
+   */
+  void Initialize( unsigned int workerCount );
+
+  /**
+   * @brief Retrieve the number of worker threads
+   * @return The number of worker threads, not including the calling thread
+   */
+  unsigned int GetWorkerCount() const;
+
+  /**
+   * @brief Split the range [begin, end) into chunks and process them on the workers and the calling thread.
+   * Returns when all the chunks have been processed.
+   * @param[in] task The task to run
+   * @param[in] begin The first item index
+   * @param[in] end One past the last item index
+   * @param[in] chunkSize The maximum number of items processed by a single call to Task::Process()
+   */
+  void ParallelProcess( Task& task, unsigned int begin, unsigned int end, unsigned int chunkSize );
+
+private:
+
+  // Undefined
+  ThreadPool( const ThreadPool& );
+
+  // Undefined
+  ThreadPool& operator=( const ThreadPool& );
+
+private:
+
+  struct Impl;
+  Impl* mImpl;
+};
+
+} // namespace Internal
+
+} // namespace Dali
+
+#endif // DALI_INTERNAL_THREAD_POOL_H
@@ -0,0 +1,162 @@
+/*
+ * Copyright (c) 2017 Samsung Electronics Co., Ltd.
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ * http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ *
+ */
+
+// CLASS HEADER
+#include <dali/internal/common/trace-impl.h>
+
+// EXTERNAL INCLUDES
+#include <ostream>
+#include <sys/syscall.h>
+#include <time.h>
+#include <unistd.h>
+
+// INTERNAL INCLUDES
+#include <dali/public-api/common/compile-time-assert.h>
+
+namespace Dali
+{
+
+namespace Internal
+{
+
+namespace Trace
+{
+
+namespace
+{
+
+const char* const MARKER_NAMES[] =
+{
+  "Core::ProcessEvents",
+  "UpdateManager::Update",
+  "ResetProperties",
+  "ProcessMessages",
+  "Animate",
+  "UpdateNodes",
+  "UpdateRenderers",
+  "TransformManager::Update",
+  "RenderTaskProcessor::Process",
+  "RenderManager::Render"
+};
+DALI_COMPILE_TIME_ASSERT( sizeof( MARKER_NAMES ) / sizeof( MARKER_NAMES[0] ) == MARKER_COUNT );
+
+const unsigned int RING_BUFFER_SIZE = 16384u; ///< Number of markers kept, must be a power of two
+
+/**
+ * A completed marker.
+ * The sequence is zero whilst the event is being written, otherwise it is one more than the index of the event.
+ */
+struct Event
+{
+  volatile unsigned int sequence;
+  unsigned int          marker;
+  unsigned int          threadId;
+  uint64_t              startTime;
+  uint64_t              endTime;
+};
+
+Event gEvents[RING_BUFFER_SIZE];
+volatile unsigned int gNextEvent = 0u;  ///< Index of the next event to write, incremented atomically
+volatile unsigned int gFirstEvent = 0u; ///< Index of the first event which has not been cleared
+
+__thread unsigned int gThreadId = 0u;
+
+unsigned int GetThreadId()
+{
+  if( gThreadId == 0u )
+  {
+    gThreadId = static_cast< unsigned int >( syscall( SYS_gettid ) );
+  }
+  return gThreadId;
+}
+
+} // unnamed namespace
+
+uint64_t GetTime()
+{
+  timespec time;
+  clock_gettime( CLOCK_MONOTONIC, &time );
+  return static_cast< uint64_t >( time.tv_sec ) * 1000000000u + static_cast< uint64_t >( time.tv_nsec );
+}
+
+void Record( Marker marker, uint64_t startTime, uint64_t endTime )
+{
+  const unsigned int index = __sync_fetch_and_add( &gNextEvent, 1u );
+  Event& event = gEvents[ index & ( RING_BUFFER_SIZE - 1u ) ];
+
+  event.sequence = 0u;
+  __sync_synchronize();
+  event.marker = marker;
+  event.threadId = GetThreadId();
+  event.startTime = startTime;
+  event.endTime = endTime;
+  __sync_synchronize();
+  event.sequence = index + 1u;
+}
+
+void Write( std::ostream& output )
+{
+  const unsigned int end = gNextEvent;
+  unsigned int begin = gFirstEvent;
+  if( end - begin > RING_BUFFER_SIZE )
+  {
+    begin = end - RING_BUFFER_SIZE;
+  }
+
+  const int processId = static_cast< int >( getpid() );
+  output << "{\"traceEvents\":[";
+
+  bool first = true;
+  for( unsigned int index = begin; index != end; ++index )
+  {
+    const Event& slot = gEvents[ index & ( RING_BUFFER_SIZE - 1u ) ];
+    const unsigned int sequence = slot.sequence;
+    __sync_synchronize();
+    const unsigned int marker = slot.marker;
+    const unsigned int threadId = slot.threadId;
+    const uint64_t startTime = slot.startTime;
+    const uint64_t endTime = slot.endTime;
+    __sync_synchronize();
+
+    // Skip events which are still being written or have been overwritten
+    if( sequence != index + 1u || slot.sequence != sequence || marker >= MARKER_COUNT )
+    {
+      continue;
+    }
+
+    // Chrome expects the times in microseconds
+    output << ( first ? "" : "," )
+           << "{\"name\":\"" << MARKER_NAMES[marker] << "\",\"cat\":\"dali\",\"ph\":\"X\""
+           << ",\"ts\":" << startTime / 1000u << "." << ( startTime % 1000u ) / 100u
+           << ",\"dur\":" << ( endTime - startTime ) / 1000u << "." << ( ( endTime - startTime ) % 1000u ) / 100u
+           << ",\"pid\":" << processId << ",\"tid\":" << threadId << "}";
+    first = false;
+  }
+
+  output << "],\"displayTimeUnit\":\"ms\"}";
+}
+
+void Clear()
+{
+  gFirstEvent = gNextEvent;
+}
+
+} // namespace Trace
+
+} // namespace Internal
+
+} // namespace Dali
@@ -0,0 +1,120 @@
+#ifndef DALI_INTERNAL_TRACE_IMPL_H
+#define DALI_INTERNAL_TRACE_IMPL_H
+
+/*
+ * Copyright (c) 2017 Samsung Electronics Co., Ltd.
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ * http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ *
+ */
+
+// EXTERNAL INCLUDES
+#include <iosfwd>
+#include <stdint.h>
+
+namespace Dali
+{
+
+namespace Internal
+{
+
+namespace Trace
+{
+
+/**
+ * @brief The phases which can be traced.
+ * The ids are compile time constants, so recording a marker does not need to look anything up.
+ */
+enum Marker
+{
+  PROCESS_EVENTS,             ///< Core::ProcessEvents
+  UPDATE,                     ///< UpdateManager::Update
+  RESET_PROPERTIES,           ///< UpdateManager::ResetProperties
+  PROCESS_MESSAGES,           ///< MessageQueue::ProcessMessages
+  ANIMATE,                    ///< UpdateManager::Animate
+  UPDATE_NODES,               ///< UpdateManager::UpdateNodes
+  UPDATE_RENDERERS,           ///< UpdateManager::UpdateRenderers
+  TRANSFORM_MANAGER_UPDATE,   ///< TransformManager::Update
+  RENDER_TASK_PROCESS,        ///< RenderTaskProcessor::Process
+  RENDER,                     ///< RenderManager::Render
+  MARKER_COUNT
+};
+
+/**
+ * @brief Retrieve the time used for the markers
+ * @return The monotonic clock time in nanoseconds
+ */
+uint64_t GetTime();
+
+/**
+ * @brief Record a completed marker in the ring buffer; once the buffer is full the oldest markers are overwritten.
+ * Can be called from any thread.
+ * @param[in] marker The phase which completed
+ * @param[in] startTime When the phase started, see GetTime()
+ * @param[in] endTime When the phase ended, see GetTime()
+ */
+void Record( Marker marker, uint64_t startTime, uint64_t endTime );
+
+/**
+ * @brief Write the markers in the ring buffer in the Chrome trace-event JSON format.
+ * Markers which are being overwritten whilst writing are skipped.
+ * @param[in] output The stream to write to
+ */
+void Write( std::ostream& output );
+
+/**
+ * @brief Forget the markers recorded so far
+ */
+void Clear();
+
+/**
+ * @brief Records a marker for the lifetime of the object, see DALI_TRACE_SCOPE
+ */
+class ScopedMarker
+{
+public:
+
+  explicit ScopedMarker( Marker marker )
+  : mMarker( marker ),
+    mStartTime( GetTime() )
+  {
+  }
+
+  ~ScopedMarker()
+  {
+    Record( mMarker, mStartTime, GetTime() );
+  }
+
+private:
+
+  Marker   mMarker;
+  uint64_t mStartTime;
+};
+
+} // namespace Trace
+
+} // namespace Internal
+
+} // namespace Dali
+
+/**
+ * Traces the rest of the enclosing scope; compiled out unless Core is built with --enable-trace.
+ * @param marker The name of one of the Trace::Marker values
+ */
+#ifdef TRACE_ENABLED
+#define DALI_TRACE_SCOPE( marker ) Dali::Internal::Trace::ScopedMarker traceScopedMarker( Dali::Internal::Trace::marker )
+#else
+#define DALI_TRACE_SCOPE( marker )
+#endif
+
+#endif // DALI_INTERNAL_TRACE_IMPL_H
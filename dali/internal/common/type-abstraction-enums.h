@@ -19,6 +19,7 @@
  */
 
 // INTERNAL INCLUDES
+#include <dali/public-api/images/pixel.h>
 #include <dali/public-api/rendering/renderer.h>
 #include <dali/internal/common/type-abstraction.h>
 
@@ -36,6 +37,7 @@ template <> struct ParameterType< Dali::DepthFunction::Type >    : public BasicT
 template <> struct ParameterType< Dali::RenderMode::Type >       : public BasicType< Dali::RenderMode::Type > {};
 template <> struct ParameterType< Dali::StencilFunction::Type >  : public BasicType< Dali::StencilFunction::Type > {};
 template <> struct ParameterType< Dali::StencilOperation::Type > : public BasicType< Dali::StencilOperation::Type > {};
+template <> struct ParameterType< Dali::Pixel::Format >          : public BasicType< Dali::Pixel::Format > {};
 
 } //namespace Internal
 
@@ -24,6 +24,7 @@
 #include <dali/public-api/actors/layer.h>
 #include <dali/public-api/common/dali-common.h>
 #include <dali/public-api/object/type-registry.h>
+#include <dali/devel-api/actors/layer-devel.h>
 #include <dali/internal/event/actors/layer-list.h>
 #include <dali/internal/event/common/property-helper.h>
 #include <dali/internal/event/common/stage-impl.h>
@@ -58,6 +59,7 @@ DALI_PROPERTY_TABLE_BEGIN
 DALI_PROPERTY( "clippingEnable",    BOOLEAN,    true,    false,   true,   Dali::Layer::Property::CLIPPING_ENABLE )
 DALI_PROPERTY( "clippingBox",       RECTANGLE,  true,    false,   true,   Dali::Layer::Property::CLIPPING_BOX    )
 DALI_PROPERTY( "behavior",          STRING,     true,    false,   false,  Dali::Layer::Property::BEHAVIOR        )
+DALI_PROPERTY( "hierarchicalCulling", BOOLEAN,  true,    false,   false,  Dali::DevelLayer::Property::HIERARCHICAL_CULLING )
 DALI_PROPERTY_TABLE_END( DEFAULT_DERIVED_ACTOR_PROPERTY_START_INDEX )
 
 // Actions
@@ -124,6 +126,7 @@ Layer::Layer( Actor::DerivedType type )
   mBehavior( Dali::Layer::LAYER_2D ),
   mIsClipping( false ),
   mDepthTestDisabled( true ),
+  mHierarchicalCulling( false ),
   mTouchConsumed( false ),
   mHoverConsumed( false )
 {
@@ -282,6 +285,22 @@ bool Layer::IsDepthTestDisabled() const
   return mDepthTestDisabled;
 }
 
+void Layer::SetHierarchicalCulling( bool enabled )
+{
+  if( enabled != mHierarchicalCulling )
+  {
+    mHierarchicalCulling = enabled;
+
+    // layerNode is being used in a separate thread; queue a message to set the value
+    SetHierarchicalCullingMessage( GetEventThreadServices(), GetSceneLayerOnStage(), mHierarchicalCulling );
+  }
+}
+
+bool Layer::IsHierarchicalCulling() const
+{
+  return mHierarchicalCulling;
+}
+
 void Layer::SetSortFunction(Dali::Layer::SortFunctionType function)
 {
   if( function != mSortFunction )
@@ -488,6 +507,11 @@ void Layer::SetDefaultProperty( Property::Index index, const Property::Value& pr
         }
         break;
       }
+      case Dali::DevelLayer::Property::HIERARCHICAL_CULLING:
+      {
+        SetHierarchicalCulling( propertyValue.Get<bool>() );
+        break;
+      }
       default:
       {
         DALI_LOG_WARNING( "Unknown property (%d)\n", index );
@@ -524,6 +548,11 @@ Property::Value Layer::GetDefaultProperty( Property::Index index ) const
         ret = Scripting::GetLinearEnumerationName< Behavior >( GetBehavior(), BEHAVIOR_TABLE, BEHAVIOR_TABLE_COUNT );
         break;
       }
+      case Dali::DevelLayer::Property::HIERARCHICAL_CULLING:
+      {
+        ret = mHierarchicalCulling;
+        break;
+      }
       default:
       {
         DALI_LOG_WARNING( "Unknown property (%d)\n", index );
@@ -174,6 +174,19 @@ public:
    */
   bool IsDepthTestDisabled() const;
 
+  /**
+   * Sets whether the renderers of the layer are culled a subtree at a time.
+   * @see Dali::DevelLayer::Property::HIERARCHICAL_CULLING
+   * @param[in] enabled True to enable hierarchical culling
+   */
+  void SetHierarchicalCulling( bool enabled );
+
+  /**
+   * Query whether the renderers of the layer are culled a subtree at a time.
+   * @return True if hierarchical culling is enabled
+   */
+  bool IsHierarchicalCulling() const;
+
   /**
    * @copydoc Dali::Layer::SetSortFunction()
    */
@@ -305,6 +318,7 @@ private:
 
   bool mIsClipping:1;                           ///< True when clipping is enabled
   bool mDepthTestDisabled:1;                    ///< Whether depth test is disabled.
+  bool mHierarchicalCulling:1;                  ///< Whether the renderers are culled a subtree at a time.
   bool mTouchConsumed:1;                        ///< Whether we should consume touch (including gesture).
   bool mHoverConsumed:1;                        ///< Whether we should consume hover.
 
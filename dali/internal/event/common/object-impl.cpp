@@ -219,23 +219,18 @@ Property::Index Object::GetPropertyIndex(const std::string& name) const
 
   if( (index == Property::INVALID_INDEX)&&( mCustomProperties.Count() > 0 ) )
   {
-    Property::Index count = PROPERTY_CUSTOM_START_INDEX;
-    const PropertyMetadataLookup::ConstIterator end = mCustomProperties.End();
-    for( PropertyMetadataLookup::ConstIterator iter = mCustomProperties.Begin(); iter != end; ++iter, ++count )
+    const unsigned int position = mCustomPropertyNameIndex.Find( mCustomProperties, name );
+    if( position < mCustomProperties.Count() )
     {
-      CustomPropertyMetadata* custom = static_cast<CustomPropertyMetadata*>(*iter);
-      if ( custom->name == name )
+      CustomPropertyMetadata* custom = static_cast<CustomPropertyMetadata*>( mCustomProperties[ position ] );
+      if ( custom->childPropertyIndex != Property::INVALID_INDEX )
       {
-        if ( custom->childPropertyIndex != Property::INVALID_INDEX )
-        {
-          // If it is a child property, return the child property index
-          index = custom->childPropertyIndex;
-        }
-        else
-        {
-          index = count;
-        }
-        break;
+        // If it is a child property, return the child property index
+        index = custom->childPropertyIndex;
+      }
+      else
+      {
+        index = PROPERTY_CUSTOM_START_INDEX + position;
       }
     }
   }
@@ -249,23 +244,18 @@ Property::Index Object::GetPropertyIndex( Property::Index key ) const
 
   if( mCustomProperties.Count() > 0 )
   {
-    Property::Index count = PROPERTY_CUSTOM_START_INDEX;
-    const PropertyMetadataLookup::ConstIterator end = mCustomProperties.End();
-    for( PropertyMetadataLookup::ConstIterator iter = mCustomProperties.Begin(); iter != end; ++iter, ++count )
+    const unsigned int position = mCustomPropertyKeyIndex.Find( mCustomProperties, key );
+    if( position < mCustomProperties.Count() )
     {
-      CustomPropertyMetadata* custom = static_cast<CustomPropertyMetadata*>(*iter);
-      if( custom->key == key )
+      CustomPropertyMetadata* custom = static_cast<CustomPropertyMetadata*>( mCustomProperties[ position ] );
+      if( custom->childPropertyIndex != Property::INVALID_INDEX )
       {
-        if( custom->childPropertyIndex != Property::INVALID_INDEX )
-        {
-          // If it is a child property, return the child property index
-          index = custom->childPropertyIndex;
-        }
-        else
-        {
-          index = count;
-        }
-        break;
+        // If it is a child property, return the child property index
+        index = custom->childPropertyIndex;
+      }
+      else
+      {
+        index = PROPERTY_CUSTOM_START_INDEX + position;
       }
     }
   }
@@ -467,14 +457,25 @@ void Object::SetProperty( Property::Index index, const Property::Value& property
 
     if ( ( index >= CHILD_PROPERTY_REGISTRATION_START_INDEX ) && ( index <= CHILD_PROPERTY_REGISTRATION_MAX_INDEX ) )
     {
+      // Metadata appended since the last search is indexed by the next one, so only the keys of
+      // metadata that was registered before need their index reset when they change
+      bool registered = false;
       if( !custom )
       {
         // If the child property is not registered yet, register it.
         custom = new CustomPropertyMetadata( "", propertyValue, Property::READ_WRITE );
         mCustomProperties.PushBack( custom );
+        registered = true;
       }
 
-      custom->childPropertyIndex = index;
+      if( custom->childPropertyIndex != index )
+      {
+        custom->childPropertyIndex = index;
+        if( !registered )
+        {
+          mChildPropertyIndex.Reset();
+        }
+      }
 
       // Resolve name for the child property
       Object* parent = GetParentObject();
@@ -483,7 +484,15 @@ void Object::SetProperty( Property::Index index, const Property::Value& property
         const TypeInfo* parentTypeInfo( parent->GetTypeInfo() );
         if( parentTypeInfo )
         {
-          custom->name = parentTypeInfo->GetChildPropertyName( index );
+          const std::string& name = parentTypeInfo->GetChildPropertyName( index );
+          if( custom->name != name )
+          {
+            custom->name = name;
+            if( !registered )
+            {
+              mCustomPropertyNameIndex.Reset();
+            }
+          }
         }
       }
     }
@@ -1348,13 +1357,10 @@ CustomPropertyMetadata* Object::FindCustomProperty( Property::Index index ) cons
   CustomPropertyMetadata* property( NULL );
   if ( ( index >= CHILD_PROPERTY_REGISTRATION_START_INDEX ) && ( index <= CHILD_PROPERTY_REGISTRATION_MAX_INDEX ) )
   {
-    for ( std::size_t arrayIndex = 0; arrayIndex < mCustomProperties.Count(); arrayIndex++ )
+    const unsigned int position = mChildPropertyIndex.Find( mCustomProperties, index );
+    if( position < mCustomProperties.Count() )
     {
-      CustomPropertyMetadata* custom = static_cast<CustomPropertyMetadata*>( mCustomProperties[ arrayIndex ] );
-      if( custom->childPropertyIndex == index )
-      {
-        property = custom;
-      }
+      property = static_cast<CustomPropertyMetadata*>( mCustomProperties[ position ] );
     }
   }
   else
@@ -1373,13 +1379,10 @@ CustomPropertyMetadata* Object::FindCustomProperty( Property::Index index ) cons
 
 AnimatablePropertyMetadata* Object::FindAnimatableProperty( Property::Index index ) const
 {
-  for ( int arrayIndex = 0; arrayIndex < (int)mAnimatableProperties.Count(); arrayIndex++ )
+  const unsigned int position = mAnimatablePropertyIndex.Find( mAnimatableProperties, index );
+  if( position < mAnimatableProperties.Count() )
   {
-    AnimatablePropertyMetadata* property = static_cast<AnimatablePropertyMetadata*>( mAnimatableProperties[ arrayIndex ] );
-    if( property->index == index )
-    {
-      return property;
-    }
+    return static_cast<AnimatablePropertyMetadata*>( mAnimatableProperties[ position ] );
   }
   return NULL;
 }
@@ -1444,6 +1447,9 @@ void Object::ResolveChildProperties()
     const TypeInfo* parentTypeInfo( parent->GetTypeInfo() );
     if( parentTypeInfo )
     {
+      bool childIndicesChanged = false;
+      bool namesChanged = false;
+
       // Go through each custom property
       for ( int arrayIndex = 0; arrayIndex < (int)mCustomProperties.Count(); arrayIndex++ )
       {
@@ -1454,19 +1460,35 @@ void Object::ResolveChildProperties()
           if( customProperty->childPropertyIndex != Property::INVALID_INDEX )
           {
             // Resolve name for any child property with no name
-            customProperty->name = parentTypeInfo->GetChildPropertyName( customProperty->childPropertyIndex );
+            const std::string& name = parentTypeInfo->GetChildPropertyName( customProperty->childPropertyIndex );
+            if( !name.empty() )
+            {
+              customProperty->name = name;
+              namesChanged = true;
+            }
           }
         }
         else
         {
           Property::Index childPropertyIndex = parentTypeInfo->GetChildPropertyIndex( customProperty->name );
-          if( childPropertyIndex != Property::INVALID_INDEX )
+          if( ( childPropertyIndex != Property::INVALID_INDEX ) && ( customProperty->childPropertyIndex != childPropertyIndex ) )
           {
             // Resolve index for any property with a name that matches the parent's child property name
             customProperty->childPropertyIndex = childPropertyIndex;
+            childIndicesChanged = true;
           }
         }
       }
+
+      // The indices must find the metadata under its new keys
+      if( childIndicesChanged )
+      {
+        mChildPropertyIndex.Reset();
+      }
+      if( namesChanged )
+      {
+        mCustomPropertyNameIndex.Reset();
+      }
     }
   }
 }
@@ -553,6 +553,10 @@ private:
   typedef OwnerContainer<PropertyMetadata*> PropertyMetadataLookup;
   mutable PropertyMetadataLookup mCustomProperties; ///< Used for accessing custom Node properties
   mutable PropertyMetadataLookup mAnimatableProperties; ///< Used for accessing animatable Node properties
+  mutable PropertyMetadataIndex< AnimatablePropertyIndexTraits > mAnimatablePropertyIndex; ///< Finds animatable properties by index
+  mutable PropertyMetadataIndex< ChildPropertyIndexTraits > mChildPropertyIndex;           ///< Finds custom properties by child property index
+  mutable PropertyMetadataIndex< CustomPropertyKeyTraits > mCustomPropertyKeyIndex;        ///< Finds custom properties by key
+  mutable PropertyMetadataIndex< CustomPropertyNameTraits > mCustomPropertyNameIndex;      ///< Finds custom properties by name
   mutable TypeInfo const *  mTypeInfo; ///< The type-info for this object, mutable so it can be lazy initialized from const method if it is required
 
   Dali::Vector<Observer*> mObservers;
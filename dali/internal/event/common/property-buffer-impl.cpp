@@ -121,10 +121,15 @@ unsigned int GetPropertyImplementationAlignment( Property::Type& propertyType )
 } // unnamed namespace
 
 PropertyBufferPtr PropertyBuffer::New( Dali::Property::Map& format )
+{
+  return New( format, DevelPropertyBuffer::Usage::STATIC );
+}
+
+PropertyBufferPtr PropertyBuffer::New( Dali::Property::Map& format, DevelPropertyBuffer::Usage::Type usage )
 {
   DALI_ASSERT_ALWAYS( format.Count() && "Format cannot be empty." );
 
-  PropertyBufferPtr propertyBuffer( new PropertyBuffer() );
+  PropertyBufferPtr propertyBuffer( new PropertyBuffer( usage ) );
   propertyBuffer->Initialize( format );
 
   return propertyBuffer;
@@ -150,11 +155,51 @@ void PropertyBuffer::SetData( const void* data, std::size_t size )
   SceneGraph::SetPropertyBufferData( mEventThreadServices.GetUpdateManager(), *mRenderObject, bufferCopy, mSize );
 }
 
+void PropertyBuffer::SetData( Dali::Vector<char>& data )
+{
+  DALI_ASSERT_ALWAYS( data.Count() % mBufferFormatSize == 0u && "Data size is not a multiple of the element size" );
+
+  mSize = data.Count() / mBufferFormatSize;
+
+  // The contents are swapped into the heap allocated vector, so the data is not copied
+  Dali::Vector<char>* bufferData = new Dali::Vector<char>();
+  bufferData->Swap( data );
+
+  // Ownership of the bufferData is passed to the message ( uses an owner pointer )
+  SceneGraph::SetPropertyBufferData( mEventThreadServices.GetUpdateManager(), *mRenderObject, bufferData, mSize );
+}
+
+void PropertyBuffer::SetDataRange( const void* data, std::size_t firstElement, std::size_t count )
+{
+  DALI_ASSERT_ALWAYS( firstElement + count <= mSize && "Range exceeds the size of the buffer" );
+
+  if( count == 0u )
+  {
+    return;
+  }
+
+  // Only the range is copied; the render thread writes it over its copy of the data
+  unsigned int rangeSize = mBufferFormatSize * count;
+  Dali::Vector<char>* rangeCopy = new Dali::Vector<char>();
+  rangeCopy->Resize( rangeSize );
+
+  const char* source = static_cast<const char*>( data );
+  std::copy( source, source + rangeSize, rangeCopy->Begin() );
+
+  // Ownership of the rangeCopy is passed to the message ( uses an owner pointer )
+  SceneGraph::SetPropertyBufferDataRange( mEventThreadServices.GetUpdateManager(), *mRenderObject, rangeCopy, mBufferFormatSize * firstElement );
+}
+
 std::size_t PropertyBuffer::GetSize() const
 {
   return mSize;
 }
 
+DevelPropertyBuffer::Usage::Type PropertyBuffer::GetUsage() const
+{
+  return mUsage;
+}
+
 const Render::PropertyBuffer* PropertyBuffer::GetRenderObject() const
 {
   return mRenderObject;
@@ -168,17 +213,28 @@ PropertyBuffer::~PropertyBuffer()
   }
 }
 
-PropertyBuffer::PropertyBuffer()
+PropertyBuffer::PropertyBuffer( DevelPropertyBuffer::Usage::Type usage )
 : mEventThreadServices( *Stage::GetCurrent() ),
   mRenderObject( NULL ),
   mBufferFormatSize( 0 ),
-  mSize( 0 )
+  mSize( 0 ),
+  mUsage( usage )
 {
 }
 
 void PropertyBuffer::Initialize( Dali::Property::Map& formatMap )
 {
-  mRenderObject = new Render::PropertyBuffer();
+  GpuBuffer::Usage gpuUsage = GpuBuffer::STATIC_DRAW;
+  if( mUsage == DevelPropertyBuffer::Usage::DYNAMIC )
+  {
+    gpuUsage = GpuBuffer::DYNAMIC_DRAW;
+  }
+  else if( mUsage == DevelPropertyBuffer::Usage::STREAM )
+  {
+    gpuUsage = GpuBuffer::STREAM_DRAW;
+  }
+
+  mRenderObject = new Render::PropertyBuffer( gpuUsage );
   SceneGraph::AddPropertyBuffer(mEventThreadServices.GetUpdateManager(), *mRenderObject );
 
   size_t numComponents = formatMap.Count();
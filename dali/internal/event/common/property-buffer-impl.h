@@ -23,6 +23,7 @@
 #include <dali/public-api/common/intrusive-ptr.h> // Dali::IntrusivePtr
 #include <dali/public-api/object/base-object.h>
 #include <dali/public-api/object/property-map.h> // Dali::Property::Map
+#include <dali/devel-api/rendering/property-buffer-devel.h>
 #include <dali/internal/event/common/event-thread-services.h>
 #include <dali/internal/render/renderers/render-property-buffer.h>
 
@@ -47,11 +48,31 @@ public:
    */
   static PropertyBufferPtr New( Dali::Property::Map& format );
 
+  /**
+   * @copydoc DevelPropertyBuffer::New()
+   */
+  static PropertyBufferPtr New( Dali::Property::Map& format, DevelPropertyBuffer::Usage::Type usage );
+
   /**
    * @copydoc PropertBuffer::SetData()
    */
   void SetData( const void* data, std::size_t size );
 
+  /**
+   * @copydoc DevelPropertyBuffer::SetData( PropertyBuffer&, Dali::Vector<char>& )
+   */
+  void SetData( Dali::Vector<char>& data );
+
+  /**
+   * @copydoc DevelPropertyBuffer::SetDataRange()
+   */
+  void SetDataRange( const void* data, std::size_t firstElement, std::size_t count );
+
+  /**
+   * @copydoc DevelPropertyBuffer::GetUsage()
+   */
+  DevelPropertyBuffer::Usage::Type GetUsage() const;
+
   /**
    * @copydoc PropertBuffer::GetSize()
    */
@@ -74,9 +95,10 @@ protected:
 
 private: // implementation
   /**
-   * @brief Default constructor
+   * @brief Constructor
+   * @param[in] usage How often the data of the buffer is expected to change
    */
-  PropertyBuffer();
+  PropertyBuffer( DevelPropertyBuffer::Usage::Type usage );
 
   /**
    * Second stage initialization
@@ -92,6 +114,7 @@ private: // data
   Render::PropertyBuffer* mRenderObject;        ///<Render side object
   unsigned int mBufferFormatSize;
   unsigned int mSize; ///< Number of elements in the buffer
+  DevelPropertyBuffer::Usage::Type mUsage; ///< How often the data is expected to change
 };
 
 /**
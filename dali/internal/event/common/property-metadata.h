@@ -24,8 +24,11 @@
 
 // INTERNAL INCLUDES
 #include <dali/public-api/common/constants.h>
+#include <dali/public-api/common/dali-vector.h>
 #include <dali/public-api/object/property.h>
 #include <dali/public-api/object/property-value.h>
+#include <dali/devel-api/common/hash.h>
+#include <dali/devel-api/common/owner-container.h>
 
 namespace Dali
 {
@@ -261,6 +264,201 @@ private:
   Property::AccessMode mAccessMode; ///< The mode of the property
 };
 
+typedef OwnerContainer< PropertyMetadata* > PropertyMetadataContainer;
+
+/**
+ * Hash table from a key of property metadata to its position in a metadata container, so that
+ * properties are found in constant time however many an object has.
+ *
+ * Metadata is only ever appended to the containers, so each search indexes the metadata appended since the
+ * previous search. Reset() must be called when the key of indexed metadata changes.
+ * Small containers are searched linearly.
+ *
+ * The Traits provide the KeyType, GetKey( metadata ), Hash( key ), and KEEP_LAST, which says whether the last
+ * rather than the first metadata with a key is found.
+ */
+template< typename Traits >
+class PropertyMetadataIndex
+{
+public:
+
+  typedef typename Traits::KeyType KeyType;
+
+  PropertyMetadataIndex()
+  : mSlots(),
+    mIndexedCount( 0u )
+  {
+  }
+
+  /**
+   * Forget the indexed metadata
+   */
+  void Reset()
+  {
+    mSlots.Clear();
+    mIndexedCount = 0u;
+  }
+
+  /**
+   * Find the metadata with a key
+   * @param[in] container The metadata to search
+   * @param[in] key The key to find
+   * @return The position of the metadata in the container, or the size of the container if not found
+   */
+  unsigned int Find( const PropertyMetadataContainer& container, const KeyType& key )
+  {
+    const unsigned int count = container.Count();
+    if( count < LINEAR_SEARCH_LIMIT )
+    {
+      unsigned int found = count;
+      for( unsigned int position = 0u; position < count; ++position )
+      {
+        if( Traits::GetKey( *container[position] ) == key )
+        {
+          found = position;
+          if( !Traits::KEEP_LAST )
+          {
+            break;
+          }
+        }
+      }
+      return found;
+    }
+
+    Update( container );
+
+    const unsigned int mask = mSlots.Count() - 1u;
+    for( unsigned int slot = Traits::Hash( key ) & mask; mSlots[slot] != 0u; slot = ( slot + 1u ) & mask )
+    {
+      const unsigned int position = mSlots[slot] - 1u;
+      if( Traits::GetKey( *container[position] ) == key )
+      {
+        return position;
+      }
+    }
+    return count;
+  }
+
+private:
+
+  /**
+   * Index the metadata appended since the last search; the table is rebuilt when it would be more than half full
+   */
+  void Update( const PropertyMetadataContainer& container )
+  {
+    const unsigned int count = container.Count();
+    if( count * 2u > mSlots.Count() )
+    {
+      unsigned int capacity = LINEAR_SEARCH_LIMIT * 2u;
+      while( capacity < count * 2u )
+      {
+        capacity *= 2u;
+      }
+      mSlots.Clear();
+      mSlots.Resize( capacity, 0u );
+      mIndexedCount = 0u;
+    }
+
+    const unsigned int mask = mSlots.Count() - 1u;
+    for( ; mIndexedCount < count; ++mIndexedCount )
+    {
+      const KeyType& key = Traits::GetKey( *container[mIndexedCount] );
+      unsigned int slot = Traits::Hash( key ) & mask;
+      while( ( mSlots[slot] != 0u ) && !( Traits::GetKey( *container[ mSlots[slot] - 1u ] ) == key ) )
+      {
+        slot = ( slot + 1u ) & mask;
+      }
+      if( ( mSlots[slot] == 0u ) || Traits::KEEP_LAST )
+      {
+        mSlots[slot] = mIndexedCount + 1u;
+      }
+    }
+  }
+
+private:
+
+  static const unsigned int LINEAR_SEARCH_LIMIT = 8u; ///< Containers with fewer metadata are searched linearly
+
+  Dali::Vector< unsigned int > mSlots; ///< Positions plus one, or zero for an empty slot
+  unsigned int mIndexedCount;          ///< Number of metadata of the container in the table
+};
+
+/**
+ * Indexes animatable property metadata by property index
+ */
+struct AnimatablePropertyIndexTraits
+{
+  typedef Property::Index KeyType;
+  static const bool KEEP_LAST = false;
+
+  static const Property::Index& GetKey( const PropertyMetadata& metadata )
+  {
+    return static_cast< const AnimatablePropertyMetadata& >( metadata ).index;
+  }
+
+  static unsigned int Hash( Property::Index index )
+  {
+    return static_cast< unsigned int >( index ) * 2654435761u; // Knuth's multiplicative hash
+  }
+};
+
+/**
+ * Indexes custom property metadata by child property index; the last registration of a child property is found
+ */
+struct ChildPropertyIndexTraits
+{
+  typedef Property::Index KeyType;
+  static const bool KEEP_LAST = true;
+
+  static const Property::Index& GetKey( const PropertyMetadata& metadata )
+  {
+    return static_cast< const CustomPropertyMetadata& >( metadata ).childPropertyIndex;
+  }
+
+  static unsigned int Hash( Property::Index index )
+  {
+    return static_cast< unsigned int >( index ) * 2654435761u;
+  }
+};
+
+/**
+ * Indexes custom property metadata by integer key
+ */
+struct CustomPropertyKeyTraits
+{
+  typedef Property::Index KeyType;
+  static const bool KEEP_LAST = false;
+
+  static const Property::Index& GetKey( const PropertyMetadata& metadata )
+  {
+    return static_cast< const CustomPropertyMetadata& >( metadata ).key;
+  }
+
+  static unsigned int Hash( Property::Index key )
+  {
+    return static_cast< unsigned int >( key ) * 2654435761u;
+  }
+};
+
+/**
+ * Indexes custom property metadata by name
+ */
+struct CustomPropertyNameTraits
+{
+  typedef std::string KeyType;
+  static const bool KEEP_LAST = false;
+
+  static const std::string& GetKey( const PropertyMetadata& metadata )
+  {
+    return static_cast< const CustomPropertyMetadata& >( metadata ).name;
+  }
+
+  static unsigned int Hash( const std::string& name )
+  {
+    return static_cast< unsigned int >( CalculateHash( name ) );
+  }
+};
+
 } // namespace Internal
 
 } // namespace Dali
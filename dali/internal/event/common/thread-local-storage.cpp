@@ -97,6 +97,11 @@ StagePtr ThreadLocalStorage::GetCurrentStage()
   return mCore->GetCurrentStage();
 }
 
+ImageDecodeQueue& ThreadLocalStorage::GetImageDecodeQueue()
+{
+  return mCore->GetImageDecodeQueue();
+}
+
 GestureEventProcessor& ThreadLocalStorage::GetGestureEventProcessor()
 {
   return mCore->GetGestureEventProcessor();
@@ -37,6 +37,7 @@ namespace Internal
 class Core;
 class NotificationManager;
 class ShaderFactory;
+class ImageDecodeQueue;
 class GestureEventProcessor;
 class RelayoutController;
 
@@ -113,6 +114,12 @@ public:
    */
   ShaderFactory& GetShaderFactory();
 
+  /**
+   * Returns the Image Decode Queue
+   * @return reference to the Image Decode Queue
+   */
+  ImageDecodeQueue& GetImageDecodeQueue();
+
   /**
    * Returns the current stage.
    * @return A pointer to the current stage.
@@ -19,10 +19,11 @@
 #include <dali/internal/event/common/type-info-impl.h>
 
 // EXTERNAL INCLUDES
-#include <algorithm> // std::find_if
+#include <algorithm> // std::find, std::find_if
 #include <string>
 
 // INTERNAL INCLUDES
+#include <dali/devel-api/common/hash.h>
 #include <dali/integration-api/debug.h>
 #include <dali/internal/event/common/type-registry-impl.h>
 #include <dali/internal/event/common/object-impl.h>
@@ -54,73 +55,273 @@ private:
 };
 
 /**
- * Functor to find a matching property name
+ * Functor to find a matching property component index
  */
 template <typename T>
-struct PropertyNameFinder
+struct PropertyComponentFinder
 {
-  PropertyNameFinder( const std::string& find )
-  : mFind( find )
+  PropertyComponentFinder( Dali::Property::Index basePropertyIndex, const int find )
+  : mBasePropertyIndex( basePropertyIndex ),
+    mFind( find )
   {
   }
 
   bool operator()(const T &p) const
   {
-    return p.second.name == mFind;
+    return ( p.second.basePropertyIndex == mBasePropertyIndex && p.second.componentIndex == mFind );
   }
 
 private:
 
-  const std::string& mFind;
+  Dali::Property::Index mBasePropertyIndex;
+  const int mFind;
 };
 
+} // namespace anon
+
+namespace Dali
+{
+
+namespace Internal
+{
+
+namespace
+{
+
 /**
- * Functor to find a matching property component index
+ * Changed whenever a type is created or destroyed, or something is registered to a type.
+ * The lookup tables of every type are rebuilt when they are next used after this changes,
+ * as any type may have been registered as the base of another.
  */
-template <typename T>
-struct PropertyComponentFinder
+unsigned int gRegistrationGeneration = 0u;
+
+inline unsigned int HashKey( const std::string* name )
 {
-  PropertyComponentFinder( Dali::Property::Index basePropertyIndex, const int find )
-  : mBasePropertyIndex( basePropertyIndex ),
-    mFind( find )
+  return static_cast< unsigned int >( CalculateHash( *name ) );
+}
+
+inline unsigned int HashKey( Property::Index index )
+{
+  return static_cast< unsigned int >( index ) * 2654435761u; // Knuth's multiplicative hash
+}
+
+inline bool KeysEqual( const std::string* lhs, const std::string* rhs )
+{
+  return *lhs == *rhs;
+}
+
+inline bool KeysEqual( Property::Index lhs, Property::Index rhs )
+{
+  return lhs == rhs;
+}
+
+/**
+ * An open-addressing hash table from a name or index to the type that registered it and
+ * its position in that type's container.
+ *
+ * Only the first insertion of a key is kept, so inserting the types of an inheritance chain
+ * from the most derived type and each type's entries in registration order matches the
+ * result of searching each type in turn.
+ */
+template< typename Key >
+class ChainTable
+{
+public:
+
+  struct Entry
+  {
+    Key key;
+    const TypeInfo* owner; ///< The type which registered the key, NULL for an empty slot
+    unsigned int position; ///< The position of the key in the owner's container
+  };
+
+  /**
+   * Remove all entries and size the table to hold the given number of keys.
+   * @param[in] count The number of keys which will be inserted.
+   */
+  void Reset( unsigned int count )
   {
+    unsigned int capacity = 8u;
+    while( capacity < count * 2u )
+    {
+      capacity <<= 1u;
+    }
+
+    Entry empty = Entry();
+    mSlots.assign( capacity, empty );
   }
 
-  bool operator()(const T &p) const
+  /**
+   * Insert a key unless it is already in the table.
+   * @param[in] key The name or index.
+   * @param[in] owner The type which registered the key.
+   * @param[in] position The position of the key in the owner's container.
+   */
+  void Insert( Key key, const TypeInfo* owner, unsigned int position )
   {
-    return ( p.second.basePropertyIndex == mBasePropertyIndex && p.second.componentIndex == mFind );
+    const unsigned int mask = mSlots.size() - 1u;
+    for( unsigned int slot = HashKey( key ) & mask; ; slot = ( slot + 1u ) & mask )
+    {
+      Entry& entry = mSlots[ slot ];
+      if( !entry.owner )
+      {
+        entry.key = key;
+        entry.owner = owner;
+        entry.position = position;
+        return;
+      }
+      if( KeysEqual( entry.key, key ) )
+      {
+        return;
+      }
+    }
+  }
+
+  /**
+   * Find a key.
+   * @param[in] key The name or index.
+   * @return The entry of the key, or NULL if it is not in the table.
+   */
+  const Entry* Find( Key key ) const
+  {
+    const unsigned int mask = mSlots.size() - 1u;
+    for( unsigned int slot = HashKey( key ) & mask; ; slot = ( slot + 1u ) & mask )
+    {
+      const Entry& entry = mSlots[ slot ];
+      if( !entry.owner )
+      {
+        return NULL;
+      }
+      if( KeysEqual( entry.key, key ) )
+      {
+        return &entry;
+      }
+    }
   }
 
 private:
 
-  Dali::Property::Index mBasePropertyIndex;
-  const int mFind;
+  std::vector< Entry > mSlots; ///< The slots, a power of two and never more than half full
 };
 
-} // namespace anon
+} // unnamed namespace
 
-namespace Dali
+/**
+ * The lookup tables of a type, covering the type and all of its bases.
+ */
+struct TypeInfo::Lookup
 {
+  typedef ChainTable< const std::string* > NameTable;
+  typedef ChainTable< Property::Index > IndexTable;
 
-namespace Internal
-{
+  Lookup()
+  : generation( gRegistrationGeneration + 1u ) // Out of date until built
+  {
+  }
+
+  /**
+   * Rebuild the tables of a type.
+   * @param[in] type The type.
+   */
+  void Build( const TypeInfo& type )
+  {
+    chain.clear();
+
+    unsigned int propertyCount = 0u;
+    unsigned int childPropertyCount = 0u;
+    unsigned int actionCount = 0u;
+    unsigned int signalCount = 0u;
+
+    const TypeInfo* current = &type;
+    while( current )
+    {
+      chain.push_back( current );
+      propertyCount += current->mRegisteredProperties.size();
+      childPropertyCount += current->mRegisteredChildProperties.size();
+      actionCount += current->mActions.size();
+      signalCount += current->mSignalConnectors.size();
+
+      Dali::TypeInfo base = TypeRegistry::Get()->GetTypeInfo( current->mBaseTypeName );
+      current = base ? &GetImplementation( base ) : NULL;
+    }
+
+    propertyNames.Reset( propertyCount );
+    propertyIndices.Reset( propertyCount );
+    childPropertyNames.Reset( childPropertyCount );
+    childPropertyIndices.Reset( childPropertyCount );
+    actionNames.Reset( actionCount );
+    signalNames.Reset( signalCount );
+
+    for( std::vector< const TypeInfo* >::const_iterator iter = chain.begin(), endIter = chain.end(); iter != endIter; ++iter )
+    {
+      const TypeInfo* owner = *iter;
+
+      for( unsigned int i = 0u; i < owner->mRegisteredProperties.size(); ++i )
+      {
+        propertyNames.Insert( &owner->mRegisteredProperties[i].second.name, owner, i );
+        propertyIndices.Insert( owner->mRegisteredProperties[i].first, owner, i );
+      }
+      for( unsigned int i = 0u; i < owner->mRegisteredChildProperties.size(); ++i )
+      {
+        childPropertyNames.Insert( &owner->mRegisteredChildProperties[i].second.name, owner, i );
+        childPropertyIndices.Insert( owner->mRegisteredChildProperties[i].first, owner, i );
+      }
+      for( unsigned int i = 0u; i < owner->mActions.size(); ++i )
+      {
+        actionNames.Insert( &owner->mActions[i].first, owner, i );
+      }
+      for( unsigned int i = 0u; i < owner->mSignalConnectors.size(); ++i )
+      {
+        signalNames.Insert( &owner->mSignalConnectors[i].first, owner, i );
+      }
+    }
+
+    generation = gRegistrationGeneration;
+  }
+
+  std::vector< const TypeInfo* > chain; ///< The type followed by its bases, most derived first
+  NameTable propertyNames;
+  IndexTable propertyIndices;
+  NameTable childPropertyNames;
+  IndexTable childPropertyIndices;
+  NameTable actionNames;
+  NameTable signalNames;
+  unsigned int generation;              ///< The registration generation the tables were built for
+};
 
 TypeInfo::TypeInfo(const std::string &name, const std::string &baseTypeName, Dali::TypeInfo::CreateFunction creator)
-  : mTypeName(name), mBaseTypeName(baseTypeName), mCSharpType(false), mCreate(creator)
+  : mTypeName(name), mBaseTypeName(baseTypeName), mCSharpType(false), mCreate(creator), mLookup(NULL)
 {
   DALI_ASSERT_ALWAYS(!name.empty() && "Type info construction must have a name");
   DALI_ASSERT_ALWAYS(!baseTypeName.empty() && "Type info construction must have a base type name");
+  ++gRegistrationGeneration;
 }
 
 TypeInfo::TypeInfo(const std::string &name, const std::string &baseTypeName, Dali::CSharpTypeInfo::CreateFunction creator)
-  : mTypeName(name), mBaseTypeName(baseTypeName), mCSharpType(true), mCSharpCreate(creator)
+  : mTypeName(name), mBaseTypeName(baseTypeName), mCSharpType(true), mCSharpCreate(creator), mLookup(NULL)
 {
   DALI_ASSERT_ALWAYS(!name.empty() && "Type info construction must have a name");
   DALI_ASSERT_ALWAYS(!baseTypeName.empty() && "Type info construction must have a base type name");
+  ++gRegistrationGeneration;
 }
 
 TypeInfo::~TypeInfo()
 {
+  delete mLookup;
+  ++gRegistrationGeneration;
+}
+
+const TypeInfo::Lookup& TypeInfo::GetLookup() const
+{
+  if( !mLookup )
+  {
+    mLookup = new Lookup;
+  }
+  if( mLookup->generation != gRegistrationGeneration )
+  {
+    mLookup->Build( *this );
+  }
+  return *mLookup;
 }
 
 BaseHandle TypeInfo::CreateInstance() const
@@ -154,34 +355,33 @@ BaseHandle TypeInfo::CreateInstance() const
   return ret;
 }
 
-  bool TypeInfo::DoActionTo(BaseObject *object, const std::string &actionName, const Property::Map &properties)
+bool TypeInfo::DoActionTo(BaseObject *object, const std::string &actionName, const Property::Map &properties)
 {
   bool done = false;
 
-  ActionContainer::iterator iter = find_if(mActions.begin(), mActions.end(), PairFinder<std::string, ActionPair>(actionName));
+  const Lookup& lookup = GetLookup();
+  const Lookup::NameTable::Entry* entry = lookup.actionNames.Find( &actionName );
 
-  if( iter != mActions.end() )
+  if( entry )
   {
-    done = (iter->second)(object, actionName, properties);
-  }
-  else
-  {
-    DALI_LOG_WARNING("Type '%s' cannot do action '%s'\n", mTypeName.c_str(), actionName.c_str());
-  }
+    // Try the most derived action first, then any action with the same name in the bases
+    std::vector< const TypeInfo* >::const_iterator iter = std::find( lookup.chain.begin(), lookup.chain.end(), entry->owner );
+    done = ( entry->owner->mActions[ entry->position ].second )( object, actionName, properties );
 
-  if(!done)
-  {
-    Dali::TypeInfo base = Dali::TypeRegistry::Get().GetTypeInfo( mBaseTypeName );
-    while( base )
+    for( ++iter; !done && iter != lookup.chain.end(); ++iter )
     {
-      done = GetImplementation(base).DoActionTo(object, actionName, properties);
-      if( done )
+      const ActionContainer& actions = (*iter)->mActions;
+      ActionContainer::const_iterator action = find_if( actions.begin(), actions.end(), PairFinder<std::string, ActionPair>( actionName ) );
+      if( action != actions.end() )
       {
-        break;
+        done = ( action->second )( object, actionName, properties );
       }
-      base =  Dali::TypeRegistry::Get().GetTypeInfo( base.GetBaseName() );
     }
   }
+  else
+  {
+    DALI_LOG_WARNING("Type '%s' cannot do action '%s'\n", mTypeName.c_str(), actionName.c_str());
+  }
 
   return done;
 }
@@ -190,12 +390,12 @@ bool TypeInfo::ConnectSignal( BaseObject* object, ConnectionTrackerInterface* co
 {
   bool connected( false );
 
-  ConnectorContainer::iterator iter = find_if( mSignalConnectors.begin(), mSignalConnectors.end(),
-                                                 PairFinder<std::string, ConnectionPair>(signalName) );
+  // Only this type's connectors are used, the type registry tries the bases in turn
+  const Lookup::NameTable::Entry* entry = GetLookup().signalNames.Find( &signalName );
 
-  if( iter != mSignalConnectors.end() )
+  if( entry && entry->owner == this )
   {
-    connected = (iter->second)( object, connectionTracker, signalName, functor );
+    connected = ( mSignalConnectors[ entry->position ].second )( object, connectionTracker, signalName, functor );
   }
 
   return connected;
@@ -218,13 +418,12 @@ Dali::TypeInfo::CreateFunction TypeInfo::GetCreator() const
 
 size_t TypeInfo::GetActionCount() const
 {
-  size_t count = mActions.size();
+  const Lookup& lookup = GetLookup();
 
-  Dali::TypeInfo base = Dali::TypeRegistry::Get().GetTypeInfo( mBaseTypeName );
-  while( base )
+  size_t count = 0;
+  for( std::vector< const TypeInfo* >::const_iterator iter = lookup.chain.begin(), endIter = lookup.chain.end(); iter != endIter; ++iter )
   {
-    count += GetImplementation(base).mActions.size();
-    base = Dali::TypeRegistry::Get().GetTypeInfo( base.GetBaseName() );
+    count += (*iter)->mActions.size();
   }
 
   return count;
@@ -234,29 +433,16 @@ std::string TypeInfo::GetActionName(size_t index) const
 {
   std::string name;
 
-  if( index < mActions.size() )
-  {
-    name = mActions[index].first;
-  }
-  else
+  const Lookup& lookup = GetLookup();
+  for( std::vector< const TypeInfo* >::const_iterator iter = lookup.chain.begin(), endIter = lookup.chain.end(); iter != endIter; ++iter )
   {
-    size_t count = mActions.size();
-
-    Dali::TypeInfo base = Dali::TypeRegistry::Get().GetTypeInfo( mBaseTypeName );
-    while( base )
+    const size_t count = (*iter)->mActions.size();
+    if( index < count )
     {
-      size_t baseCount = GetImplementation(base).mActions.size();
-
-      if( index < count + baseCount )
-      {
-        name = GetImplementation(base).mActions[ index - count ].first;
-        break;
-      }
-
-      count += baseCount;
-
-      base = Dali::TypeRegistry::Get().GetTypeInfo( base.GetBaseName() );
+      name = (*iter)->mActions[ index ].first;
+      break;
     }
+    index -= count;
   }
 
   return name;
@@ -264,13 +450,12 @@ std::string TypeInfo::GetActionName(size_t index) const
 
 size_t TypeInfo::GetSignalCount() const
 {
-  size_t count = mSignalConnectors.size();
+  const Lookup& lookup = GetLookup();
 
-  Dali::TypeInfo base = Dali::TypeRegistry::Get().GetTypeInfo( mBaseTypeName );
-  while( base )
+  size_t count = 0;
+  for( std::vector< const TypeInfo* >::const_iterator iter = lookup.chain.begin(), endIter = lookup.chain.end(); iter != endIter; ++iter )
   {
-    count += GetImplementation(base).mSignalConnectors.size();
-    base = Dali::TypeRegistry::Get().GetTypeInfo( base.GetBaseName() );
+    count += (*iter)->mSignalConnectors.size();
   }
 
   return count;
@@ -280,29 +465,16 @@ std::string TypeInfo::GetSignalName(size_t index) const
 {
   std::string name;
 
-  if( index < mSignalConnectors.size() )
-  {
-    name = mSignalConnectors[index].first;
-  }
-  else
+  const Lookup& lookup = GetLookup();
+  for( std::vector< const TypeInfo* >::const_iterator iter = lookup.chain.begin(), endIter = lookup.chain.end(); iter != endIter; ++iter )
   {
-    size_t count = mSignalConnectors.size();
-
-    Dali::TypeInfo base = Dali::TypeRegistry::Get().GetTypeInfo( mBaseTypeName );
-    while( base )
+    const size_t count = (*iter)->mSignalConnectors.size();
+    if( index < count )
     {
-      size_t baseCount = GetImplementation(base).mSignalConnectors.size();
-
-      if( index < count + baseCount )
-      {
-        name = GetImplementation(base).mSignalConnectors[ index - count ].first;
-        break;
-      }
-
-      count += baseCount;
-
-      base = Dali::TypeRegistry::Get().GetTypeInfo( base.GetBaseName() );
+      name = (*iter)->mSignalConnectors[ index ].first;
+      break;
     }
+    index -= count;
   }
 
   return name;
@@ -310,39 +482,32 @@ std::string TypeInfo::GetSignalName(size_t index) const
 
 void TypeInfo::GetPropertyIndices( Property::IndexContainer& indices ) const
 {
-  Dali::TypeInfo base = TypeRegistry::Get()->GetTypeInfo( mBaseTypeName );
-  if ( base )
-  {
-    const TypeInfo& baseImpl( GetImplementation( base ) );
-    baseImpl.GetPropertyIndices( indices );
-  }
+  const Lookup& lookup = GetLookup();
 
-  if ( ! mRegisteredProperties.empty() )
+  // The indices of the bases come first
+  for( std::vector< const TypeInfo* >::const_reverse_iterator iter = lookup.chain.rbegin(), endIter = lookup.chain.rend(); iter != endIter; ++iter )
   {
-    indices.Reserve( indices.Size() + mRegisteredProperties.size() );
-
-    const RegisteredPropertyContainer::const_iterator endIter = mRegisteredProperties.end();
-    for ( RegisteredPropertyContainer::const_iterator iter = mRegisteredProperties.begin(); iter != endIter; ++iter )
+    const RegisteredPropertyContainer& properties = (*iter)->mRegisteredProperties;
+    if ( ! properties.empty() )
     {
-      indices.PushBack( iter->first );
+      indices.Reserve( indices.Size() + properties.size() );
+
+      const RegisteredPropertyContainer::const_iterator endPropertyIter = properties.end();
+      for ( RegisteredPropertyContainer::const_iterator propertyIter = properties.begin(); propertyIter != endPropertyIter; ++propertyIter )
+      {
+        indices.PushBack( propertyIter->first );
+      }
     }
   }
 }
 
 const std::string& TypeInfo::GetPropertyName( Property::Index index ) const
 {
-  RegisteredPropertyContainer::const_iterator iter = find_if( mRegisteredProperties.begin(), mRegisteredProperties.end(),
-                                                          PairFinder< Property::Index, RegisteredPropertyPair >( index ) );
-
-  if ( iter != mRegisteredProperties.end() )
-  {
-    return iter->second.name;
-  }
+  const Lookup::IndexTable::Entry* entry = GetLookup().propertyIndices.Find( index );
 
-  Dali::TypeInfo base = TypeRegistry::Get()->GetTypeInfo( mBaseTypeName );
-  if ( base )
+  if ( entry )
   {
-    return GetImplementation(base).GetPropertyName( index );
+    return entry->owner->mRegisteredProperties[ entry->position ].second.name;
   }
 
   DALI_ASSERT_ALWAYS( ! "Cannot find property index" ); // use the same assert as Object
@@ -362,6 +527,7 @@ void TypeInfo::AddActionFunction( const std::string &actionName, Dali::TypeInfo:
     if( iter == mActions.end() )
     {
       mActions.push_back( ActionPair( actionName, function ) );
+      ++gRegistrationGeneration;
     }
     else
     {
@@ -384,6 +550,7 @@ void TypeInfo::AddConnectorFunction( const std::string& signalName, Dali::TypeIn
     if( iter == mSignalConnectors.end() )
     {
       mSignalConnectors.push_back( ConnectionPair( signalName, function ) );
+      ++gRegistrationGeneration;
     }
     else
     {
@@ -408,6 +575,7 @@ void TypeInfo::AddProperty( const std::string& name, Property::Index index, Prop
     if ( iter == mRegisteredProperties.end() )
     {
       mRegisteredProperties.push_back( RegisteredPropertyPair( index, RegisteredProperty( type, setFunc, getFunc, name, Property::INVALID_INDEX, Property::INVALID_COMPONENT_INDEX ) ) );
+      ++gRegistrationGeneration;
     }
     else
     {
@@ -433,6 +601,7 @@ void TypeInfo::AddProperty( const std::string& name, Property::Index index, Prop
     if ( iter == mRegisteredProperties.end() )
     {
       mRegisteredProperties.push_back( RegisteredPropertyPair( index, RegisteredProperty( type, setFunc, getFunc, name, Property::INVALID_INDEX, Property::INVALID_COMPONENT_INDEX ) ) );
+      ++gRegistrationGeneration;
     }
     else
     {
@@ -451,6 +620,7 @@ void TypeInfo::AddAnimatableProperty( const std::string& name, Property::Index i
   if ( iter == mRegisteredProperties.end() )
   {
     mRegisteredProperties.push_back( RegisteredPropertyPair( index, RegisteredProperty( type, name, Property::INVALID_INDEX, Property::INVALID_COMPONENT_INDEX ) ) );
+    ++gRegistrationGeneration;
   }
   else
   {
@@ -467,6 +637,7 @@ void TypeInfo::AddAnimatableProperty( const std::string& name, Property::Index i
   {
     mRegisteredProperties.push_back( RegisteredPropertyPair( index, RegisteredProperty( defaultValue.GetType(), name, Property::INVALID_INDEX, Property::INVALID_COMPONENT_INDEX ) ) );
     mPropertyDefaultValues.push_back( PropertyDefaultValuePair( index, defaultValue ) );
+    ++gRegistrationGeneration;
   }
   else
   {
@@ -492,6 +663,7 @@ void TypeInfo::AddAnimatablePropertyComponent( const std::string& name, Property
     if ( iter == mRegisteredProperties.end() )
     {
       mRegisteredProperties.push_back( RegisteredPropertyPair( index, RegisteredProperty( type, name, baseIndex, componentIndex ) ) );
+      ++gRegistrationGeneration;
       success = true;
     }
   }
@@ -507,6 +679,7 @@ void TypeInfo::AddChildProperty( const std::string& name, Property::Index index,
   if ( iter == mRegisteredChildProperties.end() )
   {
     mRegisteredChildProperties.push_back( RegisteredPropertyPair( index, RegisteredProperty( type, name, Property::INVALID_INDEX, Property::INVALID_COMPONENT_INDEX ) ) );
+    ++gRegistrationGeneration;
   }
   else
   {
@@ -516,14 +689,12 @@ void TypeInfo::AddChildProperty( const std::string& name, Property::Index index,
 
 size_t TypeInfo::GetPropertyCount() const
 {
-  size_t count( mRegisteredProperties.size() );
+  const Lookup& lookup = GetLookup();
 
-  Dali::TypeInfo base = TypeRegistry::Get()->GetTypeInfo( mBaseTypeName );
-  while ( base )
+  size_t count = 0;
+  for( std::vector< const TypeInfo* >::const_iterator iter = lookup.chain.begin(), endIter = lookup.chain.end(); iter != endIter; ++iter )
   {
-    const TypeInfo& baseImpl( GetImplementation(base) );
-    count += baseImpl.mRegisteredProperties.size();
-    base = TypeRegistry::Get()->GetTypeInfo( baseImpl.mBaseTypeName );
+    count += (*iter)->mRegisteredProperties.size();
   }
 
   return count;
@@ -533,21 +704,11 @@ Property::Index TypeInfo::GetPropertyIndex( const std::string& name ) const
 {
   Property::Index index = Property::INVALID_INDEX;
 
-  // Slow but should not be done that often
-  RegisteredPropertyContainer::const_iterator iter = find_if( mRegisteredProperties.begin(), mRegisteredProperties.end(),
-                                                          PropertyNameFinder< RegisteredPropertyPair >( name ) );
+  const Lookup::NameTable::Entry* entry = GetLookup().propertyNames.Find( &name );
 
-  if ( iter != mRegisteredProperties.end() )
-  {
-    index = iter->first;
-  }
-  else
+  if ( entry )
   {
-    Dali::TypeInfo base = TypeRegistry::Get()->GetTypeInfo( mBaseTypeName );
-    if ( base )
-    {
-      index = GetImplementation(base).GetPropertyIndex( name );
-    }
+    index = entry->owner->mRegisteredProperties[ entry->position ].first;
   }
 
   return index;
@@ -557,20 +718,11 @@ Property::Index TypeInfo::GetBasePropertyIndex( Property::Index index ) const
 {
   Property::Index basePropertyIndex = Property::INVALID_INDEX;
 
-  RegisteredPropertyContainer::const_iterator iter = find_if( mRegisteredProperties.begin(), mRegisteredProperties.end(),
-                                                          PairFinder< Property::Index, RegisteredPropertyPair >( index ) );
+  const Lookup::IndexTable::Entry* entry = GetLookup().propertyIndices.Find( index );
 
-  if ( iter != mRegisteredProperties.end() )
-  {
-    basePropertyIndex = iter->second.basePropertyIndex;
-  }
-  else
+  if ( entry )
   {
-    Dali::TypeInfo base = TypeRegistry::Get()->GetTypeInfo( mBaseTypeName );
-    if ( base )
-    {
-      basePropertyIndex = GetImplementation(base).GetBasePropertyIndex( index );
-    }
+    basePropertyIndex = entry->owner->mRegisteredProperties[ entry->position ].second.basePropertyIndex;
   }
 
   return basePropertyIndex;
@@ -580,20 +732,11 @@ int TypeInfo::GetComponentIndex( Property::Index index ) const
 {
   int componentIndex = Property::INVALID_COMPONENT_INDEX;
 
-  RegisteredPropertyContainer::const_iterator iter = find_if( mRegisteredProperties.begin(), mRegisteredProperties.end(),
-                                                          PairFinder< Property::Index, RegisteredPropertyPair >( index ) );
+  const Lookup::IndexTable::Entry* entry = GetLookup().propertyIndices.Find( index );
 
-  if ( iter != mRegisteredProperties.end() )
+  if ( entry )
   {
-    componentIndex = iter->second.componentIndex;
-  }
-  else
-  {
-    Dali::TypeInfo base = TypeRegistry::Get()->GetTypeInfo( mBaseTypeName );
-    if ( base )
-    {
-      componentIndex = GetImplementation(base).GetComponentIndex( index );
-    }
+    componentIndex = entry->owner->mRegisteredProperties[ entry->position ].second.componentIndex;
   }
 
   return componentIndex;
@@ -603,21 +746,11 @@ Property::Index TypeInfo::GetChildPropertyIndex( const std::string& name ) const
 {
   Property::Index index = Property::INVALID_INDEX;
 
-  // Slow but should not be done that often
-  RegisteredPropertyContainer::const_iterator iter = find_if( mRegisteredChildProperties.begin(), mRegisteredChildProperties.end(),
-                                                          PropertyNameFinder< RegisteredPropertyPair >( name ) );
+  const Lookup::NameTable::Entry* entry = GetLookup().childPropertyNames.Find( &name );
 
-  if ( iter != mRegisteredChildProperties.end() )
+  if ( entry )
   {
-    index = iter->first;
-  }
-  else
-  {
-    Dali::TypeInfo base = TypeRegistry::Get()->GetTypeInfo( mBaseTypeName );
-    if ( base )
-    {
-      index = GetImplementation(base).GetChildPropertyIndex( name );
-    }
+    index = entry->owner->mRegisteredChildProperties[ entry->position ].first;
   }
 
   return index;
@@ -625,18 +758,11 @@ Property::Index TypeInfo::GetChildPropertyIndex( const std::string& name ) const
 
 const std::string& TypeInfo::GetChildPropertyName( Property::Index index ) const
 {
-  RegisteredPropertyContainer::const_iterator iter = find_if( mRegisteredChildProperties.begin(), mRegisteredChildProperties.end(),
-                                                          PairFinder< Property::Index, RegisteredPropertyPair >( index ) );
+  const Lookup::IndexTable::Entry* entry = GetLookup().childPropertyIndices.Find( index );
 
-  if ( iter != mRegisteredChildProperties.end() )
+  if ( entry )
   {
-    return iter->second.name;
-  }
-
-  Dali::TypeInfo base = TypeRegistry::Get()->GetTypeInfo( mBaseTypeName );
-  if ( base )
-  {
-    return GetImplementation(base).GetChildPropertyName( index );
+    return entry->owner->mRegisteredChildProperties[ entry->position ].second.name;
   }
 
   DALI_ASSERT_ALWAYS( ! "Cannot find property index" ); // use the same assert as Object
@@ -646,24 +772,15 @@ Property::Type TypeInfo::GetChildPropertyType( Property::Index index ) const
 {
   Property::Type type( Property::NONE );
 
-  RegisteredPropertyContainer::const_iterator iter = find_if( mRegisteredChildProperties.begin(), mRegisteredChildProperties.end(),
-                                                          PairFinder< Property::Index, RegisteredPropertyPair >( index ) );
+  const Lookup::IndexTable::Entry* entry = GetLookup().childPropertyIndices.Find( index );
 
-  if ( iter != mRegisteredChildProperties.end() )
+  if ( entry )
   {
-    type = iter->second.type;
+    type = entry->owner->mRegisteredChildProperties[ entry->position ].second.type;
   }
   else
   {
-    Dali::TypeInfo base = TypeRegistry::Get()->GetTypeInfo( mBaseTypeName );
-    if ( base )
-    {
-      type = GetImplementation(base).GetChildPropertyType( index );
-    }
-    else
-    {
-      DALI_ASSERT_ALWAYS( ! "Cannot find property index" ); // use the same assert as Object
-    }
+    DALI_ASSERT_ALWAYS( ! "Cannot find property index" ); // use the same assert as Object
   }
 
   return type;
@@ -673,10 +790,9 @@ bool TypeInfo::IsPropertyWritable( Property::Index index ) const
 {
   bool writable( false );
 
-  RegisteredPropertyContainer::const_iterator iter = find_if( mRegisteredProperties.begin(), mRegisteredProperties.end(),
-                                                          PairFinder< Property::Index, RegisteredPropertyPair >( index ) );
+  const Lookup::IndexTable::Entry* entry = GetLookup().propertyIndices.Find( index );
 
-  if ( iter != mRegisteredProperties.end() )
+  if ( entry )
   {
     if( ( index >= ANIMATABLE_PROPERTY_REGISTRATION_START_INDEX ) && ( index <= ANIMATABLE_PROPERTY_REGISTRATION_MAX_INDEX ) )
     {
@@ -684,20 +800,12 @@ bool TypeInfo::IsPropertyWritable( Property::Index index ) const
     }
     else
     {
-      writable = iter->second.setFunc ? true : false;
+      writable = entry->owner->mRegisteredProperties[ entry->position ].second.setFunc ? true : false;
     }
   }
   else
   {
-    Dali::TypeInfo base = TypeRegistry::Get()->GetTypeInfo( mBaseTypeName );
-    if ( base )
-    {
-      writable = GetImplementation(base).IsPropertyWritable( index );
-    }
-    else
-    {
-      DALI_ASSERT_ALWAYS( ! "Cannot find property index" ); // use the same assert as Object
-    }
+    DALI_ASSERT_ALWAYS( ! "Cannot find property index" ); // use the same assert as Object
   }
 
   return writable;
@@ -707,24 +815,15 @@ Property::Type TypeInfo::GetPropertyType( Property::Index index ) const
 {
   Property::Type type( Property::NONE );
 
-  RegisteredPropertyContainer::const_iterator iter = find_if( mRegisteredProperties.begin(), mRegisteredProperties.end(),
-                                                          PairFinder< Property::Index, RegisteredPropertyPair >( index ) );
+  const Lookup::IndexTable::Entry* entry = GetLookup().propertyIndices.Find( index );
 
-  if ( iter != mRegisteredProperties.end() )
+  if ( entry )
   {
-    type = iter->second.type;
+    type = entry->owner->mRegisteredProperties[ entry->position ].second.type;
   }
   else
   {
-    Dali::TypeInfo base = TypeRegistry::Get()->GetTypeInfo( mBaseTypeName );
-    if ( base )
-    {
-      type = GetImplementation(base).GetPropertyType( index );
-    }
-    else
-    {
-      DALI_ASSERT_ALWAYS( ! "Cannot find property index" ); // use the same assert as Object
-    }
+    DALI_ASSERT_ALWAYS( ! "Cannot find property index" ); // use the same assert as Object
   }
 
   return type;
@@ -746,133 +845,107 @@ Property::Value TypeInfo::GetPropertyDefaultValue( Property::Index index ) const
 
 void TypeInfo::SetProperty( BaseObject *object, Property::Index index, const Property::Value& value ) const
 {
-  RegisteredPropertyContainer::const_iterator iter = find_if( mRegisteredProperties.begin(), mRegisteredProperties.end(),
-                                                              PairFinder< Property::Index, RegisteredPropertyPair >( index ) );
-  if ( iter != mRegisteredProperties.end() )
+  const Lookup::IndexTable::Entry* entry = GetLookup().propertyIndices.Find( index );
+  if ( entry )
   {
-    if( iter->second.setFunc )
+    const TypeInfo* owner = entry->owner;
+    const RegisteredProperty& property = owner->mRegisteredProperties[ entry->position ].second;
+    if( property.setFunc )
     {
-      if( mCSharpType )
+      if( owner->mCSharpType )
       {
         // CSharp wants a property name not an index
-        const std::string& name = (iter->second).name;
+        const std::string& name = property.name;
 
-        iter->second.cSharpSetFunc( object,name.c_str(), const_cast< Property::Value* >(&value) );
+        property.cSharpSetFunc( object,name.c_str(), const_cast< Property::Value* >(&value) );
       }
       else
       {
-        iter->second.setFunc( object, index, value );
+        property.setFunc( object, index, value );
       }
     }
   }
   else
   {
-    Dali::TypeInfo base = TypeRegistry::Get()->GetTypeInfo( mBaseTypeName );
-    if ( base )
-    {
-      GetImplementation(base).SetProperty( object, index, value );
-    }
-    else
-    {
-      DALI_ASSERT_ALWAYS( ! "Cannot find property index" ); // use the same assert as Object
-    }
+    DALI_ASSERT_ALWAYS( ! "Cannot find property index" ); // use the same assert as Object
   }
 }
 
 void TypeInfo::SetProperty( BaseObject *object, const std::string& name, const Property::Value& value ) const
 {
-  RegisteredPropertyContainer::const_iterator iter = find_if( mRegisteredProperties.begin(), mRegisteredProperties.end(),
-                                                              PropertyNameFinder< RegisteredPropertyPair >( name ) );
-  if ( iter != mRegisteredProperties.end() )
+  const Lookup::NameTable::Entry* entry = GetLookup().propertyNames.Find( &name );
+  if ( entry )
   {
-    DALI_ASSERT_ALWAYS( iter->second.setFunc && "Trying to write to a read-only property" );
+    const TypeInfo* owner = entry->owner;
+    const RegisteredPropertyPair& property = owner->mRegisteredProperties[ entry->position ];
 
-    if( mCSharpType )
+    DALI_ASSERT_ALWAYS( property.second.setFunc && "Trying to write to a read-only property" );
+
+    if( owner->mCSharpType )
     {
       // CSharp wants a property name not an index
-      iter->second.cSharpSetFunc( object,name.c_str(), const_cast< Property::Value* >(&value ));
+      property.second.cSharpSetFunc( object,name.c_str(), const_cast< Property::Value* >(&value ));
     }
     else
     {
-      iter->second.setFunc( object, iter->first, value );
+      property.second.setFunc( object, property.first, value );
     }
   }
   else
   {
-    Dali::TypeInfo base = TypeRegistry::Get()->GetTypeInfo( mBaseTypeName );
-    if ( base )
-    {
-      GetImplementation(base).SetProperty( object, name, value );
-    }
-    else
-    {
-      DALI_ASSERT_ALWAYS( ! "Cannot find property name" );
-    }
+    DALI_ASSERT_ALWAYS( ! "Cannot find property name" );
   }
 }
 
 Property::Value TypeInfo::GetProperty( const BaseObject *object, Property::Index index ) const
 {
-  RegisteredPropertyContainer::const_iterator iter = find_if( mRegisteredProperties.begin(), mRegisteredProperties.end(),
-                                                          PairFinder< Property::Index, RegisteredPropertyPair >( index ) );
-  if( iter != mRegisteredProperties.end() )
+  const Lookup::IndexTable::Entry* entry = GetLookup().propertyIndices.Find( index );
+  if( entry )
   {
-    if( mCSharpType ) // using csharp property get which returns a pointer to a Property::Value
+    const TypeInfo* owner = entry->owner;
+    const RegisteredProperty& property = owner->mRegisteredProperties[ entry->position ].second;
+    if( owner->mCSharpType ) // using csharp property get which returns a pointer to a Property::Value
     {
       // CSharp wants a property name not an index
       // CSharp callback can't return an object by value, it can only return a pointer
       // CSharp has ownership of the pointer contents, which is fine because we are returning by from this function by value
-      const std::string& name = (iter->second).name;
+      const std::string& name = property.name;
 
-      return *( iter->second.cSharpGetFunc( const_cast< BaseObject* >( object ), name.c_str()) );
+      return *( property.cSharpGetFunc( const_cast< BaseObject* >( object ), name.c_str()) );
 
     }
     else
     {
       // Need to remove the constness here as CustomActor will not be able to call Downcast with a const pointer to the object
-      return iter->second.getFunc( const_cast< BaseObject* >( object ), index );
+      return property.getFunc( const_cast< BaseObject* >( object ), index );
     }
   }
 
-  Dali::TypeInfo base = TypeRegistry::Get()->GetTypeInfo( mBaseTypeName );
-  if ( base )
-  {
-    return GetImplementation( base ).GetProperty( object, index );
-  }
-
   DALI_ASSERT_ALWAYS( ! "Cannot find property index" ); // use the same assert as Object
 }
 
 Property::Value TypeInfo::GetProperty( const BaseObject *object, const std::string& name ) const
 {
-  RegisteredPropertyContainer::const_iterator iter = find_if( mRegisteredProperties.begin(), mRegisteredProperties.end(),
-                                                            PropertyNameFinder< RegisteredPropertyPair >( name ) );
-
-
-
-  if( iter != mRegisteredProperties.end() )
+  const Lookup::NameTable::Entry* entry = GetLookup().propertyNames.Find( &name );
+  if( entry )
   {
-    if( mCSharpType ) // using csharp property get which returns a pointer to a Property::Value
+    const TypeInfo* owner = entry->owner;
+    const RegisteredPropertyPair& property = owner->mRegisteredProperties[ entry->position ];
+    if( owner->mCSharpType ) // using csharp property get which returns a pointer to a Property::Value
     {
        // CSharp wants a property name not an index
        // CSharp callback can't return an object by value, it can only return a pointer
        // CSharp has ownership of the pointer contents, which is fine because we are returning by from this function by value
-       return *( iter->second.cSharpGetFunc( const_cast< BaseObject* >( object ), name.c_str() ));
+       return *( property.second.cSharpGetFunc( const_cast< BaseObject* >( object ), name.c_str() ));
 
     }
     else
     {
       // Need to remove the constness here as CustomActor will not be able to call Downcast with a const pointer to the object
-      return iter->second.getFunc( const_cast< BaseObject* >( object ), iter->first );
+      return property.second.getFunc( const_cast< BaseObject* >( object ), property.first );
     }
   }
 
-  Dali::TypeInfo base = TypeRegistry::Get()->GetTypeInfo( mBaseTypeName );
-  if ( base )
-  {
-    return GetImplementation( base ).GetProperty( object, name );
-  }
-
   DALI_ASSERT_ALWAYS( ! "Cannot find property name" );
 }
 
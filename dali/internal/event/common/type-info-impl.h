@@ -308,6 +308,14 @@ public:
 
 private:
 
+  struct Lookup;
+
+  /**
+   * Retrieve the lookup tables of this type, building them if they are missing or out of date.
+   * @return The lookup tables.
+   */
+  const Lookup& GetLookup() const;
+
   struct RegisteredProperty
   {
     RegisteredProperty()
@@ -391,6 +399,7 @@ private:
   RegisteredPropertyContainer mRegisteredProperties;
   RegisteredPropertyContainer mRegisteredChildProperties;
   PropertyDefaultValueContainer mPropertyDefaultValues;
+  mutable Lookup* mLookup;        ///< Hashed names and indices of this type and its bases, built on first use
 };
 
 } // namespace Internal
@@ -58,6 +58,7 @@ TypeRegistry::TypeRegistry()
 
 TypeRegistry::~TypeRegistry()
 {
+  mTypeIdLut.clear();
   mRegistryLut.clear();
 }
 
@@ -83,6 +84,12 @@ Dali::TypeInfo TypeRegistry::GetTypeInfo( const std::type_info& registerType )
 {
   Dali::TypeInfo ret;
 
+  TypeIdMap::iterator cached = mTypeIdLut.find( &registerType );
+  if( cached != mTypeIdLut.end() )
+  {
+    return cached->second;
+  }
+
   std::string typeName = DemangleClassName(registerType.name());
 
   RegistryMap::iterator iter = mRegistryLut.find(typeName);
@@ -90,6 +97,9 @@ Dali::TypeInfo TypeRegistry::GetTypeInfo( const std::type_info& registerType )
   if( iter != mRegistryLut.end() )
   {
     ret = iter->second;
+
+    // Types are never unregistered, so the result can be reused
+    mTypeIdLut[ &registerType ] = ret;
   }
   else
   {
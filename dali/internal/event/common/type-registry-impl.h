@@ -220,6 +220,12 @@ private:
   typedef std::map<std::string, Dali::TypeInfo> RegistryMap;
   RegistryMap mRegistryLut;
 
+  /*
+   * Map from std::type_info to TypeInfo, so that types which have already been found do not need demangling
+   */
+  typedef std::map<const std::type_info*, Dali::TypeInfo> TypeIdMap;
+  TypeIdMap mTypeIdLut;
+
   typedef std::vector<Dali::TypeInfo::CreateFunction> InitFunctions;
   InitFunctions mInitFunctions;
 
@@ -19,20 +19,63 @@
 #include <dali/internal/event/effects/shader-factory.h>
 
 // EXTERNAL INCLUDES
+#include <algorithm>
+#include <cstring>
 #include <sstream>
+#include <utility>
+#include <vector>
+#include <stdint.h>
 
 // INTERNAL INCLUDES
 #include <dali/public-api/dali-core-version.h>
 #include <dali/public-api/common/dali-common.h>
 #include <dali/devel-api/common/hash.h>
+#include <dali/devel-api/threading/thread.h>
 #include <dali/integration-api/debug.h>
 #include <dali/integration-api/platform-abstraction.h>
-#include <dali/internal/event/common/thread-local-storage.h>
 
 namespace
 {
 const char* VERSION_SEPARATOR = "-";
 const char* SHADER_SUFFIX = ".dali-bin";
+const char* INDEX_NAME = "shader-cache";
+
+const uint32_t BINARY_MAGIC = 0x44534842;                     ///< "DSHB", the start of a binary file
+const uint32_t INDEX_MAGIC = 0x44534849;                      ///< "DSHI", the start of the index file
+const unsigned int DEFAULT_CACHE_SIZE = 8u * 1024u * 1024u;   ///< The default maximum size of the binary files
+
+/**
+ * @brief Precedes the program binary in a binary file
+ */
+struct BinaryHeader
+{
+  uint32_t magic;
+  uint32_t reserved;
+  uint64_t driverHash;  ///< Identifies the driver which compiled the binary
+};
+
+/**
+ * @brief The start of the index file, followed by the records
+ */
+struct IndexHeader
+{
+  uint32_t magic;
+  uint32_t recordCount;
+  uint32_t useCount;    ///< The use count of the cache when the index was saved
+  uint32_t reserved;
+};
+
+/**
+ * @brief Describes a binary file in the index file
+ */
+struct IndexRecord
+{
+  uint64_t shaderHash;
+  uint64_t driverHash;
+  uint32_t fileSize;
+  uint32_t lastUse;
+};
+
 }
 
 namespace Dali
@@ -58,67 +101,176 @@ void shaderBinaryFilename( size_t shaderHash, std::string& filename )
   filename = binaryShaderFilenameBuilder.str();
 }
 
+/**
+ * @brief Generates the filename of the index of the shader binaries.
+ * @param[out] filename A string to overwrite with the filename.
+ */
+void indexFilename( std::string& filename )
+{
+  std::stringstream indexFilenameBuilder( std::ios_base::out );
+  indexFilenameBuilder << CORE_MAJOR_VERSION << VERSION_SEPARATOR << CORE_MINOR_VERSION << VERSION_SEPARATOR << CORE_MICRO_VERSION << VERSION_SEPARATOR
+                       << INDEX_NAME
+                       << SHADER_SUFFIX;
+  filename = indexFilenameBuilder.str();
 }
 
-ShaderFactory::ShaderFactory()
+} // unnamed namespace
+
+/**
+ * @brief A binary in the cache
+ */
+struct ShaderFactory::CacheEntry
+{
+  CacheEntry( size_t shaderHash, size_t driverHash, unsigned int fileSize, unsigned int lastUse )
+  : shaderHash( shaderHash ),
+    driverHash( driverHash ),
+    fileSize( fileSize ),
+    lastUse( lastUse ),
+    shaderData(),
+    binary()
+  {
+  }
+
+  size_t                      shaderHash;  ///< The hash of the shader sources
+  size_t                      driverHash;  ///< Identifies the driver which compiled the binary
+  unsigned int                fileSize;    ///< The size of the binary file, or zero if it was not saved
+  unsigned int                lastUse;     ///< The use count of the cache when the binary was last used
+  ShaderDataPtr               shaderData;  ///< The shader, once it has been loaded or saved by the event thread
+  Dali::Vector<unsigned char> binary;      ///< The binary loaded by the preload thread, until the shader is loaded
+};
+
+/**
+ * @brief Reads the index file and loads the binaries it lists in the background, each time a context is created
+ */
+class ShaderFactory::PreloadThread : public Thread
+{
+public:
+
+  PreloadThread( ShaderFactory& factory )
+  : mFactory( factory )
+  {
+  }
+
+  virtual ~PreloadThread()
+  {
+  }
+
+protected:
+
+  virtual void Run()
+  {
+    mFactory.RunPreloads();
+  }
+
+private:
+
+  ShaderFactory& mFactory;
+};
+
+ShaderFactory::ShaderFactory( Integration::PlatformAbstraction& platformAbstraction )
+: mPlatformAbstraction( platformAbstraction ),
+  mCacheEntries(),
+  mMutex(),
+  mIndexFileMutex(),
+  mPreloadWait(),
+  mPreloadedWait(),
+  mPreloadThread( NULL ),
+  mPreloadRequests( 0u ),
+  mPreloadsDone( 0u ),
+  mDriverHash( 0u ),
+  mCacheSize( DEFAULT_CACHE_SIZE ),
+  mUseCount( 0u ),
+  mDriverKnown( false ),
+  mIndexLoaded( false ),
+  mIndexChanged( false ),
+  mTerminate( false )
 {
 }
 
 ShaderFactory::~ShaderFactory()
 {
-  // Let all the cached objects destroy themselves:
-  for( int i = 0, cacheSize = mShaderBinaryCache.Size(); i < cacheSize; ++i )
+  // The preload thread is only joined here
+  PreloadThread* preloadThread = NULL;
   {
-    if( mShaderBinaryCache[i] )
-    {
-      mShaderBinaryCache[i]->Unreference();
-    }
+    ConditionalWait::ScopedLock lock( mPreloadWait );
+    mTerminate = true;
+    preloadThread = mPreloadThread;
+    mPreloadThread = NULL;
+    mPreloadWait.Notify( lock );
+  }
+
+  if( preloadThread )
+  {
+    preloadThread->Join();
+    delete preloadThread;
   }
+
+  // Remember which binaries were used
+  SaveIndex();
 }
 
 ShaderDataPtr ShaderFactory::Load( const std::string& vertexSource, const std::string& fragmentSource, const Dali::Shader::Hint::Value hints, size_t& shaderHash )
 {
   // Work out the filename for the binary that the glsl source will be compiled and linked to:
   shaderHash = CalculateHash( vertexSource.c_str(), fragmentSource.c_str() );
-  std::string binaryShaderFilename;
-  shaderBinaryFilename( shaderHash, binaryShaderFilename );
 
   ShaderDataPtr shaderData;
+  bool loadFile = false;
 
-  /// Check a cache of previously loaded shaders:
-  for( int i = 0, cacheSize = mShaderBinaryCache.Size(); i < cacheSize; ++i )
+  /// Check the cache of previously loaded and preloaded shaders:
   {
-    if( mShaderBinaryCache[i]->GetHashValue() == shaderHash )
+    Mutex::ScopedLock lock( mMutex );
+    CacheEntry* entry = FindEntry( shaderHash );
+    if( entry )
     {
-      shaderData = mShaderBinaryCache[i];
+      entry->lastUse = ++mUseCount;
+      mIndexChanged = true;
+
+      if( !entry->shaderData && !entry->binary.Empty() )
+      {
+        // Preloaded binaries have no sources
+        entry->shaderData = new ShaderData( vertexSource, fragmentSource, hints );
+        entry->shaderData->SetHashValue( shaderHash );
+        entry->shaderData->GetBuffer().Swap( entry->binary );
+      }
+      shaderData = entry->shaderData;
 
-      DALI_LOG_INFO( Debug::Filter::gShader, Debug::General, "Mem cache hit on path: \"%s\"\n", binaryShaderFilename.c_str() );
-      break;
+      // The binary may not have been preloaded yet
+      loadFile = !shaderData;
+    }
+    else
+    {
+      // Until the index has been read, the binary may exist without an entry
+      loadFile = !mIndexLoaded;
     }
   }
 
-  // If memory cache failed check the file system for a binary or return a source-only ShaderData:
-  if( shaderData.Get() == NULL )
+  if( shaderData )
   {
-    // Allocate the structure that returns the loaded shader:
-    shaderData = new ShaderData( vertexSource, fragmentSource, hints );
-    shaderData->SetHashValue( shaderHash );
-    shaderData->GetBuffer().Clear();
+    DALI_LOG_INFO( Debug::Filter::gShader, Debug::General, "Mem cache hit for hash: %u\n", shaderHash );
+    return shaderData;
+  }
 
-    // Try to load the binary (this will fail if the shader source has never been compiled before):
-    ThreadLocalStorage& tls = ThreadLocalStorage::Get();
-    Integration::PlatformAbstraction& platformAbstraction = tls.GetPlatformAbstraction();
-    const bool loaded = platformAbstraction.LoadShaderBinaryFile( binaryShaderFilename, shaderData->GetBuffer() );
+  // Allocate the structure that returns the loaded shader:
+  shaderData = new ShaderData( vertexSource, fragmentSource, hints );
+  shaderData->SetHashValue( shaderHash );
+  shaderData->GetBuffer().Clear();
 
-    if( loaded )
+  // Try to load the binary (this will fail if the shader source has never been compiled before):
+  size_t driverHash = 0u;
+  if( loadFile && LoadBinaryFile( shaderHash, shaderData->GetBuffer(), driverHash ) )
+  {
+    Mutex::ScopedLock lock( mMutex );
+    CacheEntry* entry = FindEntry( shaderHash );
+    if( !entry )
     {
-      MemoryCacheInsert( *shaderData );
+      entry = new CacheEntry( shaderHash, driverHash, shaderData->GetBufferSize() + sizeof( BinaryHeader ), 0u );
+      mCacheEntries.PushBack( entry );
     }
-
-    DALI_LOG_INFO(Debug::Filter::gShader, Debug::General, loaded ?
-        "loaded on path: \"%s\"\n" :
-        "failed to load on path: \"%s\"\n",
-        binaryShaderFilename.c_str());
+    entry->lastUse = ++mUseCount;
+    entry->shaderData = shaderData;
+    entry->binary.Clear();
+    mIndexChanged = true;
   }
 
   return shaderData;
@@ -126,35 +278,383 @@ ShaderDataPtr ShaderFactory::Load( const std::string& vertexSource, const std::s
 
 void ShaderFactory::SaveBinary( Internal::ShaderDataPtr shaderData )
 {
-  // Save the binary to the file system:
+  const size_t shaderHash = shaderData->GetHashValue();
   std::string binaryShaderFilename;
-  shaderBinaryFilename( shaderData->GetHashValue(), binaryShaderFilename );
+  shaderBinaryFilename( shaderHash, binaryShaderFilename );
 
-  ThreadLocalStorage& tls = ThreadLocalStorage::Get();
-  Integration::PlatformAbstraction& platformAbstraction = tls.GetPlatformAbstraction();
-  const bool saved = platformAbstraction.SaveShaderBinaryFile( binaryShaderFilename, &shaderData->GetBuffer()[0], shaderData->GetBufferSize() );
+  BinaryHeader header;
+  header.magic = BINARY_MAGIC;
+  header.reserved = 0u;
+  {
+    Mutex::ScopedLock lock( mMutex );
+    header.driverHash = mDriverHash;
+  }
 
-  // Save the binary into to memory cache:
-  MemoryCacheInsert( *shaderData );
+  // Save the binary to the file system:
+  Dali::Vector< unsigned char > file;
+  file.Resize( sizeof( BinaryHeader ) + shaderData->GetBufferSize() );
+  memcpy( file.Begin(), &header, sizeof( BinaryHeader ) );
+  memcpy( file.Begin() + sizeof( BinaryHeader ), shaderData->GetBufferData(), shaderData->GetBufferSize() );
+  const bool saved = mPlatformAbstraction.SaveShaderBinaryFile( binaryShaderFilename, file.Begin(), file.Count() );
 
   DALI_LOG_INFO( Debug::Filter::gShader, Debug::General, saved ? "Saved to file: %s\n" : "Save to file failed: %s\n", binaryShaderFilename.c_str() );
-  if( saved ) {} // Avoid unused variable warning in release builds
+
+  // Save the binary into to memory cache, and evict binaries to make room for it:
+  Dali::Vector< size_t > evicted;
+  {
+    Mutex::ScopedLock lock( mMutex );
+    CacheEntry* entry = FindEntry( shaderHash );
+    if( !entry )
+    {
+      entry = new CacheEntry( shaderHash, 0u, 0u, 0u );
+      mCacheEntries.PushBack( entry );
+    }
+    entry->driverHash = header.driverHash;
+    entry->fileSize = saved ? file.Count() : 0u;
+    entry->lastUse = ++mUseCount;
+    entry->shaderData = shaderData;
+    entry->binary.Clear();
+    mIndexChanged = true;
+
+    EvictEntries( evicted );
+  }
+
+  SaveIndex();
+  ClearBinaryFiles( evicted );
+}
+
+void ShaderFactory::ContextCreated( const std::string& vendor, const std::string& renderer, const std::string& version )
+{
+  {
+    Mutex::ScopedLock lock( mMutex );
+    mDriverHash = CalculateHash( vendor + renderer + version );
+    mDriverKnown = true;
+  }
+
+  // The files are read and written by the preload thread, so that the render thread does no file I/O
+  ConditionalWait::ScopedLock lock( mPreloadWait );
+  ++mPreloadRequests;
+  if( !mPreloadThread && !mTerminate )
+  {
+    mPreloadThread = new PreloadThread( *this );
+    mPreloadThread->Start();
+  }
+  mPreloadWait.Notify( lock );
 }
 
-void ShaderFactory::MemoryCacheInsert( ShaderData& shaderData )
+void ShaderFactory::WaitForPreload()
 {
-  DALI_ASSERT_DEBUG( shaderData.GetBufferSize() > 0 );
+  unsigned int preloadRequests = 0u;
+  {
+    ConditionalWait::ScopedLock lock( mPreloadWait );
+    preloadRequests = mPreloadRequests;
+  }
 
-  // Save the binary into to memory cache:
-  if( shaderData.GetBufferSize() > 0 )
+  ConditionalWait::ScopedLock lock( mPreloadedWait );
+  while( mPreloadsDone < preloadRequests )
   {
-    mShaderBinaryCache.Reserve( mShaderBinaryCache.Size() + 1 ); // Make sure the push won't throw after we inc the ref count.
-    shaderData.Reference();
-    mShaderBinaryCache.PushBack( &shaderData );
-    DALI_LOG_INFO( Debug::Filter::gShader, Debug::General, "CACHED BINARY FOR HASH: %u\n", shaderData.GetHashValue() );
+    mPreloadedWait.Wait( lock );
   }
 }
 
+void ShaderFactory::SetCacheSize( unsigned int bytes )
+{
+  Dali::Vector< size_t > evicted;
+  {
+    Mutex::ScopedLock lock( mMutex );
+    mCacheSize = bytes;
+    EvictEntries( evicted );
+  }
+
+  SaveIndex();
+  ClearBinaryFiles( evicted );
+}
+
+ShaderFactory::CacheEntry* ShaderFactory::FindEntry( size_t shaderHash )
+{
+  for( CacheEntryContainer::Iterator iter = mCacheEntries.Begin(), endIter = mCacheEntries.End(); iter != endIter; ++iter )
+  {
+    if( (*iter)->shaderHash == shaderHash )
+    {
+      return *iter;
+    }
+  }
+  return NULL;
+}
+
+bool ShaderFactory::LoadBinaryFile( size_t shaderHash, Dali::Vector< unsigned char >& binary, size_t& driverHash )
+{
+  std::string binaryShaderFilename;
+  shaderBinaryFilename( shaderHash, binaryShaderFilename );
+
+  bool loaded = mPlatformAbstraction.LoadShaderBinaryFile( binaryShaderFilename, binary );
+
+  // Evicted binaries are empty files, and binaries from another driver would fail to link
+  BinaryHeader header;
+  loaded = loaded && binary.Count() > sizeof( BinaryHeader );
+  if( loaded )
+  {
+    memcpy( &header, binary.Begin(), sizeof( BinaryHeader ) );
+
+    Mutex::ScopedLock lock( mMutex );
+    loaded = header.magic == BINARY_MAGIC && ( !mDriverKnown || header.driverHash == mDriverHash );
+  }
+
+  if( loaded )
+  {
+    binary.Erase( binary.Begin(), binary.Begin() + sizeof( BinaryHeader ) );
+    driverHash = header.driverHash;
+  }
+  else
+  {
+    binary.Clear();
+  }
+
+  DALI_LOG_INFO( Debug::Filter::gShader, Debug::General, loaded ?
+      "loaded on path: \"%s\"\n" :
+      "failed to load on path: \"%s\"\n",
+      binaryShaderFilename.c_str() );
+
+  return loaded;
+}
+
+void ShaderFactory::ClearBinaryFiles( const Dali::Vector< size_t >& shaderHashes )
+{
+  for( Dali::Vector< size_t >::ConstIterator iter = shaderHashes.Begin(), endIter = shaderHashes.End(); iter != endIter; ++iter )
+  {
+    std::string binaryShaderFilename;
+    shaderBinaryFilename( *iter, binaryShaderFilename );
+    mPlatformAbstraction.SaveShaderBinaryFile( binaryShaderFilename, NULL, 0u );
+  }
+}
+
+void ShaderFactory::EvictEntries( Dali::Vector< size_t >& evicted )
+{
+  unsigned int totalSize = 0u;
+  for( CacheEntryContainer::Iterator iter = mCacheEntries.Begin(), endIter = mCacheEntries.End(); iter != endIter; ++iter )
+  {
+    totalSize += (*iter)->fileSize;
+  }
+
+  while( totalSize > mCacheSize )
+  {
+    CacheEntryContainer::Iterator leastRecent = mCacheEntries.End();
+    for( CacheEntryContainer::Iterator iter = mCacheEntries.Begin(), endIter = mCacheEntries.End(); iter != endIter; ++iter )
+    {
+      if( (*iter)->fileSize > 0u && ( leastRecent == endIter || (*iter)->lastUse < (*leastRecent)->lastUse ) )
+      {
+        leastRecent = iter;
+      }
+    }
+
+    DALI_LOG_INFO( Debug::Filter::gShader, Debug::General, "Evicting binary for hash: %u\n", (*leastRecent)->shaderHash );
+
+    totalSize -= (*leastRecent)->fileSize;
+    evicted.PushBack( (*leastRecent)->shaderHash );
+    mCacheEntries.Erase( leastRecent );
+    mIndexChanged = true;
+  }
+}
+
+void ShaderFactory::RunPreloads()
+{
+  unsigned int preloadRequests = 0u;
+  while( true )
+  {
+    bool terminate = false;
+    {
+      ConditionalWait::ScopedLock lock( mPreloadWait );
+      while( mPreloadRequests == preloadRequests && !mTerminate )
+      {
+        mPreloadWait.Wait( lock );
+      }
+
+      if( mPreloadRequests == preloadRequests )
+      {
+        break;
+      }
+
+      // Contexts created whilst the previous one was preloading are handled together
+      preloadRequests = mPreloadRequests;
+      terminate = mTerminate;
+    }
+
+    // The index is still read when the factory is being destroyed, so that the binaries used are saved in it
+    LoadIndex();
+    if( !terminate )
+    {
+      Preload();
+    }
+
+    ConditionalWait::ScopedLock lock( mPreloadedWait );
+    mPreloadsDone = preloadRequests;
+    mPreloadedWait.Notify( lock );
+  }
+}
+
+void ShaderFactory::LoadIndex()
+{
+  bool indexLoaded = false;
+  {
+    Mutex::ScopedLock lock( mMutex );
+    indexLoaded = mIndexLoaded;
+  }
+
+  // The index is only read once, and only this thread sets mIndexLoaded
+  std::string filename;
+  indexFilename( filename );
+  Dali::Vector< unsigned char > index;
+  const bool indexRead = !indexLoaded && mPlatformAbstraction.LoadShaderBinaryFile( filename, index );
+
+  Dali::Vector< size_t > discarded;
+  {
+    Mutex::ScopedLock lock( mMutex );
+    if( !mIndexLoaded )
+    {
+      mIndexLoaded = true;
+
+      IndexHeader header;
+      if( indexRead && index.Count() >= sizeof( IndexHeader ) )
+      {
+        memcpy( &header, index.Begin(), sizeof( IndexHeader ) );
+      }
+
+      if( indexRead && index.Count() >= sizeof( IndexHeader ) && header.magic == INDEX_MAGIC &&
+          index.Count() >= sizeof( IndexHeader ) + header.recordCount * sizeof( IndexRecord ) )
+      {
+        // The binaries used so far this run are more recent than those in the index
+        for( CacheEntryContainer::Iterator iter = mCacheEntries.Begin(), endIter = mCacheEntries.End(); iter != endIter; ++iter )
+        {
+          (*iter)->lastUse += header.useCount;
+        }
+        mUseCount += header.useCount;
+
+        for( unsigned int i = 0u; i < header.recordCount; ++i )
+        {
+          IndexRecord record;
+          memcpy( &record, index.Begin() + sizeof( IndexHeader ) + i * sizeof( IndexRecord ), sizeof( IndexRecord ) );
+
+          if( record.driverHash != mDriverHash )
+          {
+            // Compiled by another driver, e.g. before a system update
+            discarded.PushBack( record.shaderHash );
+            mIndexChanged = true;
+          }
+          else if( !FindEntry( record.shaderHash ) )
+          {
+            mCacheEntries.PushBack( new CacheEntry( record.shaderHash, record.driverHash, record.fileSize, record.lastUse ) );
+          }
+        }
+      }
+    }
+    else
+    {
+      // The new context may have a different driver
+      for( CacheEntryContainer::Iterator iter = mCacheEntries.Begin(); iter != mCacheEntries.End(); )
+      {
+        if( (*iter)->driverHash != mDriverHash && !(*iter)->shaderData )
+        {
+          discarded.PushBack( (*iter)->shaderHash );
+          iter = mCacheEntries.Erase( iter );
+          mIndexChanged = true;
+        }
+        else
+        {
+          ++iter;
+        }
+      }
+    }
+  }
+
+  SaveIndex();
+  ClearBinaryFiles( discarded );
+}
+
+void ShaderFactory::Preload()
+{
+  // Load the most recently used binaries first, as they are the most likely to be needed soon
+  std::vector< std::pair< unsigned int, size_t > > preload;
+  {
+    Mutex::ScopedLock lock( mMutex );
+    for( CacheEntryContainer::Iterator iter = mCacheEntries.Begin(), endIter = mCacheEntries.End(); iter != endIter; ++iter )
+    {
+      if( !(*iter)->shaderData && (*iter)->binary.Empty() )
+      {
+        preload.push_back( std::make_pair( (*iter)->lastUse, (*iter)->shaderHash ) );
+      }
+    }
+  }
+  std::sort( preload.begin(), preload.end() );
+
+  for( std::vector< std::pair< unsigned int, size_t > >::reverse_iterator iter = preload.rbegin(), endIter = preload.rend(); iter != endIter; ++iter )
+  {
+    Dali::Vector< unsigned char > binary;
+    size_t driverHash = 0u;
+    const bool loaded = LoadBinaryFile( iter->second, binary, driverHash );
+
+    Mutex::ScopedLock lock( mMutex );
+    CacheEntry* entry = FindEntry( iter->second );
+    if( entry && !entry->shaderData && entry->binary.Empty() )
+    {
+      if( loaded )
+      {
+        entry->binary.Swap( binary );
+      }
+      else
+      {
+        // The file is missing; forget it
+        mCacheEntries.Erase( std::find( mCacheEntries.Begin(), mCacheEntries.End(), entry ) );
+        mIndexChanged = true;
+      }
+    }
+  }
+
+  SaveIndex();
+}
+
+void ShaderFactory::SaveIndex()
+{
+  // Held whilst the file is written, so that an older index cannot overwrite a newer one
+  Mutex::ScopedLock fileLock( mIndexFileMutex );
+
+  IndexHeader header;
+  header.magic = INDEX_MAGIC;
+  header.recordCount = 0u;
+  header.reserved = 0u;
+
+  Dali::Vector< unsigned char > index;
+  {
+    Mutex::ScopedLock lock( mMutex );
+    if( !mIndexLoaded || !mIndexChanged )
+    {
+      // Saving before the index has been read would lose the binaries it lists
+      return;
+    }
+
+    header.useCount = mUseCount;
+    index.Resize( sizeof( IndexHeader ) + mCacheEntries.Count() * sizeof( IndexRecord ) );
+    for( CacheEntryContainer::Iterator iter = mCacheEntries.Begin(), endIter = mCacheEntries.End(); iter != endIter; ++iter )
+    {
+      if( (*iter)->fileSize > 0u )
+      {
+        IndexRecord record;
+        record.shaderHash = (*iter)->shaderHash;
+        record.driverHash = (*iter)->driverHash;
+        record.fileSize = (*iter)->fileSize;
+        record.lastUse = (*iter)->lastUse;
+        memcpy( index.Begin() + sizeof( IndexHeader ) + header.recordCount * sizeof( IndexRecord ), &record, sizeof( IndexRecord ) );
+        ++header.recordCount;
+      }
+    }
+    mIndexChanged = false;
+  }
+  memcpy( index.Begin(), &header, sizeof( IndexHeader ) );
+
+  std::string filename;
+  indexFilename( filename );
+  mPlatformAbstraction.SaveShaderBinaryFile( filename, index.Begin(), sizeof( IndexHeader ) + header.recordCount * sizeof( IndexRecord ) );
+}
+
 } // namespace Internal
 
 } // namespace Dali
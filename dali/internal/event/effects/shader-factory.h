@@ -20,6 +20,9 @@
 
 // INTERNAL INCLUDES
 #include <dali/public-api/common/dali-vector.h>
+#include <dali/devel-api/common/owner-container.h>
+#include <dali/devel-api/threading/conditional-wait.h>
+#include <dali/devel-api/threading/mutex.h>
 #include <dali/internal/common/message.h>
 #include <dali/internal/common/shader-data.h>
 #include <dali/internal/common/shader-saver.h>
@@ -27,6 +30,11 @@
 namespace Dali
 {
 
+namespace Integration
+{
+class PlatformAbstraction;
+}
+
 namespace Internal
 {
 
@@ -34,18 +42,28 @@ class ShaderData;
 typedef IntrusivePtr<ShaderData> ShaderDataPtr;
 
 /**
- * @brief ShaderFactory loads and saves shader binaries synchronously.
+ * @brief ShaderFactory loads and saves shader binaries, and manages the cache of binaries on disk.
  *
  * Binaries loaded or saved are also cached by the ShaderFactory.
+ *
+ * An index file records the binaries on disk, the GL driver they were compiled by and when they were
+ * last used. When the GL context is created, the index and the binaries compiled by the current driver
+ * are loaded by a preload thread, so that the programs of a second launch need not be compiled.
+ * The preload thread is started by the first context, and is stopped by the destructor.
+ * Binaries compiled by another driver are discarded, and the least recently used binaries are evicted
+ * when the binaries would exceed the size of the cache.
+ *
+ * The PlatformAbstraction cannot delete files, so an evicted binary is overwritten with an empty file.
  */
 class ShaderFactory : public ShaderSaver
 {
 public:
 
   /**
-   * Default constructor
+   * Constructor
+   * @param[in] platformAbstraction Used to load and save the binaries
    */
-  ShaderFactory();
+  ShaderFactory( Integration::PlatformAbstraction& platformAbstraction );
 
   /**
    * Destructor
@@ -79,9 +97,81 @@ public:
    */
   virtual void SaveBinary( Internal::ShaderDataPtr shader );
 
+  /**
+   * @brief Identifies the GL driver, and wakes the preload thread to load the index and the cached binaries.
+   *
+   * Binaries compiled by a different driver are discarded by the preload thread.
+   * Multi-threading note: this method is called from the render thread, and does no file I/O.
+   * @param[in] vendor The GL_VENDOR string
+   * @param[in] renderer The GL_RENDERER string
+   * @param[in] version The GL_VERSION string
+   */
+  void ContextCreated( const std::string& vendor, const std::string& renderer, const std::string& version );
+
+  /**
+   * @brief Waits until the preload thread has handled the contexts created so far.
+   */
+  void WaitForPreload();
+
+  /**
+   * @copydoc Dali::Integration::Core::SetShaderBinaryCacheSize()
+   */
+  void SetCacheSize( unsigned int bytes );
+
 private:
 
-  void MemoryCacheInsert( Internal::ShaderData& shaderData );
+  struct CacheEntry;
+  class PreloadThread;
+
+  typedef OwnerContainer< CacheEntry* > CacheEntryContainer;
+
+  /**
+   * @brief Find the entry of a shader; mMutex must be locked.
+   * @param[in] shaderHash The hash of the shader sources
+   * @return The entry, or NULL
+   */
+  CacheEntry* FindEntry( size_t shaderHash );
+
+  /**
+   * @brief Load a binary file, and check that it was compiled by the current driver.
+   * @param[in] shaderHash The hash of the shader sources
+   * @param[out] binary The binary, without its header
+   * @param[out] driverHash The hash of the driver which compiled the binary
+   * @return True if a binary was loaded
+   */
+  bool LoadBinaryFile( size_t shaderHash, Dali::Vector< unsigned char >& binary, size_t& driverHash );
+
+  /**
+   * @brief Overwrite the binary files of discarded entries with empty files.
+   * @param[in] shaderHashes The hashes of the discarded shaders
+   */
+  void ClearBinaryFiles( const Dali::Vector< size_t >& shaderHashes );
+
+  /**
+   * @brief Evict the least recently used entries until the cache fits its size; mMutex must be locked.
+   * @param[out] evicted The hashes of the evicted shaders
+   */
+  void EvictEntries( Dali::Vector< size_t >& evicted );
+
+  /**
+   * @brief Handle the contexts created until the destructor stops the thread. Called by the preload thread.
+   */
+  void RunPreloads();
+
+  /**
+   * @brief Read the index file the first time, and discard the binaries of other drivers. Called by the preload thread.
+   */
+  void LoadIndex();
+
+  /**
+   * @brief Load the binaries listed by the index. Called by the preload thread.
+   */
+  void Preload();
+
+  /**
+   * @brief Write the index file if it has changed; mMutex must not be locked.
+   */
+  void SaveIndex();
 
   // Undefined
   ShaderFactory( const ShaderFactory& );
@@ -90,7 +180,22 @@ private:
   ShaderFactory& operator=( const ShaderFactory& rhs );
 
 private:
-  Dali::Vector< Internal::ShaderData* > mShaderBinaryCache; ///< Cache of pre-compiled shaders.
+  Integration::PlatformAbstraction& mPlatformAbstraction; ///< Loads and saves the binaries
+  CacheEntryContainer mCacheEntries;                      ///< The binaries on disk and in memory, guarded by mMutex
+  Mutex               mMutex;                             ///< Guards the cache, which is used by the preload thread
+  Mutex               mIndexFileMutex;                    ///< Orders the writes of the index file
+  ConditionalWait     mPreloadWait;                       ///< Wakes the preload thread
+  ConditionalWait     mPreloadedWait;                     ///< Wakes WaitForPreload()
+  PreloadThread*      mPreloadThread;                     ///< Loads the cache in the background, or NULL until a context is created, guarded by mPreloadWait
+  unsigned int        mPreloadRequests;                   ///< Counts the contexts created, guarded by mPreloadWait
+  unsigned int        mPreloadsDone;                      ///< Counts the contexts handled by the preload thread, guarded by mPreloadedWait
+  size_t              mDriverHash;                        ///< Identifies the GL driver, guarded by mMutex
+  unsigned int        mCacheSize;                         ///< The maximum total size of the binary files, guarded by mMutex
+  unsigned int        mUseCount;                          ///< Counts the uses of the cache, to find the least recently used entries
+  bool                mDriverKnown;                       ///< Whether ContextCreated() has been called, guarded by mMutex
+  bool                mIndexLoaded;                       ///< Whether the index file has been read, guarded by mMutex
+  bool                mIndexChanged;                      ///< Whether the index file needs saving, guarded by mMutex
+  bool                mTerminate;                         ///< Set by the destructor to stop the preload thread, guarded by mPreloadWait
 
 }; // class ShaderFactory
 
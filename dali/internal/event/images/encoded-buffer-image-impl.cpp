@@ -19,12 +19,13 @@
 #include <dali/internal/event/images/encoded-buffer-image-impl.h>
 
 // EXTERNAL INCLUDES
+#include <algorithm> // for std::max
 #include <cstring> // for memcpy
 
 // INTERNAL INCLUDES
 #include <dali/public-api/object/type-registry.h>
-#include <dali/devel-api/common/ref-counted-dali-vector.h>
 #include <dali/internal/event/common/thread-local-storage.h>
+#include <dali/integration-api/bitmap.h>
 #include <dali/integration-api/platform-abstraction.h>
 
 namespace Dali
@@ -38,9 +39,9 @@ namespace
 TypeRegistration mType( typeid( Dali::EncodedBufferImage ), typeid( Dali::Image ), NULL );
 
 /** Raw bytes of a resource laid out exactly as it would be in a file, but in memory. */
-typedef Dali::RefCountedVector<uint8_t> RequestBuffer;
+typedef ImageDecodeQueue::EncodedBuffer    RequestBuffer;
 /** Counting smart pointer for managing a buffer of raw bytes. */
-typedef IntrusivePtr<RequestBuffer>     RequestBufferPtr;
+typedef ImageDecodeQueue::EncodedBufferPtr RequestBufferPtr;
 
 } // unnamed namespace
 
@@ -73,43 +74,74 @@ EncodedBufferImagePtr EncodedBufferImage::New( const uint8_t * const encodedImag
   image->mWidth = (unsigned int) expectedSize.GetWidth();
   image->mHeight = (unsigned int) expectedSize.GetHeight();
 
-  // Load the image synchronously
-  Integration::BitmapPtr bitmap = platformAbstraction.DecodeBuffer( resourceType, &(buffer->GetVector()[0]), encodedImageByteCount );
+  image->mRequestedSize = size;
 
-  if( bitmap )
+  ImageDecodeQueue& decodeQueue = Internal::ThreadLocalStorage::Get().GetImageDecodeQueue();
+  if( decodeQueue.IsAsynchronous() )
+  {
+    // The texture is created now, so that it can be used before the image has been decoded.
+    // It is respecified if the decoded image turns out to have another size or format.
+    unsigned int width = image->mWidth;
+    unsigned int height = image->mHeight;
+    if( width == 0u || height == 0u )
+    {
+      // The size could not be read from the buffer, so use the requested size until the image is decoded
+      width = std::max( static_cast< unsigned int >( size.GetWidth() ), 1u );
+      height = std::max( static_cast< unsigned int >( size.GetHeight() ), 1u );
+    }
+    image->mTexture = Texture::New( Dali::TextureType::TEXTURE_2D, Pixel::RGBA8888, width, height );
+    image->mDecodeRequestId = decodeQueue.RequestDecode( *image, resourceType, buffer, 0 );
+  }
+  else
+  {
+    // Load the image synchronously
+    Integration::BitmapPtr bitmap = platformAbstraction.DecodeBuffer( resourceType, &(buffer->GetVector()[0]), encodedImageByteCount );
+    image->DecodingFinished( bitmap.Get() );
+  }
+
+  return image;
+}
+
+EncodedBufferImage::~EncodedBufferImage()
+{
+  if( mDecodeRequestId && Internal::ThreadLocalStorage::Created() )
   {
-    unsigned width  = bitmap->GetImageWidth();
-    unsigned height = bitmap->GetImageHeight();
+    Internal::ThreadLocalStorage::Get().GetImageDecodeQueue().Cancel( mDecodeRequestId );
+  }
+}
 
-    //Create texture
-    Pixel::Format format = bitmap->GetPixelFormat();
-    image->mTexture = Texture::New( Dali::TextureType::TEXTURE_2D, format, width, height );
+void EncodedBufferImage::ImageDecoded( unsigned int /*requestId*/, Integration::BitmapPtr bitmap )
+{
+  mDecodeRequestId = 0u;
+  DecodingFinished( bitmap.Get() );
+}
 
-    //Upload data to the texture
-    size_t bufferSize = bitmap->GetBufferSize();
-    PixelDataPtr pixelData = PixelData::New( bitmap->GetBufferOwnership(), bufferSize, width, height, format,
-                                             static_cast< Dali::PixelData::ReleaseFunction >( bitmap->GetReleaseFunction() ) );
-    image->mTexture->Upload( pixelData );
+void EncodedBufferImage::DecodingFinished( Integration::Bitmap* bitmap )
+{
+  if( bitmap )
+  {
+    UploadBitmap( *bitmap );
 
-    image->mWidth = size.GetWidth();
-    if( image->mWidth == 0 )
+    mWidth = mRequestedSize.GetWidth();
+    if( mWidth == 0 )
     {
-      image->mWidth = width;
+      mWidth = bitmap->GetImageWidth();
     }
 
-    image->mHeight = size.GetHeight();
-    if( image->mHeight == 0 )
+    mHeight = mRequestedSize.GetHeight();
+    if( mHeight == 0 )
     {
-      image->mHeight = height;
+      mHeight = bitmap->GetImageHeight();
     }
   }
   else
   {
-    image->mTexture = Texture::New( Dali::TextureType::TEXTURE_2D, Pixel::RGBA8888, 0u, 0u );
-    image->mWidth = image->mHeight = 0u;
+    if( !mTexture )
+    {
+      mTexture = Texture::New( Dali::TextureType::TEXTURE_2D, Pixel::RGBA8888, 0u, 0u );
+    }
+    mWidth = mHeight = 0u;
   }
-
-  return image;
 }
 
 } // namespace Internal
@@ -21,6 +21,7 @@
 // INTERNAL INCLUDES
 #include <dali/public-api/object/ref-object.h>
 #include <dali/internal/event/images/image-impl.h>
+#include <dali/internal/event/images/image-decode-queue.h>
 #include <dali/public-api/images/encoded-buffer-image.h>
 
 namespace Dali
@@ -41,15 +42,32 @@ class UpdateManager;
  *
  * A memory buffer of encoded image data is provided by the application and
  * decoded asynchronously on a background thread to fill the image's
- * pixel data.
+ * pixel data, when Core has image decode threads. Otherwise it is decoded
+ * when the image is created.
  */
-class EncodedBufferImage : public Image
+class EncodedBufferImage : public Image, public ImageDecodeQueue::Observer
 {
 private:
   /**
    * Construct using the supplied load policy.
    */
-  EncodedBufferImage() : Image() {}
+  EncodedBufferImage() : Image(), mRequestedSize(), mDecodeRequestId( 0u ) {}
+
+  /**
+   * A reference counted object may only be deleted by calling Unreference()
+   */
+  virtual ~EncodedBufferImage();
+
+  /**
+   * @copydoc ImageDecodeQueue::Observer::ImageDecoded()
+   */
+  virtual void ImageDecoded( unsigned int requestId, Integration::BitmapPtr bitmap );
+
+  /**
+   * Sets the texture and size of the image from the decoded bitmap
+   * @param[in] bitmap The bitmap, or NULL if the image could not be decoded
+   */
+  void DecodingFinished( Integration::Bitmap* bitmap );
 
 public:
   /**
@@ -70,6 +88,11 @@ public:
                                    FittingMode::Type scalingMode = FittingMode::SHRINK_TO_FIT,
                                    SamplingMode::Type samplingMode = SamplingMode::BOX,
                                    bool orientationCorrection = true);
+
+private:
+
+  ImageDimensions mRequestedSize;  ///< The size requested for the image
+  unsigned int    mDecodeRequestId; ///< The request of the asynchronous decode, or zero
 };
 
 } // namespace Internal
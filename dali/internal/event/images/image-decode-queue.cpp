@@ -0,0 +1,383 @@
+/*
+ * Copyright (c) 2017 Samsung Electronics Co., Ltd.
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ * http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ *
+ */
+
+// CLASS HEADER
+#include <dali/internal/event/images/image-decode-queue.h>
+
+// EXTERNAL INCLUDES
+#include <algorithm>
+#include <vector>
+
+// INTERNAL INCLUDES
+#include <dali/devel-api/common/owner-container.h>
+#include <dali/devel-api/threading/conditional-wait.h>
+#include <dali/devel-api/threading/thread.h>
+#include <dali/integration-api/platform-abstraction.h>
+#include <dali/internal/common/owner-pointer.h>
+
+namespace Dali
+{
+
+namespace Internal
+{
+
+/**
+ * @brief Private implementation class
+ */
+struct ImageDecodeQueue::Impl
+{
+  /**
+   * @brief A request to load or decode an image
+   */
+  struct Request
+  {
+    Request( unsigned int id, Observer& observer, const Integration::BitmapResourceType& resourceType, int priority )
+    : id( id ),
+      observer( &observer ),
+      resourceType( resourceType.Clone() ),
+      url(),
+      buffer(),
+      bitmap(),
+      priority( priority )
+    {
+    }
+
+    unsigned int                              id;           ///< The id of the request
+    Observer*                                 observer;     ///< Told when the image has been decoded, NULL once cancelled
+    OwnerPointer< Integration::ResourceType > resourceType; ///< The attributes of the bitmap to create
+    std::string                               url;          ///< The url to load, if buffer is NULL
+    EncodedBufferPtr                          buffer;       ///< The encoded image to decode
+    Integration::BitmapPtr                    bitmap;       ///< The result
+    int                                       priority;     ///< Requests with a higher priority are decoded first
+  };
+
+  typedef std::vector< Request* > RequestContainer;
+
+  /**
+   * @brief A thread which decodes requests until there are none left, then waits for more
+   */
+  class WorkerThread : public Thread
+  {
+  public:
+
+    WorkerThread( Impl& impl )
+    : mImpl( impl )
+    {
+    }
+
+    virtual ~WorkerThread()
+    {
+    }
+
+  protected:
+
+    virtual void Run()
+    {
+      for( Request* request = mImpl.WaitForRequest(); request; request = mImpl.WaitForRequest() )
+      {
+        // The request is not touched by the other threads while it is being decoded
+        Integration::BitmapPtr bitmap;
+        if( request->buffer )
+        {
+          Dali::Vector< uint8_t >& buffer = request->buffer->GetVector();
+          bitmap = mImpl.platformAbstraction.DecodeBuffer( *request->resourceType, buffer.Begin(), buffer.Count() );
+        }
+        else
+        {
+          Integration::ResourcePointer resource = mImpl.platformAbstraction.LoadResourceSynchronously( *request->resourceType, request->url );
+          bitmap = static_cast< Integration::Bitmap* >( resource.Get() );
+        }
+
+        mImpl.RequestDecoded( request, bitmap );
+      }
+    }
+
+  private:
+
+    Impl& mImpl;
+  };
+
+  Impl( Integration::PlatformAbstraction& platformAbstraction )
+  : platformAbstraction( platformAbstraction ),
+    workers(),
+    wait(),
+    waiting(),
+    decoding(),
+    completed(),
+    nextId( 1u ),
+    terminate( false )
+  {
+  }
+
+  ~Impl()
+  {
+    Stop();
+
+    DeleteRequests( waiting );
+    DeleteRequests( decoding );
+    DeleteRequests( completed );
+  }
+
+  /**
+   * @brief Called by the workers to take the next request to decode.
+   * @return The request with the highest priority, or NULL if the worker should exit
+   */
+  Request* WaitForRequest()
+  {
+    ConditionalWait::ScopedLock lock( wait );
+    while( waiting.empty() && !terminate )
+    {
+      wait.Wait( lock );
+    }
+
+    if( terminate )
+    {
+      return NULL;
+    }
+
+    // The queue is expected to be short, so it is searched rather than kept sorted
+    RequestContainer::iterator next = waiting.begin();
+    for( RequestContainer::iterator iter = waiting.begin() + 1, endIter = waiting.end(); iter != endIter; ++iter )
+    {
+      if( (*iter)->priority > (*next)->priority )
+      {
+        next = iter;
+      }
+    }
+
+    Request* request = *next;
+    waiting.erase( next );
+    decoding.push_back( request );
+
+    return request;
+  }
+
+  /**
+   * @brief Called by the workers when a request has been decoded
+   * @param[in] request The request
+   * @param[in] bitmap The result
+   */
+  void RequestDecoded( Request* request, Integration::BitmapPtr bitmap )
+  {
+    ConditionalWait::ScopedLock lock( wait );
+    decoding.erase( std::find( decoding.begin(), decoding.end(), request ) );
+
+    if( request->observer )
+    {
+      request->bitmap = bitmap;
+      completed.push_back( request );
+    }
+    else
+    {
+      // Cancelled whilst it was being decoded
+      delete request;
+    }
+  }
+
+  /**
+   * @brief Adds a request and wakes a worker to decode it
+   * @param[in] request The request
+   * @return The id of the request
+   */
+  unsigned int AddRequest( Request* request )
+  {
+    ConditionalWait::ScopedLock lock( wait );
+    waiting.push_back( request );
+    wait.Notify( lock );
+    return request->id;
+  }
+
+  /**
+   * @brief Stop and destroy all the worker threads
+   */
+  void Stop()
+  {
+    {
+      ConditionalWait::ScopedLock lock( wait );
+      terminate = true;
+      wait.Notify( lock );
+    }
+
+    for( OwnerContainer< WorkerThread* >::Iterator iter = workers.Begin(), endIter = workers.End(); iter != endIter; ++iter )
+    {
+      (*iter)->Join();
+    }
+    workers.Clear();
+
+    // The workers have finished the requests they were decoding
+    terminate = false;
+  }
+
+  /**
+   * @brief Find a request by id
+   * @param[in] container The requests to search
+   * @param[in] requestId The id of the request
+   * @return An iterator to the request, or the end of the container
+   */
+  static RequestContainer::iterator Find( RequestContainer& container, unsigned int requestId )
+  {
+    RequestContainer::iterator iter = container.begin();
+    for( RequestContainer::iterator endIter = container.end(); iter != endIter; ++iter )
+    {
+      if( (*iter)->id == requestId )
+      {
+        break;
+      }
+    }
+    return iter;
+  }
+
+  /**
+   * @brief Delete the requests of a container
+   * @param[in] container The requests to delete
+   */
+  static void DeleteRequests( RequestContainer& container )
+  {
+    for( RequestContainer::iterator iter = container.begin(), endIter = container.end(); iter != endIter; ++iter )
+    {
+      delete *iter;
+    }
+    container.clear();
+  }
+
+  Integration::PlatformAbstraction& platformAbstraction; ///< Loads and decodes the images
+  OwnerContainer< WorkerThread* >   workers;             ///< The worker threads
+  ConditionalWait                   wait;                ///< Guards the requests, and wakes the workers when requests are added
+  RequestContainer                  waiting;             ///< The requests which have not been started, guarded by wait
+  RequestContainer                  decoding;            ///< The requests being decoded by the workers, guarded by wait
+  RequestContainer                  completed;           ///< The requests waiting to be delivered, guarded by wait
+  unsigned int                      nextId;              ///< The id of the next request, only used by the event-thread
+  bool                              terminate;           ///< Set to stop the workers, guarded by wait
+};
+
+ImageDecodeQueue::ImageDecodeQueue( Integration::PlatformAbstraction& platformAbstraction )
+: mImpl( new Impl( platformAbstraction ) )
+{
+}
+
+ImageDecodeQueue::~ImageDecodeQueue()
+{
+  delete mImpl;
+}
+
+void ImageDecodeQueue::SetWorkerCount( unsigned int workerCount )
+{
+  mImpl->Stop();
+
+  for( unsigned int i = 0u; i < workerCount; ++i )
+  {
+    Impl::WorkerThread* worker = new Impl::WorkerThread( *mImpl );
+    mImpl->workers.PushBack( worker );
+    worker->Start();
+  }
+}
+
+bool ImageDecodeQueue::IsAsynchronous() const
+{
+  return !mImpl->workers.IsEmpty();
+}
+
+unsigned int ImageDecodeQueue::RequestLoad( Observer& observer, const Integration::BitmapResourceType& resourceType, const std::string& url, int priority )
+{
+  Impl::Request* request = new Impl::Request( mImpl->nextId++, observer, resourceType, priority );
+  request->url = url;
+
+  return mImpl->AddRequest( request );
+}
+
+unsigned int ImageDecodeQueue::RequestDecode( Observer& observer, const Integration::BitmapResourceType& resourceType, EncodedBufferPtr buffer, int priority )
+{
+  Impl::Request* request = new Impl::Request( mImpl->nextId++, observer, resourceType, priority );
+  request->buffer = buffer;
+
+  return mImpl->AddRequest( request );
+}
+
+void ImageDecodeQueue::SetPriority( unsigned int requestId, int priority )
+{
+  ConditionalWait::ScopedLock lock( mImpl->wait );
+  Impl::RequestContainer::iterator iter = Impl::Find( mImpl->waiting, requestId );
+  if( iter != mImpl->waiting.end() )
+  {
+    (*iter)->priority = priority;
+  }
+}
+
+void ImageDecodeQueue::Cancel( unsigned int requestId )
+{
+  ConditionalWait::ScopedLock lock( mImpl->wait );
+
+  Impl::RequestContainer::iterator iter = Impl::Find( mImpl->waiting, requestId );
+  if( iter != mImpl->waiting.end() )
+  {
+    delete *iter;
+    mImpl->waiting.erase( iter );
+    return;
+  }
+
+  iter = Impl::Find( mImpl->decoding, requestId );
+  if( iter != mImpl->decoding.end() )
+  {
+    // The worker deletes the request when it has finished with it
+    (*iter)->observer = NULL;
+    return;
+  }
+
+  iter = Impl::Find( mImpl->completed, requestId );
+  if( iter != mImpl->completed.end() )
+  {
+    delete *iter;
+    mImpl->completed.erase( iter );
+  }
+}
+
+bool ImageDecodeQueue::HasPendingRequests() const
+{
+  ConditionalWait::ScopedLock lock( mImpl->wait );
+  return !( mImpl->waiting.empty() && mImpl->decoding.empty() && mImpl->completed.empty() );
+}
+
+bool ImageDecodeQueue::HasCompletedRequests() const
+{
+  ConditionalWait::ScopedLock lock( mImpl->wait );
+  return !mImpl->completed.empty();
+}
+
+void ImageDecodeQueue::ProcessCompletedRequests()
+{
+  // The observers may make or cancel requests, so the lock is not held whilst they are called
+  for( ;; )
+  {
+    Impl::Request* request = NULL;
+    {
+      ConditionalWait::ScopedLock lock( mImpl->wait );
+      if( mImpl->completed.empty() )
+      {
+        break;
+      }
+      request = mImpl->completed.front();
+      mImpl->completed.erase( mImpl->completed.begin() );
+    }
+
+    request->observer->ImageDecoded( request->id, request->bitmap );
+    delete request;
+  }
+}
+
+} // namespace Internal
+
+} // namespace Dali
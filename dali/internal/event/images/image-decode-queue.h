@@ -0,0 +1,178 @@
+#ifndef DALI_INTERNAL_IMAGE_DECODE_QUEUE_H
+#define DALI_INTERNAL_IMAGE_DECODE_QUEUE_H
+
+/*
+ * Copyright (c) 2017 Samsung Electronics Co., Ltd.
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ * http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ *
+ */
+
+// EXTERNAL INCLUDES
+#include <string>
+#include <stdint.h>
+
+// INTERNAL INCLUDES
+#include <dali/devel-api/common/ref-counted-dali-vector.h>
+#include <dali/integration-api/bitmap.h>
+#include <dali/integration-api/resource-types.h>
+
+namespace Dali
+{
+
+namespace Integration
+{
+class PlatformAbstraction;
+}
+
+namespace Internal
+{
+
+/**
+ * @brief Decodes images on a bounded pool of worker threads.
+ *
+ * Requests are decoded in order of priority, highest first, and in the order they were made
+ * when the priorities are equal. The decoded bitmaps are handed to the observers on the event-thread,
+ * by ProcessCompletedRequests(), which Core calls during event processing.
+ *
+ * Only the worker threads call the PlatformAbstraction, which must therefore be able to load
+ * resources from several threads at once.
+ */
+class ImageDecodeQueue
+{
+public:
+
+  /**
+   * @brief The raw bytes of an encoded image held in memory
+   */
+  typedef Dali::RefCountedVector< uint8_t > EncodedBuffer;
+  typedef IntrusivePtr< EncodedBuffer >     EncodedBufferPtr;
+
+  /**
+   * @brief Interface of the objects waiting for an image to be decoded
+   */
+  class Observer
+  {
+  public:
+
+    /**
+     * @brief Called on the event-thread when a request has been decoded.
+     * @param[in] requestId The id returned when the request was made
+     * @param[in] bitmap The decoded bitmap, or NULL if the image could not be decoded
+     */
+    virtual void ImageDecoded( unsigned int requestId, Integration::BitmapPtr bitmap ) = 0;
+
+  protected:
+
+    /**
+     * @brief Protected destructor, the observer is not owned by the queue
+     */
+    virtual ~Observer() {}
+  };
+
+  /**
+   * @brief Constructor. The queue starts with no worker threads.
+   * @param[in] platformAbstraction Used to load and decode the images
+   */
+  ImageDecodeQueue( Integration::PlatformAbstraction& platformAbstraction );
+
+  /**
+   * @brief Destructor. Discards the requests and joins the worker threads.
+   */
+  ~ImageDecodeQueue();
+
+  /**
+   * @brief Stops any existing workers and starts the given number of new ones.
+   * Requests which have not been decoded yet are kept, and decoded by the new workers.
+   * @param[in] workerCount The number of worker threads; zero means images are loaded synchronously by their users
+   */
+  void SetWorkerCount( unsigned int workerCount );
+
+  /**
+   * @brief Query whether images should be decoded by the queue.
+   * @return True if there are worker threads
+   */
+  bool IsAsynchronous() const;
+
+  /**
+   * @brief Requests an image file to be loaded and decoded.
+   * @param[in] observer Told when the image has been decoded
+   * @param[in] resourceType The attributes of the bitmap to create
+   * @param[in] url The url of the image
+   * @param[in] priority The priority of the request
+   * @return The id of the request, which is never zero
+   */
+  unsigned int RequestLoad( Observer& observer, const Integration::BitmapResourceType& resourceType, const std::string& url, int priority );
+
+  /**
+   * @brief Requests an encoded image in memory to be decoded.
+   * @param[in] observer Told when the image has been decoded
+   * @param[in] resourceType The attributes of the bitmap to create
+   * @param[in] buffer The encoded image, which is kept alive by the request
+   * @param[in] priority The priority of the request
+   * @return The id of the request, which is never zero
+   */
+  unsigned int RequestDecode( Observer& observer, const Integration::BitmapResourceType& resourceType, EncodedBufferPtr buffer, int priority );
+
+  /**
+   * @brief Changes the priority of a request which has not started decoding yet.
+   * @param[in] requestId The id of the request
+   * @param[in] priority The new priority
+   */
+  void SetPriority( unsigned int requestId, int priority );
+
+  /**
+   * @brief Cancels a request. Its observer will not be called.
+   * A request which is being decoded is finished by the worker, and its bitmap is discarded.
+   * @param[in] requestId The id of the request
+   */
+  void Cancel( unsigned int requestId );
+
+  /**
+   * @brief Query whether any requests are waiting, being decoded or waiting to be delivered.
+   * Can be called from any thread.
+   * @return True if there are requests which have not been delivered
+   */
+  bool HasPendingRequests() const;
+
+  /**
+   * @brief Query whether any decoded requests are waiting to be delivered.
+   * Can be called from any thread.
+   * @return True if ProcessCompletedRequests() has work to do
+   */
+  bool HasCompletedRequests() const;
+
+  /**
+   * @brief Hands the decoded bitmaps to their observers. Called on the event-thread.
+   */
+  void ProcessCompletedRequests();
+
+private:
+
+  // Undefined
+  ImageDecodeQueue( const ImageDecodeQueue& );
+
+  // Undefined
+  ImageDecodeQueue& operator=( const ImageDecodeQueue& );
+
+private:
+
+  struct Impl;
+  Impl* mImpl;
+};
+
+} // namespace Internal
+
+} // namespace Dali
+
+#endif // DALI_INTERNAL_IMAGE_DECODE_QUEUE_H
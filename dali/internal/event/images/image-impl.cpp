@@ -25,6 +25,7 @@
 #include <dali/public-api/common/dali-common.h>
 #include <dali/public-api/object/type-registry.h>
 
+#include <dali/integration-api/bitmap.h>
 #include <dali/integration-api/debug.h>
 #include <dali/internal/event/common/thread-local-storage.h>
 #include <dali/internal/event/common/stage-impl.h>
@@ -105,6 +106,29 @@ void Image::Initialize()
   RegisterObject();
 }
 
+void Image::UploadBitmap( Integration::Bitmap& bitmap )
+{
+  unsigned width  = bitmap.GetImageWidth();
+  unsigned height = bitmap.GetImageHeight();
+  Pixel::Format format = bitmap.GetPixelFormat();
+
+  if( !mTexture )
+  {
+    mTexture = Texture::New( Dali::TextureType::TEXTURE_2D, format, width, height );
+  }
+  else if( mTexture->GetWidth() != width || mTexture->GetHeight() != height ||
+           !( format == mTexture->GetPixelFormat() || ( format == Pixel::RGB888 && mTexture->GetPixelFormat() == Pixel::RGBA8888 ) ) )
+  {
+    // Texture sets may already use the texture, so change it rather than creating a new one
+    mTexture->Respecify( format, width, height );
+  }
+
+  size_t bufferSize = bitmap.GetBufferSize();
+  PixelDataPtr pixelData = PixelData::New( bitmap.GetBufferOwnership(), bufferSize, width, height, format,
+                                           static_cast< Dali::PixelData::ReleaseFunction >( bitmap.GetReleaseFunction() ) );
+  mTexture->Upload( pixelData );
+}
+
 } // namespace Internal
 
 } // namespace Dali
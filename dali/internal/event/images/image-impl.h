@@ -29,6 +29,11 @@
 namespace Dali
 {
 
+namespace Integration
+{
+class Bitmap;
+}
+
 namespace Internal
 {
 
@@ -122,6 +127,14 @@ protected:
    */
   void Initialize();
 
+  /**
+   * Uploads a decoded bitmap to the texture of the image.
+   * The existing texture is always reused, so that texture sets using it show the bitmap; it is
+   * respecified first if the bitmap does not fit it.
+   * @param[in] bitmap The decoded bitmap, whose buffer is taken by the texture
+   */
+  void UploadBitmap( Integration::Bitmap& bitmap );
+
 protected:
 
   TexturePtr mTexture;  ///< smart pointer to the texture used by the image
@@ -63,7 +63,9 @@ ResourceImage::ResourceImage()
   mLoadingFinished(),
   mAttributes(),
   mUrl(),
-  mLoadingState( Dali::ResourceLoading )
+  mLoadingState( Dali::ResourceLoading ),
+  mDecodeRequestId( 0u ),
+  mDecodePriority( 0 )
 {
 }
 
@@ -72,7 +74,9 @@ ResourceImage::ResourceImage( const std::string& url, const ImageAttributes& att
   mLoadingFinished(),
   mAttributes(attributes),
   mUrl(url),
-  mLoadingState( Dali::ResourceLoading )
+  mLoadingState( Dali::ResourceLoading ),
+  mDecodeRequestId( 0u ),
+  mDecodePriority( 0 )
 {
 }
 
@@ -105,6 +109,10 @@ ResourceImagePtr ResourceImage::New( const std::string& url, const ImageAttribut
 
 ResourceImage::~ResourceImage()
 {
+  if( mDecodeRequestId && ThreadLocalStorage::Created() )
+  {
+    ThreadLocalStorage::Get().GetImageDecodeQueue().Cancel( mDecodeRequestId );
+  }
 }
 
 bool ResourceImage::DoConnectSignal( BaseObject* object, ConnectionTrackerInterface* tracker, const std::string& signalName, FunctorDelegate* functor )
@@ -146,42 +154,90 @@ void ResourceImage::Reload()
                                                 mAttributes.GetFilterMode(),
                                                 mAttributes.GetOrientationCorrection() );
 
+  ImageDecodeQueue& decodeQueue = tls.GetImageDecodeQueue();
+  if( decodeQueue.IsAsynchronous() )
+  {
+    if( mDecodeRequestId )
+    {
+      decodeQueue.Cancel( mDecodeRequestId );
+    }
+
+    if( !mTexture )
+    {
+      // Create the texture now, so that it can be used before the image has been decoded
+      const ImageDimensions size = platformAbstraction.GetClosestImageSize( mUrl, resourceType.size, resourceType.scalingMode,
+                                                                            resourceType.samplingMode, resourceType.orientationCorrection );
+      mTexture = Texture::New( Dali::TextureType::TEXTURE_2D, Pixel::RGBA8888, size.GetWidth(), size.GetHeight() );
+      mWidth = mAttributes.GetWidth() ? mAttributes.GetWidth() : size.GetWidth();
+      mHeight = mAttributes.GetHeight() ? mAttributes.GetHeight() : size.GetHeight();
+    }
+
+    mLoadingState = Dali::ResourceLoading;
+    mDecodeRequestId = decodeQueue.RequestLoad( *this, resourceType, mUrl, mDecodePriority );
+    return;
+  }
+
   // Note, bitmap is only destroyed when the image is destroyed.
   Integration::ResourcePointer resource = platformAbstraction.LoadResourceSynchronously( resourceType, mUrl );
-  if( resource )
+
+  // A synchronous load always creates a new texture
+  mTexture.Reset();
+  LoadingFinished( static_cast<Integration::Bitmap*>( resource.Get() ) );
+}
+
+void ResourceImage::SetDecodePriority( int priority )
+{
+  mDecodePriority = priority;
+
+  if( mDecodeRequestId )
   {
-    Integration::Bitmap* bitmap = static_cast<Integration::Bitmap*>( resource.Get() );
-    unsigned width  = bitmap->GetImageWidth();
-    unsigned height = bitmap->GetImageHeight();
+    ThreadLocalStorage::Get().GetImageDecodeQueue().SetPriority( mDecodeRequestId, priority );
+  }
+}
 
-    //Create texture
-    Pixel::Format format = bitmap->GetPixelFormat();
-    mTexture = Texture::New( Dali::TextureType::TEXTURE_2D, format, width, height );
+void ResourceImage::CancelLoading()
+{
+  if( mDecodeRequestId )
+  {
+    ThreadLocalStorage::Get().GetImageDecodeQueue().Cancel( mDecodeRequestId );
+    mDecodeRequestId = 0u;
+    mLoadingState = Dali::ResourceLoadingFailed;
+  }
+}
 
-    //Upload data to the texture
-    size_t bufferSize = bitmap->GetBufferSize();
-    PixelDataPtr pixelData = PixelData::New( bitmap->GetBufferOwnership(), bufferSize, width, height, format,
-                                             static_cast< Dali::PixelData::ReleaseFunction >( bitmap->GetReleaseFunction() ) );
-    mTexture->Upload( pixelData );
+void ResourceImage::ImageDecoded( unsigned int /*requestId*/, Integration::BitmapPtr bitmap )
+{
+  mDecodeRequestId = 0u;
+  LoadingFinished( bitmap.Get() );
+}
+
+void ResourceImage::LoadingFinished( Integration::Bitmap* bitmap )
+{
+  if( bitmap )
+  {
+    UploadBitmap( *bitmap );
 
     mWidth = mAttributes.GetWidth();
     if( mWidth == 0 )
     {
-      mWidth = width;
+      mWidth = bitmap->GetImageWidth();
     }
 
     mHeight = mAttributes.GetHeight();
     if( mHeight == 0 )
     {
-      mHeight = height;
+      mHeight = bitmap->GetImageHeight();
     }
 
     mLoadingState = Dali::ResourceLoadingSucceeded;
-
   }
   else
   {
-    mTexture = Texture::New( Dali::TextureType::TEXTURE_2D, Pixel::RGBA8888, 0u, 0u );
+    // Keep the texture of an asynchronous load, as texture sets may already use it
+    if( !mTexture )
+    {
+      mTexture = Texture::New( Dali::TextureType::TEXTURE_2D, Pixel::RGBA8888, 0u, 0u );
+    }
     mWidth = mHeight = 0u;
     mLoadingState = Dali::ResourceLoadingFailed;
   }
@@ -24,6 +24,7 @@
 // INTERNAL INCLUDES
 #include <dali/public-api/images/resource-image.h>
 #include <dali/internal/event/images/image-impl.h>
+#include <dali/internal/event/images/image-decode-queue.h>
 #include <dali/internal/common/image-attributes.h>
 #include <dali/integration-api/debug.h> // For DALI_LOG_OBJECT_STRING_DECLARATION
 
@@ -38,8 +39,9 @@ typedef IntrusivePtr<ResourceImage> ResourceImagePtr;
 
 /**
  * ResourceImage is an image loaded using a URL, it is an image resource that can be added to actors etc.
+ * The image is loaded synchronously, unless Core has image decode threads.
  */
-class ResourceImage : public Image
+class ResourceImage : public Image, public ImageDecodeQueue::Observer
 {
 public:
 
@@ -102,6 +104,16 @@ public:
    */
   void Reload();
 
+  /**
+   * @copydoc Dali::DevelResourceImage::SetDecodePriority()
+   */
+  void SetDecodePriority( int priority );
+
+  /**
+   * @copydoc Dali::DevelResourceImage::CancelLoading()
+   */
+  void CancelLoading();
+
   /**
    * @copydoc Dali::Image::GetWidth()
    */
@@ -135,11 +147,26 @@ protected:
    */
   ResourceImage( const std::string& url, const ImageAttributes& attributes);
 
+private:
+
+  /**
+   * @copydoc ImageDecodeQueue::Observer::ImageDecoded()
+   */
+  virtual void ImageDecoded( unsigned int requestId, Integration::BitmapPtr bitmap );
+
+  /**
+   * Sets the texture and size of the image from the loaded bitmap
+   * @param[in] bitmap The bitmap, or NULL if the image could not be loaded
+   */
+  void LoadingFinished( Integration::Bitmap* bitmap );
+
 private:
   Dali::ResourceImage::ResourceImageSignal mLoadingFinished;
   ImageAttributes mAttributes;
   std::string mUrl;
   Dali::LoadingState mLoadingState;
+  unsigned int mDecodeRequestId; ///< The request of the asynchronous load, or zero
+  int mDecodePriority;           ///< The priority of asynchronous loads
 
   // Changes scope, should be at end of class
   DALI_LOG_OBJECT_STRING_DECLARATION;
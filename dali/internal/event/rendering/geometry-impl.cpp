@@ -18,6 +18,10 @@
 // CLASS HEADER
 #include <dali/internal/event/rendering/geometry-impl.h> // Dali::Internal::Geometry
 
+// EXTERNAL INCLUDES
+#include <algorithm> // std::max_element
+#include <limits>
+
 // INTERNAL INCLUDES
 #include <dali/public-api/object/type-registry.h>
 
@@ -68,6 +72,49 @@ void Geometry::SetIndexBuffer( const unsigned short* indices, size_t count )
   SceneGraph::SetIndexBufferMessage( mEventThreadServices.GetUpdateManager(), *mRenderObject, indexData );
 }
 
+void Geometry::SetIndexBuffer( const uint32_t* indices, size_t count )
+{
+  if( indices && count && *std::max_element( indices, indices + count ) > std::numeric_limits< unsigned short >::max() )
+  {
+    Dali::Vector<uint32_t> indexData;
+    indexData.Resize( count );
+    std::copy( indices, indices + count, indexData.Begin() );
+
+    SceneGraph::SetIndexBufferMessage( mEventThreadServices.GetUpdateManager(), *mRenderObject, indexData );
+  }
+  else
+  {
+    // 16 bit indices take half the memory and can be drawn by every GL context
+    Dali::Vector<unsigned short> indexData;
+    if( indices && count )
+    {
+      indexData.Resize( count );
+      std::copy( indices, indices + count, indexData.Begin() );
+    }
+
+    SceneGraph::SetIndexBufferMessage( mEventThreadServices.GetUpdateManager(), *mRenderObject, indexData );
+  }
+}
+
+void Geometry::SetIndexBuffer( Dali::Vector<unsigned short>& indices )
+{
+  // The message swaps the contents of the vector, so the indices are not copied
+  SceneGraph::SetIndexBufferMessage( mEventThreadServices.GetUpdateManager(), *mRenderObject, indices );
+}
+
+void Geometry::SetIndexBuffer( Dali::Vector<uint32_t>& indices )
+{
+  if( !indices.Empty() && *std::max_element( indices.Begin(), indices.End() ) > std::numeric_limits< unsigned short >::max() )
+  {
+    SceneGraph::SetIndexBufferMessage( mEventThreadServices.GetUpdateManager(), *mRenderObject, indices );
+  }
+  else
+  {
+    SetIndexBuffer( indices.Begin(), indices.Count() );
+    indices.Clear();
+  }
+}
+
 void Geometry::SetType( Dali::Geometry::Type geometryType )
 {
   if( geometryType != mType )
@@ -77,6 +77,21 @@ public:
    */
   void SetIndexBuffer( const unsigned short* indices, size_t count );
 
+  /**
+   * @copydoc DevelGeometry::SetIndexBuffer( Geometry&, const uint32_t*, size_t )
+   */
+  void SetIndexBuffer( const uint32_t* indices, size_t count );
+
+  /**
+   * @copydoc DevelGeometry::SetIndexBuffer( Geometry&, Dali::Vector<unsigned short>& )
+   */
+  void SetIndexBuffer( Dali::Vector<unsigned short>& indices );
+
+  /**
+   * @copydoc DevelGeometry::SetIndexBuffer( Geometry&, Dali::Vector<uint32_t>& )
+   */
+  void SetIndexBuffer( Dali::Vector<uint32_t>& indices );
+
   /**
    * @copydoc Dali::Geometry::SetType()
    */
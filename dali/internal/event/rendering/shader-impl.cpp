@@ -47,7 +47,8 @@ const ObjectImplHelper<DEFAULT_PROPERTY_COUNT> SHADER_IMPL = { DEFAULT_PROPERTY_
 Dali::Scripting::StringEnum ShaderHintsTable[] =
   { { "NONE",                     Dali::Shader::Hint::NONE},
     { "OUTPUT_IS_TRANSPARENT",    Dali::Shader::Hint::OUTPUT_IS_TRANSPARENT},
-    { "MODIFIES_GEOMETRY",        Dali::Shader::Hint::MODIFIES_GEOMETRY}
+    { "MODIFIES_GEOMETRY",        Dali::Shader::Hint::MODIFIES_GEOMETRY},
+    { "INSTANCED",                Dali::Shader::Hint::INSTANCED}
   };
 
 const unsigned int ShaderHintsTableSize = sizeof( ShaderHintsTable ) / sizeof( ShaderHintsTable[0] );
@@ -89,6 +90,11 @@ Property::Value HintString(const Dali::Shader::Hint::Value& hints)
     AppendString(s, "MODIFIES_GEOMETRY");
   }
 
+  if(hints & Dali::Shader::Hint::INSTANCED)
+  {
+    AppendString(s, "INSTANCED");
+  }
+
   return Property::Value(s);
 }
 
@@ -0,0 +1,398 @@
+/*
+ * Copyright (c) 2017 Samsung Electronics Co., Ltd.
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ * http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ *
+ */
+
+// CLASS HEADER
+#include <dali/internal/event/rendering/texture-atlas-impl.h>
+
+// EXTERNAL INCLUDES
+#include <algorithm>
+#include <cstdlib>
+
+// INTERNAL INCLUDES
+#include <dali/public-api/common/vector-wrapper.h>
+#include <dali/integration-api/debug.h>
+#include <dali/internal/event/rendering/renderer-impl.h>
+
+namespace Dali
+{
+namespace Internal
+{
+
+namespace
+{
+
+const char* const ATLAS_RECT_UNIFORM_NAME( "uAtlasRect" );
+
+/**
+ * The gap left to the right of and below each region, so that linear filtering
+ * at the edge of a region does not sample its neighbours. The gap is cleared when the region is uploaded.
+ */
+const unsigned int PADDING = 1u;
+
+/**
+ * Creates pixel data cleared to zero
+ * @param[in] format The format of the pixel data
+ * @param[in] width The width of the pixel data
+ * @param[in] height The height of the pixel data
+ * @return The pixel data
+ */
+PixelDataPtr CreateClearPixelData( Pixel::Format format, unsigned int width, unsigned int height )
+{
+  const unsigned int bufferSize = width * height * Pixel::GetBytesPerPixel( format );
+  unsigned char* buffer = static_cast< unsigned char* >( calloc( bufferSize, 1u ) );
+  return PixelData::New( buffer, bufferSize, width, height, format, Dali::PixelData::FREE );
+}
+
+/**
+ * Where a region is placed when the atlas is repacked
+ */
+struct Placement
+{
+  unsigned int x;
+  unsigned int y;
+  unsigned int shelf;
+};
+
+} // unnamed namespace
+
+TextureAtlasPtr TextureAtlas::New( Pixel::Format format, unsigned int width, unsigned int height )
+{
+  return TextureAtlasPtr( new TextureAtlas( format, width, height ) );
+}
+
+TextureAtlas::TextureAtlas( Pixel::Format format, unsigned int width, unsigned int height )
+: mTexture( Texture::New( TextureType::TEXTURE_2D, format, width, height ) ),
+  mTextureSet( TextureSet::New() ),
+  mRegions(),
+  mShelves(),
+  mWidth( width ),
+  mHeight( height ),
+  mNextId( 1u ),
+  mUsedArea( 0u )
+{
+  mTextureSet->SetTexture( 0u, mTexture );
+}
+
+TextureAtlas::~TextureAtlas()
+{
+  for( RegionContainer::Iterator iter = mRegions.Begin(), end = mRegions.End(); iter != end; ++iter )
+  {
+    for( Dali::Vector< Renderer* >::Iterator rendererIter = (*iter)->renderers.Begin(); rendererIter != (*iter)->renderers.End(); ++rendererIter )
+    {
+      (*rendererIter)->RemoveObserver( *this );
+    }
+  }
+}
+
+unsigned int TextureAtlas::Add( PixelDataPtr pixelData )
+{
+  DALI_ASSERT_ALWAYS( pixelData && "PixelData is empty" );
+
+  Region* region = new Region;
+  region->pixelData = pixelData;
+  region->id = mNextId;
+  region->removed = false;
+
+  const unsigned int width = GetPaddedWidth( *region );
+  const unsigned int height = GetPaddedHeight( *region );
+  if( pixelData->GetWidth() > mWidth || pixelData->GetHeight() > mHeight ||
+      !Allocate( mShelves, width, height, region->x, region->y, region->shelf ) )
+  {
+    // Repack the regions if the free space would be large enough, were it contiguous
+    bool allocated = false;
+    if( pixelData->GetWidth() <= mWidth && pixelData->GetHeight() <= mHeight &&
+        mUsedArea + width * height <= mWidth * mHeight )
+    {
+      Defragment();
+      allocated = Allocate( mShelves, width, height, region->x, region->y, region->shelf );
+    }
+
+    if( !allocated )
+    {
+      DALI_LOG_ERROR( "No space in the texture atlas for %u x %u pixels\n", pixelData->GetWidth(), pixelData->GetHeight() );
+      delete region;
+      return 0u;
+    }
+  }
+
+  mUsedArea += width * height;
+  mRegions.PushBack( region );
+  if( !Upload( *region ) )
+  {
+    // e.g. the pixel data is not in the format of the atlas
+    DALI_LOG_ERROR( "The pixel data could not be uploaded to the texture atlas\n" );
+    Release( region );
+    return 0u;
+  }
+
+  ++mNextId;
+  return region->id;
+}
+
+void TextureAtlas::Remove( unsigned int id )
+{
+  Region* region = FindRegion( id );
+  if( region && !region->removed )
+  {
+    region->removed = true;
+    if( region->renderers.Empty() )
+    {
+      Release( region );
+    }
+  }
+}
+
+Vector4 TextureAtlas::GetTextureRect( unsigned int id ) const
+{
+  Vector4 rect( Vector4::ZERO );
+  const Region* region = FindRegion( id );
+  if( region )
+  {
+    rect.x = static_cast<float>( region->x ) / static_cast<float>( mWidth );
+    rect.y = static_cast<float>( region->y ) / static_cast<float>( mHeight );
+    rect.z = static_cast<float>( region->pixelData->GetWidth() ) / static_cast<float>( mWidth );
+    rect.w = static_cast<float>( region->pixelData->GetHeight() ) / static_cast<float>( mHeight );
+  }
+  return rect;
+}
+
+bool TextureAtlas::Assign( unsigned int id, Renderer& renderer )
+{
+  Region* region = FindRegion( id );
+  if( !region || region->removed )
+  {
+    return false;
+  }
+
+  if( std::find( region->renderers.Begin(), region->renderers.End(), &renderer ) == region->renderers.End() )
+  {
+    Unassign( renderer );
+    region->renderers.PushBack( &renderer );
+    renderer.AddObserver( *this );
+  }
+
+  renderer.SetTextures( *mTextureSet );
+  renderer.RegisterProperty( ATLAS_RECT_UNIFORM_NAME, GetTextureRect( id ) );
+  return true;
+}
+
+void TextureAtlas::Defragment()
+{
+  // Place the tallest regions first, so that the shelves waste little height
+  std::vector< Region* > regions( mRegions.Begin(), mRegions.End() );
+  std::stable_sort( regions.begin(), regions.end(), HasGreaterHeight() );
+
+  ShelfContainer shelves;
+  Dali::Vector< Placement > placements;
+  placements.Resize( regions.size() );
+  for( std::size_t i = 0u; i < regions.size(); ++i )
+  {
+    Placement& placement = placements[i];
+    if( !Allocate( shelves, GetPaddedWidth( *regions[i] ), GetPaddedHeight( *regions[i] ), placement.x, placement.y, placement.shelf ) )
+    {
+      // Keep the current layout rather than lose a region
+      return;
+    }
+  }
+
+  mShelves = shelves;
+  for( std::size_t i = 0u; i < regions.size(); ++i )
+  {
+    Region& region = *regions[i];
+    const Placement& placement = placements[i];
+    region.shelf = placement.shelf;
+    if( region.x != placement.x || region.y != placement.y )
+    {
+      region.x = placement.x;
+      region.y = placement.y;
+      Upload( region );
+    }
+  }
+}
+
+Texture* TextureAtlas::GetTexture() const
+{
+  return mTexture.Get();
+}
+
+TextureSet* TextureAtlas::GetTextureSet() const
+{
+  return mTextureSet.Get();
+}
+
+void TextureAtlas::SceneObjectAdded( Object& object )
+{
+}
+
+void TextureAtlas::SceneObjectRemoved( Object& object )
+{
+}
+
+void TextureAtlas::ObjectDestroyed( Object& object )
+{
+  // The renderer is being destroyed, so it must not be asked to remove the observer
+  for( RegionContainer::Iterator iter = mRegions.Begin(), end = mRegions.End(); iter != end; ++iter )
+  {
+    Region* region = *iter;
+    for( Dali::Vector< Renderer* >::Iterator rendererIter = region->renderers.Begin(); rendererIter != region->renderers.End(); ++rendererIter )
+    {
+      if( static_cast< Object* >( *rendererIter ) == &object )
+      {
+        region->renderers.Erase( rendererIter );
+        if( region->removed && region->renderers.Empty() )
+        {
+          Release( region );
+        }
+        return;
+      }
+    }
+  }
+}
+
+TextureAtlas::Region* TextureAtlas::FindRegion( unsigned int id ) const
+{
+  for( RegionContainer::ConstIterator iter = mRegions.Begin(), end = mRegions.End(); iter != end; ++iter )
+  {
+    if( (*iter)->id == id )
+    {
+      return *iter;
+    }
+  }
+  return NULL;
+}
+
+bool TextureAtlas::Allocate( ShelfContainer& shelves, unsigned int width, unsigned int height, unsigned int& x, unsigned int& y, unsigned int& shelf ) const
+{
+  // Use the lowest shelf which is tall enough and has room at its end
+  const unsigned int count = shelves.Count();
+  unsigned int bestShelf = count;
+  for( unsigned int i = 0u; i < count; ++i )
+  {
+    if( shelves[i].height >= height && shelves[i].width + width <= mWidth &&
+        ( bestShelf == count || shelves[i].height < shelves[bestShelf].height ) )
+    {
+      bestShelf = i;
+    }
+  }
+
+  if( bestShelf == count )
+  {
+    const unsigned int top = ( count > 0u ) ? shelves[count - 1u].y + shelves[count - 1u].height : 0u;
+    if( top + height > mHeight || width > mWidth )
+    {
+      return false;
+    }
+
+    Shelf newShelf = { top, height, 0u };
+    shelves.PushBack( newShelf );
+  }
+
+  x = shelves[bestShelf].width;
+  y = shelves[bestShelf].y;
+  shelf = bestShelf;
+  shelves[bestShelf].width += width;
+  return true;
+}
+
+void TextureAtlas::Release( Region* region )
+{
+  mUsedArea -= GetPaddedWidth( *region ) * GetPaddedHeight( *region );
+
+  // Reclaim the end of the shelf, up to the last region still on it
+  unsigned int shelfWidth = 0u;
+  for( RegionContainer::Iterator iter = mRegions.Begin(), end = mRegions.End(); iter != end; ++iter )
+  {
+    if( *iter != region && (*iter)->shelf == region->shelf )
+    {
+      shelfWidth = std::max( shelfWidth, (*iter)->x + GetPaddedWidth( **iter ) );
+    }
+  }
+  mShelves[region->shelf].width = shelfWidth;
+
+  // Empty shelves at the bottom of the atlas can be replaced by a shelf of a different height
+  while( !mShelves.Empty() && mShelves[mShelves.Count() - 1u].width == 0u )
+  {
+    mShelves.Erase( mShelves.End() - 1u );
+  }
+
+  mRegions.Erase( std::find( mRegions.Begin(), mRegions.End(), region ) );
+}
+
+bool TextureAtlas::Upload( Region& region )
+{
+  const unsigned int width = region.pixelData->GetWidth();
+  const unsigned int height = region.pixelData->GetHeight();
+  if( !mTexture->Upload( region.pixelData, 0u, 0u, region.x, region.y, width, height ) )
+  {
+    return false;
+  }
+
+  // Clear the padding, which may hold the texels of a region which has been released or moved
+  const Pixel::Format format = mTexture->GetPixelFormat();
+  if( Pixel::GetBytesPerPixel( format ) > 0u )
+  {
+    if( region.x + width < mWidth )
+    {
+      const unsigned int paddingHeight = std::min( height + PADDING, mHeight - region.y );
+      mTexture->Upload( CreateClearPixelData( format, PADDING, paddingHeight ), 0u, 0u, region.x + width, region.y, PADDING, paddingHeight );
+    }
+    if( region.y + height < mHeight )
+    {
+      mTexture->Upload( CreateClearPixelData( format, width, PADDING ), 0u, 0u, region.x, region.y + height, width, PADDING );
+    }
+  }
+
+  const Vector4 rect = GetTextureRect( region.id );
+  for( Dali::Vector< Renderer* >::Iterator iter = region.renderers.Begin(); iter != region.renderers.End(); ++iter )
+  {
+    (*iter)->RegisterProperty( ATLAS_RECT_UNIFORM_NAME, rect );
+  }
+  return true;
+}
+
+void TextureAtlas::Unassign( Renderer& renderer )
+{
+  for( RegionContainer::Iterator iter = mRegions.Begin(), end = mRegions.End(); iter != end; ++iter )
+  {
+    Region* region = *iter;
+    Dali::Vector< Renderer* >::Iterator rendererIter = std::find( region->renderers.Begin(), region->renderers.End(), &renderer );
+    if( rendererIter != region->renderers.End() )
+    {
+      region->renderers.Erase( rendererIter );
+      renderer.RemoveObserver( *this );
+      if( region->removed && region->renderers.Empty() )
+      {
+        Release( region );
+      }
+      return;
+    }
+  }
+}
+
+unsigned int TextureAtlas::GetPaddedWidth( const Region& region ) const
+{
+  return std::min( region.pixelData->GetWidth() + PADDING, mWidth );
+}
+
+unsigned int TextureAtlas::GetPaddedHeight( const Region& region ) const
+{
+  return std::min( region.pixelData->GetHeight() + PADDING, mHeight );
+}
+
+} // namespace Internal
+
+} // namespace Dali
@@ -0,0 +1,246 @@
+#ifndef DALI_INTERNAL_TEXTURE_ATLAS_H
+#define DALI_INTERNAL_TEXTURE_ATLAS_H
+
+/*
+ * Copyright (c) 2017 Samsung Electronics Co., Ltd.
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ * http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ *
+ */
+
+// INTERNAL INCLUDES
+#include <dali/public-api/common/dali-vector.h>
+#include <dali/public-api/common/intrusive-ptr.h>
+#include <dali/public-api/math/vector4.h>
+#include <dali/public-api/object/base-object.h>
+#include <dali/devel-api/common/owner-container.h>
+#include <dali/devel-api/rendering/texture-atlas.h>
+#include <dali/internal/event/common/object-impl.h>
+#include <dali/internal/event/images/pixel-data-impl.h>
+#include <dali/internal/event/rendering/texture-impl.h>
+#include <dali/internal/event/rendering/texture-set-impl.h>
+
+namespace Dali
+{
+namespace Internal
+{
+
+class Renderer;
+class TextureAtlas;
+typedef IntrusivePtr<TextureAtlas> TextureAtlasPtr;
+
+/**
+ * TextureAtlas packs pixel data into the regions of a texture, on shelves: rows as tall as
+ * the tallest region placed on them, filled from left to right.
+ */
+class TextureAtlas : public BaseObject, public Object::Observer
+{
+public:
+
+  /**
+   * @copydoc Dali::TextureAtlas::New()
+   */
+  static TextureAtlasPtr New( Pixel::Format format, unsigned int width, unsigned int height );
+
+  /**
+   * @copydoc Dali::TextureAtlas::Add()
+   */
+  unsigned int Add( PixelDataPtr pixelData );
+
+  /**
+   * @copydoc Dali::TextureAtlas::Remove()
+   */
+  void Remove( unsigned int id );
+
+  /**
+   * @copydoc Dali::TextureAtlas::GetTextureRect()
+   */
+  Vector4 GetTextureRect( unsigned int id ) const;
+
+  /**
+   * @copydoc Dali::TextureAtlas::Assign()
+   */
+  bool Assign( unsigned int id, Renderer& renderer );
+
+  /**
+   * @copydoc Dali::TextureAtlas::Defragment()
+   */
+  void Defragment();
+
+  /**
+   * @copydoc Dali::TextureAtlas::GetTexture()
+   */
+  Texture* GetTexture() const;
+
+  /**
+   * @copydoc Dali::TextureAtlas::GetTextureSet()
+   */
+  TextureSet* GetTextureSet() const;
+
+private: // From Object::Observer
+
+  /**
+   * @copydoc Object::Observer::SceneObjectAdded()
+   */
+  virtual void SceneObjectAdded( Object& object );
+
+  /**
+   * @copydoc Object::Observer::SceneObjectRemoved()
+   */
+  virtual void SceneObjectRemoved( Object& object );
+
+  /**
+   * @copydoc Object::Observer::ObjectDestroyed()
+   */
+  virtual void ObjectDestroyed( Object& object );
+
+private: // implementation
+
+  /**
+   * An area of the texture holding the pixel data of one Add()
+   */
+  struct Region
+  {
+    PixelDataPtr pixelData;               ///< The pixel data, kept to upload it again when the region moves
+    Dali::Vector< Renderer* > renderers;  ///< The renderers assigned to the region, which are observed
+    unsigned int id;                      ///< The identifier returned by Add()
+    unsigned int x;                       ///< The position of the region in the texture
+    unsigned int y;
+    unsigned int shelf;                   ///< The index of the shelf holding the region
+    bool removed;                         ///< Whether Remove() has been called
+  };
+
+  /**
+   * A row of regions
+   */
+  struct Shelf
+  {
+    unsigned int y;       ///< The top of the shelf
+    unsigned int height;  ///< The height of the shelf, including padding
+    unsigned int width;   ///< The width used by the regions of the shelf, including padding
+  };
+
+  /**
+   * Orders regions from the tallest to the shortest
+   */
+  struct HasGreaterHeight
+  {
+    bool operator()( const Region* lhs, const Region* rhs ) const
+    {
+      return lhs->pixelData->GetHeight() > rhs->pixelData->GetHeight();
+    }
+  };
+
+  typedef OwnerContainer< Region* > RegionContainer;
+  typedef Dali::Vector< Shelf > ShelfContainer;
+
+  /**
+   * Constructor
+   * @param[in] format The format of the texture
+   * @param[in] width The width of the texture
+   * @param[in] height The height of the texture
+   */
+  TextureAtlas( Pixel::Format format, unsigned int width, unsigned int height );
+
+  /**
+   * Find the region with an identifier
+   * @param[in] id The identifier
+   * @return The region, or NULL
+   */
+  Region* FindRegion( unsigned int id ) const;
+
+  /**
+   * Find space for an area on a shelf, adding a shelf if needed
+   * @param[in,out] shelves The shelves
+   * @param[in] width The width of the area
+   * @param[in] height The height of the area
+   * @param[out] x The position of the area
+   * @param[out] y
+   * @param[out] shelf The index of the shelf holding the area
+   * @return True if the area fits
+   */
+  bool Allocate( ShelfContainer& shelves, unsigned int width, unsigned int height, unsigned int& x, unsigned int& y, unsigned int& shelf ) const;
+
+  /**
+   * Release the space of a region, and destroy it
+   * @param[in] region The region
+   */
+  void Release( Region* region );
+
+  /**
+   * Upload the pixel data of a region and clear its padding, and update the renderers assigned to it
+   * @param[in] region The region
+   * @return False if the pixel data could not be uploaded to the texture
+   */
+  bool Upload( Region& region );
+
+  /**
+   * Remove a renderer from the region it is assigned to, releasing the region if it is no longer used
+   * @param[in] renderer The renderer
+   */
+  void Unassign( Renderer& renderer );
+
+  /**
+   * @return The padded width of the region
+   */
+  unsigned int GetPaddedWidth( const Region& region ) const;
+
+  /**
+   * @return The padded height of the region
+   */
+  unsigned int GetPaddedHeight( const Region& region ) const;
+
+protected:
+
+  /**
+   * A reference counted object may only be deleted by calling Unreference()
+   */
+  virtual ~TextureAtlas();
+
+private: // unimplemented methods
+
+  TextureAtlas( const TextureAtlas& );
+  TextureAtlas& operator=( const TextureAtlas& );
+
+private: // data
+
+  TexturePtr mTexture;          ///< The texture holding the regions
+  TextureSetPtr mTextureSet;    ///< The texture set given to the assigned renderers
+  RegionContainer mRegions;     ///< The regions in use
+  ShelfContainer mShelves;      ///< The shelves, from the top of the texture down
+  unsigned int mWidth;          ///< Width of the texture
+  unsigned int mHeight;         ///< Height of the texture
+  unsigned int mNextId;         ///< The identifier of the next region
+  unsigned int mUsedArea;       ///< The padded area of the regions in use
+};
+
+} // namespace Internal
+
+// Helpers for public-api forwarding methods
+inline Internal::TextureAtlas& GetImplementation( Dali::TextureAtlas& handle )
+{
+  DALI_ASSERT_ALWAYS( handle && "TextureAtlas handle is empty" );
+  BaseObject& object = handle.GetBaseObject();
+  return static_cast<Internal::TextureAtlas&>( object );
+}
+
+inline const Internal::TextureAtlas& GetImplementation( const Dali::TextureAtlas& handle )
+{
+  DALI_ASSERT_ALWAYS( handle && "TextureAtlas handle is empty" );
+  const BaseObject& object = handle.GetBaseObject();
+  return static_cast<const Internal::TextureAtlas&>( object );
+}
+
+} // namespace Dali
+
+#endif // DALI_INTERNAL_TEXTURE_ATLAS_H
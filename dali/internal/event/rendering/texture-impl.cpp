@@ -150,6 +150,20 @@ bool Texture::Upload( PixelDataPtr pixelData,
   return result;
 }
 
+void Texture::Respecify( Pixel::Format format, unsigned int width, unsigned int height )
+{
+  DALI_ASSERT_ALWAYS( !mNativeImage && "Native textures can not be respecified" );
+
+  mFormat = format;
+  mWidth = width;
+  mHeight = height;
+
+  if( EventThreadServices::IsCoreRunning() && mRenderObject )
+  {
+    RespecifyTextureMessage( mEventThreadServices.GetUpdateManager(), *mRenderObject, format, width, height );
+  }
+}
+
 void Texture::GenerateMipmaps()
 {
   if( EventThreadServices::IsCoreRunning() && mRenderObject )
@@ -168,5 +182,10 @@ unsigned int Texture::GetHeight() const
   return mHeight;
 }
 
+Pixel::Format Texture::GetPixelFormat() const
+{
+  return mFormat;
+}
+
 } // namespace Internal
 } // namespace Dali
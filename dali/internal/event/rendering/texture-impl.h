@@ -94,6 +94,15 @@ public:
                unsigned int xOffset, unsigned int yOffset,
                unsigned int width, unsigned int height );
 
+  /**
+   * Changes the format and size of the texture, keeping the texture itself so that texture sets using it
+   * show the new contents. The contents are undefined until the whole texture is uploaded again.
+   * @param[in] format The new format of the pixel data
+   * @param[in] width The new width of the texture
+   * @param[in] height The new height of the texture
+   */
+  void Respecify( Pixel::Format format, unsigned int width, unsigned int height );
+
   /**
    * @copydoc Dali::Texture::GenerateMipmaps()
    */
@@ -109,6 +118,12 @@ public:
    */
   unsigned int GetHeight() const;
 
+  /**
+   * Retrieve the pixel format of the texture
+   * @return The pixel format
+   */
+  Pixel::Format GetPixelFormat() const;
+
 private: // implementation
 
   /**
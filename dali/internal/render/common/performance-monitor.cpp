@@ -0,0 +1,238 @@
+/*
+ * Copyright (c) 2017 Samsung Electronics Co., Ltd.
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ * http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ *
+ */
+
+// CLASS HEADER
+#include <dali/internal/render/common/performance-monitor.h>
+
+// EXTERNAL INCLUDES
+#include <cstring>
+#include <stdint.h>
+#include <time.h>
+
+// INTERNAL INCLUDES
+#include <dali/integration-api/core.h>
+
+namespace Dali
+{
+
+namespace Internal
+{
+
+namespace
+{
+
+const unsigned int RING_BUFFER_SIZE = 128u;   ///< Number of completed frames kept for each thread
+const float NANOSECONDS_TO_MILLISECONDS = 1e-6f;
+
+uint64_t GetNanoseconds()
+{
+  timespec time;
+  clock_gettime( CLOCK_MONOTONIC, &time );
+  return static_cast< uint64_t >( time.tv_sec ) * 1000000000u + static_cast< uint64_t >( time.tv_nsec );
+}
+
+} // unnamed namespace
+
+/**
+ * @brief Records the frames of one thread.
+ *
+ * The current frame is only touched by the recording thread. Completed frames are copied into a ring buffer
+ * which is only written by the recording thread and only read by the thread calling PopFrame(); if the ring
+ * buffer is full, the completed frame is dropped.
+ */
+struct PerformanceMonitor::Recorder
+{
+  struct Frame
+  {
+    unsigned int frameNumber;
+    uint64_t     startTime;
+    uint64_t     endTime;
+    uint64_t     values[METRIC_COUNT]; ///< Nanoseconds for timed metrics, otherwise a count
+  };
+
+  Recorder()
+  : writeCount( 0u ),
+    readCount( 0u )
+  {
+    memset( &current, 0, sizeof( current ) );
+    memset( metricStart, 0, sizeof( metricStart ) );
+  }
+
+  void Push()
+  {
+    if( writeCount - readCount < RING_BUFFER_SIZE )
+    {
+      frames[ writeCount % RING_BUFFER_SIZE ] = current;
+      __sync_synchronize(); // The frame must be written before it is published
+      writeCount = writeCount + 1u;
+    }
+  }
+
+  bool Pop( Frame& frame )
+  {
+    if( readCount == writeCount )
+    {
+      return false;
+    }
+
+    __sync_synchronize(); // Read the frame after seeing it has been published
+    frame = frames[ readCount % RING_BUFFER_SIZE ];
+    __sync_synchronize(); // The frame must be read before its slot is released
+    readCount = readCount + 1u;
+    return true;
+  }
+
+  Frame                 current;                     ///< The frame being recorded
+  uint64_t              metricStart[METRIC_COUNT];   ///< When each timed metric was last started
+  Frame                 frames[RING_BUFFER_SIZE];    ///< Completed frames
+  volatile unsigned int writeCount;                  ///< Number of frames pushed, only written by the recording thread
+  volatile unsigned int readCount;                   ///< Number of frames popped, only written by the reading thread
+};
+
+namespace
+{
+
+__thread PerformanceMonitor::Recorder* gRecorder = NULL; ///< The recorder of the calling thread, NULL when not recording
+PerformanceMonitor::Recorder* volatile gWorkerRecorder = NULL; ///< The update thread's recorder whilst it records a frame, for the threads without a recorder
+
+} // unnamed namespace
+
+PerformanceMonitor::PerformanceMonitor()
+: mFrameNumber( 0u ),
+  mEnabled( false )
+{
+  for( unsigned int i = 0u; i < THREAD_COUNT; ++i )
+  {
+    mRecorders[i] = new Recorder;
+  }
+}
+
+PerformanceMonitor::~PerformanceMonitor()
+{
+  for( unsigned int i = 0u; i < THREAD_COUNT; ++i )
+  {
+    delete mRecorders[i];
+  }
+}
+
+void PerformanceMonitor::SetEnabled( bool enabled )
+{
+  mEnabled = enabled;
+}
+
+void PerformanceMonitor::FrameStart( Thread thread )
+{
+  if( thread == UPDATE_THREAD )
+  {
+    mFrameNumber = mFrameNumber + 1u;
+  }
+
+  if( !mEnabled )
+  {
+    gRecorder = NULL;
+    return;
+  }
+
+  Recorder* recorder = mRecorders[thread];
+  memset( recorder->current.values, 0, sizeof( recorder->current.values ) );
+  recorder->current.frameNumber = mFrameNumber;
+  recorder->current.startTime = GetNanoseconds();
+  gRecorder = recorder;
+
+  if( thread == UPDATE_THREAD )
+  {
+    __sync_synchronize(); // The frame must be reset before worker threads add to it
+    gWorkerRecorder = recorder;
+  }
+}
+
+void PerformanceMonitor::FrameEnd( Thread thread )
+{
+  Recorder* recorder = mRecorders[thread];
+  if( thread == UPDATE_THREAD )
+  {
+    gWorkerRecorder = NULL;
+    __sync_synchronize(); // Stop worker threads adding to the frame before it is pushed
+  }
+
+  if( gRecorder == recorder )
+  {
+    recorder->current.endTime = GetNanoseconds();
+    recorder->Push();
+  }
+  gRecorder = NULL;
+}
+
+bool PerformanceMonitor::PopFrame( Thread thread, Integration::FrameStatistics& statistics )
+{
+  Recorder::Frame frame;
+  if( !mRecorders[thread]->Pop( frame ) )
+  {
+    return false;
+  }
+
+  statistics.thread                 = ( thread == UPDATE_THREAD ) ? Integration::FrameStatistics::UPDATE_THREAD : Integration::FrameStatistics::RENDER_THREAD;
+  statistics.frameNumber            = frame.frameNumber;
+  statistics.startTime              = static_cast< double >( frame.startTime ) * 1e-6;
+  statistics.frameTime              = static_cast< float >( frame.endTime - frame.startTime ) * NANOSECONDS_TO_MILLISECONDS;
+  statistics.resetPropertiesTime    = static_cast< float >( frame.values[RESET_PROPERTIES] ) * NANOSECONDS_TO_MILLISECONDS;
+  statistics.processMessagesTime    = static_cast< float >( frame.values[PROCESS_MESSAGES] ) * NANOSECONDS_TO_MILLISECONDS;
+  statistics.animateTime            = static_cast< float >( frame.values[ANIMATE_NODES] ) * NANOSECONDS_TO_MILLISECONDS;
+  statistics.applyConstraintsTime   = static_cast< float >( frame.values[APPLY_CONSTRAINTS] ) * NANOSECONDS_TO_MILLISECONDS;
+  statistics.updateNodesTime        = static_cast< float >( frame.values[UPDATE_NODES] ) * NANOSECONDS_TO_MILLISECONDS;
+  statistics.prepareRenderablesTime = static_cast< float >( frame.values[PREPARE_RENDERABLES] ) * NANOSECONDS_TO_MILLISECONDS;
+  statistics.processRenderTasksTime = static_cast< float >( frame.values[PROCESS_RENDER_TASKS] ) * NANOSECONDS_TO_MILLISECONDS;
+  statistics.drawNodesTime          = static_cast< float >( frame.values[DRAW_NODES] ) * NANOSECONDS_TO_MILLISECONDS;
+  statistics.animatorsApplied       = static_cast< unsigned int >( frame.values[ANIMATORS_APPLIED] );
+  statistics.constraintsApplied     = static_cast< unsigned int >( frame.values[CONSTRAINTS_APPLIED] );
+  statistics.constraintsSkipped     = static_cast< unsigned int >( frame.values[CONSTRAINTS_SKIPPED] );
+  statistics.renderItemsReused      = static_cast< unsigned int >( frame.values[RENDER_ITEMS_REUSED] );
+
+  return true;
+}
+
+void PerformanceMonitor::Start( Metric metric )
+{
+  Recorder* recorder = gRecorder;
+  if( recorder )
+  {
+    recorder->metricStart[metric] = GetNanoseconds();
+  }
+}
+
+void PerformanceMonitor::End( Metric metric )
+{
+  Recorder* recorder = gRecorder;
+  if( recorder )
+  {
+    recorder->current.values[metric] += GetNanoseconds() - recorder->metricStart[metric];
+  }
+}
+
+void PerformanceMonitor::Increase( Metric metric, unsigned int value )
+{
+  // Threads without a recorder, such as the workers of the update thread, add to the update thread's frame
+  Recorder* recorder = gRecorder ? gRecorder : gWorkerRecorder;
+  if( recorder )
+  {
+    __sync_fetch_and_add( &recorder->current.values[metric], static_cast< uint64_t >( value ) );
+  }
+}
+
+} // namespace Internal
+
+} // namespace Dali
@@ -21,14 +21,25 @@
 namespace Dali
 {
 
-namespace Internal
+namespace Integration
 {
+struct FrameStatistics;
+}
 
-
+namespace Internal
+{
 
 /**
  * @brief PerformanceMonitor.
- * Empty stubs should we decided to hook into monitoring counters
+ * Records timings and counters for each frame of the update and render threads, when enabled.
+ *
+ * The metrics are recorded through the macros below, which find the recorder of the calling thread
+ * through thread local storage, so recording needs no locks. Completed frames are handed to the
+ * event thread through a single producer, single consumer ring buffer per thread.
+ * Metrics recorded outside of FrameStart() / FrameEnd(), or whilst disabled, are ignored.
+ *
+ * Counters increased on other threads, such as the workers of the update thread's ThreadPool, are added
+ * to the frame the update thread is recording. Timed metrics are only recorded on the update and render threads.
  */
 class PerformanceMonitor
 {
@@ -50,19 +61,103 @@ public:
     APPLY_CONSTRAINTS,
     CONSTRAINTS_APPLIED,
     CONSTRAINTS_SKIPPED,
+    RENDER_ITEMS_REUSED,
     UPDATE_NODES,
     PREPARE_RENDERABLES,
     PROCESS_RENDER_TASKS,
     DRAW_NODES,
+    METRIC_COUNT
+  };
+
+  /*
+   * The threads which record frames
+   */
+  enum Thread
+  {
+    UPDATE_THREAD,
+    RENDER_THREAD,
+    THREAD_COUNT
   };
+
+  struct Recorder; ///< Per thread frame recorder, only used in the implementation
+
+  /**
+   * Constructor, the monitor is disabled by default
+   */
+  PerformanceMonitor();
+
+  /**
+   * Destructor
+   */
+  ~PerformanceMonitor();
+
+  /**
+   * Enable or disable recording; takes effect from the next frame of each thread.
+   * @param[in] enabled True to record frames
+   */
+  void SetEnabled( bool enabled );
+
+  /**
+   * Called at the start of a frame, on the thread doing the frame
+   * @param[in] thread The thread starting a frame
+   */
+  void FrameStart( Thread thread );
+
+  /**
+   * Called at the end of a frame, on the thread doing the frame
+   * @param[in] thread The thread ending a frame
+   */
+  void FrameEnd( Thread thread );
+
+  /**
+   * Retrieve the oldest completed frame of a thread which has not been retrieved yet.
+   * Can be called from any one thread, e.g. the event-thread.
+   * @param[in] thread The thread which recorded the frame
+   * @param[out] statistics The timings and counters of the frame
+   * @return true if there was a frame to retrieve
+   */
+  bool PopFrame( Thread thread, Integration::FrameStatistics& statistics );
+
+  /**
+   * Start timing a metric on the calling thread, see PERF_MONITOR_START
+   * @param[in] metric The metric
+   */
+  static void Start( Metric metric );
+
+  /**
+   * Stop timing a metric on the calling thread, see PERF_MONITOR_END
+   * @param[in] metric The metric
+   */
+  static void End( Metric metric );
+
+  /**
+   * Increase a counter on the calling thread, or on the update thread if the calling thread does not record frames; see INCREASE_COUNTER
+   * @param[in] metric The metric
+   * @param[in] value The amount to add to the counter
+   */
+  static void Increase( Metric metric, unsigned int value );
+
+private:
+
+  // Undefined
+  PerformanceMonitor( const PerformanceMonitor& );
+
+  // Undefined
+  PerformanceMonitor& operator=( const PerformanceMonitor& );
+
+private:
+
+  Recorder*             mRecorders[THREAD_COUNT]; ///< One recorder for each thread
+  volatile unsigned int mFrameNumber;             ///< Incremented by each update frame
+  volatile bool         mEnabled;                 ///< Set by the event-thread, read at the start of each frame
 };
 
 #define PERFORMANCE_MONITOR_INIT(x)
-#define PERF_MONITOR_START(x)     // start of timed event
-#define PERF_MONITOR_END(x)       // end of a timed event
-#define INCREASE_COUNTER(x)       // increase a counter by 1
-#define INCREASE_BY(x,y)          // increase a count by x
-#define MATH_INCREASE_COUNTER(x)  // increase a math counter ( MATRIX_MULTIPLYS, QUATERNION_TO_MATRIX, FLOAT_POINT_MULTIPLY)
+#define PERF_MONITOR_START(x)     Dali::Internal::PerformanceMonitor::Start( x )        // start of timed event
+#define PERF_MONITOR_END(x)       Dali::Internal::PerformanceMonitor::End( x )          // end of a timed event
+#define INCREASE_COUNTER(x)       Dali::Internal::PerformanceMonitor::Increase( x, 1u ) // increase a counter by 1
+#define INCREASE_BY(x,y)          Dali::Internal::PerformanceMonitor::Increase( x, y )  // increase a count by y
+#define MATH_INCREASE_COUNTER(x)  // increase a math counter ( MATRIX_MULTIPLYS, QUATERNION_TO_MATRIX, FLOAT_POINT_MULTIPLY), not recorded as they are too frequent
 #define MATH_INCREASE_BY(x,y)     // increase a math counter by x
 #define PERF_MONITOR_NEXT_FRAME() // update started rendering a new frame
 
@@ -23,6 +23,7 @@
 #include <dali/internal/render/common/render-list.h>
 #include <dali/internal/render/common/render-instruction.h>
 #include <dali/internal/render/gl-resources/context.h>
+#include <dali/internal/render/renderers/render-instance-buffer.h>
 #include <dali/internal/render/renderers/render-renderer.h>
 #include <dali/internal/update/nodes/scene-graph-layer.h>
 
@@ -289,6 +290,25 @@ inline void SetupDepthBuffer( const RenderItem& item, Context& context, bool dep
   }
 }
 
+/**
+ * @brief Query whether the next render item can be drawn in the same instanced draw call as the current one.
+ * Besides the renderers being compatible, the items must set up the depth and stencil buffers the same way.
+ * @param[in] item     The first render item of the instanced draw call.
+ * @param[in] nextItem The render item following it.
+ * @return True if both items can be drawn with one instanced draw call.
+ */
+inline bool CanRenderInstanced( const RenderItem& item, const RenderItem& nextItem )
+{
+  if( item.mIsOpaque != nextItem.mIsOpaque || !item.mRenderer->CanRenderInstancedWith( *nextItem.mRenderer ) )
+  {
+    return false;
+  }
+
+  // Automatic clipping sets up the stencil buffer for each node
+  return ( item.mRenderer->GetRenderMode() != RenderMode::AUTO ) ||
+         ( item.mNode->GetClippingId() == 0u && nextItem.mNode->GetClippingId() == 0u );
+}
+
 /**
  * @brief Process a render-list.
  * @param[in] renderList       The render-list to process.
@@ -297,6 +317,7 @@ inline void SetupDepthBuffer( const RenderItem& item, Context& context, bool dep
  * @param[in] buffer           The current render buffer index (previous update buffer)
  * @param[in] viewMatrix       The view matrix from the appropriate camera.
  * @param[in] projectionMatrix The projection matrix from the appropriate camera.
+ * @param[in] instances        The buffer used to collect the instances of instanced draw calls.
  */
 inline void ProcessRenderList(
   const RenderList& renderList,
@@ -304,7 +325,8 @@ inline void ProcessRenderList(
   SceneGraph::Shader& defaultShader,
   BufferIndex bufferIndex,
   const Matrix& viewMatrix,
-  const Matrix& projectionMatrix )
+  const Matrix& projectionMatrix,
+  InstanceBuffer& instances )
 {
   DALI_PRINT_RENDER_LIST( renderList );
 
@@ -318,6 +340,7 @@ inline void ProcessRenderList(
   uint32_t lastClippingId( 0u );
   bool usedStencilBuffer( false );
   bool firstDepthBufferUse( true );
+  const bool instancingSupported( context.IsInstancingSupported() );
 
   for( size_t index( 0u ); index < count; ++index )
   {
@@ -335,6 +358,26 @@ inline void ProcessRenderList(
     // The Renderer API will be used if specified. If AUTO, the Actors automatic clipping feature will be used.
     SetupStencilBuffer( item, context, usedStencilBuffer, lastStencilDepth, lastClippingId );
 
+    // The items are sorted by shader, textures and geometry, so draw a run of compatible items with one instanced draw call
+    size_t instanceCount( 1u );
+    if( instancingSupported )
+    {
+      while( ( index + instanceCount < count ) && CanRenderInstanced( item, renderList.GetItem( index + instanceCount ) ) )
+      {
+        ++instanceCount;
+      }
+    }
+
+    if( instanceCount > 1u )
+    {
+      instances.Clear();
+      for( size_t instance( 0u ); instance < instanceCount; ++instance )
+      {
+        const RenderItem& instanceItem = renderList.GetItem( index + instance );
+        instanceItem.mRenderer->AddInstance( instances, bufferIndex, *instanceItem.mNode, instanceItem.mModelViewMatrix, instanceItem.mSize );
+      }
+    }
+
     // Render the item
     item.mRenderer->Render( context,
                             bufferIndex,
@@ -345,14 +388,18 @@ inline void ProcessRenderList(
                             viewMatrix,
                             projectionMatrix,
                             item.mSize,
-                            !item.mIsOpaque );
+                            !item.mIsOpaque,
+                            instanceCount > 1u ? &instances : NULL );
+
+    index += instanceCount - 1u;
   }
 }
 
 void ProcessRenderInstruction( const RenderInstruction& instruction,
                                Context& context,
                                SceneGraph::Shader& defaultShader,
-                               BufferIndex bufferIndex )
+                               BufferIndex bufferIndex,
+                               InstanceBuffer& instances )
 {
   DALI_PRINT_RENDER_INSTRUCTION( instruction, bufferIndex );
 
@@ -379,7 +426,8 @@ void ProcessRenderInstruction( const RenderInstruction& instruction,
                            defaultShader,
                            bufferIndex,
                            *viewMatrix,
-                           *projectionMatrix );
+                           *projectionMatrix,
+                           instances );
       }
     }
   }
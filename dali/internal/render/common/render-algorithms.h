@@ -36,6 +36,7 @@ class TextureCache;
 
 namespace Render
 {
+class InstanceBuffer;
 
 /**
  * Process a render-instruction.
@@ -43,11 +44,13 @@ namespace Render
  * @param[in] context The GL context.
  * @param[in] defaultShader The default shader.
  * @param[in] bufferIndex The current render buffer index (previous update buffer)
+ * @param[in] instances The buffer used to collect the instances of instanced draw calls.
  */
 void ProcessRenderInstruction( const SceneGraph::RenderInstruction& instruction,
                                Context& context,
                                SceneGraph::Shader& defaultShader,
-                               BufferIndex bufferIndex );
+                               BufferIndex bufferIndex,
+                               InstanceBuffer& instances );
 
 } // namespace Render
 
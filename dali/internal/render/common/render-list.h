@@ -156,11 +156,13 @@ public:
   }
 
   /**
-   * Tells the render list to reuse the items from the cache
+   * Tells the render list to reuse the first items from the cache
+   * @param[in] count The number of items to reuse
    */
-  void ReuseCachedItems()
+  void ReuseCachedItems( RenderItemContainer::SizeType count )
   {
-    mNextFree = mItems.Count();
+    DALI_ASSERT_DEBUG( count <= GetCachedItemCount() );
+    mNextFree = count;
   }
 
   /**
@@ -26,6 +26,8 @@
 #include <dali/integration-api/debug.h>
 #include <dali/integration-api/core.h>
 #include <dali/internal/common/owner-pointer.h>
+#include <dali/internal/common/trace-impl.h>
+#include <dali/internal/render/common/performance-monitor.h>
 #include <dali/internal/render/common/render-algorithms.h>
 #include <dali/internal/render/common/render-debug.h>
 #include <dali/internal/render/common/render-tracker.h>
@@ -35,6 +37,8 @@
 #include <dali/internal/render/queue/render-queue.h>
 #include <dali/internal/render/renderers/render-frame-buffer.h>
 #include <dali/internal/render/renderers/render-geometry.h>
+#include <dali/internal/render/renderers/render-instance-buffer.h>
+#include <dali/internal/render/renderers/render-uniform-buffer.h>
 #include <dali/internal/render/renderers/render-renderer.h>
 #include <dali/internal/render/renderers/render-sampler.h>
 #include <dali/internal/render/shaders/program-controller.h>
@@ -89,6 +93,8 @@ struct RenderManager::Impl
     samplerContainer(),
     textureContainer(),
     frameBufferContainer(),
+    instanceBuffer(),
+    uniformBuffer(),
     renderersAdded( false ),
     firstRenderCompleted( false ),
     defaultShader( NULL ),
@@ -150,6 +156,8 @@ struct RenderManager::Impl
   FrameBufferOwnerContainer     frameBufferContainer;     ///< List of owned framebuffers
   PropertyBufferOwnerContainer  propertyBufferContainer;  ///< List of owned property buffers
   GeometryOwnerContainer        geometryContainer;        ///< List of owned Geometries
+  Render::InstanceBuffer        instanceBuffer;           ///< Collects the instances of instanced draw calls
+  Render::UniformBuffer         uniformBuffer;            ///< Holds the uniform blocks of the renderers
 
   bool                          renderersAdded;
 
@@ -211,6 +219,15 @@ void RenderManager::ContextDestroyed()
     (*iter)->GlContextDestroyed();
   }
 
+  //Inform geometries
+  for( GeometryOwnerIter iter = mImpl->geometryContainer.Begin(); iter != mImpl->geometryContainer.End(); ++iter )
+  {
+    (*iter)->GlContextDestroyed();
+  }
+
+  mImpl->instanceBuffer.GlContextDestroyed();
+  mImpl->uniformBuffer.GlContextDestroyed();
+
   // inform renderers
   RendererOwnerContainer::Iterator end = mImpl->rendererContainer.End();
   RendererOwnerContainer::Iterator iter = mImpl->rendererContainer.Begin();
@@ -241,10 +258,15 @@ void RenderManager::SetDefaultSurfaceRect(const Rect<int>& rect)
   mImpl->defaultSurfaceRect = rect;
 }
 
+void RenderManager::EnableParallelShaderCompilation( bool enable )
+{
+  mImpl->programController.EnableParallelCompile( enable );
+}
+
 void RenderManager::AddRenderer( Render::Renderer* renderer )
 {
   // Initialize the renderer as we are now in render thread
-  renderer->Initialize( mImpl->context );
+  renderer->Initialize( mImpl->context, mImpl->uniformBuffer );
 
   mImpl->rendererContainer.PushBack( renderer );
 
@@ -322,6 +344,11 @@ void RenderManager::UploadTexture( Render::Texture* texture, PixelDataPtr pixelD
   texture->Upload( mImpl->context, pixelData, params );
 }
 
+void RenderManager::RespecifyTexture( Render::Texture* texture, Pixel::Format format, unsigned int width, unsigned int height )
+{
+  texture->Respecify( format, width, height );
+}
+
 void RenderManager::GenerateMipmaps( Render::Texture* texture )
 {
   texture->GenerateMipmaps( mImpl->context );
@@ -401,11 +428,21 @@ void RenderManager::SetPropertyBufferData( Render::PropertyBuffer* propertyBuffe
   propertyBuffer->SetData( data, size );
 }
 
+void RenderManager::SetPropertyBufferDataRange( Render::PropertyBuffer* propertyBuffer, Dali::Vector<char>* data, size_t offset )
+{
+  propertyBuffer->SetDataRange( data, offset );
+}
+
 void RenderManager::SetIndexBuffer( Render::Geometry* geometry, Dali::Vector<unsigned short>& indices )
 {
   geometry->SetIndexBuffer( indices );
 }
 
+void RenderManager::SetIndexBuffer( Render::Geometry* geometry, Dali::Vector<uint32_t>& indices )
+{
+  geometry->SetIndexBuffer( indices );
+}
+
 void RenderManager::AddGeometry( Render::Geometry* geometry )
 {
   mImpl->geometryContainer.PushBack( geometry );
@@ -489,6 +526,8 @@ ProgramCache* RenderManager::GetProgramCache()
 
 bool RenderManager::Render( Integration::RenderStatus& status )
 {
+  DALI_TRACE_SCOPE( RENDER );
+
   DALI_PRINT_RENDER_START( mImpl->renderBufferIndex );
 
   // Core::Render documents that GL context must be current before calling Render
@@ -497,6 +536,9 @@ bool RenderManager::Render( Integration::RenderStatus& status )
   // Increment the frame count at the beginning of each frame
   ++(mImpl->frameCount);
 
+  // Finish the programs compiled since the previous frame, before new programs start compiling
+  mImpl->programController.FinishCompilation( mImpl->context.IsParallelShaderCompileSupported() );
+
   // Process messages queued during previous update
   mImpl->renderQueue.ProcessMessages( mImpl->renderBufferIndex );
 
@@ -535,6 +577,7 @@ bool RenderManager::Render( Integration::RenderStatus& status )
     // if we don't have default shader, no point doing the render calls
     if( mImpl->defaultShader )
     {
+      PERF_MONITOR_START( PerformanceMonitor::DRAW_NODES );
       size_t count = mImpl->instructions.Count( mImpl->renderBufferIndex );
       for ( size_t i = 0; i < count; ++i )
       {
@@ -542,6 +585,7 @@ bool RenderManager::Render( Integration::RenderStatus& status )
 
         DoRender( instruction, *mImpl->defaultShader );
       }
+      PERF_MONITOR_END( PerformanceMonitor::DRAW_NODES );
       GLenum attachments[] = { GL_DEPTH, GL_STENCIL };
       mImpl->context.InvalidateFramebuffer(GL_FRAMEBUFFER, 2, attachments);
 
@@ -564,9 +608,13 @@ bool RenderManager::Render( Integration::RenderStatus& status )
    */
   mImpl->renderBufferIndex = (0 != mImpl->renderBufferIndex) ? 0 : 1;
 
+  // Keep rendering until the renderers waiting for their programs have been drawn
+  const unsigned int compilingProgramCount = mImpl->programController.GetCompilingProgramCount();
+  status.SetCompilingProgramCount( compilingProgramCount );
+
   DALI_PRINT_RENDER_END();
 
-  return false;
+  return compilingProgramCount > 0u;
 }
 
 void RenderManager::DoRender( RenderInstruction& instruction, Shader& defaultShader )
@@ -635,7 +683,8 @@ void RenderManager::DoRender( RenderInstruction& instruction, Shader& defaultSha
   Render::ProcessRenderInstruction( instruction,
                                     mImpl->context,
                                     defaultShader,
-                                    mImpl->renderBufferIndex );
+                                    mImpl->renderBufferIndex,
+                                    mImpl->instanceBuffer );
 
   if( instruction.mRenderTracker && ( instruction.mFrameBuffer != NULL ) )
   {
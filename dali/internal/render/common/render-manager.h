@@ -133,6 +133,13 @@ public:
    */
   void SetDefaultSurfaceRect( const Rect<int>& rect );
 
+  /**
+   * Enable or disable parallel compilation of the shader programs. When enabled, renderers
+   * are not drawn until their program has been compiled, instead of blocking the frame.
+   * @param[in] enable True to compile programs in parallel
+   */
+  void EnableParallelShaderCompilation( bool enable );
+
   /**
    * Add a Renderer to the render manager.
    * @param[in] renderer The renderer to add.
@@ -234,6 +241,14 @@ public:
    */
   void SetPropertyBufferData( Render::PropertyBuffer* propertyBuffer, Dali::Vector<char>* data, size_t size );
 
+  /**
+   * Updates a range of the data of an existing property buffer
+   * @param[in] propertyBuffer The property buffer.
+   * @param[in] data The new data of the range
+   * @param[in] offset The offset of the range in bytes
+   */
+  void SetPropertyBufferDataRange( Render::PropertyBuffer* propertyBuffer, Dali::Vector<char>* data, size_t offset );
+
   /**
    * Sets the data for the index buffer of an existing geometry
    * @param[in] geometry The geometry
@@ -241,6 +256,13 @@ public:
    */
   void SetIndexBuffer( Render::Geometry* geometry, Dali::Vector<unsigned short>& data );
 
+  /**
+   * Sets the data for the 32 bit index buffer of an existing geometry
+   * @param[in] geometry The geometry
+   * @param[in] data A vector containing the indices
+   */
+  void SetIndexBuffer( Render::Geometry* geometry, Dali::Vector<uint32_t>& data );
+
   /**
    * Set the geometry type of an existing render geometry
    * @param[in] geometry The render geometry
@@ -268,6 +290,15 @@ public:
    */
   void UploadTexture( Render::Texture* texture, PixelDataPtr pixelData, const Texture::UploadParams& params );
 
+  /**
+   * Changes the format and size of an existing texture
+   * @param[in] texture The texture
+   * @param[in] format The new format of the pixel data
+   * @param[in] width The new width of the texture
+   * @param[in] height The new height of the texture
+   */
+  void RespecifyTexture( Render::Texture* texture, Pixel::Format format, unsigned int width, unsigned int height );
+
   /**
    * Generates mipmaps for a given texture
    * @param[in] texture The texture
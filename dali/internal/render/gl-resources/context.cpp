@@ -20,6 +20,7 @@
 
 // EXTERNAL INCLUDES
 #include <algorithm>
+#include <cstdlib>
 #include <cstring>
 
 // INTERNAL INCLUDES
@@ -58,6 +59,54 @@ errorStrings errors[] =
    { GL_OUT_OF_MEMORY,      "GL_OUT_OF_MEMORY" }
 };
 
+/**
+ * Checks the major version of a GL_VERSION string, e.g. "OpenGL ES 3.0 ..." or "3.3.0 ..." for desktop OpenGL.
+ * @param[in] version The GL_VERSION string, may be NULL
+ * @param[in] major The required major version
+ * @return True if the version is at least the required version
+ */
+bool IsVersionAtLeast( const GLubyte* version, int major )
+{
+  if( !version )
+  {
+    return false;
+  }
+
+  const char* string = reinterpret_cast< const char* >( version );
+  const char* const prefix = "OpenGL ES ";
+  if( strncmp( string, prefix, strlen( prefix ) ) == 0 )
+  {
+    string += strlen( prefix );
+  }
+  return atoi( string ) >= major;
+}
+
+/**
+ * Checks whether an extension is in the GL_EXTENSIONS string
+ * @param[in] extensions The GL_EXTENSIONS string, may be NULL
+ * @param[in] name The name of the extension
+ * @return True if the extension is listed
+ */
+bool HasExtension( const GLubyte* extensions, const char* name )
+{
+  if( !extensions )
+  {
+    return false;
+  }
+
+  // Match whole names only, one extension name may be the prefix of another
+  const size_t length = strlen( name );
+  const char* string = reinterpret_cast< const char* >( extensions );
+  for( const char* found = strstr( string, name ); found; found = strstr( found + length, name ) )
+  {
+    if( ( found == string || found[-1] == ' ' ) && ( found[length] == ' ' || found[length] == '\0' ) )
+    {
+      return true;
+    }
+  }
+  return false;
+}
+
 } // unnamed namespace
 
 #ifdef DEBUG_ENABLED
@@ -67,6 +116,11 @@ Debug::Filter* gContextLogFilter = Debug::Filter::New(Debug::Concise, false, "LO
 Context::Context(Integration::GlAbstraction& glAbstraction)
 : mGlAbstraction(glAbstraction),
   mGlContextCreated(false),
+  mVertexArrayObjectSupported(false),
+  mInstancingSupported(false),
+  mUniformBufferSupported(false),
+  mElementIndexUintSupported(false),
+  mParallelShaderCompileSupported(false),
   mColorMask(true),
   mStencilMask(0xFF),
   mBlendEnabled(false),
@@ -83,6 +137,8 @@ Context::Context(Integration::GlAbstraction& glAbstraction)
   mBoundArrayBufferId(0),
   mBoundElementArrayBufferId(0),
   mBoundTransformFeedbackBufferId(0),
+  mBoundUniformBufferId(0),
+  mBoundVertexArrayId(0),
   mActiveTextureUnit( TEXTURE_UNIT_LAST ),
   mBlendColor(Color::TRANSPARENT),
   mBlendFuncSeparateSrcRGB(GL_ONE),
@@ -93,6 +149,7 @@ Context::Context(Integration::GlAbstraction& glAbstraction)
   mBlendEquationSeparateModeAlpha( GL_FUNC_ADD ),
   mDepthFunction( GL_LESS ),
   mMaxTextureSize(0),
+  mUniformBufferOffsetAlignment(1),
   mClearColor(Color::WHITE),    // initial color, never used until it's been set by the user
   mCullFaceMode( FaceCullingMode::NONE ),
   mViewPort( 0, 0, 0, 0 )
@@ -144,6 +201,12 @@ const Rect< int >& Context::GetViewport()
 
 void Context::FlushVertexAttributeLocations()
 {
+  if( mBoundVertexArrayId != 0 )
+  {
+    // The attribute arrays of a vertex array object are set when it is bound, not through the cache
+    return;
+  }
+
   for( unsigned int i = 0; i < MAX_ATTRIBUTE_CACHE_SIZE; ++i )
   {
     // see if our cached state is different to the actual state
@@ -171,7 +234,7 @@ void Context::FlushVertexAttributeLocations()
 void Context::SetVertexAttributeLocation(unsigned int location, bool state)
 {
 
-  if( location >= MAX_ATTRIBUTE_CACHE_SIZE )
+  if( location >= MAX_ATTRIBUTE_CACHE_SIZE || mBoundVertexArrayId != 0 )
   {
     // not cached, make the gl call through context
     if ( state )
@@ -215,6 +278,8 @@ void Context::InitializeGlState()
   mBoundArrayBufferId = 0;
   mBoundElementArrayBufferId = 0;
   mBoundTransformFeedbackBufferId = 0;
+  mBoundUniformBufferId = 0;
+  mBoundVertexArrayId = 0;
   mActiveTextureUnit = TEXTURE_UNIT_IMAGE;
 
   mUsingDefaultBlendColor = true; //Default blend color is (0,0,0,0)
@@ -233,6 +298,19 @@ void Context::InitializeGlState()
   // get maximum texture size
   mGlAbstraction.GetIntegerv(GL_MAX_TEXTURE_SIZE, &mMaxTextureSize);
 
+  mVertexArrayObjectSupported = IsVersionAtLeast( mGlAbstraction.GetString( GL_VERSION ), 3 );
+  mInstancingSupported = mVertexArrayObjectSupported;
+  mUniformBufferSupported = mVertexArrayObjectSupported;
+  mElementIndexUintSupported = mVertexArrayObjectSupported || HasExtension( mGlAbstraction.GetString( GL_EXTENSIONS ), "GL_OES_element_index_uint" );
+  mParallelShaderCompileSupported = HasExtension( mGlAbstraction.GetString( GL_EXTENSIONS ), "GL_KHR_parallel_shader_compile" );
+
+  mUniformBufferOffsetAlignment = 1;
+  if( mUniformBufferSupported )
+  {
+    mGlAbstraction.GetIntegerv( GL_UNIFORM_BUFFER_OFFSET_ALIGNMENT, &mUniformBufferOffsetAlignment );
+    mUniformBufferOffsetAlignment = std::max( mUniformBufferOffsetAlignment, 1 );
+  }
+
   // reset viewport, this will be set to something useful when rendering
   mViewPort.x = mViewPort.y = mViewPort.width = mViewPort.height = 0;
 
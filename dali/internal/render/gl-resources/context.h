@@ -93,6 +93,46 @@ public:
    */
   bool IsGlContextCreated() { return mGlContextCreated; }
 
+  /**
+   * Query whether vertex array objects can be used. They are part of OpenGL ES 3.0, and support
+   * is determined from GL_VERSION when the context is created.
+   * @return True if vertex array objects are supported.
+   */
+  bool IsVertexArrayObjectSupported() const { return mVertexArrayObjectSupported; }
+
+  /**
+   * Query whether instanced drawing can be used. It is part of OpenGL ES 3.0, and support
+   * is determined from GL_VERSION when the context is created.
+   * @return True if instanced draw calls and vertex attribute divisors are supported.
+   */
+  bool IsInstancingSupported() const { return mInstancingSupported; }
+
+  /**
+   * Query whether uniform buffer objects can be used. They are part of OpenGL ES 3.0, and support
+   * is determined from GL_VERSION when the context is created.
+   * @return True if uniform blocks can be backed by uniform buffers.
+   */
+  bool IsUniformBufferSupported() const { return mUniformBufferSupported; }
+
+  /**
+   * Query whether 32 bit indices can be drawn. They are part of OpenGL ES 3.0, or provided by
+   * the GL_OES_element_index_uint extension, determined when the context is created.
+   * @return True if GL_UNSIGNED_INT can be used as the type of indices.
+   */
+  bool IsElementIndexUintSupported() const { return mElementIndexUintSupported; }
+
+  /**
+   * Query whether the driver reports the completion of shader compilation without blocking. It is
+   * provided by the GL_KHR_parallel_shader_compile extension, determined when the context is created.
+   * @return True if GL_COMPLETION_STATUS_KHR can be queried.
+   */
+  bool IsParallelShaderCompileSupported() const { return mParallelShaderCompileSupported; }
+
+  /**
+   * @return The alignment required for the offset of a uniform buffer range, from GL_UNIFORM_BUFFER_OFFSET_ALIGNMENT
+   */
+  GLint GetUniformBufferOffsetAlignment() const { return mUniformBufferOffsetAlignment; }
+
   /**
    * @return the GLAbstraction
    */
@@ -209,6 +249,33 @@ public:
     }
   }
 
+  /**
+   * Wrapper for OpenGL ES 3.0 glBindBuffer(GL_UNIFORM_BUFFER, ...)
+   */
+  void BindUniformBuffer(GLuint buffer)
+  {
+    // Avoid unecessary calls to BindBuffer
+    if (mBoundUniformBufferId != buffer)
+    {
+      mBoundUniformBufferId = buffer;
+
+      LOG_GL("BindBuffer GL_UNIFORM_BUFFER %d\n", buffer);
+      CHECK_GL( mGlAbstraction, mGlAbstraction.BindBuffer(GL_UNIFORM_BUFFER, buffer) );
+    }
+  }
+
+  /**
+   * Wrapper for OpenGL ES 3.0 glBindBufferRange(GL_UNIFORM_BUFFER, ...)
+   */
+  void BindUniformBufferRange(GLuint index, GLuint buffer, GLintptr offset, GLsizeiptr size)
+  {
+    // This also binds the buffer to the generic GL_UNIFORM_BUFFER binding point
+    mBoundUniformBufferId = buffer;
+
+    LOG_GL("BindBufferRange GL_UNIFORM_BUFFER %d %d %d %d\n", index, buffer, offset, size);
+    CHECK_GL( mGlAbstraction, mGlAbstraction.BindBufferRange(GL_UNIFORM_BUFFER, index, buffer, offset, size) );
+  }
+
   /**
    * Wrapper for OpenGL ES 3.0 glBindBufferBase(GL_TRANSFORM_FEEDBACK_BUFFER, ...)
    */
@@ -253,6 +320,26 @@ public:
     CHECK_GL( mGlAbstraction, mGlAbstraction.BindTransformFeedback(target, id) );
   }
 
+  /**
+   * Wrapper for OpenGL ES 3.0 glBindVertexArray()
+   * While a vertex array object other than 0 is bound, vertex attribute arrays are enabled and disabled
+   * immediately rather than through the attribute cache, which only tracks the default vertex array object.
+   */
+  void BindVertexArray(GLuint array)
+  {
+    // Avoid unecessary calls to BindVertexArray
+    if( mBoundVertexArrayId != array )
+    {
+      mBoundVertexArrayId = array;
+
+      // The element array buffer binding belongs to the vertex array object
+      mBoundElementArrayBufferId = UNKNOWN_BUFFER_ID;
+
+      LOG_GL("BindVertexArray %d\n", array);
+      CHECK_GL( mGlAbstraction, mGlAbstraction.BindVertexArray(array) );
+    }
+  }
+
   /**
    * Helper to bind texture for rendering. If given texture is
    * already bound in the given textureunit, this method does nothing.
@@ -626,6 +713,7 @@ public:
     mBoundArrayBufferId = 0;
     mBoundElementArrayBufferId = 0;
     mBoundTransformFeedbackBufferId = 0;
+    mBoundUniformBufferId = 0;
   }
 
   /**
@@ -682,6 +770,29 @@ public:
     CHECK_GL( mGlAbstraction, mGlAbstraction.DeleteTransformFeedbacks(n, ids) );
   }
 
+  /**
+   * Wrapper for OpenGL ES 3.0 glDeleteVertexArrays()
+   */
+  void DeleteVertexArrays(GLsizei n, const GLuint* arrays)
+  {
+    // Deleting a bound vertex array object reverts the binding to zero
+    for( GLsizei i = 0; i < n; ++i )
+    {
+      if( arrays[i] == mBoundVertexArrayId )
+      {
+        mBoundVertexArrayId = 0;
+        mBoundElementArrayBufferId = UNKNOWN_BUFFER_ID;
+      }
+    }
+
+    // Prevent GL calls when DALi core is being deleted, as in DeleteBuffers()
+    if( this->IsGlContextCreated() )
+    {
+      LOG_GL("DeleteVertexArrays %d %p\n", n, arrays);
+      CHECK_GL( mGlAbstraction, mGlAbstraction.DeleteVertexArrays(n, arrays) );
+    }
+  }
+
   /**
    * Wrapper for OpenGL ES 2.0 glDepthFunc()
    */
@@ -814,6 +925,15 @@ public:
     CHECK_GL( mGlAbstraction, mGlAbstraction.GenTransformFeedbacks(n, ids) );
   }
 
+  /**
+   * Wrapper for OpenGL ES 3.0 glGenVertexArrays()
+   */
+  void GenVertexArrays(GLsizei n, GLuint* arrays)
+  {
+    LOG_GL("GenVertexArrays %d %p\n", n, arrays);
+    CHECK_GL( mGlAbstraction, mGlAbstraction.GenVertexArrays(n, arrays) );
+  }
+
   /**
    * @return the current buffer bound for a given target
    */
@@ -837,6 +957,11 @@ public:
         result = mBoundTransformFeedbackBufferId;
         break;
       }
+      case GL_UNIFORM_BUFFER:
+      {
+        result = mBoundUniformBufferId;
+        break;
+      }
       default:
       {
         DALI_ASSERT_DEBUG(0 && "target buffer type not supported");
@@ -1708,9 +1833,16 @@ private: // Implementation
 
 private: // Data
 
+  static const GLuint UNKNOWN_BUFFER_ID = 0xFFFFFFFF; ///< A cached binding which does not match any buffer
+
   Integration::GlAbstraction& mGlAbstraction;
 
   bool mGlContextCreated; ///< True if the OpenGL context has been created
+  bool mVertexArrayObjectSupported; ///< True if the context supports vertex array objects
+  bool mInstancingSupported;         ///< True if the context supports instanced drawing
+  bool mUniformBufferSupported;      ///< True if the context supports uniform buffer objects
+  bool mElementIndexUintSupported;   ///< True if the context supports 32 bit indices
+  bool mParallelShaderCompileSupported; ///< True if the context supports GL_KHR_parallel_shader_compile
 
   // glEnable/glDisable states
   bool mColorMask;
@@ -1731,6 +1863,8 @@ private: // Data
   GLuint mBoundArrayBufferId;        ///< The ID passed to glBindBuffer(GL_ARRAY_BUFFER)
   GLuint mBoundElementArrayBufferId; ///< The ID passed to glBindBuffer(GL_ELEMENT_ARRAY_BUFFER)
   GLuint mBoundTransformFeedbackBufferId; ///< The ID passed to glBindBuffer(GL_TRANSFORM_FEEDBACK_BUFFER)
+  GLuint mBoundUniformBufferId;      ///< The ID passed to glBindBuffer(GL_UNIFORM_BUFFER)
+  GLuint mBoundVertexArrayId;        ///< The ID passed to glBindVertexArray()
 
   // glBindTexture() state
   TextureUnit mActiveTextureUnit;
@@ -1752,6 +1886,7 @@ private: // Data
   GLenum mDepthFunction;  ///The depth function
 
   GLint mMaxTextureSize;      ///< return value from GetIntegerv(GL_MAX_TEXTURE_SIZE)
+  GLint mUniformBufferOffsetAlignment; ///< return value from GetIntegerv(GL_UNIFORM_BUFFER_OFFSET_ALIGNMENT)
   Vector4 mClearColor;        ///< clear color
 
   // Face culling mode
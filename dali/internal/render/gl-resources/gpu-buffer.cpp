@@ -96,36 +96,21 @@ void GpuBuffer::UpdateDataBuffer(GLsizeiptr size, const GLvoid *data, Usage usag
     DALI_ASSERT_DEBUG(mBufferId);
   }
 
-  GLenum glTargetEnum = GL_ARRAY_BUFFER;
-
   // make sure the buffer is bound, don't perform any checks because size may be zero
-  if(ARRAY_BUFFER == target)
-  {
-    mContext.BindArrayBuffer( mBufferId );
-  }
-  else if(ELEMENT_ARRAY_BUFFER == target)
-  {
-    glTargetEnum = GL_ELEMENT_ARRAY_BUFFER;
-    mContext.BindElementArrayBuffer( mBufferId );
-  }
-  else if(TRANSFORM_FEEDBACK_BUFFER == target)
-  {
-    glTargetEnum = GL_TRANSFORM_FEEDBACK_BUFFER;
-    mContext.BindTransformFeedbackBuffer( mBufferId );
-  }
+  GLenum glTargetEnum = BindTarget( target, mBufferId );
 
   // if the buffer has already been created, just update the data providing it fits
   if (mBufferCreated )
   {
-    // if the data will fit in the existing buffer, just update it
-    if (size <= mCapacity )
+    // if the data will fit in the existing buffer, just update it, unless the buffer is streamed
+    if (size <= mCapacity && usage != STREAM_DRAW )
     {
       mContext.BufferSubData( glTargetEnum, 0, size, data );
     }
     else
     {
-      // create a new buffer of the larger size,
-      // gl should automatically deallocate the old buffer
+      // create a new buffer of the larger size, or respecify a streamed one,
+      // gl should automatically deallocate the old buffer once the draw calls using it are done
       mContext.BufferData( glTargetEnum, size, data, ModeAsGlEnum( usage ) );
       mCapacity = size;
     }
@@ -138,18 +123,16 @@ void GpuBuffer::UpdateDataBuffer(GLsizeiptr size, const GLvoid *data, Usage usag
     mCapacity = size;
   }
 
-  if(ARRAY_BUFFER == target)
-  {
-    mContext.BindArrayBuffer( 0 );
-  }
-  else if(ELEMENT_ARRAY_BUFFER == target)
-  {
-    mContext.BindElementArrayBuffer( 0 );
-  }
-  else if(TRANSFORM_FEEDBACK_BUFFER == target)
-  {
-    mContext.BindTransformFeedbackBuffer( 0 );
-  }
+  BindTarget( target, 0 );
+}
+
+void GpuBuffer::UpdateDataBufferRange(GLintptr offset, GLsizeiptr size, const GLvoid *data, Target target)
+{
+  DALI_ASSERT_DEBUG( mBufferCreated && offset + size <= mCapacity );
+
+  GLenum glTargetEnum = BindTarget( target, mBufferId );
+  mContext.BufferSubData( glTargetEnum, offset, size, data );
+  BindTarget( target, 0 );
 }
 
 void GpuBuffer::Bind(Target target) const
@@ -170,6 +153,28 @@ void GpuBuffer::Bind(Target target) const
   }
 }
 
+GLenum GpuBuffer::BindTarget(Target target, GLuint bufferId) const
+{
+  GLenum glTargetEnum = GL_ARRAY_BUFFER;
+
+  if(ARRAY_BUFFER == target)
+  {
+    mContext.BindArrayBuffer( bufferId );
+  }
+  else if(ELEMENT_ARRAY_BUFFER == target)
+  {
+    glTargetEnum = GL_ELEMENT_ARRAY_BUFFER;
+    mContext.BindElementArrayBuffer( bufferId );
+  }
+  else if(TRANSFORM_FEEDBACK_BUFFER == target)
+  {
+    glTargetEnum = GL_TRANSFORM_FEEDBACK_BUFFER;
+    mContext.BindTransformFeedbackBuffer( bufferId );
+  }
+
+  return glTargetEnum;
+}
+
 bool GpuBuffer::BufferIsValid() const
 {
   return mBufferCreated && (0 != mCapacity );
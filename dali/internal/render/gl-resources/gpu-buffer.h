@@ -77,6 +77,8 @@ public:
   /**
    *
    * Creates or updates a buffer object and binds it to the target.
+   * A STREAM_DRAW buffer is always respecified, which orphans the previous data store
+   * instead of waiting until the draw calls reading it have finished.
    * @param size Specifies the size in bytes of the buffer object's new data store.
    * @param data pointer to the data to load
    * @param usage How the buffer will be used
@@ -84,6 +86,16 @@ public:
    */
   void UpdateDataBuffer(GLsizeiptr size, const GLvoid *data, Usage usage, Target target);
 
+  /**
+   * Updates a range of an existing buffer object.
+   * @pre The buffer has been created with UpdateDataBuffer() and the range is within its size
+   * @param offset The offset in bytes of the range
+   * @param size The size in bytes of the range
+   * @param data pointer to the data to load
+   * @param target The target buffer to update
+   */
+  void UpdateDataBufferRange(GLintptr offset, GLsizeiptr size, const GLvoid *data, Target target);
+
   /**
    * Bind the buffer object to the target
    * Will assert if the buffer size is zero
@@ -117,6 +129,14 @@ private:
    */
   void BindNoChecks(GLuint bufferId) const;
 
+  /**
+   * Binds a buffer to the target, or unbinds it with a buffer id of 0
+   * @param target The target buffer
+   * @param bufferId to bind
+   * @return The GL enum of the target
+   */
+  GLenum BindTarget(Target target, GLuint bufferId) const;
+
 private: // Data
 
   Context&           mContext;             ///< dali drawing context
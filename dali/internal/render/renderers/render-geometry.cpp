@@ -15,9 +15,15 @@
  */
 
 #include <dali/internal/render/renderers/render-geometry.h>
+
+// EXTERNAL INCLUDES
+#include <cstring> // memcmp
+
+// INTERNAL INCLUDES
 #include <dali/internal/common/buffer-index.h>
 #include <dali/internal/render/gl-resources/context.h>
 #include <dali/internal/render/gl-resources/gpu-buffer.h>
+#include <dali/internal/render/renderers/render-instance-buffer.h>
 #include <dali/internal/render/renderers/render-property-buffer.h>
 #include <dali/internal/render/shaders/program.h>
 
@@ -28,18 +34,31 @@ namespace Internal
 namespace Render
 {
 
+namespace
+{
+
+const unsigned int MAX_VERTEX_ARRAYS = 4u; ///< Vertex array objects kept for each geometry, the oldest is deleted first
+
+} // unnamed namespace
+
 Geometry::Geometry()
-: mIndices(),
+: mVertexArrayContext(NULL),
+  mIndices(),
+  mIndices32(),
   mIndexBuffer(NULL),
+  mIndexCount(0u),
+  mIndexType(GL_UNSIGNED_SHORT),
   mGeometryType( Dali::Geometry::TRIANGLES ),
   mIndicesChanged(false),
   mHasBeenUpdated(false),
-  mAttributesChanged(true)
+  mAttributesChanged(true),
+  mVertexArraysChanged(false)
 {
 }
 
 Geometry::~Geometry()
 {
+  DeleteVertexArrays();
 }
 
 void Geometry::GlContextCreated( Context& context )
@@ -48,17 +67,29 @@ void Geometry::GlContextCreated( Context& context )
 
 void Geometry::GlContextDestroyed()
 {
+  // The vertex array objects were destroyed with the context
+  mVertexArrays.Clear();
+  mVertexArrayContext = NULL;
 }
 
 void Geometry::AddPropertyBuffer( Render::PropertyBuffer* propertyBuffer )
 {
   mVertexBuffers.PushBack( propertyBuffer );
   mAttributesChanged = true;
+  mVertexArraysChanged = true;
 }
 
 void Geometry::SetIndexBuffer( Dali::Vector<unsigned short>& indices )
 {
   mIndices.Swap( indices );
+  mIndices32.Clear();
+  mIndicesChanged = true;
+}
+
+void Geometry::SetIndexBuffer( Dali::Vector<uint32_t>& indices )
+{
+  mIndices32.Swap( indices );
+  mIndices.Clear();
   mIndicesChanged = true;
 }
 
@@ -72,6 +103,7 @@ void Geometry::RemovePropertyBuffer( const Render::PropertyBuffer* propertyBuffe
       //This will delete the gpu buffer associated to the RenderPropertyBuffer if there is one
       mVertexBuffers.Remove( mVertexBuffers.Begin()+i );
       mAttributesChanged = true;
+      mVertexArraysChanged = true;
       break;
     }
   }
@@ -100,6 +132,67 @@ void Geometry::GetAttributeLocationFromProgram( Vector<GLint>& attributeLocation
   }
 }
 
+void Geometry::BindVertexArray( Context& context, const Vector<GLint>& attributeLocation )
+{
+  if( mVertexArraysChanged )
+  {
+    DeleteVertexArrays();
+    mVertexArraysChanged = false;
+  }
+
+  const size_t locationCount = attributeLocation.Count();
+  for( VertexArrayContainer::Iterator iter = mVertexArrays.Begin(), end = mVertexArrays.End(); iter != end; ++iter )
+  {
+    const Vector<GLint>& locations = (*iter)->attributeLocation;
+    if( locations.Count() == locationCount &&
+        ( locationCount == 0u || memcmp( &locations[0], &attributeLocation[0], locationCount * sizeof( GLint ) ) == 0 ) )
+    {
+      context.BindVertexArray( (*iter)->id );
+      return;
+    }
+  }
+
+  if( mVertexArrays.Count() >= MAX_VERTEX_ARRAYS )
+  {
+    context.DeleteVertexArrays( 1, &mVertexArrays[0]->id );
+    mVertexArrays.Erase( mVertexArrays.Begin() );
+  }
+
+  VertexArray* vertexArray = new VertexArray;
+  vertexArray->attributeLocation = attributeLocation;
+  context.GenVertexArrays( 1, &vertexArray->id );
+  mVertexArrays.PushBack( vertexArray );
+  mVertexArrayContext = &context;
+
+  // Record the buffer bindings and attribute setup in the new vertex array object
+  context.BindVertexArray( vertexArray->id );
+
+  unsigned int base = 0u;
+  for( unsigned int i = 0; i < mVertexBuffers.Count(); ++i )
+  {
+    mVertexBuffers[i]->BindBuffer( GpuBuffer::ARRAY_BUFFER );
+    base += mVertexBuffers[i]->EnableVertexAttributes( context, vertexArray->attributeLocation, base );
+  }
+
+  if( mIndexBuffer )
+  {
+    mIndexBuffer->Bind( GpuBuffer::ELEMENT_ARRAY_BUFFER );
+  }
+}
+
+void Geometry::DeleteVertexArrays()
+{
+  if( mVertexArrayContext )
+  {
+    for( VertexArrayContainer::Iterator iter = mVertexArrays.Begin(), end = mVertexArrays.End(); iter != end; ++iter )
+    {
+      mVertexArrayContext->DeleteVertexArrays( 1, &(*iter)->id );
+    }
+  }
+  mVertexArrays.Clear();
+  mVertexArrayContext = NULL;
+}
+
 void Geometry::OnRenderFinished()
 {
   mHasBeenUpdated = false;
@@ -111,26 +204,53 @@ void Geometry::UploadAndDraw(
     BufferIndex bufferIndex,
     Vector<GLint>& attributeLocation,
     size_t elementBufferOffset,
-    size_t elementBufferCount )
+    size_t elementBufferCount,
+    InstanceBuffer* instances )
 {
+  const bool useVertexArray = context.IsVertexArrayObjectSupported();
+
   if( !mHasBeenUpdated )
   {
     // Update buffers
     if( mIndicesChanged )
     {
-      if( mIndices.Empty() )
+      if( useVertexArray )
+      {
+        // Uploading binds the element array buffer, which must not change the binding of a vertex array object
+        context.BindVertexArray( 0 );
+      }
+
+      if( mIndices.Empty() && mIndices32.Empty() )
       {
         mIndexBuffer = NULL;
+        mIndexCount = 0u;
+        mVertexArraysChanged = true;
       }
       else
       {
         if ( mIndexBuffer == NULL )
         {
           mIndexBuffer = new GpuBuffer( context );
+          mVertexArraysChanged = true;
         }
 
-        std::size_t bufferSize =  sizeof( unsigned short ) * mIndices.Size();
-        mIndexBuffer->UpdateDataBuffer( bufferSize, &mIndices[0], GpuBuffer::STATIC_DRAW, GpuBuffer::ELEMENT_ARRAY_BUFFER );
+        if( mIndices32.Empty() )
+        {
+          mIndexCount = mIndices.Size();
+          mIndexType = GL_UNSIGNED_SHORT;
+          mIndexBuffer->UpdateDataBuffer( sizeof( unsigned short ) * mIndexCount, &mIndices[0], GpuBuffer::STATIC_DRAW, GpuBuffer::ELEMENT_ARRAY_BUFFER );
+        }
+        else
+        {
+          mIndexCount = mIndices32.Size();
+          mIndexType = GL_UNSIGNED_INT;
+          mIndexBuffer->UpdateDataBuffer( sizeof( uint32_t ) * mIndexCount, &mIndices32[0], GpuBuffer::STATIC_DRAW, GpuBuffer::ELEMENT_ARRAY_BUFFER );
+
+          if( !context.IsElementIndexUintSupported() )
+          {
+            DALI_LOG_ERROR( "32 bit indices are not supported by the GL context, the geometry will not be drawn\n" );
+          }
+        }
       }
 
       mIndicesChanged = false;
@@ -150,25 +270,38 @@ void Geometry::UploadAndDraw(
     mHasBeenUpdated = true;
   }
 
-  //Bind buffers to attribute locations
-  unsigned int base = 0u;
   size_t vertexBufferCount(mVertexBuffers.Count());
-  for( unsigned int i = 0; i < vertexBufferCount; ++i )
+  if( useVertexArray )
   {
-    mVertexBuffers[i]->BindBuffer( GpuBuffer::ARRAY_BUFFER );
-    base += mVertexBuffers[i]->EnableVertexAttributes( context, attributeLocation, base );
+    BindVertexArray( context, attributeLocation );
+  }
+  else
+  {
+    //Bind buffers to attribute locations
+    unsigned int base = 0u;
+    for( unsigned int i = 0; i < vertexBufferCount; ++i )
+    {
+      mVertexBuffers[i]->BindBuffer( GpuBuffer::ARRAY_BUFFER );
+      base += mVertexBuffers[i]->EnableVertexAttributes( context, attributeLocation, base );
+    }
+  }
+
+  if( instances )
+  {
+    // Per-instance attributes are only set up for this draw call; they are restored afterwards, also in a bound vertex array object
+    instances->EnableAttributes( context );
   }
 
   size_t numIndices(0u);
   intptr_t firstIndexOffset(0u);
   if( mIndexBuffer )
   {
-    numIndices = mIndices.Size();
+    numIndices = mIndexCount;
 
     if( elementBufferOffset != 0u )
     {
       elementBufferOffset = elementBufferOffset >= numIndices ? numIndices - 1 : elementBufferOffset;
-      firstIndexOffset = elementBufferOffset * sizeof(GLushort);
+      firstIndexOffset = elementBufferOffset * ( mIndexType == GL_UNSIGNED_INT ? sizeof( GLuint ) : sizeof( GLushort ) );
       numIndices -= elementBufferOffset;
     }
 
@@ -221,9 +354,23 @@ void Geometry::UploadAndDraw(
   //Draw call
   if( mIndexBuffer && geometryGLType != GL_POINTS )
   {
-    //Indexed draw call
-    mIndexBuffer->Bind( GpuBuffer::ELEMENT_ARRAY_BUFFER );
-    context.DrawElements(geometryGLType, numIndices, GL_UNSIGNED_SHORT, reinterpret_cast<void*>(firstIndexOffset));
+    //Indexed draw call, the vertex array object already holds the index buffer binding
+    if( !useVertexArray )
+    {
+      mIndexBuffer->Bind( GpuBuffer::ELEMENT_ARRAY_BUFFER );
+    }
+    // Unsupported 32 bit indices were reported when they were uploaded
+    if( mIndexType == GL_UNSIGNED_SHORT || context.IsElementIndexUintSupported() )
+    {
+      if( instances )
+      {
+        context.DrawElementsInstanced( geometryGLType, numIndices, mIndexType, reinterpret_cast<void*>(firstIndexOffset), instances->GetCount() );
+      }
+      else
+      {
+        context.DrawElements(geometryGLType, numIndices, mIndexType, reinterpret_cast<void*>(firstIndexOffset));
+      }
+    }
   }
   else
   {
@@ -234,15 +381,30 @@ void Geometry::UploadAndDraw(
       numVertices = mVertexBuffers[0]->GetElementCount();
     }
 
-    context.DrawArrays( geometryGLType, 0, numVertices );
+    if( instances )
+    {
+      context.DrawArraysInstanced( geometryGLType, 0, numVertices, instances->GetCount() );
+    }
+    else
+    {
+      context.DrawArrays( geometryGLType, 0, numVertices );
+    }
+  }
+
+  if( instances )
+  {
+    instances->DisableAttributes( context );
   }
 
-  //Disable attributes
-  for( unsigned int i = 0; i < attributeLocation.Count(); ++i )
+  //Disable attributes, unless they belong to the vertex array object
+  if( !useVertexArray )
   {
-    if( attributeLocation[i] != -1 )
+    for( unsigned int i = 0; i < attributeLocation.Count(); ++i )
     {
-      context.DisableVertexAttributeArray( attributeLocation[i] );
+      if( attributeLocation[i] != -1 )
+      {
+        context.DisableVertexAttributeArray( attributeLocation[i] );
+      }
     }
   }
 }
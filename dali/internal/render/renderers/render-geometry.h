@@ -36,6 +36,7 @@ class GpuBuffer;
 
 namespace Render
 {
+class InstanceBuffer;
 class PropertyBuffer;
 
 /**
@@ -77,6 +78,12 @@ public:
    */
   void SetIndexBuffer( Dali::Vector<unsigned short>& indices );
 
+  /**
+   * Set the data for the 32 bit index buffer to be used by the geometry
+   * @param[in] indices A vector containing the indices
+   */
+  void SetIndexBuffer( Dali::Vector<uint32_t>& indices );
+
   /**
    * Removes a PropertyBuffer from the geometry
    * @param[in] propertyBuffer The property buffer to be removed
@@ -122,26 +129,59 @@ public:
    * @param[in] attributeLocation The location for the attributes in the shader
    * @param[in] elementBufferOffset The index of first element to draw if index buffer bound
    * @param[in] elementBufferCount Number of elements to draw if index buffer bound, uses whole buffer when 0
+   * @param[in] instances The uploaded instances to draw with an instanced draw call, or NULL to draw the geometry once
    */
   void UploadAndDraw(Context& context,
                      BufferIndex bufferIndex,
                      Vector<GLint>& attributeLocation,
                      size_t elementBufferOffset,
-                     size_t elementBufferCount );
+                     size_t elementBufferCount,
+                     InstanceBuffer* instances );
 
 private:
 
+  /**
+   * A vertex array object holding the buffer bindings and attribute setup for one set of attribute locations.
+   * Programs which use the same attribute locations share the vertex array object.
+   */
+  struct VertexArray
+  {
+    Vector<GLint> attributeLocation; ///< The attribute locations the vertex array object was set up with
+    GLuint id;                       ///< The GL name of the vertex array object
+  };
+
+  typedef OwnerContainer< VertexArray* > VertexArrayContainer;
+
+  /**
+   * Binds the vertex array object for the given attribute locations, creating it if needed.
+   * @param[in] context The GL context
+   * @param[in] attributeLocation The location for the attributes in the shader
+   */
+  void BindVertexArray( Context& context, const Vector<GLint>& attributeLocation );
+
+  /**
+   * Deletes all the vertex array objects of the geometry
+   */
+  void DeleteVertexArrays();
+
   // PropertyBuffers
   Vector< Render::PropertyBuffer* > mVertexBuffers;
 
+  VertexArrayContainer mVertexArrays; ///< Vertex array objects, when supported by the context
+  Context* mVertexArrayContext;       ///< The context the vertex array objects belong to
+
   Dali::Vector< unsigned short> mIndices;
+  Dali::Vector< uint32_t > mIndices32; ///< Used instead of mIndices when the indices do not fit in 16 bits
   OwnerPointer< GpuBuffer > mIndexBuffer;
+  size_t mIndexCount;                  ///< The number of indices in the index buffer
+  GLenum mIndexType;                   ///< The type of the indices in the index buffer
   Type mGeometryType;
 
   // Booleans
   bool mIndicesChanged : 1;
   bool mHasBeenUpdated : 1;
   bool mAttributesChanged : 1;
+  bool mVertexArraysChanged : 1; ///< Buffers have been added or removed since the vertex array objects were set up
 };
 
 } // namespace Render
@@ -0,0 +1,171 @@
+/*
+ * Copyright (c) 2017 Samsung Electronics Co., Ltd.
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ * http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+// CLASS HEADER
+#include <dali/internal/render/renderers/render-instance-buffer.h>
+
+// EXTERNAL INCLUDES
+#include <cstring>
+
+// INTERNAL INCLUDES
+#include <dali/internal/render/gl-resources/context.h>
+#include <dali/internal/render/gl-resources/gpu-buffer.h>
+#include <dali/internal/render/shaders/program.h>
+
+namespace Dali
+{
+
+namespace Internal
+{
+
+namespace Render
+{
+
+namespace
+{
+
+const unsigned int MATRIX_COLUMNS = 4u; ///< A mat4 attribute is set up as four consecutive vec4 attributes
+
+} // unnamed namespace
+
+InstanceBuffer::InstanceBuffer()
+: mData(),
+  mGpuBuffer( NULL ),
+  mModelViewLocation( -1 ),
+  mColorLocation( -1 ),
+  mSizeLocation( -1 )
+{
+}
+
+InstanceBuffer::~InstanceBuffer()
+{
+  delete mGpuBuffer;
+}
+
+void InstanceBuffer::Clear()
+{
+  mData.Clear();
+}
+
+void InstanceBuffer::Add( const Matrix& modelViewMatrix, const Vector4& color, const Vector3& size )
+{
+  const Dali::Vector< float >::SizeType offset = mData.Count();
+  mData.Resize( offset + FLOATS_PER_INSTANCE );
+
+  float* instance = &mData[offset];
+  memcpy( instance + MODEL_VIEW_OFFSET, modelViewMatrix.AsFloat(), 16u * sizeof( float ) );
+  memcpy( instance + COLOR_OFFSET, color.AsFloat(), 4u * sizeof( float ) );
+  memcpy( instance + SIZE_OFFSET, size.AsFloat(), 3u * sizeof( float ) );
+  instance[SIZE_OFFSET + 3u] = 0.0f;
+}
+
+void InstanceBuffer::Upload( Context& context, Program& program )
+{
+  mModelViewLocation = program.GetAttribLocation( Program::ATTRIB_INSTANCE_MODEL_VIEW );
+  mColorLocation = program.GetAttribLocation( Program::ATTRIB_INSTANCE_COLOR );
+  mSizeLocation = program.GetAttribLocation( Program::ATTRIB_INSTANCE_SIZE );
+
+  if( !mData.Empty() )
+  {
+    if( !mGpuBuffer )
+    {
+      mGpuBuffer = new GpuBuffer( context );
+    }
+
+    // GpuBuffer respecifies a STREAM_DRAW buffer on every update rather than overwriting it,
+    // so the driver does not need to wait for previous draws to read it
+    mGpuBuffer->UpdateDataBuffer( mData.Count() * sizeof( float ), &mData[0], GpuBuffer::STREAM_DRAW, GpuBuffer::ARRAY_BUFFER );
+  }
+}
+
+void InstanceBuffer::EnableAttributes( Context& context )
+{
+  if( !mGpuBuffer )
+  {
+    return;
+  }
+
+  mGpuBuffer->Bind( GpuBuffer::ARRAY_BUFFER );
+
+  const GLsizei stride = FLOATS_PER_INSTANCE * sizeof( float );
+
+  if( mModelViewLocation != -1 )
+  {
+    for( unsigned int column = 0u; column < MATRIX_COLUMNS; ++column )
+    {
+      const GLuint location = mModelViewLocation + column;
+      const size_t offset = ( MODEL_VIEW_OFFSET + column * 4u ) * sizeof( float );
+      context.EnableVertexAttributeArray( location );
+      context.VertexAttribPointer( location, 4, GL_FLOAT, GL_FALSE, stride, reinterpret_cast< void* >( offset ) );
+      context.VertexAttribDivisor( location, 1 );
+    }
+  }
+
+  if( mColorLocation != -1 )
+  {
+    const size_t offset = COLOR_OFFSET * sizeof( float );
+    context.EnableVertexAttributeArray( mColorLocation );
+    context.VertexAttribPointer( mColorLocation, 4, GL_FLOAT, GL_FALSE, stride, reinterpret_cast< void* >( offset ) );
+    context.VertexAttribDivisor( mColorLocation, 1 );
+  }
+
+  if( mSizeLocation != -1 )
+  {
+    const size_t offset = SIZE_OFFSET * sizeof( float );
+    context.EnableVertexAttributeArray( mSizeLocation );
+    context.VertexAttribPointer( mSizeLocation, 3, GL_FLOAT, GL_FALSE, stride, reinterpret_cast< void* >( offset ) );
+    context.VertexAttribDivisor( mSizeLocation, 1 );
+  }
+}
+
+void InstanceBuffer::DisableAttributes( Context& context )
+{
+  // The divisor is attribute state, which would otherwise leak into later non-instanced draws
+  if( mModelViewLocation != -1 )
+  {
+    for( unsigned int column = 0u; column < MATRIX_COLUMNS; ++column )
+    {
+      context.VertexAttribDivisor( mModelViewLocation + column, 0 );
+      context.DisableVertexAttributeArray( mModelViewLocation + column );
+    }
+  }
+
+  if( mColorLocation != -1 )
+  {
+    context.VertexAttribDivisor( mColorLocation, 0 );
+    context.DisableVertexAttributeArray( mColorLocation );
+  }
+
+  if( mSizeLocation != -1 )
+  {
+    context.VertexAttribDivisor( mSizeLocation, 0 );
+    context.DisableVertexAttributeArray( mSizeLocation );
+  }
+}
+
+void InstanceBuffer::GlContextDestroyed()
+{
+  if( mGpuBuffer )
+  {
+    mGpuBuffer->GlContextDestroyed();
+  }
+}
+
+} // namespace Render
+
+} // namespace Internal
+
+} // namespace Dali
@@ -0,0 +1,137 @@
+#ifndef DALI_INTERNAL_RENDER_INSTANCE_BUFFER_H
+#define DALI_INTERNAL_RENDER_INSTANCE_BUFFER_H
+
+/*
+ * Copyright (c) 2017 Samsung Electronics Co., Ltd.
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ * http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+// INTERNAL INCLUDES
+#include <dali/public-api/common/dali-vector.h>
+#include <dali/public-api/math/matrix.h>
+#include <dali/public-api/math/vector3.h>
+#include <dali/public-api/math/vector4.h>
+#include <dali/integration-api/gl-abstraction.h>
+
+namespace Dali
+{
+
+namespace Internal
+{
+class Context;
+class GpuBuffer;
+class Program;
+
+namespace Render
+{
+
+/**
+ * Holds the per-instance data of an instanced draw call.
+ *
+ * Each instance stores its model-view matrix, color and size, which shaders using
+ * Shader::Hint::INSTANCED read from the aInstanceModelView, aInstanceColor and aInstanceSize attributes.
+ * The data is collected and uploaded again for every instanced draw call, reusing the same GPU buffer.
+ */
+class InstanceBuffer
+{
+public:
+
+  /**
+   * Constructor
+   */
+  InstanceBuffer();
+
+  /**
+   * Destructor
+   */
+  ~InstanceBuffer();
+
+  /**
+   * Removes all the instances
+   */
+  void Clear();
+
+  /**
+   * Adds an instance
+   * @param[in] modelViewMatrix The model-view matrix of the instance
+   * @param[in] color The color of the instance
+   * @param[in] size The size of the instance
+   */
+  void Add( const Matrix& modelViewMatrix, const Vector4& color, const Vector3& size );
+
+  /**
+   * @return The number of instances
+   */
+  unsigned int GetCount() const
+  {
+    return mData.Count() / FLOATS_PER_INSTANCE;
+  }
+
+  /**
+   * Uploads the instances to the GPU and queries the instance attributes of the program
+   * @param[in] context The GL context
+   * @param[in] program The program which will draw the instances
+   */
+  void Upload( Context& context, Program& program );
+
+  /**
+   * Sets up the instance attributes used by the program, for the next draw call
+   * @pre Upload() has been called
+   * @param[in] context The GL context
+   */
+  void EnableAttributes( Context& context );
+
+  /**
+   * Restores the instance attributes to per-vertex and disables them
+   * @param[in] context The GL context
+   */
+  void DisableAttributes( Context& context );
+
+  /**
+   * Needs to be called when the GL context is destroyed
+   */
+  void GlContextDestroyed();
+
+private:
+
+  // Undefined
+  InstanceBuffer( const InstanceBuffer& );
+
+  // Undefined
+  InstanceBuffer& operator=( const InstanceBuffer& rhs );
+
+private:
+
+  enum
+  {
+    MODEL_VIEW_OFFSET   = 0,  ///< Offset in floats of the model-view matrix, a mat4 attribute uses four locations
+    COLOR_OFFSET        = 16, ///< Offset in floats of the color
+    SIZE_OFFSET         = 20, ///< Offset in floats of the size
+    FLOATS_PER_INSTANCE = 24  ///< The size is padded so that each instance is 16 byte aligned
+  };
+
+  Dali::Vector< float > mData;              ///< The instances
+  GpuBuffer*            mGpuBuffer;         ///< The GPU buffer holding the instances, created on first upload
+  GLint                 mModelViewLocation; ///< The location of aInstanceModelView, or -1
+  GLint                 mColorLocation;     ///< The location of aInstanceColor, or -1
+  GLint                 mSizeLocation;      ///< The location of aInstanceSize, or -1
+};
+
+} // namespace Render
+
+} // namespace Internal
+
+} // namespace Dali
+
+#endif // DALI_INTERNAL_RENDER_INSTANCE_BUFFER_H
@@ -2,6 +2,9 @@
 #include <dali/internal/render/renderers/render-property-buffer.h>
 #include <dali/internal/event/common/property-buffer-impl.h>  // Dali::Internal::PropertyBuffer
 
+#include <algorithm> // std::min, std::max
+#include <cstring> // memcpy
+
 namespace
 {
 
@@ -104,6 +107,21 @@ PropertyBuffer::PropertyBuffer()
  mData(NULL),
  mGpuBuffer(NULL),
  mSize(0),
+ mDirtyBegin(0),
+ mDirtyEnd(0),
+ mUsage(GpuBuffer::STATIC_DRAW),
+ mDataChanged(true)
+{
+}
+
+PropertyBuffer::PropertyBuffer( GpuBuffer::Usage usage )
+:mFormat(NULL),
+ mData(NULL),
+ mGpuBuffer(NULL),
+ mSize(0),
+ mDirtyBegin(0),
+ mDirtyEnd(0),
+ mUsage(usage),
  mDataChanged(true)
 {
 }
@@ -125,6 +143,31 @@ void PropertyBuffer::SetData( Dali::Vector<char>* data, size_t size )
   mDataChanged = true;
 }
 
+void PropertyBuffer::SetDataRange( Dali::Vector<char>* data, size_t offset )
+{
+  OwnerPointer< Dali::Vector< char > > range( data );
+
+  if( !mData || offset + range->Size() > mData->Size() )
+  {
+    DALI_ASSERT_DEBUG( !"Property buffer range out of bounds" );
+    return;
+  }
+
+  memcpy( &(*mData)[offset], range->Begin(), range->Size() );
+
+  if( mDirtyEnd == mDirtyBegin )
+  {
+    mDirtyBegin = offset;
+    mDirtyEnd = offset + range->Size();
+  }
+  else
+  {
+    // Ranges are merged, one upload of the bytes in between is cheaper than one upload for each range
+    mDirtyBegin = std::min( mDirtyBegin, offset );
+    mDirtyEnd = std::max( mDirtyEnd, offset + range->Size() );
+  }
+}
+
 bool PropertyBuffer::Update( Context& context )
 {
   if( !mData || !mFormat || !mSize )
@@ -132,7 +175,8 @@ bool PropertyBuffer::Update( Context& context )
     return false;
   }
 
-  if( !mGpuBuffer || mDataChanged )
+  // A stream buffer is respecified whenever it changes, so the driver does not need to wait for draws reading the old data
+  if( !mGpuBuffer || mDataChanged || ( mUsage == GpuBuffer::STREAM_DRAW && mDirtyEnd != mDirtyBegin ) )
   {
     if ( ! mGpuBuffer )
     {
@@ -143,10 +187,16 @@ bool PropertyBuffer::Update( Context& context )
     if ( mGpuBuffer )
     {
       DALI_ASSERT_DEBUG( mSize && "No data in the property buffer!" );
-      mGpuBuffer->UpdateDataBuffer( GetDataSize(), &((*mData)[0]), GpuBuffer::STATIC_DRAW, GpuBuffer::ARRAY_BUFFER );
+      mGpuBuffer->UpdateDataBuffer( GetDataSize(), &((*mData)[0]), mUsage, GpuBuffer::ARRAY_BUFFER );
     }
 
     mDataChanged = false;
+    mDirtyBegin = mDirtyEnd = 0;
+  }
+  else if( mDirtyEnd != mDirtyBegin )
+  {
+    mGpuBuffer->UpdateDataBufferRange( mDirtyBegin, mDirtyEnd - mDirtyBegin, &((*mData)[mDirtyBegin]), GpuBuffer::ARRAY_BUFFER );
+    mDirtyBegin = mDirtyEnd = 0;
   }
 
   return true;
@@ -52,10 +52,16 @@ public:
   };
 
   /**
-   * @brief Default constructor
+   * @brief Default constructor, for a buffer with static data
    */
   PropertyBuffer();
 
+  /**
+   * @brief Constructor
+   * @param[in] usage How often the data of the buffer is expected to change
+   */
+  explicit PropertyBuffer( GpuBuffer::Usage usage );
+
   /**
    * @brief Destructor
    */
@@ -79,6 +85,16 @@ public:
    */
   void SetData( Dali::Vector<char>* data, size_t size );
 
+  /**
+   * @brief Update a range of the data of the PropertyBuffer
+   *
+   * This function takes ownership of the pointer. Only the updated ranges are uploaded,
+   * unless the whole buffer has to be uploaded anyway.
+   * @param[in] data The new data of the range
+   * @param[in] offset The offset of the range in bytes
+   */
+  void SetDataRange( Dali::Vector<char>* data, size_t offset );
+
   /**
    * @brief Set the number of elements
    * @param[in] size The number of elements
@@ -188,6 +204,9 @@ private:
   OwnerPointer< GpuBuffer >               mGpuBuffer; ///< Pointer to the GpuBuffer associated with this RenderPropertyBuffer
 
   size_t mSize;       ///< Number of Elements in the buffer
+  size_t mDirtyBegin; ///< Offset in bytes of the first byte updated since the last upload
+  size_t mDirtyEnd;   ///< Offset in bytes after the last byte updated since the last upload, equal to mDirtyBegin if nothing was
+  GpuBuffer::Usage mUsage; ///< How often the data is expected to change
   bool mDataChanged;  ///< Flag to know if data has changed in a frame
 };
 
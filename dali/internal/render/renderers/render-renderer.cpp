@@ -18,10 +18,15 @@
 // CLASS HEADER
 #include <dali/internal/render/renderers/render-renderer.h>
 
+// EXTERNAL INCLUDES
+#include <cstring>
+
 // INTERNAL INCLUDES
 #include <dali/internal/common/image-sampler.h>
 #include <dali/internal/render/gl-resources/context.h>
+#include <dali/internal/render/renderers/render-instance-buffer.h>
 #include <dali/internal/render/renderers/render-sampler.h>
+#include <dali/internal/render/renderers/render-uniform-buffer.h>
 #include <dali/internal/render/shaders/scene-graph-shader.h>
 #include <dali/internal/render/shaders/program.h>
 #include <dali/internal/render/data-providers/node-data-provider.h>
@@ -100,6 +105,210 @@ inline void SetMatrices( Program& program,
   }
 }
 
+/**
+ * Setters of default block uniforms, one for each supported property type.
+ */
+void SetIntegerUniform( Program& program, GLint location, const PropertyInputImpl& property, BufferIndex bufferIndex )
+{
+  program.SetUniform1i( location, property.GetInteger( bufferIndex ) );
+}
+
+void SetFloatUniform( Program& program, GLint location, const PropertyInputImpl& property, BufferIndex bufferIndex )
+{
+  program.SetUniform1f( location, property.GetFloat( bufferIndex ) );
+}
+
+void SetVector2Uniform( Program& program, GLint location, const PropertyInputImpl& property, BufferIndex bufferIndex )
+{
+  const Vector2& value( property.GetVector2( bufferIndex ) );
+  program.SetUniform2f( location, value.x, value.y );
+}
+
+void SetVector3Uniform( Program& program, GLint location, const PropertyInputImpl& property, BufferIndex bufferIndex )
+{
+  const Vector3& value( property.GetVector3( bufferIndex ) );
+  program.SetUniform3f( location, value.x, value.y, value.z );
+}
+
+void SetVector4Uniform( Program& program, GLint location, const PropertyInputImpl& property, BufferIndex bufferIndex )
+{
+  const Vector4& value( property.GetVector4( bufferIndex ) );
+  program.SetUniform4f( location, value.x, value.y, value.z, value.w );
+}
+
+void SetRotationUniform( Program& program, GLint location, const PropertyInputImpl& property, BufferIndex bufferIndex )
+{
+  const Quaternion& value( property.GetQuaternion( bufferIndex ) );
+  program.SetUniform4f( location, value.mVector.x, value.mVector.y, value.mVector.z, value.mVector.w );
+}
+
+void SetMatrixUniform( Program& program, GLint location, const PropertyInputImpl& property, BufferIndex bufferIndex )
+{
+  program.SetUniformMatrix4fv( location, 1, property.GetMatrix( bufferIndex ).AsFloat() );
+}
+
+void SetMatrix3Uniform( Program& program, GLint location, const PropertyInputImpl& property, BufferIndex bufferIndex )
+{
+  program.SetUniformMatrix3fv( location, 1, property.GetMatrix3( bufferIndex ).AsFloat() );
+}
+
+typedef void (*SetUniformFunction)( Program& program, GLint location, const PropertyInputImpl& property, BufferIndex bufferIndex );
+
+/**
+ * @param[in] type The type of a property
+ * @return The setter for the property type, or NULL if the type can not be a uniform
+ */
+SetUniformFunction GetSetUniformFunction( Property::Type type )
+{
+  switch( type )
+  {
+    case Property::INTEGER:
+    {
+      return SetIntegerUniform;
+    }
+    case Property::FLOAT:
+    {
+      return SetFloatUniform;
+    }
+    case Property::VECTOR2:
+    {
+      return SetVector2Uniform;
+    }
+    case Property::VECTOR3:
+    {
+      return SetVector3Uniform;
+    }
+    case Property::VECTOR4:
+    {
+      return SetVector4Uniform;
+    }
+    case Property::ROTATION:
+    {
+      return SetRotationUniform;
+    }
+    case Property::MATRIX:
+    {
+      return SetMatrixUniform;
+    }
+    case Property::MATRIX3:
+    {
+      return SetMatrix3Uniform;
+    }
+    default:
+    {
+      // Other property types are ignored
+      return NULL;
+    }
+  }
+}
+
+/**
+ * Writers for the packed data of a uniform block, one for each supported property type.
+ * The layout of a member is given by the offset and matrix stride queried from the Program.
+ */
+void WriteIntegerToBlock( const PropertyInputImpl& property, BufferIndex bufferIndex, char* destination, GLint /*matrixStride*/ )
+{
+  const GLint value = property.GetInteger( bufferIndex );
+  memcpy( destination, &value, sizeof( GLint ) );
+}
+
+void WriteFloatToBlock( const PropertyInputImpl& property, BufferIndex bufferIndex, char* destination, GLint /*matrixStride*/ )
+{
+  const float value = property.GetFloat( bufferIndex );
+  memcpy( destination, &value, sizeof( float ) );
+}
+
+void WriteVector2ToBlock( const PropertyInputImpl& property, BufferIndex bufferIndex, char* destination, GLint /*matrixStride*/ )
+{
+  memcpy( destination, property.GetVector2( bufferIndex ).AsFloat(), 2u * sizeof( float ) );
+}
+
+void WriteVector3ToBlock( const PropertyInputImpl& property, BufferIndex bufferIndex, char* destination, GLint /*matrixStride*/ )
+{
+  memcpy( destination, property.GetVector3( bufferIndex ).AsFloat(), 3u * sizeof( float ) );
+}
+
+void WriteVector4ToBlock( const PropertyInputImpl& property, BufferIndex bufferIndex, char* destination, GLint /*matrixStride*/ )
+{
+  memcpy( destination, property.GetVector4( bufferIndex ).AsFloat(), 4u * sizeof( float ) );
+}
+
+void WriteRotationToBlock( const PropertyInputImpl& property, BufferIndex bufferIndex, char* destination, GLint /*matrixStride*/ )
+{
+  memcpy( destination, property.GetQuaternion( bufferIndex ).mVector.AsFloat(), 4u * sizeof( float ) );
+}
+
+void WriteMatrixToBlock( const PropertyInputImpl& property, BufferIndex bufferIndex, char* destination, GLint matrixStride )
+{
+  const float* columns = property.GetMatrix( bufferIndex ).AsFloat();
+  const GLint stride = matrixStride ? matrixStride : 4 * sizeof( float );
+  for( unsigned int column = 0u; column < 4u; ++column )
+  {
+    memcpy( destination + column * stride, columns + column * 4u, 4u * sizeof( float ) );
+  }
+}
+
+void WriteMatrix3ToBlock( const PropertyInputImpl& property, BufferIndex bufferIndex, char* destination, GLint matrixStride )
+{
+  // Each column of a mat3 is padded to a vec4 in a block
+  const float* columns = property.GetMatrix3( bufferIndex ).AsFloat();
+  const GLint stride = matrixStride ? matrixStride : 4 * sizeof( float );
+  for( unsigned int column = 0u; column < 3u; ++column )
+  {
+    memcpy( destination + column * stride, columns + column * 3u, 3u * sizeof( float ) );
+  }
+}
+
+typedef void (*WriteToBlockFunction)( const PropertyInputImpl& property, BufferIndex bufferIndex, char* destination, GLint matrixStride );
+
+/**
+ * @param[in] type The type of a property
+ * @return The writer for the property type, or NULL if the type can not be a uniform
+ */
+WriteToBlockFunction GetUniformBlockWriteFunction( Property::Type type )
+{
+  switch( type )
+  {
+    case Property::INTEGER:
+    {
+      return WriteIntegerToBlock;
+    }
+    case Property::FLOAT:
+    {
+      return WriteFloatToBlock;
+    }
+    case Property::VECTOR2:
+    {
+      return WriteVector2ToBlock;
+    }
+    case Property::VECTOR3:
+    {
+      return WriteVector3ToBlock;
+    }
+    case Property::VECTOR4:
+    {
+      return WriteVector4ToBlock;
+    }
+    case Property::ROTATION:
+    {
+      return WriteRotationToBlock;
+    }
+    case Property::MATRIX:
+    {
+      return WriteMatrixToBlock;
+    }
+    case Property::MATRIX3:
+    {
+      return WriteMatrix3ToBlock;
+    }
+    default:
+    {
+      // Other property types are ignored
+      return NULL;
+    }
+  }
+}
+
 }
 
 namespace Render
@@ -135,6 +344,11 @@ Renderer::Renderer( SceneGraph::RenderDataProvider* dataProvider,
   mContext( NULL),
   mGeometry( geometry ),
   mUniformIndexMap(),
+  mUniformWriters(),
+  mUniformBlockWriters(),
+  mUniformBlockData(),
+  mUniformWritersProgram( NULL ),
+  mUniformBuffer( NULL ),
   mAttributesLocation(),
   mStencilParameters( stencilParameters ),
   mBlendingOptions(),
@@ -145,7 +359,8 @@ Renderer::Renderer( SceneGraph::RenderDataProvider* dataProvider,
   mDepthWriteMode( depthWriteMode ),
   mDepthTestMode( depthTestMode ),
   mUpdateAttributesLocation( true ),
-  mPremultipledAlphaEnabled( preMultipliedAlphaEnabled )
+  mPremultipledAlphaEnabled( preMultipliedAlphaEnabled ),
+  mUpdateUniformWriters( true )
 {
   if(  blendingBitmask != 0u )
   {
@@ -158,9 +373,10 @@ Renderer::Renderer( SceneGraph::RenderDataProvider* dataProvider,
   }
 }
 
-void Renderer::Initialize( Context& context )
+void Renderer::Initialize( Context& context, UniformBuffer& uniformBuffer )
 {
   mContext = &context;
+  mUniformBuffer = &uniformBuffer;
 }
 
 Renderer::~Renderer()
@@ -175,7 +391,7 @@ void Renderer::SetRenderDataProvider( SceneGraph::RenderDataProvider* dataProvid
   //Check that the number of textures match the number of samplers in the shader
   size_t textureCount =  dataProvider->GetTextures().size();
   Program* program = dataProvider->GetShader().GetProgram();
-  if( program && program->GetActiveSamplerCount() != textureCount )
+  if( program && !program->IsCompiling() && program->GetActiveSamplerCount() != textureCount )
   {
     DALI_LOG_WARNING("The number of active samplers in the shader(%lu) does not match the number of textures in the TextureSet(%lu)\n",
                    program->GetActiveSamplerCount(),
@@ -220,13 +436,16 @@ void Renderer::SetBlending( Context& context, bool blend )
 void Renderer::GlContextDestroyed()
 {
   mGeometry->GlContextDestroyed();
+
+  // The programs are linked again, so the uniform locations have to be resolved again
+  mUpdateUniformWriters = true;
 }
 
 void Renderer::GlCleanup()
 {
 }
 
-void Renderer::SetUniforms( BufferIndex bufferIndex, const SceneGraph::NodeDataProvider& node, const Vector3& size, Program& program )
+void Renderer::SetUniforms( Context& context, BufferIndex bufferIndex, const SceneGraph::NodeDataProvider& node, const Vector3& size, Program& program )
 {
   // Check if the map has changed
   DALI_ASSERT_DEBUG( mRenderDataProvider && "No Uniform map data provider available" );
@@ -273,15 +492,18 @@ void Renderer::SetUniforms( BufferIndex bufferIndex, const SceneGraph::NodeDataP
     }
 
     mUniformIndexMap.Resize( mapIndex );
+    mUpdateUniformWriters = true;
+  }
+
+  if( mUpdateUniformWriters || mUniformWritersProgram != &program )
+  {
+    UpdateUniformWriters( context, program );
   }
 
   // Set uniforms in local map
-  for( UniformIndexMappings::Iterator iter = mUniformIndexMap.Begin(),
-         end = mUniformIndexMap.End() ;
-       iter != end ;
-       ++iter )
+  for( UniformWriters::ConstIterator iter = mUniformWriters.Begin(), end = mUniformWriters.End(); iter != end; ++iter )
   {
-    SetUniformFromProperty( bufferIndex, program, *iter );
+    iter->set( program, iter->location, *iter->propertyValue, bufferIndex );
   }
 
   GLint sizeLoc = program.GetUniformLocation( Program::UNIFORM_SIZE );
@@ -291,72 +513,85 @@ void Renderer::SetUniforms( BufferIndex bufferIndex, const SceneGraph::NodeDataP
   }
 }
 
-void Renderer::SetUniformFromProperty( BufferIndex bufferIndex, Program& program, UniformIndexMap& map )
+void Renderer::UpdateUniformWriters( Context& context, Program& program )
 {
-  GLint location = program.GetUniformLocation(map.uniformIndex);
-  if( Program::UNIFORM_UNKNOWN != location )
+  // Resolve the locations and the setters for the property types once, rather than for every draw call
+  mUniformWriters.Clear();
+  for( UniformIndexMappings::ConstIterator iter = mUniformIndexMap.Begin(), end = mUniformIndexMap.End(); iter != end; ++iter )
   {
-    // switch based on property type to use correct GL uniform setter
-    switch ( map.propertyValue->GetType() )
+    const GLint location = program.GetUniformLocation( iter->uniformIndex );
+    if( Program::UNIFORM_UNKNOWN != location )
     {
-      case Property::INTEGER:
-      {
-        program.SetUniform1i( location, map.propertyValue->GetInteger( bufferIndex ) );
-        break;
-      }
-      case Property::FLOAT:
-      {
-        program.SetUniform1f( location, map.propertyValue->GetFloat( bufferIndex ) );
-        break;
-      }
-      case Property::VECTOR2:
+      UniformSetFunction set = GetSetUniformFunction( iter->propertyValue->GetType() );
+      if( set )
       {
-        Vector2 value( map.propertyValue->GetVector2( bufferIndex ) );
-        program.SetUniform2f( location, value.x, value.y );
-        break;
+        UniformWriter writer = { set, iter->propertyValue, location };
+        mUniformWriters.PushBack( writer );
       }
+    }
+  }
 
-      case Property::VECTOR3:
+  // Members of uniform blocks do not have a location, they are written to the uniform buffer instead
+  mUniformBlockWriters.Clear();
+  if( context.IsUniformBufferSupported() )
+  {
+    const Program::UniformBlocks& blocks = program.GetUniformBlocks();
+    for( unsigned int blockIndex = 0; blockIndex < blocks.size(); ++blockIndex )
+    {
+      const std::vector< Program::UniformBlockMember >& members = blocks[blockIndex].members;
+      for( std::vector< Program::UniformBlockMember >::const_iterator member = members.begin(); member != members.end(); ++member )
       {
-        Vector3 value( map.propertyValue->GetVector3( bufferIndex ) );
-        program.SetUniform3f( location, value.x, value.y, value.z );
-        break;
+        for( UniformIndexMappings::ConstIterator iter = mUniformIndexMap.Begin(); iter != mUniformIndexMap.End(); ++iter )
+        {
+          if( iter->uniformIndex == member->uniformIndex )
+          {
+            UniformBlockWriteFunction write = GetUniformBlockWriteFunction( iter->propertyValue->GetType() );
+            if( write )
+            {
+              UniformBlockWriter writer = { write, iter->propertyValue, blockIndex, member->offset, member->matrixStride };
+              mUniformBlockWriters.PushBack( writer );
+            }
+            break;
+          }
+        }
       }
+    }
+  }
 
-      case Property::VECTOR4:
-      {
-        Vector4 value( map.propertyValue->GetVector4( bufferIndex ) );
-        program.SetUniform4f( location, value.x, value.y, value.z, value.w );
-        break;
-      }
+  mUniformWritersProgram = &program;
+  mUpdateUniformWriters = false;
+}
 
-      case Property::ROTATION:
-      {
-        Quaternion value( map.propertyValue->GetQuaternion( bufferIndex ) );
-        program.SetUniform4f( location, value.mVector.x, value.mVector.y, value.mVector.z, value.mVector.w );
-        break;
-      }
+void Renderer::WriteUniformBlocks( Context& context, BufferIndex bufferIndex, Program& program )
+{
+  const Program::UniformBlocks& blocks = program.GetUniformBlocks();
 
-      case Property::MATRIX:
+  UniformBlockWriters::ConstIterator writer = mUniformBlockWriters.Begin();
+  const UniformBlockWriters::ConstIterator end = mUniformBlockWriters.End();
+  for( unsigned int blockIndex = 0; blockIndex < blocks.size(); ++blockIndex )
+  {
+    const Program::UniformBlock& block = blocks[blockIndex];
+    if( block.size <= 0 )
+    {
+      // Skip the writers of this block, so that the next block does not start with them
+      while( writer != end && writer->block == blockIndex )
       {
-        const Matrix& value = map.propertyValue->GetMatrix(bufferIndex);
-        program.SetUniformMatrix4fv(location, 1, value.AsFloat() );
-        break;
+        ++writer;
       }
+      continue;
+    }
 
-      case Property::MATRIX3:
-      {
-        const Matrix3& value = map.propertyValue->GetMatrix3(bufferIndex);
-        program.SetUniformMatrix3fv(location, 1, value.AsFloat() );
-        break;
-      }
+    // Members without a mapped property are left as zero
+    mUniformBlockData.Resize( block.size );
+    char* data = &mUniformBlockData[0];
+    memset( data, 0, block.size );
 
-      default:
-      {
-        // Other property types are ignored
-        break;
-      }
+    for( ; writer != end && writer->block == blockIndex; ++writer )
+    {
+      writer->write( *writer->propertyValue, bufferIndex, data + writer->offset, writer->matrixStride );
     }
+
+    mUniformBuffer->Write( context, block.binding, data, block.size );
   }
 }
 
@@ -533,7 +768,8 @@ void Renderer::Render( Context& context,
                        const Matrix& viewMatrix,
                        const Matrix& projectionMatrix,
                        const Vector3& size,
-                       bool blend )
+                       bool blend,
+                       InstanceBuffer* instances )
 {
   // Get the program to use:
   Program* program = mRenderDataProvider->GetShader().GetProgram();
@@ -549,6 +785,12 @@ void Renderer::Render( Context& context,
     }
   }
 
+  if( program->IsCompiling() )
+  {
+    // Skip drawing rather than waiting for the driver to finish compiling the program
+    return;
+  }
+
   //Set cull face  mode
   context.CullFace( mFaceCullingMode );
 
@@ -580,7 +822,12 @@ void Renderer::Render( Context& context,
       }
     }
 
-    SetUniforms( bufferIndex, node, size, *program );
+    SetUniforms( context, bufferIndex, node, size, *program );
+
+    if( mUniformBuffer && context.IsUniformBufferSupported() )
+    {
+      WriteUniformBlocks( context, bufferIndex, *program );
+    }
 
     if( mUpdateAttributesLocation || mGeometry->AttributesChanged() )
     {
@@ -588,11 +835,77 @@ void Renderer::Render( Context& context,
       mUpdateAttributesLocation = false;
     }
 
+    if( instances )
+    {
+      instances->Upload( context, *program );
+    }
+
     mGeometry->UploadAndDraw( context,
                               bufferIndex,
                               mAttributesLocation,
                               mIndexedDrawFirstElement,
-                              mIndexedDrawElementsCount );
+                              mIndexedDrawElementsCount,
+                              instances );
+  }
+}
+
+bool Renderer::CanRenderInstancedWith( const Renderer& other ) const
+{
+  // The default program, used until the shader has one, does not read the per-instance attributes
+  SceneGraph::Shader& shader = mRenderDataProvider->GetShader();
+  if( &shader != &other.mRenderDataProvider->GetShader() ||
+      !shader.HintEnabled( Dali::Shader::Hint::INSTANCED ) ||
+      !shader.GetProgram() ||
+      mGeometry != other.mGeometry )
+  {
+    return false;
+  }
+
+  if( mRenderDataProvider->GetTextures() != other.mRenderDataProvider->GetTextures() ||
+      mRenderDataProvider->GetSamplers() != other.mRenderDataProvider->GetSamplers() )
+  {
+    return false;
+  }
+
+  const Vector4* blendColor = mBlendingOptions.GetBlendColor();
+  const Vector4* otherBlendColor = other.mBlendingOptions.GetBlendColor();
+  if( ( mBlendingOptions.GetBitmask() != other.mBlendingOptions.GetBitmask() ) ||
+      ( blendColor != otherBlendColor && ( !blendColor || !otherBlendColor || *blendColor != *otherBlendColor ) ) )
+  {
+    return false;
+  }
+
+  return ( mIndexedDrawFirstElement == other.mIndexedDrawFirstElement ) &&
+         ( mIndexedDrawElementsCount == other.mIndexedDrawElementsCount ) &&
+         ( mFaceCullingMode == other.mFaceCullingMode ) &&
+         ( mPremultipledAlphaEnabled == other.mPremultipledAlphaEnabled ) &&
+         ( mDepthWriteMode == other.mDepthWriteMode ) &&
+         ( mDepthTestMode == other.mDepthTestMode ) &&
+         ( mDepthFunction == other.mDepthFunction ) &&
+         ( mStencilParameters.renderMode == other.mStencilParameters.renderMode ) &&
+         ( mStencilParameters.stencilFunction == other.mStencilParameters.stencilFunction ) &&
+         ( mStencilParameters.stencilFunctionMask == other.mStencilParameters.stencilFunctionMask ) &&
+         ( mStencilParameters.stencilFunctionReference == other.mStencilParameters.stencilFunctionReference ) &&
+         ( mStencilParameters.stencilMask == other.mStencilParameters.stencilMask ) &&
+         ( mStencilParameters.stencilOperationOnFail == other.mStencilParameters.stencilOperationOnFail ) &&
+         ( mStencilParameters.stencilOperationOnZFail == other.mStencilParameters.stencilOperationOnZFail ) &&
+         ( mStencilParameters.stencilOperationOnZPass == other.mStencilParameters.stencilOperationOnZPass );
+}
+
+void Renderer::AddInstance( InstanceBuffer& instances,
+                            BufferIndex bufferIndex,
+                            const SceneGraph::NodeDataProvider& node,
+                            const Matrix& modelViewMatrix,
+                            const Vector3& size ) const
+{
+  const Vector4& color = node.GetRenderColor( bufferIndex );
+  if( mPremultipledAlphaEnabled )
+  {
+    instances.Add( modelViewMatrix, Vector4( color.r * color.a, color.g * color.a, color.b * color.a, color.a ), size );
+  }
+  else
+  {
+    instances.Add( modelViewMatrix, color, size );
   }
 }
 
@@ -50,6 +50,8 @@ class NodeDataProvider;
 
 namespace Render
 {
+class InstanceBuffer;
+class UniformBuffer;
 
 /**
  * Renderers are used to render meshes
@@ -163,8 +165,9 @@ public:
    * Second-phase construction.
    * This is called when the renderer is inside render thread
    * @param[in] context Context used by the renderer
+   * @param[in] uniformBuffer The uniform buffer shared by the renderers, used when the context supports it
    */
-  void Initialize( Context& context );
+  void Initialize( Context& context, UniformBuffer& uniformBuffer );
 
   /**
    * Destructor
@@ -351,6 +354,8 @@ public:
    * @param[in] projectionMatrix The projection matrix.
    * @param[in] size Size of the render item
    * @param[in] blend If true, blending is enabled
+   * @param[in] instances The instances to draw with one instanced draw call, or NULL to draw once.
+   *                      The uniforms are then set from the first instance, which is the one passed in.
    */
   void Render( Context& context,
                BufferIndex bufferIndex,
@@ -361,7 +366,30 @@ public:
                const Matrix& viewMatrix,
                const Matrix& projectionMatrix,
                const Vector3& size,
-               bool blend );
+               bool blend,
+               InstanceBuffer* instances );
+
+  /**
+   * Query whether this renderer can be drawn in the same instanced draw call as another one.
+   * This requires a shader with Shader::Hint::INSTANCED, and the same geometry, textures and render state.
+   * @param[in] other The renderer drawn next
+   * @return True if both renderers can be drawn with one instanced draw call
+   */
+  bool CanRenderInstancedWith( const Renderer& other ) const;
+
+  /**
+   * Adds the per-instance data of a node drawn with this renderer
+   * @param[in] instances The instances to add to
+   * @param[in] bufferIndex The index of the previous update buffer.
+   * @param[in] node The node using this renderer
+   * @param[in] modelViewMatrix The model-view matrix.
+   * @param[in] size Size of the render item
+   */
+  void AddInstance( InstanceBuffer& instances,
+                    BufferIndex bufferIndex,
+                    const SceneGraph::NodeDataProvider& node,
+                    const Matrix& modelViewMatrix,
+                    const Vector3& size ) const;
 
   /**
    * Write the renderer's sort attributes to the passed in reference
@@ -374,6 +402,8 @@ public:
 private:
 
   struct UniformIndexMap;
+  struct UniformWriter;
+  struct UniformBlockWriter;
 
   // Undefined
   Renderer( const Renderer& );
@@ -390,20 +420,31 @@ private:
 
   /**
    * Set the uniforms from properties according to the uniform map
+   * @param[in] context The GL context
    * @param[in] bufferIndex The index of the previous update buffer.
    * @param[in] node The node using the renderer
    * @param[in] size The size of the renderer
    * @param[in] program The shader program on which to set the uniforms.
    */
-  void SetUniforms( BufferIndex bufferIndex, const SceneGraph::NodeDataProvider& node, const Vector3& size, Program& program );
+  void SetUniforms( Context& context, BufferIndex bufferIndex, const SceneGraph::NodeDataProvider& node, const Vector3& size, Program& program );
+
+  /**
+   * Rebuild the uniform writers from the uniform map, resolving the uniform locations and
+   * the setters for the property types, so that setting the uniforms does not look them up every draw.
+   * @param[in] context The GL context
+   * @param[in] program The shader program
+   */
+  void UpdateUniformWriters( Context& context, Program& program );
 
   /**
-   * Set the program uniform in the map from the mapped property
+   * Write the mapped properties which are members of the uniform blocks of the program to the uniform buffer.
+   * Uniforms set by the renderer itself (matrices, color, size) are expected in the default block.
+   * @pre The context supports uniform buffers
+   * @param[in] context The GL context
    * @param[in] bufferIndex The index of the previous update buffer.
    * @param[in] program The shader program
-   * @param[in] map The uniform
    */
-  void SetUniformFromProperty( BufferIndex bufferIndex, Program& program, UniformIndexMap& map );
+  void WriteUniformBlocks( Context& context, BufferIndex bufferIndex, Program& program );
 
   /**
    * Bind the textures and setup the samplers
@@ -428,7 +469,42 @@ private:
 
   typedef Dali::Vector< UniformIndexMap > UniformIndexMappings;
 
+  /**
+   * Sets a property to a default block uniform
+   */
+  typedef void (*UniformSetFunction)( Program& program, GLint location, const PropertyInputImpl& property, BufferIndex bufferIndex );
+
+  struct UniformWriter
+  {
+    UniformSetFunction         set;                         ///< The setter for the type of the property
+    const PropertyInputImpl*   propertyValue;
+    GLint                      location;                    ///< The resolved location of the uniform
+  };
+
+  typedef Dali::Vector< UniformWriter > UniformWriters;
+
+  /**
+   * Writes a property to the packed data of a uniform block
+   */
+  typedef void (*UniformBlockWriteFunction)( const PropertyInputImpl& property, BufferIndex bufferIndex, char* destination, GLint matrixStride );
+
+  struct UniformBlockWriter
+  {
+    UniformBlockWriteFunction  write;                       ///< The writer for the type of the property
+    const PropertyInputImpl*   propertyValue;
+    unsigned int               block;                       ///< The index of the block in the Program
+    GLint                      offset;                      ///< The offset of the uniform within the block
+    GLint                      matrixStride;                ///< The stride between the columns of a matrix uniform
+  };
+
+  typedef Dali::Vector< UniformBlockWriter > UniformBlockWriters;
+
   UniformIndexMappings         mUniformIndexMap;
+  UniformWriters               mUniformWriters;             ///< Rebuilt when the uniform map or the program changes
+  UniformBlockWriters          mUniformBlockWriters;        ///< Sorted by block, rebuilt with the uniform writers
+  Dali::Vector< char >         mUniformBlockData;           ///< Staging memory for packing a uniform block
+  const Program*               mUniformWritersProgram;      ///< The program the uniform writers were created for
+  UniformBuffer*               mUniformBuffer;
   Vector<GLint>                mAttributesLocation;
 
   StencilParameters            mStencilParameters;          ///< Struct containing all stencil related options
@@ -443,6 +519,7 @@ private:
   DepthTestMode::Type          mDepthTestMode:2;            ///< The depth test mode
   bool                         mUpdateAttributesLocation:1; ///< Indicates attribute locations have changed
   bool                         mPremultipledAlphaEnabled:1; ///< Flag indicating whether the Pre-multiplied Alpha Blending is required
+  bool                         mUpdateUniformWriters:1;     ///< Indicates the uniform writers have to be rebuilt
 
 };
 
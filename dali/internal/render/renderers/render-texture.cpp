@@ -797,6 +797,17 @@ void Texture::Upload( Context& context, PixelDataPtr pixelData, const Internal::
   delete[] tempBuffer;
 }
 
+void Texture::Respecify( Pixel::Format format, unsigned int width, unsigned int height )
+{
+  DALI_ASSERT_ALWAYS( mNativeImage == NULL );
+
+  PixelFormatToGl( format, mPixelDataType, mInternalFormat );
+  mWidth = width;
+  mHeight = height;
+  mHasAlpha = HasAlpha( format );
+  mIsCompressed = IsCompressedFormat( format );
+}
+
 bool Texture::Bind( Context& context, unsigned int textureUnit, Render::Sampler* sampler )
 {
   if( mNativeImage && mId == 0 )
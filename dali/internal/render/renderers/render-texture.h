@@ -88,6 +88,15 @@ public:
    */
   void Upload( Context& context, PixelDataPtr pixelData, const Internal::Texture::UploadParams& params );
 
+  /**
+   * Changes the format and size of the texture.
+   * The storage of the texture is reallocated by the next upload of the whole texture.
+   * @param[in] format The new format of the pixel data
+   * @param[in] width The new width of the texture
+   * @param[in] height The new height of the texture
+   */
+  void Respecify( Pixel::Format format, unsigned int width, unsigned int height );
+
   /**
    * Bind the texture to the given texture unit and applies the given sampler
    * @param[in] context The GL context
@@ -0,0 +1,97 @@
+/*
+ * Copyright (c) 2017 Samsung Electronics Co., Ltd.
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ * http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+// CLASS HEADER
+#include <dali/internal/render/renderers/render-uniform-buffer.h>
+
+// INTERNAL INCLUDES
+#include <dali/internal/render/gl-resources/context.h>
+
+namespace Dali
+{
+
+namespace Internal
+{
+
+namespace Render
+{
+
+namespace
+{
+
+const GLsizeiptr DEFAULT_CAPACITY = 64 * 1024; ///< Enough for the blocks of a typical frame, the minimum GL_MAX_UNIFORM_BLOCK_SIZE is 16KB
+
+} // unnamed namespace
+
+UniformBuffer::UniformBuffer()
+: mBufferId( 0 ),
+  mCapacity( 0 ),
+  mOffset( 0 )
+{
+}
+
+UniformBuffer::~UniformBuffer()
+{
+  // The GL resource is released with the context
+}
+
+void UniformBuffer::Write( Context& context, GLuint binding, const void* data, GLsizeiptr size )
+{
+  if( !mBufferId )
+  {
+    context.GenBuffers( 1, &mBufferId );
+    mCapacity = 0;
+  }
+  context.BindUniformBuffer( mBufferId );
+
+  // Each bound range must start at a multiple of the offset alignment
+  const GLintptr alignment = context.GetUniformBufferOffsetAlignment();
+  GLintptr offset = ( ( mOffset + alignment - 1 ) / alignment ) * alignment;
+
+  if( size > mCapacity )
+  {
+    while( mCapacity < size )
+    {
+      mCapacity = mCapacity ? mCapacity * 2 : DEFAULT_CAPACITY;
+    }
+    context.BufferData( GL_UNIFORM_BUFFER, mCapacity, NULL, GL_STREAM_DRAW );
+    offset = 0;
+  }
+  else if( offset + size > mCapacity )
+  {
+    // Orphan the storage, the driver keeps the old one alive until the pending draw calls are done
+    context.BufferData( GL_UNIFORM_BUFFER, mCapacity, NULL, GL_STREAM_DRAW );
+    offset = 0;
+  }
+
+  context.BufferSubData( GL_UNIFORM_BUFFER, offset, size, data );
+  context.BindUniformBufferRange( binding, mBufferId, offset, size );
+
+  mOffset = offset + size;
+}
+
+void UniformBuffer::GlContextDestroyed()
+{
+  mBufferId = 0;
+  mCapacity = 0;
+  mOffset = 0;
+}
+
+} // namespace Render
+
+} // namespace Internal
+
+} // namespace Dali
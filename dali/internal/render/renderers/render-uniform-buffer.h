@@ -0,0 +1,90 @@
+#ifndef DALI_INTERNAL_RENDER_UNIFORM_BUFFER_H
+#define DALI_INTERNAL_RENDER_UNIFORM_BUFFER_H
+
+/*
+ * Copyright (c) 2017 Samsung Electronics Co., Ltd.
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ * http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+// INTERNAL INCLUDES
+#include <dali/integration-api/gl-abstraction.h>
+
+namespace Dali
+{
+
+namespace Internal
+{
+class Context;
+
+namespace Render
+{
+
+/**
+ * A uniform buffer shared by all the renderers, which is written as a ring.
+ *
+ * Every uniform block is appended after the previous one and bound with glBindBufferRange,
+ * so blocks of draw calls which the GPU has not executed yet are never overwritten.
+ * When the end of the buffer is reached its storage is orphaned and writing starts again at the beginning.
+ */
+class UniformBuffer
+{
+public:
+
+  /**
+   * Constructor
+   */
+  UniformBuffer();
+
+  /**
+   * Destructor
+   */
+  ~UniformBuffer();
+
+  /**
+   * Writes the data of a uniform block and binds it to the given binding point
+   * @pre The context supports uniform buffers
+   * @param[in] context The GL context
+   * @param[in] binding The uniform buffer binding point of the block
+   * @param[in] data The packed data of the block
+   * @param[in] size The size of the data in bytes
+   */
+  void Write( Context& context, GLuint binding, const void* data, GLsizeiptr size );
+
+  /**
+   * Needs to be called when the GL context is destroyed
+   */
+  void GlContextDestroyed();
+
+private:
+
+  // Undefined
+  UniformBuffer( const UniformBuffer& );
+
+  // Undefined
+  UniformBuffer& operator=( const UniformBuffer& rhs );
+
+private:
+
+  GLuint     mBufferId; ///< The GL buffer, created on first write
+  GLsizeiptr mCapacity; ///< The size of the buffer storage in bytes
+  GLintptr   mOffset;   ///< The offset where the next block is written
+};
+
+} // namespace Render
+
+} // namespace Internal
+
+} // namespace Dali
+
+#endif // DALI_INTERNAL_RENDER_UNIFORM_BUFFER_H
@@ -97,6 +97,11 @@ public: // API
    */
   virtual void StoreBinary( Internal::ShaderDataPtr programData ) = 0;
 
+  /**
+   * @return true if programs should start compiling and leave the driver to finish in the background
+   */
+  virtual bool IsParallelCompileEnabled() = 0;
+
 private: // not implemented as non-copyable
 
   ProgramCache( const ProgramCache& rhs );
@@ -35,7 +35,8 @@ ProgramController::ProgramController( Integration::GlAbstraction& glAbstraction
   mGlAbstraction( glAbstraction ),
   mCurrentProgram( NULL ),
   mProgramBinaryFormat( 0 ),
-  mNumberOfProgramBinaryFormats( 0 )
+  mNumberOfProgramBinaryFormats( 0 ),
+  mParallelCompileEnabled( false )
 {
   // we have 17 default programs so make room for those and a few custom ones as well
   mProgramCache.Reserve( 32 );
@@ -150,11 +151,48 @@ void ProgramController::StoreBinary( Internal::ShaderDataPtr programData )
   }
 }
 
+bool ProgramController::IsParallelCompileEnabled()
+{
+  return mParallelCompileEnabled;
+}
+
 void ProgramController::SetShaderSaver( ShaderSaver& shaderSaver )
 {
   mShaderSaver = &shaderSaver;
 }
 
+void ProgramController::EnableParallelCompile( bool enable )
+{
+  mParallelCompileEnabled = enable;
+}
+
+void ProgramController::FinishCompilation( bool completionStatusSupported )
+{
+  const ProgramIterator end = mProgramCache.End();
+  for ( ProgramIterator iter = mProgramCache.Begin(); iter != end; ++iter )
+  {
+    Program* program = (*iter)->GetProgram();
+    if( program->IsCompiling() )
+    {
+      program->FinishCompilation( completionStatusSupported );
+    }
+  }
+}
+
+unsigned int ProgramController::GetCompilingProgramCount() const
+{
+  unsigned int count = 0u;
+  const ProgramContainer::ConstIterator end = mProgramCache.End();
+  for ( ProgramContainer::ConstIterator iter = mProgramCache.Begin(); iter != end; ++iter )
+  {
+    if( (*iter)->GetProgram()->IsCompiling() )
+    {
+      ++count;
+    }
+  }
+  return count;
+}
+
 } // namespace Internal
 
 } // namespace Dali
@@ -124,6 +124,26 @@ public: // API
    */
   void SetShaderSaver( ShaderSaver& shaderSaver );
 
+  /**
+   * Enable or disable parallel compilation. When enabled, new programs only start compiling
+   * when they are created, and cannot be used until FinishCompilation() has finished them.
+   * @param[in] enable True to compile programs in parallel
+   */
+  void EnableParallelCompile( bool enable );
+
+  /**
+   * Finish the compilation of the programs which the driver has completed.
+   * Must be called once per frame, before new programs are created.
+   * @param[in] completionStatusSupported True if the driver reports completion without blocking,
+   * otherwise the programs started in a previous frame are finished regardless
+   */
+  void FinishCompilation( bool completionStatusSupported );
+
+  /**
+   * @return The number of programs which have started compiling and are not finished yet
+   */
+  unsigned int GetCompilingProgramCount() const;
+
 private: // From ProgramCache
 
   /**
@@ -166,6 +186,11 @@ private: // From ProgramCache
    */
   virtual void StoreBinary( Internal::ShaderDataPtr programData );
 
+  /**
+   * @copydoc ProgramCache::IsParallelCompileEnabled
+   */
+  virtual bool IsParallelCompileEnabled();
+
 private: // not implemented as non-copyable
 
   ProgramController( const ProgramController& rhs );
@@ -183,6 +208,7 @@ private: // Data
 
   GLint mProgramBinaryFormat;
   GLint mNumberOfProgramBinaryFormats;
+  bool mParallelCompileEnabled;
 
 };
 
@@ -79,8 +79,11 @@ namespace
 
 const char* gStdAttribs[ Program::ATTRIB_TYPE_LAST ] =
 {
-  "aPosition",    // ATTRIB_POSITION
-  "aTexCoord",    // ATTRIB_TEXCOORD
+  "aPosition",            // ATTRIB_POSITION
+  "aTexCoord",            // ATTRIB_TEXCOORD
+  "aInstanceModelView",   // ATTRIB_INSTANCE_MODEL_VIEW
+  "aInstanceColor",       // ATTRIB_INSTANCE_COLOR
+  "aInstanceSize",        // ATTRIB_INSTANCE_SIZE
 };
 
 const char* gStdUniforms[ Program::UNIFORM_TYPE_LAST ] =
@@ -333,6 +336,76 @@ size_t Program::GetActiveSamplerCount() const
   return mSamplerUniformLocations.size();
 }
 
+const Program::UniformBlocks& Program::GetUniformBlocks()
+{
+  if( mUniformBlocksQueried || !mLinked )
+  {
+    return mUniformBlocks;
+  }
+  mUniformBlocksQueried = true;
+
+  GLint blockCount = 0;
+  GLint uniformMaxNameLength = 0;
+  CHECK_GL( mGlAbstraction, mGlAbstraction.GetProgramiv( mProgramId, GL_ACTIVE_UNIFORM_BLOCKS, &blockCount ) );
+  CHECK_GL( mGlAbstraction, mGlAbstraction.GetProgramiv( mProgramId, GL_ACTIVE_UNIFORM_MAX_LENGTH, &uniformMaxNameLength ) );
+
+  std::vector< char > name( uniformMaxNameLength + 1, '\0' ); // Allow for null terminator
+  std::vector< char > blockName( uniformMaxNameLength + 1, '\0' );
+
+  mUniformBlocks.resize( blockCount );
+  for( GLint blockIndex = 0; blockIndex < blockCount; ++blockIndex )
+  {
+    UniformBlock& block = mUniformBlocks[ blockIndex ];
+    block.binding = blockIndex;
+    block.size = 0;
+    CHECK_GL( mGlAbstraction, mGlAbstraction.UniformBlockBinding( mProgramId, blockIndex, block.binding ) );
+    CHECK_GL( mGlAbstraction, mGlAbstraction.GetActiveUniformBlockiv( mProgramId, blockIndex, GL_UNIFORM_BLOCK_DATA_SIZE, &block.size ) );
+
+    // Uniforms of a block with an instance name are reported as "BlockName.uniform"
+    GLsizei blockNameLength = 0;
+    CHECK_GL( mGlAbstraction, mGlAbstraction.GetActiveUniformBlockName( mProgramId, blockIndex, uniformMaxNameLength, &blockNameLength, &blockName[0] ) );
+    blockName[ blockNameLength ] = '\0';
+    const std::string prefix = std::string( &blockName[0] ) + ".";
+
+    GLint memberCount = 0;
+    CHECK_GL( mGlAbstraction, mGlAbstraction.GetActiveUniformBlockiv( mProgramId, blockIndex, GL_UNIFORM_BLOCK_ACTIVE_UNIFORMS, &memberCount ) );
+    if( memberCount <= 0 )
+    {
+      continue;
+    }
+
+    std::vector< GLint > indices( memberCount, 0 );
+    std::vector< GLint > offsets( memberCount, 0 );
+    std::vector< GLint > matrixStrides( memberCount, 0 );
+    CHECK_GL( mGlAbstraction, mGlAbstraction.GetActiveUniformBlockiv( mProgramId, blockIndex, GL_UNIFORM_BLOCK_ACTIVE_UNIFORM_INDICES, &indices[0] ) );
+    const std::vector< GLuint > uniformIndices( indices.begin(), indices.end() );
+    CHECK_GL( mGlAbstraction, mGlAbstraction.GetActiveUniformsiv( mProgramId, memberCount, &uniformIndices[0], GL_UNIFORM_OFFSET, &offsets[0] ) );
+    CHECK_GL( mGlAbstraction, mGlAbstraction.GetActiveUniformsiv( mProgramId, memberCount, &uniformIndices[0], GL_UNIFORM_MATRIX_STRIDE, &matrixStrides[0] ) );
+
+    block.members.resize( memberCount );
+    for( GLint i = 0; i < memberCount; ++i )
+    {
+      GLsizei nameLength = 0;
+      GLint arraySize = 0;
+      GLenum type = GL_ZERO;
+      CHECK_GL( mGlAbstraction, mGlAbstraction.GetActiveUniform( mProgramId, uniformIndices[i], uniformMaxNameLength, &nameLength, &arraySize, &type, &name[0] ) );
+      name[ nameLength ] = '\0';
+
+      std::string uniformName( &name[0] );
+      if( uniformName.compare( 0, prefix.size(), prefix ) == 0 )
+      {
+        uniformName.erase( 0, prefix.size() );
+      }
+
+      block.members[i].uniformIndex = RegisterUniform( uniformName );
+      block.members[i].offset = offsets[i];
+      block.members[i].matrixStride = matrixStrides[i];
+    }
+  }
+
+  return mUniformBlocks;
+}
+
 void Program::SetUniform1i( GLint location, GLint value0 )
 {
   DALI_ASSERT_DEBUG( IsUsed() ); // should not call this if this program is not used
@@ -569,6 +642,7 @@ void Program::GlContextCreated()
 void Program::GlContextDestroyed()
 {
   mLinked = false;
+  mCompiling = false;
   mVertexShaderId = 0;
   mFragmentShaderId = 0;
   mProgramId = 0;
@@ -591,7 +665,9 @@ Program::Program( ProgramCache& cache, Internal::ShaderDataPtr shaderData, bool
   mFragmentShaderId( 0 ),
   mProgramId( 0 ),
   mProgramData(shaderData),
-  mModifiesGeometry( modifiesGeometry )
+  mUniformBlocksQueried( false ),
+  mModifiesGeometry( modifiesGeometry ),
+  mCompiling( false )
 {
   // reserve space for standard attributes
   mAttributeLocations.reserve( ATTRIB_TYPE_LAST );
@@ -669,31 +745,27 @@ void Program::Load()
   // Fall back to compiling and linking the vertex and fragment sources
   if( GL_FALSE == linked )
   {
+    if( mCache.IsParallelCompileEnabled() )
+    {
+      // Only issue the compile and link; querying their status would block until the driver has finished them
+      DALI_LOG_INFO(Debug::Filter::gShader, Debug::General, "Program::Load() - Parallel compilation\n");
+      StartCompileShader( GL_VERTEX_SHADER, mVertexShaderId, mProgramData->GetVertexShader() );
+      StartCompileShader( GL_FRAGMENT_SHADER, mFragmentShaderId, mProgramData->GetFragmentShader() );
+
+      LOG_GL( "LinkProgram(%d)\n", mProgramId );
+      CHECK_GL( mGlAbstraction, mGlAbstraction.LinkProgram( mProgramId ) );
+
+      mCompiling = true;
+      return;
+    }
+
     DALI_LOG_INFO(Debug::Filter::gShader, Debug::General, "Program::Load() - Runtime compilation\n");
     if( CompileShader( GL_VERTEX_SHADER, mVertexShaderId, mProgramData->GetVertexShader() ) )
     {
       if( CompileShader( GL_FRAGMENT_SHADER, mFragmentShaderId, mProgramData->GetFragmentShader() ) )
       {
         Link();
-
-        if( binariesSupported && mLinked )
-        {
-          GLint  binaryLength = 0;
-          GLenum binaryFormat;
-          DALI_LOG_INFO( Debug::Filter::gShader, Debug::General, "Compiled and linked.\n\nVS:\n%s\nFS:\n%s\n", mProgramData->GetVertexShader(), mProgramData->GetFragmentShader() );
-
-          CHECK_GL( mGlAbstraction, mGlAbstraction.GetProgramiv(mProgramId, GL_PROGRAM_BINARY_LENGTH_OES, &binaryLength) );
-          DALI_LOG_INFO(Debug::Filter::gShader, Debug::General, "Program::Load() - GL_PROGRAM_BINARY_LENGTH_OES: %d\n", binaryLength);
-          if( binaryLength > 0 )
-          {
-            // Allocate space for the bytecode in ShaderData
-            mProgramData->AllocateBuffer(binaryLength);
-            // Copy the bytecode to ShaderData
-            CHECK_GL( mGlAbstraction, mGlAbstraction.GetProgramBinary(mProgramId, binaryLength, NULL, &binaryFormat, mProgramData->GetBufferData()) );
-            mCache.StoreBinary( mProgramData );
-            DALI_LOG_INFO( Debug::Filter::gShader, Debug::General, "Saved binary.\n" );
-          }
-        }
+        StoreBinary();
       }
     }
   }
@@ -704,6 +776,37 @@ void Program::Load()
   FreeShaders();
 }
 
+bool Program::FinishCompilation( bool completionStatusSupported )
+{
+  DALI_ASSERT_DEBUG( mCompiling && "Program is not compiling" );
+
+  if( completionStatusSupported )
+  {
+    GLint completed = GL_FALSE;
+    CHECK_GL( mGlAbstraction, mGlAbstraction.GetProgramiv( mProgramId, GL_COMPLETION_STATUS_KHR, &completed ) );
+    if( GL_FALSE == completed )
+    {
+      return false;
+    }
+  }
+
+  mCompiling = false;
+
+  if( CheckCompileStatus( mVertexShaderId, mProgramData->GetVertexShader() ) &&
+      CheckCompileStatus( mFragmentShaderId, mProgramData->GetFragmentShader() ) )
+  {
+    CheckLinkStatus();
+    StoreBinary();
+  }
+
+  GetActiveSamplerUniforms();
+
+  // No longer needed
+  FreeShaders();
+
+  return true;
+}
+
 void Program::Unload()
 {
   FreeShaders();
@@ -723,10 +826,17 @@ void Program::Unload()
   }
 
   mLinked = false;
+  mCompiling = false;
 
 }
 
 bool Program::CompileShader( GLenum shaderType, GLuint& shaderId, const char* src )
+{
+  StartCompileShader( shaderType, shaderId, src );
+  return CheckCompileStatus( shaderId, src );
+}
+
+void Program::StartCompileShader( GLenum shaderType, GLuint& shaderId, const char* src )
 {
   if (!shaderId)
   {
@@ -741,7 +851,10 @@ bool Program::CompileShader( GLenum shaderType, GLuint& shaderId, const char* sr
 
   LOG_GL( "CompileShader(%d)\n", shaderId );
   CHECK_GL( mGlAbstraction, mGlAbstraction.CompileShader( shaderId ) );
+}
 
+bool Program::CheckCompileStatus( GLuint shaderId, const char* src )
+{
   GLint compiled;
   LOG_GL( "GetShaderiv(%d)\n", shaderId );
   CHECK_GL( mGlAbstraction, mGlAbstraction.GetShaderiv( shaderId, GL_COMPILE_STATUS, &compiled ) );
@@ -772,6 +885,11 @@ void Program::Link()
   LOG_GL( "LinkProgram(%d)\n", mProgramId );
   CHECK_GL( mGlAbstraction, mGlAbstraction.LinkProgram( mProgramId ) );
 
+  CheckLinkStatus();
+}
+
+void Program::CheckLinkStatus()
+{
   GLint linked;
   LOG_GL( "GetProgramiv(%d)\n", mProgramId );
   CHECK_GL( mGlAbstraction, mGlAbstraction.GetProgramiv( mProgramId, GL_LINK_STATUS, &linked ) );
@@ -796,6 +914,28 @@ void Program::Link()
   mLinked = linked != GL_FALSE;
 }
 
+void Program::StoreBinary()
+{
+  if( mCache.IsBinarySupported() && mLinked )
+  {
+    GLint  binaryLength = 0;
+    GLenum binaryFormat;
+    DALI_LOG_INFO( Debug::Filter::gShader, Debug::General, "Compiled and linked.\n\nVS:\n%s\nFS:\n%s\n", mProgramData->GetVertexShader(), mProgramData->GetFragmentShader() );
+
+    CHECK_GL( mGlAbstraction, mGlAbstraction.GetProgramiv(mProgramId, GL_PROGRAM_BINARY_LENGTH_OES, &binaryLength) );
+    DALI_LOG_INFO(Debug::Filter::gShader, Debug::General, "Program::Load() - GL_PROGRAM_BINARY_LENGTH_OES: %d\n", binaryLength);
+    if( binaryLength > 0 )
+    {
+      // Allocate space for the bytecode in ShaderData
+      mProgramData->AllocateBuffer(binaryLength);
+      // Copy the bytecode to ShaderData
+      CHECK_GL( mGlAbstraction, mGlAbstraction.GetProgramBinary(mProgramId, binaryLength, NULL, &binaryFormat, mProgramData->GetBufferData()) );
+      mCache.StoreBinary( mProgramData );
+      DALI_LOG_INFO( Debug::Filter::gShader, Debug::General, "Saved binary.\n" );
+    }
+  }
+}
+
 void Program::FreeShaders()
 {
   if (mVertexShaderId)
@@ -832,6 +972,9 @@ void Program::ResetAttribsUniformCache()
 
   mSamplerUniformLocations.clear();
 
+  mUniformBlocks.clear();
+  mUniformBlocksQueried = false;
+
   // reset uniform caches
   mSizeUniformCache.x = mSizeUniformCache.y = mSizeUniformCache.z = 0.f;
 
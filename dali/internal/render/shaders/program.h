@@ -75,6 +75,9 @@ public:
     ATTRIB_UNKNOWN = -1,
     ATTRIB_POSITION,
     ATTRIB_TEXCOORD,
+    ATTRIB_INSTANCE_MODEL_VIEW,
+    ATTRIB_INSTANCE_COLOR,
+    ATTRIB_INSTANCE_SIZE,
     ATTRIB_TYPE_LAST
   };
 
@@ -100,6 +103,28 @@ public:
     UNIFORM_TYPE_LAST
   };
 
+  /**
+   * Layout of a uniform in a uniform block, as reported by GL
+   */
+  struct UniformBlockMember
+  {
+    unsigned int uniformIndex; ///< The index of the uniform name in the local cache, see RegisterUniform()
+    GLint offset;              ///< Byte offset of the uniform in the block
+    GLint matrixStride;        ///< Byte stride between the columns of a matrix uniform
+  };
+
+  /**
+   * A uniform block of the program, bound to the uniform buffer binding point of the same index
+   */
+  struct UniformBlock
+  {
+    std::vector< UniformBlockMember > members; ///< The active uniforms of the block
+    GLint size;                                ///< Size of the block data in bytes
+    GLuint binding;                            ///< The uniform buffer binding point
+  };
+
+  typedef std::vector< UniformBlock > UniformBlocks;
+
   /**
    * Creates a new program, or returns a copy of an existing program in the program cache
    * @param[in] cache where the programs are stored
@@ -121,6 +146,24 @@ public:
    */
   bool IsUsed();
 
+  /**
+   * Query whether the program has started compiling in parallel and is not finished yet.
+   * Such a program cannot be used, see ProgramCache::IsParallelCompileEnabled().
+   * @return true if the program is still compiling
+   */
+  bool IsCompiling() const
+  {
+    return mCompiling;
+  }
+
+  /**
+   * Finish the compilation and link started when the program was loaded.
+   * @param[in] completionStatusSupported True if GL_COMPLETION_STATUS_KHR can be queried,
+   * in which case the program is only finished once the driver has completed it
+   * @return true if the program was finished
+   */
+  bool FinishCompilation( bool completionStatusSupported );
+
   /**
    * @param [in] type of the attribute
    * @return the index of the attribute
@@ -175,6 +218,14 @@ public:
    */
   size_t GetActiveSamplerCount() const;
 
+  /**
+   * Gets the uniform blocks of the program, introspecting them on first use.
+   * Uniforms in a block have no location, so their values must be provided through a uniform buffer.
+   * @pre The context supports uniform buffers
+   * @return The uniform blocks, empty if the program does not declare any
+   */
+  const UniformBlocks& GetUniformBlocks();
+
   /**
    * Sets the uniform value
    * @param [in] location of uniform
@@ -347,11 +398,37 @@ private:
    */
   bool CompileShader(GLenum shaderType, GLuint& shaderId, const char* src);
 
+  /**
+   * Start compiling the shader, without waiting for the result
+   * @param shaderType vertex or fragment shader
+   * @param shaderId of the shader, returned
+   * @param src of the shader
+   */
+  void StartCompileShader(GLenum shaderType, GLuint& shaderId, const char* src);
+
+  /**
+   * Check the result of compiling the shader, logging any errors
+   * @param shaderId of the shader
+   * @param src of the shader
+   * @return true if the compilation succeeded
+   */
+  bool CheckCompileStatus(GLuint shaderId, const char* src);
+
   /**
    * Links the shaders together to create program
    */
   void Link();
 
+  /**
+   * Check the result of linking the program, logging any errors
+   */
+  void CheckLinkStatus();
+
+  /**
+   * Retrieve the binary of the linked program and store it in the cache, when binaries are supported
+   */
+  void StoreBinary();
+
   /**
    * Frees the shader programs
    */
@@ -381,6 +458,8 @@ private:  // Data
   Locations mAttributeLocations;      ///< attribute location cache
   Locations mUniformLocations;        ///< uniform location cache
   std::vector<GLint> mSamplerUniformLocations; ///< sampler uniform location cache
+  UniformBlocks mUniformBlocks;       ///< uniform block layout cache
+  bool mUniformBlocksQueried;         ///< whether the uniform blocks have been introspected
 
   // uniform value caching
   GLint mUniformCacheInt[ MAX_UNIFORM_CACHE_SIZE ];         ///< Value cache for uniforms of single int
@@ -389,6 +468,7 @@ private:  // Data
   GLfloat mUniformCacheFloat4[ MAX_UNIFORM_CACHE_SIZE ][4]; ///< Value cache for uniforms of four floats
   Vector3 mSizeUniformCache;                                ///< Cache value for size uniform
   bool mModifiesGeometry;  ///< True if the program changes geometry
+  bool mCompiling;         ///< True if the program is compiling in parallel, and cannot be used yet
 
 };
 
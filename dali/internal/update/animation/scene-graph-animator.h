@@ -476,6 +476,8 @@ public:
       mPropertyAccessor.Set( bufferIndex, result );
     }
 
+    mPropertyOwner->OnPropertiesModified();
+
     mCurrentProgress = progress;
   }
 
@@ -140,6 +140,8 @@ void PropertyOwner::ApplyConstraint( ConstraintBase* constraint )
   mConstraints.PushBack( constraint );
 
   constraint->OnConnect();
+
+  OnPropertiesModified();
 }
 
 void PropertyOwner::RemoveConstraint( ConstraintBase* constraint )
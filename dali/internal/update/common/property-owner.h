@@ -181,6 +181,12 @@ public:
    */
   ConstraintOwnerContainer& GetConstraints();
 
+  /**
+   * Called when the properties of the owner are modified by an animator, or a constraint is applied.
+   * Derived classes which are skipped whilst clean should override this to flag that they need updating.
+   */
+  virtual void OnPropertiesModified() {}
+
   /**
    * @copydoc UniformMap::Add
    */
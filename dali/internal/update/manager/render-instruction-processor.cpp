@@ -18,6 +18,10 @@
 // CLASS HEADER
 #include <dali/internal/update/manager/render-instruction-processor.h>
 
+// EXTERNAL INCLUDES
+#include <algorithm>
+#include <cstring>
+
 // INTERNAL INCLUDES
 #include <dali/public-api/actors/layer.h>
 #include <dali/integration-api/debug.h>
@@ -25,6 +29,7 @@
 #include <dali/internal/update/manager/sorted-layers.h>
 #include <dali/internal/update/render-tasks/scene-graph-render-task.h>
 #include <dali/internal/update/rendering/scene-graph-texture-set.h>
+#include <dali/internal/render/common/performance-monitor.h>
 #include <dali/internal/render/common/render-item.h>
 #include <dali/internal/render/common/render-tracker.h>
 #include <dali/internal/render/common/render-instruction.h>
@@ -53,6 +58,115 @@ namespace SceneGraph
 namespace
 {
 
+/**
+ * The number of render items from which 2D layers are sorted by key, rather than with a comparitor
+ */
+const size_t KEY_SORT_THRESHOLD = 128u;
+
+/**
+ * The last culling pass before the count starts again; the pass is stored shifted up by one bit, next to the result of the check
+ */
+const unsigned int MAXIMUM_CULLING_PASS = 0x7fffffffu;
+
+/**
+ * Retrieve the number of bits needed to store the values up to a given value
+ * @param[in] value The largest value
+ * @return The number of bits
+ */
+inline unsigned int GetBitCount( uint64_t value )
+{
+  unsigned int bits = 0u;
+  while( value != 0u )
+  {
+    ++bits;
+    value >>= 1u;
+  }
+  return bits;
+}
+
+/**
+ * Replace pointers by their rank amongst the distinct pointers, which keeps their order
+ * @param[in,out] values The pointers, which are replaced by their ranks
+ * @param[in] distinct Used to store the distinct pointers
+ * @return The largest rank
+ */
+uintptr_t RankPointers( Dali::Vector< uintptr_t >& values, Dali::Vector< uintptr_t >& distinct )
+{
+  distinct.Resize( values.Count() );
+  std::copy( values.Begin(), values.End(), distinct.Begin() );
+  std::sort( distinct.Begin(), distinct.End() );
+  distinct.Resize( std::unique( distinct.Begin(), distinct.End() ) - distinct.Begin() );
+
+  // Neighbouring items usually share their pointers, so the previous rank is reused
+  uintptr_t previousValue = distinct[0];
+  uintptr_t previousRank = 0u;
+  for( Dali::Vector< uintptr_t >::Iterator iter = values.Begin(), endIter = values.End(); iter != endIter; ++iter )
+  {
+    if( *iter != previousValue )
+    {
+      previousValue = *iter;
+      previousRank = std::lower_bound( distinct.Begin(), distinct.End(), previousValue ) - distinct.Begin();
+    }
+    *iter = previousRank;
+  }
+
+  return distinct.Count() - 1u;
+}
+
+/**
+ * Sort keys with a stable, least significant digit first, radix sort; one byte at a time.
+ * @param[in] keys The keys to sort
+ * @param[in] buffer Holds the keys between the passes; it has as many keys as keys
+ * @return The sorted keys, which are either in keys or in buffer
+ */
+SortKey* RadixSort( Dali::Vector< SortKey >& keys, Dali::Vector< SortKey >& buffer )
+{
+  const unsigned int count = keys.Count();
+
+  // The digits which are the same in all of the keys do not need a pass
+  uint64_t allBits = ~static_cast< uint64_t >( 0u );
+  uint64_t anyBits = 0u;
+  for( unsigned int i = 0u; i < count; ++i )
+  {
+    allBits &= keys[i].key;
+    anyBits |= keys[i].key;
+  }
+  const uint64_t varyingBits = allBits ^ anyBits;
+
+  SortKey* source = keys.Begin();
+  SortKey* destination = buffer.Begin();
+  for( unsigned int shift = 0u; shift < 64u && ( varyingBits >> shift ) != 0u; shift += 8u )
+  {
+    if( ( ( varyingBits >> shift ) & 0xffu ) == 0u )
+    {
+      continue;
+    }
+
+    unsigned int offsets[ 256 ] = { 0u };
+    for( unsigned int i = 0u; i < count; ++i )
+    {
+      ++offsets[ ( source[i].key >> shift ) & 0xffu ];
+    }
+
+    unsigned int total = 0u;
+    for( unsigned int digit = 0u; digit < 256u; ++digit )
+    {
+      const unsigned int digitCount = offsets[ digit ];
+      offsets[ digit ] = total;
+      total += digitCount;
+    }
+
+    for( unsigned int i = 0u; i < count; ++i )
+    {
+      destination[ offsets[ ( source[i].key >> shift ) & 0xffu ]++ ] = source[i];
+    }
+
+    std::swap( source, destination );
+  }
+
+  return source;
+}
+
 /**
  * Function which compares render items by shader/textureSet/geometry
  * @param[in] lhs Left hand side item
@@ -165,146 +279,135 @@ bool CompareItems3DWithClipping( const RenderInstructionProcessor::SortAttribute
  * @param renderList to add the item to
  * @param renderable Node-Renderer pair
  * @param viewMatrix used to calculate modelview matrix for the item
- * @param camera The camera used to render
  * @param isLayer3d Whether we are processing a 3D layer or not
- * @param cull Whether frustum culling is enabled or not
+ * @return True if an item was added to the list
  */
-inline void AddRendererToRenderList( BufferIndex updateBufferIndex,
+inline bool AddRendererToRenderList( BufferIndex updateBufferIndex,
                                      RenderList& renderList,
                                      Renderable& renderable,
                                      const Matrix& viewMatrix,
-                                     SceneGraph::Camera& camera,
-                                     bool isLayer3d,
-                                     bool cull )
+                                     bool isLayer3d )
 {
-  bool inside( true );
   const Node* node = renderable.mNode;
 
-  if( cull && !renderable.mRenderer->GetShader().HintEnabled( Dali::Shader::Hint::MODIFIES_GEOMETRY ) )
+  Renderer::Opacity opacity = renderable.mRenderer->GetOpacity( updateBufferIndex, *renderable.mNode );
+  if( opacity != Renderer::TRANSPARENT )
   {
-    const Vector4& boundingSphere = node->GetBoundingSphere();
-    inside = ( boundingSphere.w > Math::MACHINE_EPSILON_1000 ) &&
-             ( camera.CheckSphereInFrustum( updateBufferIndex, Vector3( boundingSphere ), boundingSphere.w ) );
-  }
-
-  if( inside )
-  {
-    Renderer::Opacity opacity = renderable.mRenderer->GetOpacity( updateBufferIndex, *renderable.mNode );
-    if( opacity != Renderer::TRANSPARENT )
+    // Get the next free RenderItem.
+    RenderItem& item = renderList.GetNextFreeItem();
+    item.mRenderer = &renderable.mRenderer->GetRenderer();
+    item.mNode = renderable.mNode;
+    item.mTextureSet = renderable.mRenderer->GetTextures();
+    item.mIsOpaque = ( opacity == Renderer::OPAQUE );
+    item.mDepthIndex = renderable.mRenderer->GetDepthIndex();
+
+    if( !isLayer3d )
     {
-      // Get the next free RenderItem.
-      RenderItem& item = renderList.GetNextFreeItem();
-      item.mRenderer = &renderable.mRenderer->GetRenderer();
-      item.mNode = renderable.mNode;
-      item.mTextureSet = renderable.mRenderer->GetTextures();
-      item.mIsOpaque = ( opacity == Renderer::OPAQUE );
-      item.mDepthIndex = renderable.mRenderer->GetDepthIndex();
-
-      if( !isLayer3d )
-      {
-        item.mDepthIndex += renderable.mNode->GetDepthIndex();
-      }
+      item.mDepthIndex += renderable.mNode->GetDepthIndex();
+    }
 
-      // Save ModelView matrix onto the item.
-      node->GetWorldMatrixAndSize( item.mModelMatrix, item.mSize );
+    // Save ModelView matrix onto the item.
+    node->GetWorldMatrixAndSize( item.mModelMatrix, item.mSize );
 
-      Matrix::Multiply( item.mModelViewMatrix, item.mModelMatrix, viewMatrix );
-    }
+    Matrix::Multiply( item.mModelViewMatrix, item.mModelMatrix, viewMatrix );
+    return true;
   }
+  return false;
 }
 
 /**
- * Add all renderers to the list
- * @param updateBufferIndex to read the model matrix from
- * @param renderList to add the items to
- * @param renderers to render
- * NodeRendererContainer Node-Renderer pairs
- * @param viewMatrix used to calculate modelview matrix for the items
- * @param camera The camera used to render
- * @param isLayer3d Whether we are processing a 3D layer or not
- * @param cull Whether frustum culling is enabled or not
+ * Get the next free render list of an instruction, and set it up for the renderables of a layer
+ * @param renderables list of renderables
+ * @param layer that is being processed
+ * @param instruction to get the render list from
+ * @param renderList is set to the render list
+ * @return True if the items cached by the render list were calculated for the same layer
  */
-inline void AddRenderersToRenderList( BufferIndex updateBufferIndex,
-                                      RenderList& renderList,
-                                      RenderableContainer& renderers,
-                                      const Matrix& viewMatrix,
-                                      SceneGraph::Camera& camera,
-                                      bool isLayer3d,
-                                      bool cull )
+inline bool SetupRenderList( RenderableContainer& renderables,
+                             Layer& layer,
+                             RenderInstruction& instruction,
+                             RenderList** renderList )
 {
-  DALI_LOG_INFO( gRenderListLogFilter, Debug::Verbose, "AddRenderersToRenderList()\n");
+  *renderList = &( instruction.GetNextFreeRenderList( renderables.Size() ) );
+  const bool cachedItemsFromLayer = ( ( *renderList )->GetSourceLayer() == &layer );
+  ( *renderList )->SetClipping( layer.IsClipping(), layer.GetClippingBox() );
+  ( *renderList )->SetSourceLayer( &layer );
 
-  unsigned int rendererCount( renderers.Size() );
-  for( unsigned int i(0); i < rendererCount; ++i )
+  return cachedItemsFromLayer;
+}
+
+/**
+ * Orders cached items by node, then by renderer
+ */
+bool CompareCachedItems( const CachedRenderItem& lhs, const CachedRenderItem& rhs )
+{
+  if( lhs.node == rhs.node )
   {
-    AddRendererToRenderList( updateBufferIndex,
-                             renderList,
-                             renderers[i],
-                             viewMatrix,
-                             camera,
-                             isLayer3d,
-                             cull );
+    return lhs.renderer < rhs.renderer;
   }
+  return lhs.node < rhs.node;
 }
 
 /**
- * Try to reuse cached RenderItems from the RenderList
- * This avoids recalculating the model view matrices in case this part of the scene was static
- * An example case is a toolbar layer that rarely changes or a popup on top of the rest of the stage
- * @param layer that is being processed
- * @param renderList that is cached from frame N-1
- * @param renderables list of renderables
+ * Checks whether a cached item was calculated with the current world matrix and size of its node.
+ * The values are compared bitwise, so any change, however small, causes the item to be recalculated.
+ * @param item The cached item
+ * @return True if the item can be reused
  */
-inline bool TryReuseCachedRenderers( Layer& layer,
-                                     RenderList& renderList,
-                                     RenderableContainer& renderables )
+inline bool IsItemClean( const RenderItem& item )
 {
-  bool retValue = false;
-  size_t renderableCount = renderables.Size();
-  // Check that the cached list originates from this layer and that the counts match
-  if( ( renderList.GetSourceLayer() == &layer )&&
-      ( renderList.GetCachedItemCount() == renderableCount ) )
-  {
-    // Check that all the same renderers are there. This gives us additional security in avoiding rendering the wrong things.
-    // Render list is sorted so at this stage renderers may be in different order.
-    // Therefore we check a combined sum of all renderer addresses.
-    size_t checkSumNew = 0;
-    size_t checkSumOld = 0;
-    for( size_t index = 0; index < renderableCount; ++index )
+  Matrix worldMatrix( false );
+  Vector3 size;
+  item.mNode->GetWorldMatrixAndSize( worldMatrix, size );
+
+  return ( memcmp( worldMatrix.AsFloat(), item.mModelMatrix.AsFloat(), sizeof( float ) * 16u ) == 0 ) &&
+         ( memcmp( size.AsFloat(), item.mSize.AsFloat(), sizeof( float ) * 3u ) == 0 );
+}
+
+/**
+ * Orders sort attributes by the index of their renderable
+ */
+bool CompareRenderableIndex( const RenderInstructionProcessor::SortAttributes& lhs, const RenderInstructionProcessor::SortAttributes& rhs )
+{
+  return lhs.renderableIndex < rhs.renderableIndex;
+}
+
+/**
+ * Extends a sort comparitor so that the items which compare equal are ordered by their renderable.
+ * This is the order given by a stable sort of the items added in the order of the renderables,
+ * so items merged into a sorted list end up where a full sort would put them.
+ */
+struct CompareItemsWithIndex
+{
+  typedef bool ( *ComparitorPointer )( const RenderInstructionProcessor::SortAttributes& lhs, const RenderInstructionProcessor::SortAttributes& rhs );
+
+  CompareItemsWithIndex( ComparitorPointer comparitor )
+  : mComparitor( comparitor )
+  {
+  }
+
+  bool operator()( const RenderInstructionProcessor::SortAttributes& lhs, const RenderInstructionProcessor::SortAttributes& rhs ) const
+  {
+    if( mComparitor( lhs, rhs ) )
     {
-      const Render::Renderer& renderer = renderables[index].mRenderer->GetRenderer();
-      checkSumNew += size_t( &renderer );
-      checkSumOld += size_t( &renderList.GetRenderer( index ) );
+      return true;
     }
-    if( checkSumNew == checkSumOld )
+    if( mComparitor( rhs, lhs ) )
     {
-      // tell list to reuse its existing items
-      renderList.ReuseCachedItems();
-      retValue = true;
+      return false;
     }
+    return lhs.renderableIndex < rhs.renderableIndex;
   }
-  return retValue;
-}
 
-inline bool SetupRenderList( RenderableContainer& renderables,
-                             Layer& layer,
-                             RenderInstruction& instruction,
-                             bool tryReuseRenderList,
-                             RenderList** renderList )
-{
-  *renderList = &( instruction.GetNextFreeRenderList( renderables.Size() ) );
-  ( *renderList )->SetClipping( layer.IsClipping(), layer.GetClippingBox() );
-  ( *renderList )->SetSourceLayer( &layer );
-
-  // Try to reuse cached RenderItems from last time around.
-  return ( tryReuseRenderList && TryReuseCachedRenderers( layer, **renderList, renderables ) );
-}
+  ComparitorPointer mComparitor;
+};
 
 } // Anonymous namespace.
 
 
 RenderInstructionProcessor::RenderInstructionProcessor()
-: mSortingHelper()
+: mSortingHelper(),
+  mCullingPass( 0u )
 {
   // Set up a container of comparators for fast run-time selection.
   mSortComparitors.Reserve( 4u );
@@ -319,7 +422,229 @@ RenderInstructionProcessor::~RenderInstructionProcessor()
 {
 }
 
-inline void RenderInstructionProcessor::SortRenderItems( BufferIndex bufferIndex, RenderList& renderList, Layer& layer, bool respectClippingOrder )
+inline unsigned int RenderInstructionProcessor::AddRenderItems( BufferIndex updateBufferIndex,
+                                                                RenderList& renderList,
+                                                                RenderableContainer& renderables,
+                                                                const Matrix& viewMatrix,
+                                                                Camera& camera,
+                                                                bool isLayer3d,
+                                                                bool cull,
+                                                                bool hierarchicalCulling,
+                                                                bool reuseCachedItems )
+{
+  DALI_LOG_INFO( gRenderListLogFilter, Debug::Verbose, "AddRenderItems()\n");
+
+  const unsigned int reusedCount = reuseCachedItems ? ReuseCachedItems( updateBufferIndex, renderList, renderables, isLayer3d ) : 0u;
+  if( reusedCount == 0u )
+  {
+    // Every renderable needs a new item
+    const unsigned int renderableCount = renderables.Size();
+    mNewRenderables.Resize( renderableCount );
+    for( unsigned int index = 0u; index < renderableCount; ++index )
+    {
+      mNewRenderables[ index ] = index;
+    }
+  }
+
+  if( cull )
+  {
+    CullRenderables( updateBufferIndex, renderables, camera, hierarchicalCulling );
+  }
+
+  // Only the renderables without a reusable item are calculated; they are added after the reused items
+  const unsigned int newCount = mNewRenderables.Count();
+  for( unsigned int newIndex = 0u; newIndex < newCount; ++newIndex )
+  {
+    const unsigned int index = mNewRenderables[ newIndex ];
+    if( ( !cull || mInsideFrustum[ newIndex ] ) &&
+        AddRendererToRenderList( updateBufferIndex,
+                                 renderList,
+                                 renderables[ index ],
+                                 viewMatrix,
+                                 isLayer3d ) &&
+        reusedCount > 0u )
+    {
+      mRenderableIndices.PushBack( index );
+    }
+  }
+
+  return reusedCount;
+}
+
+void RenderInstructionProcessor::CullRenderables( BufferIndex updateBufferIndex, RenderableContainer& renderables, Camera& camera, bool hierarchicalCulling )
+{
+  const unsigned int newCount = mNewRenderables.Count();
+  mInsideFrustum.Resize( newCount );
+  mCullSpheres.Clear();
+  mCullIndices.Clear();
+
+  // Gather the bounding spheres to check, so that they are checked against the frustum in batches
+  for( unsigned int newIndex = 0u; newIndex < newCount; ++newIndex )
+  {
+    const Renderable& renderable = renderables[ mNewRenderables[ newIndex ] ];
+    bool inside = true;
+    if( !renderable.mRenderer->GetShader().HintEnabled( Dali::Shader::Hint::MODIFIES_GEOMETRY ) )
+    {
+      Node* node = renderable.mNode;
+      const Vector4& boundingSphere = node->GetBoundingSphere();
+      if( boundingSphere.w > Math::MACHINE_EPSILON_1000 &&
+          !( hierarchicalCulling && node->GetParent() && IsSubtreeCulled( updateBufferIndex, *node->GetParent(), camera ) ) )
+      {
+        mCullSpheres.PushBack( boundingSphere );
+        mCullIndices.PushBack( newIndex );
+      }
+      else
+      {
+        inside = false;
+      }
+    }
+    mInsideFrustum[ newIndex ] = inside;
+  }
+
+  const unsigned int sphereCount = mCullSpheres.Count();
+  mSpheresInside.Resize( sphereCount );
+  camera.CheckSpheresInFrustum( updateBufferIndex, mCullSpheres.Begin(), sphereCount, mSpheresInside.Begin() );
+  for( unsigned int sphereIndex = 0u; sphereIndex < sphereCount; ++sphereIndex )
+  {
+    mInsideFrustum[ mCullIndices[ sphereIndex ] ] = mSpheresInside[ sphereIndex ];
+  }
+}
+
+bool RenderInstructionProcessor::IsSubtreeCulled( BufferIndex updateBufferIndex, Node& node, Camera& camera )
+{
+  // Walk up to the closest node already checked in this pass
+  const unsigned int passStamp = mCullingPass << 1u;
+  bool culled = false;
+  mUncheckedNodes.Clear();
+  for( Node* ancestor = &node; ancestor; ancestor = ancestor->GetParent() )
+  {
+    const TransformId id = ancestor->GetTransformId();
+    if( id != INVALID_TRANSFORM_ID )
+    {
+      if( id >= mSubtreeCullingStamps.Count() )
+      {
+        mSubtreeCullingStamps.Resize( id + 1u, 0u );
+      }
+
+      const unsigned int stamp = mSubtreeCullingStamps[ id ];
+      if( ( stamp & ~1u ) == passStamp )
+      {
+        culled = ( stamp & 1u );
+        break;
+      }
+      mUncheckedNodes.PushBack( ancestor );
+    }
+  }
+
+  // Check the subtrees from the top down; once one lies outside of the frustum, so do all of the subtrees below it
+  for( unsigned int index = mUncheckedNodes.Count(); index > 0u; --index )
+  {
+    Node* ancestor = mUncheckedNodes[ index - 1u ];
+    if( !culled )
+    {
+      const Vector4& boundingSphere = ancestor->GetSubtreeBoundingSphere();
+      culled = !camera.CheckSphereInFrustum( updateBufferIndex, Vector3( boundingSphere ), boundingSphere.w );
+    }
+    mSubtreeCullingStamps[ ancestor->GetTransformId() ] = passStamp | ( culled ? 1u : 0u );
+  }
+
+  return culled;
+}
+
+unsigned int RenderInstructionProcessor::ReuseCachedItems( BufferIndex updateBufferIndex, RenderList& renderList, RenderableContainer& renderables, bool isLayer3d )
+{
+  const unsigned int cachedCount = renderList.GetCachedItemCount();
+  const unsigned int renderableCount = renderables.Size();
+  mNewRenderables.Clear();
+  mRenderableIndices.Clear();
+  if( cachedCount == 0u )
+  {
+    return 0u;
+  }
+
+  // Look the cached items up by node and renderer
+  mCachedItems.Resize( cachedCount );
+  for( unsigned int index = 0u; index < cachedCount; ++index )
+  {
+    const RenderItem& item = renderList.GetItem( index );
+    CachedRenderItem& cachedItem = mCachedItems[ index ];
+    cachedItem.node = item.mNode;
+    cachedItem.renderer = item.mRenderer;
+    cachedItem.index = index;
+  }
+  std::sort( mCachedItems.Begin(), mCachedItems.End(), CompareCachedItems );
+
+  // The renderable of each cached item which is reused
+  const unsigned int notReused = renderableCount;
+  mRenderableIndices.Resize( cachedCount, notReused );
+
+  unsigned int reusedCount = 0u;
+  for( unsigned int index = 0u; index < renderableCount; ++index )
+  {
+    Renderable& renderable = renderables[ index ];
+    CachedRenderItem key;
+    key.node = renderable.mNode;
+    key.renderer = &renderable.mRenderer->GetRenderer();
+    Dali::Vector< CachedRenderItem >::Iterator found = std::lower_bound( mCachedItems.Begin(), mCachedItems.End(), key, CompareCachedItems );
+
+    bool reused = false;
+    if( found != mCachedItems.End() && found->node == key.node && found->renderer == key.renderer &&
+        mRenderableIndices[ found->index ] == notReused )
+    {
+      RenderItem& item = renderList.GetItem( found->index );
+      if( IsItemClean( item ) )
+      {
+        // The model view matrix and the culling result still hold; the cheaper attributes are refreshed
+        Renderer::Opacity opacity = renderable.mRenderer->GetOpacity( updateBufferIndex, *renderable.mNode );
+        if( opacity != Renderer::TRANSPARENT )
+        {
+          item.mTextureSet = renderable.mRenderer->GetTextures();
+          item.mIsOpaque = ( opacity == Renderer::OPAQUE );
+          item.mDepthIndex = renderable.mRenderer->GetDepthIndex();
+          if( !isLayer3d )
+          {
+            item.mDepthIndex += renderable.mNode->GetDepthIndex();
+          }
+
+          mRenderableIndices[ found->index ] = index;
+          ++reusedCount;
+        }
+        reused = true;
+      }
+    }
+
+    if( !reused )
+    {
+      mNewRenderables.PushBack( index );
+    }
+  }
+
+  // Move the reused items to the start of the list, keeping their order; the others are free to be recalculated
+  RenderItemContainer& items = renderList.GetContainer();
+  mUnusedItems.Clear();
+  unsigned int reusedIndex = 0u;
+  for( unsigned int index = 0u; index < cachedCount; ++index )
+  {
+    if( mRenderableIndices[ index ] != notReused )
+    {
+      items[ reusedIndex ] = items[ index ];
+      mRenderableIndices[ reusedIndex ] = mRenderableIndices[ index ];
+      ++reusedIndex;
+    }
+    else
+    {
+      mUnusedItems.PushBack( items[ index ] );
+    }
+  }
+  memcpy( items.Begin() + reusedCount, mUnusedItems.Begin(), mUnusedItems.Count() * sizeof( RenderItem* ) );
+  mRenderableIndices.Resize( reusedCount );
+
+  renderList.ReuseCachedItems( reusedCount );
+  INCREASE_BY( PerformanceMonitor::RENDER_ITEMS_REUSED, reusedCount );
+  return reusedCount;
+}
+
+inline void RenderInstructionProcessor::SortRenderItems( BufferIndex bufferIndex, RenderList& renderList, Layer& layer, bool respectClippingOrder, unsigned int reusedCount )
 {
   const size_t renderableCount = renderList.Count();
   // Reserve space if needed.
@@ -385,18 +710,134 @@ inline void RenderInstructionProcessor::SortRenderItems( BufferIndex bufferIndex
   const unsigned int comparitorIndex = ( respectClippingOrder                         ? ( 1u << 0u ) : 0u ) |
                                        ( layer.GetBehavior() == Dali::Layer::LAYER_3D ? ( 1u << 1u ) : 0u );
 
-  std::stable_sort( mSortingHelper.begin(), mSortingHelper.end(), mSortComparitors[ comparitorIndex ] );
+  const bool isLayer3d = comparitorIndex & ( 1u << 1u );
+  const SortKey* sortedKeys = NULL;
+  if( reusedCount > 0u )
+  {
+    // The reused items were added in their previous order, followed by the new items in the order of their renderables
+    for( size_t index = 0; index < renderableCount; ++index )
+    {
+      mSortingHelper[ index ].renderableIndex = mRenderableIndices[ index ];
+    }
+  }
+
+  if( reusedCount > 0u && !isLayer3d )
+  {
+    // If the reused items are still in order, the new items are sorted and merged into them rather than sorting the whole list
+    const CompareItemsWithIndex compareItems( mSortComparitors[ comparitorIndex ] );
+    const SortingHelper::iterator reusedEnd = mSortingHelper.begin() + reusedCount;
+    bool reusedItemsSorted = true;
+    for( SortingHelper::iterator iter = mSortingHelper.begin() + 1u; iter < reusedEnd && reusedItemsSorted; ++iter )
+    {
+      reusedItemsSorted = !compareItems( *iter, *( iter - 1 ) );
+    }
+
+    if( reusedItemsSorted )
+    {
+      std::stable_sort( reusedEnd, mSortingHelper.end(), compareItems );
+      std::inplace_merge( mSortingHelper.begin(), reusedEnd, mSortingHelper.end(), compareItems );
+    }
+    else
+    {
+      std::stable_sort( mSortingHelper.begin(), mSortingHelper.end(), compareItems );
+    }
+  }
+  else if( reusedCount > 0u )
+  {
+    // The 3D comparitors compare the Z values with an epsilon, so they are not a strict weak ordering and cannot be merged.
+    // The items are put back in the order of their renderables and stable sorted, as if none had been reused
+    std::sort( mSortingHelper.begin(), mSortingHelper.end(), CompareRenderableIndex );
+    std::stable_sort( mSortingHelper.begin(), mSortingHelper.end(), mSortComparitors[ comparitorIndex ] );
+  }
+  else
+  {
+    // Large 2D layers are sorted by key instead, which gives the same order as their comparitors
+    if( !isLayer3d && renderableCount >= KEY_SORT_THRESHOLD )
+    {
+      sortedKeys = SortByKey( respectClippingOrder );
+    }
+
+    if( !sortedKeys )
+    {
+      std::stable_sort( mSortingHelper.begin(), mSortingHelper.end(), mSortComparitors[ comparitorIndex ] );
+    }
+  }
 
   // Reorder / re-populate the RenderItems in the RenderList to correct order based on the sortinghelper.
   DALI_LOG_INFO( gRenderListLogFilter, Debug::Verbose, "Sorted Transparent List:\n");
   RenderItemContainer::Iterator renderListIter = renderList.GetContainer().Begin();
   for( unsigned int index = 0; index < renderableCount; ++index, ++renderListIter )
   {
-    *renderListIter = mSortingHelper[ index ].renderItem;
-    DALI_LOG_INFO( gRenderListLogFilter, Debug::Verbose, "  sortedList[%d] = %p\n", index, mSortingHelper[ index ].renderItem->mRenderer);
+    const unsigned int sortedIndex = sortedKeys ? sortedKeys[ index ].index : index;
+    *renderListIter = mSortingHelper[ sortedIndex ].renderItem;
+    DALI_LOG_INFO( gRenderListLogFilter, Debug::Verbose, "  sortedList[%d] = %p\n", index, mSortingHelper[ sortedIndex ].renderItem->mRenderer);
   }
 }
 
+const SortKey* RenderInstructionProcessor::SortByKey( bool respectClippingOrder )
+{
+  const unsigned int count = mSortingHelper.size();
+  mSortKeys.Resize( count );
+  mSortKeysBuffer.Resize( count );
+  for( unsigned int i = 0u; i < 3u; ++i )
+  {
+    mPointerRanks[i].Resize( count );
+  }
+
+  // Store the clipping sort modifier and the depth index in the keys whilst finding their range,
+  // the sign bit of the depth index is flipped so that it is ordered as an unsigned value
+  uint32_t minClipping = 0xffffffffu;
+  uint32_t maxClipping = 0u;
+  uint32_t minDepth = 0xffffffffu;
+  uint32_t maxDepth = 0u;
+  for( unsigned int index = 0u; index < count; ++index )
+  {
+    const SortAttributes& attributes = mSortingHelper[ index ];
+    const uint32_t clipping = respectClippingOrder ? attributes.renderItem->mNode->mClippingSortModifier : 0u;
+    const uint32_t depth = static_cast< uint32_t >( attributes.renderItem->mDepthIndex ) ^ 0x80000000u;
+    minClipping = std::min( minClipping, clipping );
+    maxClipping = std::max( maxClipping, clipping );
+    minDepth = std::min( minDepth, depth );
+    maxDepth = std::max( maxDepth, depth );
+
+    mSortKeys[ index ].key = ( static_cast< uint64_t >( clipping ) << 32u ) | depth;
+    mSortKeys[ index ].index = index;
+
+    mPointerRanks[0][ index ] = reinterpret_cast< uintptr_t >( attributes.shader );
+    mPointerRanks[1][ index ] = reinterpret_cast< uintptr_t >( attributes.textureSet );
+    mPointerRanks[2][ index ] = reinterpret_cast< uintptr_t >( attributes.geometry );
+  }
+
+  unsigned int rankBits[ 3 ];
+  const unsigned int depthBits = GetBitCount( maxDepth - minDepth );
+  unsigned int totalBits = GetBitCount( maxClipping - minClipping ) + depthBits;
+  for( unsigned int i = 0u; i < 3u; ++i )
+  {
+    rankBits[i] = GetBitCount( RankPointers( mPointerRanks[i], mDistinctPointers ) );
+    totalBits += rankBits[i];
+  }
+
+  if( totalBits > 64u )
+  {
+    return NULL;
+  }
+
+  // Pack the attributes, from the most significant down: clipping, depth index, shader, texture set and geometry
+  for( unsigned int index = 0u; index < count; ++index )
+  {
+    SortKey& sortKey = mSortKeys[ index ];
+    uint64_t key = ( sortKey.key >> 32u ) - minClipping;
+    key = ( key << depthBits ) | ( static_cast< uint32_t >( sortKey.key ) - minDepth );
+    for( unsigned int i = 0u; i < 3u; ++i )
+    {
+      key = ( key << rankBits[i] ) | mPointerRanks[i][ index ];
+    }
+    sortKey.key = key;
+  }
+
+  return RadixSort( mSortKeys, mSortKeysBuffer );
+}
+
 void RenderInstructionProcessor::Prepare( BufferIndex updateBufferIndex,
                                           SortedLayerPointers& sortedLayers,
                                           RenderTask& renderTask,
@@ -413,11 +854,18 @@ void RenderInstructionProcessor::Prepare( BufferIndex updateBufferIndex,
   const Matrix& viewMatrix = renderTask.GetViewMatrix( updateBufferIndex );
   SceneGraph::Camera& camera = renderTask.GetCamera();
 
+  // The subtrees checked by hierarchical culling are only valid for the camera of this pass
+  if( ++mCullingPass > MAXIMUM_CULLING_PASS )
+  {
+    mCullingPass = 1u;
+    mSubtreeCullingStamps.Clear();
+  }
+
   const SortedLayersIter endIter = sortedLayers.end();
   for( SortedLayersIter iter = sortedLayers.begin(); iter != endIter; ++iter )
   {
     Layer& layer = **iter;
-    const bool tryReuseRenderList( viewMatrixHasNotChanged && layer.CanReuseRenderers( &renderTask.GetCamera() ) );
+    const bool tryReuseRenderItems( viewMatrixHasNotChanged && layer.CanReuseRenderers( &renderTask.GetCamera() ) );
     const bool isLayer3D = layer.GetBehavior() == Dali::Layer::LAYER_3D;
     RenderList* renderList = NULL;
 
@@ -425,40 +873,40 @@ void RenderInstructionProcessor::Prepare( BufferIndex updateBufferIndex,
     {
       RenderableContainer& renderables = layer.colorRenderables;
 
-      if( !SetupRenderList( renderables, layer, instruction, tryReuseRenderList, &renderList ) )
-      {
-        renderList->SetHasColorRenderItems( true );
-        AddRenderersToRenderList( updateBufferIndex,
-                                  *renderList,
-                                  renderables,
-                                  viewMatrix,
-                                  camera,
-                                  isLayer3D,
-                                  cull );
-
-        // We only use the clipping version of the sort comparitor if any clipping nodes exist within the RenderList.
-        SortRenderItems( updateBufferIndex, *renderList, layer, hasClippingNodes );
-      }
+      const bool cachedItemsFromLayer = SetupRenderList( renderables, layer, instruction, &renderList );
+      renderList->SetHasColorRenderItems( true );
+      const unsigned int reusedCount = AddRenderItems( updateBufferIndex,
+                                                       *renderList,
+                                                       renderables,
+                                                       viewMatrix,
+                                                       camera,
+                                                       isLayer3D,
+                                                       cull,
+                                                       layer.IsHierarchicalCulling(),
+                                                       tryReuseRenderItems && cachedItemsFromLayer );
+
+      // We only use the clipping version of the sort comparitor if any clipping nodes exist within the RenderList.
+      SortRenderItems( updateBufferIndex, *renderList, layer, hasClippingNodes, reusedCount );
     }
 
     if( !layer.overlayRenderables.Empty() )
     {
       RenderableContainer& renderables = layer.overlayRenderables;
 
-      if( !SetupRenderList( renderables, layer, instruction, tryReuseRenderList, &renderList ) )
-      {
-        renderList->SetHasColorRenderItems( false );
-        AddRenderersToRenderList( updateBufferIndex,
-                                  *renderList,
-                                  renderables,
-                                  viewMatrix,
-                                  camera,
-                                  isLayer3D,
-                                  cull );
-
-        // Clipping hierarchy is irrelevant when sorting overlay items, so we specify using the non-clipping version of the sort comparitor.
-        SortRenderItems( updateBufferIndex, *renderList, layer, false );
-      }
+      const bool cachedItemsFromLayer = SetupRenderList( renderables, layer, instruction, &renderList );
+      renderList->SetHasColorRenderItems( false );
+      const unsigned int reusedCount = AddRenderItems( updateBufferIndex,
+                                                       *renderList,
+                                                       renderables,
+                                                       viewMatrix,
+                                                       camera,
+                                                       isLayer3D,
+                                                       cull,
+                                                       layer.IsHierarchicalCulling(),
+                                                       tryReuseRenderItems && cachedItemsFromLayer );
+
+      // Clipping hierarchy is irrelevant when sorting overlay items, so we specify using the non-clipping version of the sort comparitor.
+      SortRenderItems( updateBufferIndex, *renderList, layer, false, reusedCount );
     }
   }
 
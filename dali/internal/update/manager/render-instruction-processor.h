@@ -18,26 +18,35 @@
  *
  */
 
+// EXTERNAL INCLUDES
+#include <stdint.h>
+
 // INTERNAL INCLUDES
 #include <dali/internal/common/buffer-index.h>
 #include <dali/internal/update/manager/sorted-layers.h>
+#include <dali/internal/update/nodes/node-declarations.h>
 #include <dali/integration-api/resource-declarations.h>
 #include <dali/public-api/common/dali-vector.h>
+#include <dali/public-api/math/vector4.h>
 
 namespace Dali
 {
 
+class Matrix;
+
 namespace Internal
 {
 
 namespace Render
 {
 class Geometry;
+class Renderer;
 }
 
 namespace SceneGraph
 {
 
+class Camera;
 class RenderTracker;
 struct RenderItem;
 class Shader;
@@ -45,6 +54,25 @@ struct RenderList;
 class RenderTask;
 class RenderInstructionContainer;
 
+/**
+ * @brief The packed sort attributes of a render item
+ */
+struct SortKey
+{
+  uint64_t key;        ///< The sort attributes, from the most significant bits down
+  unsigned int index;  ///< The index of the item in the sorting helper
+};
+
+/**
+ * @brief A render item cached by a render list, found by its node and renderer
+ */
+struct CachedRenderItem
+{
+  const Node* node;                  ///< The node of the item
+  const Render::Renderer* renderer;  ///< The renderer of the item
+  unsigned int index;                ///< The index of the item in the render list
+};
+
 
 /**
  * @brief This class handles the sorting and preparation of Renderers for each layer.
@@ -74,7 +102,8 @@ public:
       shader( NULL ),
       textureSet( NULL ),
       geometry( NULL ),
-      zValue( 0.0f )
+      zValue( 0.0f ),
+      renderableIndex( 0u )
     {
     }
 
@@ -83,6 +112,7 @@ public:
     const void*             textureSet;        ///< The textureSet instance
     const Render::Geometry* geometry;          ///< The geometry instance
     float                   zValue;            ///< The Z value of the given renderer (either distance from camera, or a custom calculated value)
+    unsigned int            renderableIndex;   ///< The index of the renderable of the item, which orders the items that compare equal
   };
 
 
@@ -120,14 +150,81 @@ private:
 
 private:
 
+  /**
+   * @brief Add the items of the renderables of a layer to a render list.
+   * When the list caches the items of the layer, the items whose node has not moved are reused rather than recalculated;
+   * they are kept at the start of the list, in the order they were sorted in.
+   * @param[in] updateBufferIndex The current update buffer index.
+   * @param[in] renderList The render list to add the items to
+   * @param[in] renderables The renderables of the layer
+   * @param[in] viewMatrix Used to calculate the model view matrix of the items
+   * @param[in] camera The camera used to render
+   * @param[in] isLayer3d Whether we are processing a 3D layer or not
+   * @param[in] cull Whether frustum culling is enabled or not
+   * @param[in] hierarchicalCulling Whether the renderables below a subtree which lies outside of the frustum are culled together
+   * @param[in] reuseCachedItems Whether the cached items of the list can be reused
+   * @return The number of items reused
+   */
+  inline unsigned int AddRenderItems( BufferIndex updateBufferIndex,
+                                      RenderList& renderList,
+                                      RenderableContainer& renderables,
+                                      const Matrix& viewMatrix,
+                                      Camera& camera,
+                                      bool isLayer3d,
+                                      bool cull,
+                                      bool hierarchicalCulling,
+                                      bool reuseCachedItems );
+
+  /**
+   * @brief Check which of the renderables in mNewRenderables lie within the view frustum, storing the results in mInsideFrustum.
+   * The bounding spheres of the renderables are checked in batches. With hierarchical culling, the renderables
+   * below a node whose subtree lies outside of the frustum are culled without checking their own spheres.
+   * @param[in] updateBufferIndex The current update buffer index.
+   * @param[in] renderables The renderables of the layer
+   * @param[in] camera The camera used to render
+   * @param[in] hierarchicalCulling Whether the subtrees containing the renderables are checked first
+   */
+  void CullRenderables( BufferIndex updateBufferIndex, RenderableContainer& renderables, Camera& camera, bool hierarchicalCulling );
+
+  /**
+   * @brief Check whether the subtree of a node, or of one of its ancestors, lies outside of the view frustum.
+   * The result for each node is kept for the rest of the pass, so every subtree is only checked once.
+   * @param[in] updateBufferIndex The current update buffer index.
+   * @param[in] node The node
+   * @param[in] camera The camera used to render
+   * @return True if the renderables in the subtree of the node can be culled
+   */
+  bool IsSubtreeCulled( BufferIndex updateBufferIndex, Node& node, Camera& camera );
+
+  /**
+   * @brief Reuse the cached items of a render list whose node and renderer are unchanged.
+   * The renderables which have no such item are stored in mNewRenderables.
+   * @param[in] updateBufferIndex The current update buffer index.
+   * @param[in] renderList The render list caching the items of the renderables
+   * @param[in] renderables The renderables of the layer
+   * @param[in] isLayer3d Whether we are processing a 3D layer or not
+   * @return The number of items reused
+   */
+  unsigned int ReuseCachedItems( BufferIndex updateBufferIndex, RenderList& renderList, RenderableContainer& renderables, bool isLayer3d );
+
   /**
    * @brief Sort render items
    * @param bufferIndex The buffer to read from
    * @param renderList to sort
    * @param layer where the Renderers are from
    * @param respectClippingOrder Sort with the correct clipping hierarchy.
+   * @param reusedCount The number of items at the start of the list which were reused, in their previous order
+   */
+  inline void SortRenderItems( BufferIndex bufferIndex, RenderList& renderList, Layer& layer, bool respectClippingOrder, unsigned int reusedCount );
+
+  /**
+   * @brief Sort the sorting helper of a 2D layer by packing the sort attributes of each item into a 64-bit key.
+   * The pointers are replaced by their rank amongst the distinct pointers, so the order is the same as
+   * when sorting with the 2D comparitors.
+   * @param[in] respectClippingOrder Sort with the correct clipping hierarchy.
+   * @return The sorted keys, or NULL if the attributes do not fit in a key
    */
-  inline void SortRenderItems( BufferIndex bufferIndex, RenderList& renderList, Layer& layer, bool respectClippingOrder );
+  const SortKey* SortByKey( bool respectClippingOrder );
 
   /// Sort comparitor function pointer type.
   typedef bool ( *ComparitorPointer )( const SortAttributes& lhs, const SortAttributes& rhs );
@@ -135,6 +232,21 @@ private:
 
   Dali::Vector< ComparitorPointer > mSortComparitors;       ///< Contains all sort comparitors, used for quick look-up
   RenderInstructionProcessor::SortingHelper mSortingHelper; ///< Helper used to sort Renderers
+  Dali::Vector< SortKey > mSortKeys;                        ///< The keys of the items of large 2D layers
+  Dali::Vector< SortKey > mSortKeysBuffer;                  ///< Used by each pass of the radix sort of the keys
+  Dali::Vector< uintptr_t > mPointerRanks[ 3 ];             ///< The ranks of the shader, texture set and geometry pointers
+  Dali::Vector< uintptr_t > mDistinctPointers;              ///< The distinct pointers of one sort attribute, in order
+  Dali::Vector< CachedRenderItem > mCachedItems;            ///< The items cached by a render list, ordered by node and renderer
+  Dali::Vector< unsigned int > mRenderableIndices;          ///< The index of the renderable of each item of a render list
+  Dali::Vector< unsigned int > mNewRenderables;             ///< The indices of the renderables whose cached item cannot be reused
+  Dali::Vector< RenderItem* > mUnusedItems;                 ///< The cached items which are not reused
+  Dali::Vector< bool > mInsideFrustum;                      ///< Whether each renderable of mNewRenderables lies within the frustum
+  Dali::Vector< Vector4 > mCullSpheres;                     ///< The bounding spheres checked against the frustum in a batch
+  Dali::Vector< unsigned int > mCullIndices;                ///< The index in mNewRenderables of each sphere of mCullSpheres
+  Dali::Vector< bool > mSpheresInside;                      ///< Whether each sphere of mCullSpheres lies within the frustum
+  Dali::Vector< unsigned int > mSubtreeCullingStamps;       ///< The pass in which the subtree of each transform was checked, and the result in the lowest bit
+  Dali::Vector< Node* > mUncheckedNodes;                    ///< The ancestors of a node whose subtree has yet to be checked
+  unsigned int mCullingPass;                                ///< Counts the calls to Prepare(), to tell the subtrees checked in this pass
 
 };
 
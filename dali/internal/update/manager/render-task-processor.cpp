@@ -19,6 +19,7 @@
 #include <dali/internal/update/manager/render-task-processor.h>
 
 // INTERNAL INCLUDES
+#include <dali/internal/common/trace-impl.h>
 #include <dali/internal/update/manager/sorted-layers.h>
 #include <dali/internal/update/render-tasks/scene-graph-render-task.h>
 #include <dali/internal/update/render-tasks/scene-graph-render-task-list.h>
@@ -202,6 +203,8 @@ void RenderTaskProcessor::Process( BufferIndex updateBufferIndex,
                                    SortedLayerPointers& sortedLayers,
                                    RenderInstructionContainer& instructions )
 {
+  DALI_TRACE_SCOPE( RENDER_TASK_PROCESS );
+
   RenderTaskList::RenderTaskContainer& taskContainer = renderTasks.GetTasks();
 
   if( taskContainer.IsEmpty() )
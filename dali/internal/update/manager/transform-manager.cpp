@@ -22,10 +22,16 @@
 #include <algorithm>
 #include <cstring>
 
+#if defined( __SSE2__ ) && !defined( __ARM_NEON__ )
+#include <emmintrin.h>
+#endif
+
 //INTERNAL INCLUDES
 #include <dali/public-api/common/constants.h>
 #include <dali/public-api/common/compile-time-assert.h>
 #include <dali/internal/common/math.h>
+#include <dali/internal/common/thread-pool.h>
+#include <dali/internal/common/trace-impl.h>
 
 namespace Dali
 {
@@ -47,6 +53,18 @@ static const float gDefaultTransformComponentStaticData[] = { 0.5f, 0.5f, 0.5f,
 DALI_COMPILE_TIME_ASSERT( sizeof(gDefaultTransformComponentAnimatableData) == sizeof(TransformComponentAnimatable) );
 DALI_COMPILE_TIME_ASSERT( sizeof(gDefaultTransformComponentStaticData) == sizeof(TransformComponentStatic) );
 
+//Levels of the hierarchy with fewer components than this are not worth splitting between threads
+static const unsigned int PARALLEL_UPDATE_MINIMUM_LEVEL_SIZE = 256u;
+
+//Minimum number of components processed by a worker in one go
+static const unsigned int PARALLEL_UPDATE_MINIMUM_CHUNK_SIZE = 64u;
+
+//Number of chunks each thread should get per level, so that uneven chunks can be balanced
+static const unsigned int PARALLEL_UPDATE_CHUNKS_PER_THREAD = 4u;
+
+//Number of components updated together by UpdateComponentBatch(), one per SIMD lane
+static const unsigned int UPDATE_BATCH_SIZE = 4u;
+
 /**
  * @brief Calculates the center position for the transform component
  * @param[out] centerPosition The calculated center-position of the transform component
@@ -75,11 +93,238 @@ inline void CalculateCenterPosition(
   }
 }
 
+/**
+ * @brief Grows a sphere so that it encloses another sphere
+ * Spheres without a radius are empty, so they leave the other sphere unchanged
+ * @param[in,out] sphere The sphere to grow. xyz is the center and w is the radius
+ * @param[in] other The sphere to enclose
+ */
+inline void MergeSpheres( Vector4& sphere, const Vector4& other )
+{
+  if( other.w <= 0.0f )
+  {
+    return;
+  }
+
+  const Vector3 offset( other.x - sphere.x, other.y - sphere.y, other.z - sphere.z );
+  const float distance = offset.Length();
+  if( sphere.w <= 0.0f || distance + sphere.w <= other.w )
+  {
+    sphere = other;
+  }
+  else if( distance + other.w > sphere.w )
+  {
+    //Move the center towards the other sphere so that both touch the merged sphere from inside.
+    //The radius is padded so that rounding errors can never leave part of the other sphere outside
+    const float radius = ( distance + sphere.w + other.w ) * 0.5f;
+    const Vector3 center = Vector3( sphere ) + offset * ( ( radius - sphere.w ) / distance );
+    sphere = Vector4( center.x, center.y, center.z, radius * ( 1.0f + Math::MACHINE_EPSILON_100 ) );
+  }
+}
+
+#if defined( __SSE2__ ) && !defined( __ARM_NEON__ )
+
+/**
+ * @brief Loads a Vector3 of four components into one register per axis
+ * @param[out] vector The x, y and z values of the four components
+ */
+inline void LoadLanes( __m128* vector, const Vector3& lane0, const Vector3& lane1, const Vector3& lane2, const Vector3& lane3 )
+{
+  vector[0] = _mm_setr_ps( lane0.x, lane1.x, lane2.x, lane3.x );
+  vector[1] = _mm_setr_ps( lane0.y, lane1.y, lane2.y, lane3.y );
+  vector[2] = _mm_setr_ps( lane0.z, lane1.z, lane2.z, lane3.z );
+}
+
+/**
+ * @brief Computes the local matrices of up to UPDATE_BATCH_SIZE components which inherit the full transform, one component per lane.
+ * The operations are the same as CalculateCenterPosition() followed by Matrix::SetTransformComponents() so the results are identical.
+ * @param[in] index The indices of the components
+ * @param[in] parentIndex The indices of the parents of the components
+ * @param[in] count The number of components
+ * @param[in] animatable The animatable part of all the components
+ * @param[in] componentStatic The static part of all the components
+ * @param[in] size The size of all the components
+ * @param[out] local The local matrices of all the components
+ */
+void ComputeLocalMatrices( const unsigned int* index, const unsigned int* parentIndex, unsigned int count,
+                           const TransformComponentAnimatable* animatable, const TransformComponentStatic* componentStatic,
+                           const Vector3* size, Matrix* local )
+{
+  //Unused lanes repeat the first component
+  unsigned int lane[UPDATE_BATCH_SIZE];
+  for( unsigned int i(0); i<UPDATE_BATCH_SIZE; ++i )
+  {
+    lane[i] = i < count ? i : 0u;
+  }
+  const TransformComponentAnimatable& a0 = animatable[ index[lane[0]] ];
+  const TransformComponentAnimatable& a1 = animatable[ index[lane[1]] ];
+  const TransformComponentAnimatable& a2 = animatable[ index[lane[2]] ];
+  const TransformComponentAnimatable& a3 = animatable[ index[lane[3]] ];
+  const TransformComponentStatic& s0 = componentStatic[ index[lane[0]] ];
+  const TransformComponentStatic& s1 = componentStatic[ index[lane[1]] ];
+  const TransformComponentStatic& s2 = componentStatic[ index[lane[2]] ];
+  const TransformComponentStatic& s3 = componentStatic[ index[lane[3]] ];
+
+  __m128 scale[3], position[3], anchorPoint[3], parentOrigin[3], componentSize[3], parentSize[3];
+  LoadLanes( scale, a0.mScale, a1.mScale, a2.mScale, a3.mScale );
+  LoadLanes( position, a0.mPosition, a1.mPosition, a2.mPosition, a3.mPosition );
+  LoadLanes( anchorPoint, s0.mAnchorPoint, s1.mAnchorPoint, s2.mAnchorPoint, s3.mAnchorPoint );
+  LoadLanes( parentOrigin, s0.mParentOrigin, s1.mParentOrigin, s2.mParentOrigin, s3.mParentOrigin );
+  LoadLanes( componentSize, size[ index[lane[0]] ], size[ index[lane[1]] ], size[ index[lane[2]] ], size[ index[lane[3]] ] );
+  LoadLanes( parentSize, size[ parentIndex[lane[0]] ], size[ parentIndex[lane[1]] ], size[ parentIndex[lane[2]] ], size[ parentIndex[lane[3]] ] );
+
+  const __m128 usesAnchorPoint = _mm_castsi128_ps( _mm_setr_epi32( s0.mPositionUsesAnchorPoint ? -1 : 0, s1.mPositionUsesAnchorPoint ? -1 : 0,
+                                                                   s2.mPositionUsesAnchorPoint ? -1 : 0, s3.mPositionUsesAnchorPoint ? -1 : 0 ) );
+  const __m128 isIdentity = _mm_castsi128_ps( _mm_setr_epi32( a0.mOrientation.IsIdentity() ? -1 : 0, a1.mOrientation.IsIdentity() ? -1 : 0,
+                                                              a2.mOrientation.IsIdentity() ? -1 : 0, a3.mOrientation.IsIdentity() ? -1 : 0 ) );
+
+  //One register per quaternion component
+  __m128 orientation[4] = { _mm_loadu_ps( a0.mOrientation.mVector.AsFloat() ), _mm_loadu_ps( a1.mOrientation.mVector.AsFloat() ),
+                            _mm_loadu_ps( a2.mOrientation.mVector.AsFloat() ), _mm_loadu_ps( a3.mOrientation.mVector.AsFloat() ) };
+  _MM_TRANSPOSE4_PS( orientation[0], orientation[1], orientation[2], orientation[3] );
+  const __m128& x = orientation[0];
+  const __m128& y = orientation[1];
+  const __m128& z = orientation[2];
+  const __m128& w = orientation[3];
+
+  const __m128 half = _mm_set1_ps( 0.5f );
+  const __m128 one = _mm_set1_ps( 1.0f );
+  const __m128 two = _mm_set1_ps( 2.0f );
+  const __m128 topLeft[3] = { _mm_setzero_ps(), _mm_setzero_ps(), half };
+
+  //Center position, see CalculateCenterPosition() and Vector3::operator*=( const Quaternion& )
+  __m128 center[3];
+  for( unsigned int i(0); i<3u; ++i )
+  {
+    center[i] = _mm_mul_ps( _mm_mul_ps( _mm_sub_ps( half, anchorPoint[i] ), componentSize[i] ), scale[i] );
+  }
+
+  __m128 uv[3], uuv[3];
+  uv[0] = _mm_sub_ps( _mm_mul_ps( y, center[2] ), _mm_mul_ps( z, center[1] ) );
+  uv[1] = _mm_sub_ps( _mm_mul_ps( z, center[0] ), _mm_mul_ps( x, center[2] ) );
+  uv[2] = _mm_sub_ps( _mm_mul_ps( x, center[1] ), _mm_mul_ps( y, center[0] ) );
+  uuv[0] = _mm_sub_ps( _mm_mul_ps( y, uv[2] ), _mm_mul_ps( z, uv[1] ) );
+  uuv[1] = _mm_sub_ps( _mm_mul_ps( z, uv[0] ), _mm_mul_ps( x, uv[2] ) );
+  uuv[2] = _mm_sub_ps( _mm_mul_ps( x, uv[1] ), _mm_mul_ps( y, uv[0] ) );
+
+  __m128 localPosition[4];
+  for( unsigned int i(0); i<3u; ++i )
+  {
+    center[i] = _mm_add_ps( center[i], _mm_mul_ps( _mm_add_ps( _mm_mul_ps( uv[i], w ), uuv[i] ), two ) );
+
+    //If the position is ignoring the anchor-point, then remove the anchor-point shift from the position
+    const __m128 shifted = _mm_sub_ps( center[i], _mm_mul_ps( _mm_sub_ps( topLeft[i], anchorPoint[i] ), componentSize[i] ) );
+    center[i] = _mm_or_ps( _mm_and_ps( usesAnchorPoint, center[i] ), _mm_andnot_ps( usesAnchorPoint, shifted ) );
+
+    localPosition[i] = _mm_add_ps( _mm_add_ps( position[i], center[i] ), _mm_mul_ps( _mm_sub_ps( parentOrigin[i], half ), parentSize[i] ) );
+  }
+  localPosition[3] = one;
+
+  //Scaled rotation, see Matrix::SetTransformComponents()
+  const __m128 xx = _mm_mul_ps( x, x );
+  const __m128 yy = _mm_mul_ps( y, y );
+  const __m128 zz = _mm_mul_ps( z, z );
+  const __m128 xy = _mm_mul_ps( x, y );
+  const __m128 xz = _mm_mul_ps( x, z );
+  const __m128 wx = _mm_mul_ps( w, x );
+  const __m128 wy = _mm_mul_ps( w, y );
+  const __m128 wz = _mm_mul_ps( w, z );
+  const __m128 yz = _mm_mul_ps( y, z );
+
+  __m128 column0[4], column1[4], column2[4];
+  column0[0] = _mm_mul_ps( scale[0], _mm_sub_ps( one, _mm_mul_ps( two, _mm_add_ps( yy, zz ) ) ) );
+  column0[1] = _mm_mul_ps( scale[0], _mm_mul_ps( two, _mm_add_ps( xy, wz ) ) );
+  column0[2] = _mm_mul_ps( scale[0], _mm_mul_ps( two, _mm_sub_ps( xz, wy ) ) );
+  column1[0] = _mm_mul_ps( scale[1], _mm_mul_ps( two, _mm_sub_ps( xy, wz ) ) );
+  column1[1] = _mm_mul_ps( scale[1], _mm_sub_ps( one, _mm_mul_ps( two, _mm_add_ps( xx, zz ) ) ) );
+  column1[2] = _mm_mul_ps( scale[1], _mm_mul_ps( two, _mm_add_ps( yz, wx ) ) );
+  column2[0] = _mm_mul_ps( scale[2], _mm_mul_ps( two, _mm_add_ps( xz, wy ) ) );
+  column2[1] = _mm_mul_ps( scale[2], _mm_mul_ps( two, _mm_sub_ps( yz, wx ) ) );
+  column2[2] = _mm_mul_ps( scale[2], _mm_sub_ps( one, _mm_mul_ps( two, _mm_add_ps( xx, yy ) ) ) );
+
+  //Identity rotations only get the scale
+  column0[0] = _mm_or_ps( _mm_and_ps( isIdentity, scale[0] ), _mm_andnot_ps( isIdentity, column0[0] ) );
+  column0[1] = _mm_andnot_ps( isIdentity, column0[1] );
+  column0[2] = _mm_andnot_ps( isIdentity, column0[2] );
+  column1[0] = _mm_andnot_ps( isIdentity, column1[0] );
+  column1[1] = _mm_or_ps( _mm_and_ps( isIdentity, scale[1] ), _mm_andnot_ps( isIdentity, column1[1] ) );
+  column1[2] = _mm_andnot_ps( isIdentity, column1[2] );
+  column2[0] = _mm_andnot_ps( isIdentity, column2[0] );
+  column2[1] = _mm_andnot_ps( isIdentity, column2[1] );
+  column2[2] = _mm_or_ps( _mm_and_ps( isIdentity, scale[2] ), _mm_andnot_ps( isIdentity, column2[2] ) );
+  column0[3] = column1[3] = column2[3] = _mm_setzero_ps();
+
+  //Back to one register per column of each matrix
+  _MM_TRANSPOSE4_PS( column0[0], column0[1], column0[2], column0[3] );
+  _MM_TRANSPOSE4_PS( column1[0], column1[1], column1[2], column1[3] );
+  _MM_TRANSPOSE4_PS( column2[0], column2[1], column2[2], column2[3] );
+  _MM_TRANSPOSE4_PS( localPosition[0], localPosition[1], localPosition[2], localPosition[3] );
+
+  for( unsigned int i(0); i<count; ++i )
+  {
+    float* matrix = local[ index[i] ].AsFloat();
+    _mm_storeu_ps( matrix, column0[i] );
+    _mm_storeu_ps( matrix + 4, column1[i] );
+    _mm_storeu_ps( matrix + 8, column2[i] );
+    _mm_storeu_ps( matrix + 12, localPosition[i] );
+  }
+}
+
+/**
+ * @brief Computes world = local * parent, with the rows of the parent already loaded.
+ * The operations are the same as in Matrix::Multiply() so the results are identical.
+ * @param[out] world The world matrix
+ * @param[in] local The local matrix
+ * @param[in] parentRows The rows of the parent world matrix
+ */
+inline void MultiplyByParent( float* world, const float* local, const __m128* parentRows )
+{
+  for( unsigned int i(0); i<16u; i+=4u )
+  {
+    const __m128 column = _mm_loadu_ps( local + i );
+    __m128 value = _mm_mul_ps( _mm_shuffle_ps( column, column, _MM_SHUFFLE( 0, 0, 0, 0 ) ), parentRows[0] );
+    value = _mm_add_ps( value, _mm_mul_ps( _mm_shuffle_ps( column, column, _MM_SHUFFLE( 1, 1, 1, 1 ) ), parentRows[1] ) );
+    value = _mm_add_ps( value, _mm_mul_ps( _mm_shuffle_ps( column, column, _MM_SHUFFLE( 2, 2, 2, 2 ) ), parentRows[2] ) );
+    value = _mm_add_ps( value, _mm_mul_ps( _mm_shuffle_ps( column, column, _MM_SHUFFLE( 3, 3, 3, 3 ) ), parentRows[3] ) );
+    _mm_storeu_ps( world + i, value );
+  }
+}
+
+#endif // __SSE2__
+
 } // unnamed namespace
 
+/**
+ * Runs TransformManager::UpdateComponents() for the chunks handed out by a ThreadPool
+ */
+class TransformManager::UpdateTask : public ThreadPool::Task
+{
+public:
+
+  UpdateTask( TransformManager& transformManager )
+  : mTransformManager( transformManager )
+  {
+  }
+
+  virtual ~UpdateTask()
+  {
+  }
+
+  virtual void Process( unsigned int begin, unsigned int end )
+  {
+    mTransformManager.UpdateComponents( begin, end );
+  }
+
+private:
+
+  TransformManager& mTransformManager;
+};
+
 TransformManager::TransformManager()
 :mComponentCount(0),
- mReorder(false)
+ mThreadPool(NULL),
+ mReorder(false),
+ mSubtreeBoundsDirty(true)
 {}
 
 TransformManager::~TransformManager()
@@ -126,6 +371,7 @@ TransformId TransformManager::CreateTransform()
   }
 
   mComponentCount++;
+  mSubtreeBoundsDirty = true;
   return id;
 }
 
@@ -153,6 +399,7 @@ void TransformManager::RemoveTransform(TransformId id)
   mIds.Remove( id );
 
   mReorder = true;
+  mSubtreeBoundsDirty = true;
 }
 
 void TransformManager::SetParent( TransformId id, TransformId parentId )
@@ -162,6 +409,7 @@ void TransformManager::SetParent( TransformId id, TransformId parentId )
   mParent[ index ] = parentId;
   mComponentDirty[ index ] = true;
   mReorder = true;
+  mSubtreeBoundsDirty = true;
 }
 
 const Matrix& TransformManager::GetWorldMatrix( TransformId id ) const
@@ -229,8 +477,15 @@ void TransformManager::ResetToBaseValue()
   }
 }
 
+void TransformManager::SetThreadPool( ThreadPool* threadPool )
+{
+  mThreadPool = threadPool;
+}
+
 void TransformManager::Update()
 {
+  DALI_TRACE_SCOPE( TRANSFORM_MANAGER_UPDATE );
+
   if( mReorder )
   {
     //If some transform component has change its parent or has been removed since last update
@@ -239,79 +494,125 @@ void TransformManager::Update()
     mReorder = false;
   }
 
-  //Iterate through all components to compute its world matrix
-  Vector3 centerPosition;
-  Vector3 localPosition;
-  const Vector3 half( 0.5f,0.5f,0.5f );
-  const Vector3 topLeft( 0.0f, 0.0f, 0.5f );
-  for( unsigned int i(0); i<mComponentCount; ++i )
+  mSubtreeBoundsDirty = true;
+
+  //Components only depend on the world matrices of their parents, which are in the previous level
+  //of the hierarchy, so the components of each level can be updated in batches or split between threads
+  UpdateTask task( *this );
+  const unsigned int threadCount = mThreadPool ? mThreadPool->GetWorkerCount() + 1u : 1u;
+  const unsigned int levelCount = mLevelEnd.Count();
+  unsigned int levelBegin = 0u;
+  for( unsigned int level(0); level <= levelCount; ++level )
+  {
+    //Components created since the last reorder have no parent so they go after the last level
+    const unsigned int levelEnd = ( level < levelCount ) ? mLevelEnd[level] : mComponentCount;
+    const unsigned int levelSize = levelEnd - levelBegin;
+    if( threadCount == 1u || levelSize < PARALLEL_UPDATE_MINIMUM_LEVEL_SIZE )
+    {
+      UpdateComponents( levelBegin, levelEnd );
+    }
+    else
+    {
+      const unsigned int chunkSize = std::max( levelSize / ( threadCount * PARALLEL_UPDATE_CHUNKS_PER_THREAD ), PARALLEL_UPDATE_MINIMUM_CHUNK_SIZE );
+      mThreadPool->ParallelProcess( task, levelBegin, levelEnd, chunkSize );
+    }
+
+    levelBegin = levelEnd;
+  }
+}
+
+void TransformManager::UpdateComponents( unsigned int begin, unsigned int end )
+{
+  for( unsigned int i(begin); i<end; i+=UPDATE_BATCH_SIZE )
   {
-    if( DALI_LIKELY( mInheritanceMode[i] != DONT_INHERIT_TRANSFORM && mParent[i] != INVALID_TRANSFORM_ID ) )
+    UpdateComponentBatch( i, std::min( i + UPDATE_BATCH_SIZE, end ) );
+  }
+}
+
+void TransformManager::UpdateComponentBatch( unsigned int begin, unsigned int end )
+{
+#if defined( __SSE2__ ) && !defined( __ARM_NEON__ )
+
+  //Local matrices of the components which inherit the full transform are computed together
+  unsigned int localIndex[UPDATE_BATCH_SIZE];
+  unsigned int localParentIndex[UPDATE_BATCH_SIZE];
+  unsigned int localCount = 0u;
+  for( unsigned int i(begin); i<end; ++i )
+  {
+    if( DALI_LIKELY( mInheritanceMode[i] == INHERIT_ALL && mParent[i] != INVALID_TRANSFORM_ID ) )
     {
       const unsigned int& parentIndex = mIds[mParent[i] ];
-      if( DALI_LIKELY( mInheritanceMode[i] == INHERIT_ALL ) )
-      {
-        if( mComponentDirty[i] || mLocalMatrixDirty[parentIndex])
-        {
-          //Full transform inherited
-          mLocalMatrixDirty[i] = true;
-          CalculateCenterPosition( centerPosition, mTxComponentStatic[ i ], mTxComponentAnimatable[ i ], mSize[ i ], half, topLeft );
-          localPosition = mTxComponentAnimatable[i].mPosition + centerPosition + ( mTxComponentStatic[i].mParentOrigin - half ) *  mSize[parentIndex];
-          mLocal[i].SetTransformComponents( mTxComponentAnimatable[i].mScale, mTxComponentAnimatable[i].mOrientation, localPosition );
-        }
-
-        //Update the world matrix
-        Matrix::Multiply( mWorld[i], mLocal[i], mWorld[parentIndex]);
-      }
-      else
+      if( mComponentDirty[i] || mLocalMatrixDirty[parentIndex] )
       {
-        //Some components are not inherited
-        Vector3 parentPosition, parentScale;
-        Quaternion parentOrientation;
-        const Matrix& parentMatrix = mWorld[parentIndex];
-        parentMatrix.GetTransformComponents( parentPosition, parentOrientation, parentScale );
-
-        Vector3 localScale = mTxComponentAnimatable[i].mScale;
-        if( (mInheritanceMode[i] & INHERIT_SCALE) == 0 )
-        {
-          //Don't inherit scale
-          localScale /= parentScale;
-        }
-
-        Quaternion localOrientation( mTxComponentAnimatable[i].mOrientation );
-        if( (mInheritanceMode[i] & INHERIT_ORIENTATION) == 0 )
-        {
-          //Don't inherit orientation
-          parentOrientation.Invert();
-          localOrientation = parentOrientation * mTxComponentAnimatable[i].mOrientation;
-        }
-
-        if( (mInheritanceMode[i] & INHERIT_POSITION) == 0 )
-        {
-          //Don't inherit position
-          mLocal[i].SetTransformComponents( localScale, localOrientation, Vector3::ZERO );
-          Matrix::Multiply( mWorld[i], mLocal[i], parentMatrix );
-          mWorld[i].SetTranslation( mTxComponentAnimatable[i].mPosition);
-        }
-        else
-        {
-          CalculateCenterPosition( centerPosition, mTxComponentStatic[ i ], mTxComponentAnimatable[ i ], mSize[ i ], half, topLeft );
-          localPosition = mTxComponentAnimatable[i].mPosition + centerPosition + ( mTxComponentStatic[i].mParentOrigin - half ) *  mSize[parentIndex];
-          mLocal[i].SetTransformComponents( localScale, localOrientation, localPosition );
-          Matrix::Multiply( mWorld[i], mLocal[i], parentMatrix );
-        }
-
         mLocalMatrixDirty[i] = true;
+        localIndex[localCount] = i;
+        localParentIndex[localCount] = parentIndex;
+        ++localCount;
       }
     }
-    else  //Component has no parent or doesn't inherit transform
+    else
     {
-      CalculateCenterPosition( centerPosition, mTxComponentStatic[ i ], mTxComponentAnimatable[ i ], mSize[ i ], half, topLeft );
-      localPosition = mTxComponentAnimatable[i].mPosition + centerPosition;
-      mLocal[i].SetTransformComponents( mTxComponentAnimatable[i].mScale, mTxComponentAnimatable[i].mOrientation, localPosition );
-      mWorld[i] = mLocal[i];
-      mLocalMatrixDirty[i] = true;
+      UpdateWorldMatrix( i );
     }
+  }
+
+  if( localCount > 0u )
+  {
+    ComputeLocalMatrices( localIndex, localParentIndex, localCount, &mTxComponentAnimatable[0], &mTxComponentStatic[0], &mSize[0], &mLocal[0] );
+  }
+
+  //Update the world matrices, consecutive components often share the same parent
+  //The rows are zeroed so the compiler can see they are set before the first parent is loaded
+  const __m128 zero = _mm_setzero_ps();
+  __m128 parentRows[4] = { zero, zero, zero, zero };
+  unsigned int loadedParent = mComponentCount;
+  for( unsigned int i(begin); i<end; ++i )
+  {
+    if( DALI_LIKELY( mInheritanceMode[i] == INHERIT_ALL && mParent[i] != INVALID_TRANSFORM_ID ) )
+    {
+      const unsigned int& parentIndex = mIds[mParent[i] ];
+      if( parentIndex != loadedParent )
+      {
+        const float* parentWorld = mWorld[parentIndex].AsFloat();
+        parentRows[0] = _mm_loadu_ps( parentWorld );
+        parentRows[1] = _mm_loadu_ps( parentWorld + 4 );
+        parentRows[2] = _mm_loadu_ps( parentWorld + 8 );
+        parentRows[3] = _mm_loadu_ps( parentWorld + 12 );
+        loadedParent = parentIndex;
+      }
+      MultiplyByParent( mWorld[i].AsFloat(), mLocal[i].AsFloat(), parentRows );
+    }
+  }
+
+  //Update the bounding spheres, the radius is the length of the world space vector ( |size| * 0.5, 0, 0 )
+  __m128 centerToEdge[UPDATE_BATCH_SIZE] = { zero, zero, zero, zero };
+  for( unsigned int i(begin); i<end; ++i )
+  {
+    const float* world = mWorld[i].AsFloat();
+    __m128 edge = _mm_mul_ps( _mm_set1_ps( mSize[i].Length() * 0.5f ), _mm_loadu_ps( world ) );
+    edge = _mm_add_ps( edge, _mm_mul_ps( zero, _mm_loadu_ps( world + 4 ) ) );
+    centerToEdge[i - begin] = _mm_add_ps( edge, _mm_mul_ps( zero, _mm_loadu_ps( world + 8 ) ) );
+  }
+
+  _MM_TRANSPOSE4_PS( centerToEdge[0], centerToEdge[1], centerToEdge[2], centerToEdge[3] );
+  __m128 lengthSquared = _mm_mul_ps( centerToEdge[0], centerToEdge[0] );
+  lengthSquared = _mm_add_ps( lengthSquared, _mm_mul_ps( centerToEdge[1], centerToEdge[1] ) );
+  lengthSquared = _mm_add_ps( lengthSquared, _mm_mul_ps( centerToEdge[2], centerToEdge[2] ) );
+  float radius[UPDATE_BATCH_SIZE];
+  _mm_storeu_ps( radius, _mm_sqrt_ps( lengthSquared ) );
+
+  for( unsigned int i(begin); i<end; ++i )
+  {
+    mBoundingSpheres[i] = mWorld[i].GetTranslation();
+    mBoundingSpheres[i].w = radius[i - begin];
+    mComponentDirty[i] = false;
+  }
+
+#else
+
+  for( unsigned int i(begin); i<end; ++i )
+  {
+    UpdateWorldMatrix( i );
 
     //Update the bounding sphere
     Vec3 centerToEdge = { mSize[i].Length() * 0.5f, 0.0f, 0.0f };
@@ -323,6 +624,108 @@ void TransformManager::Update()
 
     mComponentDirty[i] = false;
   }
+
+#endif
+}
+
+void TransformManager::UpdateWorldMatrix( unsigned int i )
+{
+  Vector3 centerPosition;
+  Vector3 localPosition;
+  const Vector3 half( 0.5f,0.5f,0.5f );
+  const Vector3 topLeft( 0.0f, 0.0f, 0.5f );
+
+  if( DALI_LIKELY( mInheritanceMode[i] != DONT_INHERIT_TRANSFORM && mParent[i] != INVALID_TRANSFORM_ID ) )
+  {
+    const unsigned int& parentIndex = mIds[mParent[i] ];
+    if( DALI_LIKELY( mInheritanceMode[i] == INHERIT_ALL ) )
+    {
+      if( mComponentDirty[i] || mLocalMatrixDirty[parentIndex])
+      {
+        //Full transform inherited
+        mLocalMatrixDirty[i] = true;
+        CalculateCenterPosition( centerPosition, mTxComponentStatic[ i ], mTxComponentAnimatable[ i ], mSize[ i ], half, topLeft );
+        localPosition = mTxComponentAnimatable[i].mPosition + centerPosition + ( mTxComponentStatic[i].mParentOrigin - half ) *  mSize[parentIndex];
+        mLocal[i].SetTransformComponents( mTxComponentAnimatable[i].mScale, mTxComponentAnimatable[i].mOrientation, localPosition );
+      }
+
+      //Update the world matrix
+      Matrix::Multiply( mWorld[i], mLocal[i], mWorld[parentIndex]);
+    }
+    else
+    {
+      //Some components are not inherited
+      Vector3 parentPosition, parentScale;
+      Quaternion parentOrientation;
+      const Matrix& parentMatrix = mWorld[parentIndex];
+      parentMatrix.GetTransformComponents( parentPosition, parentOrientation, parentScale );
+
+      Vector3 localScale = mTxComponentAnimatable[i].mScale;
+      if( (mInheritanceMode[i] & INHERIT_SCALE) == 0 )
+      {
+        //Don't inherit scale
+        localScale /= parentScale;
+      }
+
+      Quaternion localOrientation( mTxComponentAnimatable[i].mOrientation );
+      if( (mInheritanceMode[i] & INHERIT_ORIENTATION) == 0 )
+      {
+        //Don't inherit orientation
+        parentOrientation.Invert();
+        localOrientation = parentOrientation * mTxComponentAnimatable[i].mOrientation;
+      }
+
+      if( (mInheritanceMode[i] & INHERIT_POSITION) == 0 )
+      {
+        //Don't inherit position
+        mLocal[i].SetTransformComponents( localScale, localOrientation, Vector3::ZERO );
+        Matrix::Multiply( mWorld[i], mLocal[i], parentMatrix );
+        mWorld[i].SetTranslation( mTxComponentAnimatable[i].mPosition);
+      }
+      else
+      {
+        CalculateCenterPosition( centerPosition, mTxComponentStatic[ i ], mTxComponentAnimatable[ i ], mSize[ i ], half, topLeft );
+        localPosition = mTxComponentAnimatable[i].mPosition + centerPosition + ( mTxComponentStatic[i].mParentOrigin - half ) *  mSize[parentIndex];
+        mLocal[i].SetTransformComponents( localScale, localOrientation, localPosition );
+        Matrix::Multiply( mWorld[i], mLocal[i], parentMatrix );
+      }
+
+      mLocalMatrixDirty[i] = true;
+    }
+  }
+  else  //Component has no parent or doesn't inherit transform
+  {
+    CalculateCenterPosition( centerPosition, mTxComponentStatic[ i ], mTxComponentAnimatable[ i ], mSize[ i ], half, topLeft );
+    localPosition = mTxComponentAnimatable[i].mPosition + centerPosition;
+    mLocal[i].SetTransformComponents( mTxComponentAnimatable[i].mScale, mTxComponentAnimatable[i].mOrientation, localPosition );
+    mWorld[i] = mLocal[i];
+    mLocalMatrixDirty[i] = true;
+  }
+}
+
+void TransformManager::UpdateSubtreeBoundingSpheres()
+{
+  if( mSubtreeBoundingSpheres.Count() < mComponentCount )
+  {
+    mSubtreeBoundingSpheres.Resize( mComponentCount );
+  }
+
+  if( mComponentCount )
+  {
+    memcpy( &mSubtreeBoundingSpheres[0], &mBoundingSpheres[0], sizeof(Vector4)*mComponentCount );
+  }
+
+  //Components are ordered by level, so visiting them backwards merges every subtree before it is merged into its parent
+  for( unsigned int i(mComponentCount); i>0u; --i )
+  {
+    const TransformId parentId = mParent[i-1u];
+    if( parentId != INVALID_TRANSFORM_ID )
+    {
+      MergeSpheres( mSubtreeBoundingSpheres[ mIds[parentId] ], mSubtreeBoundingSpheres[i-1u] );
+    }
+  }
+
+  mSubtreeBoundsDirty = false;
 }
 
 void TransformManager::SwapComponents( unsigned int i, unsigned int j )
@@ -372,6 +775,21 @@ void TransformManager::ReorderComponents()
       SwapComponents( previousIndex, newIndex);
     }
   }
+
+  //Record where each level of the hierarchy ends
+  mLevelEnd.Clear();
+  for( unsigned int i(1); i<mComponentCount; ++i )
+  {
+    if( mOrderedComponents[i].level != mOrderedComponents[i-1].level )
+    {
+      mLevelEnd.PushBack( i );
+    }
+  }
+
+  if( mComponentCount > 0u )
+  {
+    mLevelEnd.PushBack( mComponentCount );
+  }
 }
 
 Vector3& TransformManager::GetVector3PropertyValue( TransformId id, TransformManagerProperty property )
@@ -869,6 +1287,17 @@ const Vector4& TransformManager::GetBoundingSphere( TransformId id ) const
   return mBoundingSpheres[ mIds[id] ];
 }
 
+const Vector4& TransformManager::GetSubtreeBoundingSphere( TransformId id )
+{
+  DALI_ASSERT_DEBUG( !mReorder && "Components must be ordered by level before their subtrees are merged" );
+  if( mSubtreeBoundsDirty )
+  {
+    UpdateSubtreeBoundingSpheres();
+  }
+
+  return mSubtreeBoundingSpheres[ mIds[id] ];
+}
+
 void TransformManager::GetWorldMatrixAndSize( TransformId id, Matrix& worldMatrix, Vector3& size ) const
 {
   unsigned int index = mIds[id];
@@ -32,6 +32,8 @@ namespace Dali
 namespace Internal
 {
 
+class ThreadPool;
+
 namespace SceneGraph
 {
 
@@ -190,6 +192,14 @@ public:
    */
   void SetInheritOrientation( TransformId id, bool inherit );
 
+  /**
+   * Sets the thread pool used to compute the world transforms in parallel.
+   * Each level of the hierarchy is split into chunks which are processed on the workers,
+   * with a barrier between levels. The results are identical to the serial update.
+   * @param[in] threadPool The thread pool to use, or NULL to update on the calling thread only
+   */
+  void SetThreadPool( ThreadPool* threadPool );
+
   /**
    * Recomputes all world transform matrices
    */
@@ -335,6 +345,14 @@ public:
    */
   const Vector4& GetBoundingSphere( TransformId id ) const;
 
+  /**
+   * Get the bounding sphere, in world coordinates, of a given component and all of its descendants.
+   * The spheres of every component are merged up the hierarchy the first time one is needed after an update.
+   * @param[in] id Id of the transform component
+   * @return The world space bounding sphere of the subtree, its radius is zero if none of the components has a size
+   */
+  const Vector4& GetSubtreeBoundingSphere( TransformId id );
+
   /**
    * Get the world matrix and size of a given component
    * @param[in] id Id of the transform component
@@ -374,6 +392,36 @@ private:
    */
   void ReorderComponents();
 
+  /**
+   * Computes the local and world matrices and the bounding spheres of a range of components.
+   * All the components must be in the same level of the hierarchy and the world matrices of their parents must be up to date.
+   * @param[in] begin Index of the first component to update
+   * @param[in] end One past the index of the last component to update
+   */
+  void UpdateComponents( unsigned int begin, unsigned int end );
+
+  /**
+   * Updates a few components (at most one per SIMD lane) together.
+   * Components which inherit the full transform have their local matrices, world matrices and
+   * bounding spheres computed with vector instructions where available; the others use UpdateWorldMatrix().
+   * @param[in] begin Index of the first component to update
+   * @param[in] end One past the index of the last component to update
+   */
+  void UpdateComponentBatch( unsigned int begin, unsigned int end );
+
+  /**
+   * Computes the local and world matrices of a single component
+   * @param[in] i Index of the component
+   */
+  void UpdateWorldMatrix( unsigned int i );
+
+  /**
+   * Merges the bounding sphere of every component into the bounding spheres of its ancestors
+   */
+  void UpdateSubtreeBoundingSpheres();
+
+  class UpdateTask; ///< Used to run UpdateComponents() on a ThreadPool
+
   unsigned int mComponentCount;                                            ///< Total number of components
   FreeList mIds;                                                           ///< FreeList of Ids
   Vector< TransformComponentAnimatable > mTxComponentAnimatable;           ///< Animatable part of the components
@@ -385,12 +433,16 @@ private:
   Vector< Matrix > mWorld;                                                 ///< Local to world transform of the components
   Vector< Matrix > mLocal;                                                 ///< Local to parent space transform of the components
   Vector< Vector4 > mBoundingSpheres;                                      ///< Bounding spheres. xyz is the center and w is the radius
+  Vector< Vector4 > mSubtreeBoundingSpheres;                               ///< Bounding spheres of the components and their descendants
   Vector< TransformComponentAnimatable > mTxComponentAnimatableBaseValue;  ///< Base values for the animatable part of the components
   Vector< Vector3 > mSizeBase;                                             ///< Base value for the size of the components
   Vector< bool > mComponentDirty;                                          ///< 1u if some of the parts of the component has changed in this frame, 0 otherwise
   Vector< bool > mLocalMatrixDirty;                                        ///< 1u if the local matrix has been updated in this frame, 0 otherwise
   Vector< SOrderItem > mOrderedComponents;                                 ///< Used to reorder components when hierarchy changes
+  Vector< unsigned int > mLevelEnd;                                        ///< One past the index of the last component of each hierarchy level
+  ThreadPool* mThreadPool;                                                 ///< Used to update the components in parallel (not owned), may be NULL
   bool mReorder;                                                           ///< Flag to determine if the components have to reordered in the next Update
+  bool mSubtreeBoundsDirty;                                                ///< Flag to determine if the subtree bounding spheres have to be merged again
 };
 
 } //namespace SceneGraph
@@ -25,6 +25,7 @@
 #include <dali/public-api/actors/draw-mode.h>
 #include <dali/public-api/math/matrix.h>
 #include <dali/public-api/math/vector3.h>
+#include <dali/internal/common/thread-pool.h>
 #include <dali/internal/update/nodes/node.h>
 #include <dali/internal/update/animation/scene-graph-constraint-base.h>
 #include <dali/internal/update/nodes/scene-graph-layer.h>
@@ -45,6 +46,21 @@ namespace SceneGraph
 Debug::Filter* gUpdateFilter = Debug::Filter::New(Debug::Concise, false, "LOG_UPDATE_ALGORITHMS");
 #endif
 
+namespace
+{
+
+/**
+ * The number of nodes to update below which the children of a node are not split over the threads
+ */
+const uint32_t PARALLEL_UPDATE_THRESHOLD = 512u;
+
+/**
+ * The number of chunks of children given to each thread, so that the threads which finish early can take more
+ */
+const unsigned int CHUNKS_PER_THREAD = 4u;
+
+} // unnamed namespace
+
 /******************************************************************************
  *********************** Apply Constraints ************************************
  ******************************************************************************/
@@ -99,22 +115,208 @@ inline void UpdateNodeOpacity( Node& node, int nodeDirtyFlags, BufferIndex updat
   }
 }
 
+int UpdateNodes( Node& node,
+                 int parentFlags,
+                 BufferIndex updateBufferIndex,
+                 RenderQueue& renderQueue,
+                 int inheritedDrawMode,
+                 ThreadPool* threadPool );
+
+/**
+ * Updates a range of the children of a node; used to split the children over the threads of a pool.
+ * Each child has its own results, which are merged in the order of the children once all of them have been updated.
+ */
+class UpdateChildrenTask : public ThreadPool::Task
+{
+public:
+
+  /**
+   * Constructor
+   * @param[in] children The children to update
+   * @param[in] parentFlags The dirty flags of the parent
+   * @param[in] updateBufferIndex The current update buffer index
+   * @param[in] renderQueue Used to query messages for the next Render
+   * @param[in] inheritedDrawMode The draw mode inherited from the parent
+   */
+  UpdateChildrenTask( NodeContainer& children,
+                      int parentFlags,
+                      BufferIndex updateBufferIndex,
+                      RenderQueue& renderQueue,
+                      int inheritedDrawMode )
+  : mChildren( children ),
+    mResults(),
+    mParentFlags( parentFlags ),
+    mUpdateBufferIndex( updateBufferIndex ),
+    mRenderQueue( renderQueue ),
+    mInheritedDrawMode( inheritedDrawMode )
+  {
+    mResults.Resize( children.Count() );
+  }
+
+  /**
+   * @copydoc ThreadPool::Task::Process()
+   */
+  virtual void Process( unsigned int begin, unsigned int end )
+  {
+    for( unsigned int i = begin; i < end; ++i )
+    {
+      // The subtrees are not split any further
+      mResults[i] = UpdateNodes( *mChildren[i],
+                                 mParentFlags,
+                                 mUpdateBufferIndex,
+                                 mRenderQueue,
+                                 mInheritedDrawMode,
+                                 NULL );
+    }
+  }
+
+  /**
+   * Merge the results of the children
+   * @return The cumulative (ORed) dirty flags of the children
+   */
+  int MergeResults() const
+  {
+    int cumulativeDirtyFlags = 0;
+    for( Dali::Vector< int >::ConstIterator iter = mResults.Begin(), endIter = mResults.End(); iter != endIter; ++iter )
+    {
+      cumulativeDirtyFlags |= *iter;
+    }
+    return cumulativeDirtyFlags;
+  }
+
+private:
+
+  NodeContainer& mChildren;
+  Dali::Vector< int > mResults;  ///< The cumulative dirty flags of the subtree of each child
+  int mParentFlags;
+  BufferIndex mUpdateBufferIndex;
+  RenderQueue& mRenderQueue;
+  int mInheritedDrawMode;
+};
+
+/**
+ * Update the children of a node, splitting them over the threads of a pool when there is enough work
+ * @return The cumulative (ORed) dirty flags of the children
+ */
+int UpdateChildren( Node& node,
+                    int nodeDirtyFlags,
+                    BufferIndex updateBufferIndex,
+                    RenderQueue& renderQueue,
+                    int inheritedDrawMode,
+                    ThreadPool* threadPool )
+{
+  NodeContainer& children = node.GetChildren();
+  const unsigned int childCount = children.Count();
+
+  if( threadPool && childCount > 1u && threadPool->GetWorkerCount() > 0u )
+  {
+    // Estimate the work from the number of nodes updated in the previous frames.
+    // A constraint may read the properties of any node, so constrained subtrees are always updated in order
+    uint32_t updatedNodeCount = 0u;
+    uint32_t largestSubtree = 0u;
+    bool constrained = false;
+    for( NodeIter iter = children.Begin(), endIter = children.End(); iter != endIter; ++iter )
+    {
+      Node& child = **iter;
+      if( child.IsSubtreeDirty() || ( nodeDirtyFlags & InheritedDirtyFlags ) )
+      {
+        updatedNodeCount += child.GetSubtreeSize();
+        largestSubtree = std::max( largestSubtree, child.GetSubtreeSize() );
+        constrained |= child.IsSubtreeConstrained();
+      }
+    }
+
+    // When most of the work is in one child, its own children are split instead
+    if( !constrained && updatedNodeCount >= PARALLEL_UPDATE_THRESHOLD && largestSubtree * 2u <= updatedNodeCount )
+    {
+      UpdateChildrenTask task( children, nodeDirtyFlags, updateBufferIndex, renderQueue, inheritedDrawMode );
+      const unsigned int chunkSize = std::max( 1u, childCount / ( ( threadPool->GetWorkerCount() + 1u ) * CHUNKS_PER_THREAD ) );
+      threadPool->ParallelProcess( task, 0u, childCount, chunkSize );
+
+      return task.MergeResults();
+    }
+  }
+
+  int cumulativeDirtyFlags = 0;
+  for( NodeIter iter = children.Begin(), endIter = children.End(); iter != endIter; ++iter )
+  {
+    Node& child = **iter;
+    cumulativeDirtyFlags |= UpdateNodes( child,
+                                         nodeDirtyFlags,
+                                         updateBufferIndex,
+                                         renderQueue,
+                                         inheritedDrawMode,
+                                         threadPool );
+  }
+
+  return cumulativeDirtyFlags;
+}
+
+/**
+ * Record the state of the subtree of a node, once the node and its children have been updated
+ * @param[in] node The node
+ * @param[in] nodeChanged Whether the node has changed in this frame
+ * @param[in] isConstrained Whether the node has constraints
+ */
+inline void UpdateSubtreeState( Node& node, bool nodeChanged, bool isConstrained )
+{
+  // A changed node is updated again in the next frame, to refresh its other buffer
+  unsigned int subtreeDirtyFrames = node.GetSubtreeDirtyFrames();
+  if( nodeChanged )
+  {
+    subtreeDirtyFrames = SubtreeDirtyFrames;
+  }
+  else if( subtreeDirtyFrames > 0u )
+  {
+    --subtreeDirtyFrames;
+  }
+
+  uint32_t subtreeSize = 1u;
+  bool subtreeConstrained = isConstrained;
+
+  NodeContainer& children = node.GetChildren();
+  for( NodeIter iter = children.Begin(), endIter = children.End(); iter != endIter; ++iter )
+  {
+    Node& child = **iter;
+    subtreeDirtyFrames = std::max( subtreeDirtyFrames, child.GetSubtreeDirtyFrames() );
+    subtreeSize += child.GetSubtreeSize();
+    subtreeConstrained |= child.IsSubtreeConstrained();
+  }
+
+  node.SetSubtreeState( subtreeDirtyFrames, subtreeSize, subtreeConstrained );
+}
+
 /**
  * This is called recursively for all children of the root Node
  */
-inline int UpdateNodes( Node& node,
-                        int parentFlags,
-                        BufferIndex updateBufferIndex,
-                        RenderQueue& renderQueue,
-                        Layer& currentLayer,
-                        int inheritedDrawMode )
+int UpdateNodes( Node& node,
+                 int parentFlags,
+                 BufferIndex updateBufferIndex,
+                 RenderQueue& renderQueue,
+                 int inheritedDrawMode,
+                 ThreadPool* threadPool )
 {
+  // Skip subtrees which have not changed since both of their buffers were updated
+  if ( !node.IsSubtreeDirty() && !( parentFlags & InheritedDirtyFlags ) )
+  {
+    return 0;
+  }
+
   //Apply constraints to the node
   ConstrainPropertyOwner( node, updateBufferIndex );
+  const bool isConstrained = !node.GetConstraints().Empty();
 
   // Short-circuit for invisible nodes
   if ( !node.IsVisible( updateBufferIndex ) )
   {
+    // The children are not updated; they inherit all of the dirty flags when the node becomes visible again
+    bool subtreeConstrained = isConstrained;
+    NodeContainer& children = node.GetChildren();
+    for( NodeIter iter = children.Begin(), endIter = children.End(); iter != endIter; ++iter )
+    {
+      subtreeConstrained |= (*iter)->IsSubtreeConstrained();
+    }
+    node.SetSubtreeState( isConstrained ? SubtreeDirtyFrames : 0u, 1u, subtreeConstrained );
     return 0;
   }
 
@@ -131,20 +333,11 @@ inline int UpdateNodes( Node& node,
 
   int cumulativeDirtyFlags = nodeDirtyFlags;
 
-  Layer* layer = &currentLayer;
-  Layer* nodeIsLayer( node.GetLayer() );
-  if( nodeIsLayer )
+  if( node.IsLayer() )
   {
-    // all childs go to this layer
-    layer = nodeIsLayer;
-
-    // assume layer is clean to begin with
-    layer->SetReuseRenderers( updateBufferIndex, true );
-
     // Layers do not inherit the DrawMode from their parents
     inheritedDrawMode = DrawMode::NORMAL;
   }
-  DALI_ASSERT_DEBUG( NULL != layer );
 
   UpdateNodeOpacity( node, nodeDirtyFlags, updateBufferIndex );
 
@@ -153,26 +346,15 @@ inline int UpdateNodes( Node& node,
 
   node.PrepareRender( updateBufferIndex );
 
-  // if any child node has moved or had its sort modifier changed, layer is not clean and old frame cannot be reused
-  // also if node has been deleted, dont reuse old render items
-  if( nodeDirtyFlags & RenderableUpdateFlags )
-  {
-    layer->SetReuseRenderers( updateBufferIndex, false );
-  }
-
   // recurse children
-  NodeContainer& children = node.GetChildren();
-  const NodeIter endIter = children.End();
-  for ( NodeIter iter = children.Begin(); iter != endIter; ++iter )
-  {
-    Node& child = **iter;
-    cumulativeDirtyFlags |=UpdateNodes( child,
-                                        nodeDirtyFlags,
-                                        updateBufferIndex,
-                                        renderQueue,
-                                        *layer,
-                                        inheritedDrawMode );
-  }
+  cumulativeDirtyFlags |= UpdateChildren( node,
+                                          nodeDirtyFlags,
+                                          updateBufferIndex,
+                                          renderQueue,
+                                          inheritedDrawMode,
+                                          threadPool );
+
+  UpdateSubtreeState( node, nodeDirtyFlags || isConstrained, isConstrained );
 
   return cumulativeDirtyFlags;
 }
@@ -182,7 +364,8 @@ inline int UpdateNodes( Node& node,
  */
 int UpdateNodeTree( Layer& rootNode,
                     BufferIndex updateBufferIndex,
-                    RenderQueue& renderQueue )
+                    RenderQueue& renderQueue,
+                    ThreadPool* threadPool )
 {
   DALI_ASSERT_DEBUG( rootNode.IsRoot() );
 
@@ -209,18 +392,12 @@ int UpdateNodeTree( Layer& rootNode,
   DrawMode::Type drawMode( rootNode.GetDrawMode() );
 
   // recurse children
-  NodeContainer& children = rootNode.GetChildren();
-  const NodeIter endIter = children.End();
-  for ( NodeIter iter = children.Begin(); iter != endIter; ++iter )
-  {
-    Node& child = **iter;
-    cumulativeDirtyFlags |= UpdateNodes( child,
-                                         nodeDirtyFlags,
-                                         updateBufferIndex,
-                                         renderQueue,
-                                         rootNode,
-                                         drawMode );
-  }
+  cumulativeDirtyFlags |= UpdateChildren( rootNode,
+                                          nodeDirtyFlags,
+                                          updateBufferIndex,
+                                          renderQueue,
+                                          drawMode,
+                                          threadPool );
 
   return cumulativeDirtyFlags;
 }
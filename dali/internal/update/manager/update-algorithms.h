@@ -27,6 +27,8 @@ namespace Dali
 namespace Internal
 {
 
+class ThreadPool;
+
 namespace SceneGraph
 {
 
@@ -45,14 +47,18 @@ void ConstrainPropertyOwner( PropertyOwner& propertyOwner, BufferIndex updateBuf
 /**
  * Update a tree of nodes
  * The inherited properties of each node are recalculated if necessary.
+ * Large sibling subtrees without constraints are updated in parallel when a thread pool is given;
+ * the results are the same as when the tree is updated on the calling thread only.
  * @param[in] rootNode The root of a tree of nodes.
  * @param[in] updateBufferIndex The current update buffer index.
  * @param[in] renderQueue Used to query messages for the next Render.
+ * @param[in] threadPool The thread pool to use, or NULL to update on the calling thread only
  * @return The cumulative (ORed) dirty flags for the updated nodes
  */
 int UpdateNodeTree( Layer& rootNode,
                     BufferIndex updateBufferIndex,
-                    RenderQueue& renderQueue );
+                    RenderQueue& renderQueue,
+                    ThreadPool* threadPool );
 
 } // namespace SceneGraph
 
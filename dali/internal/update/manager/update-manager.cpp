@@ -31,6 +31,8 @@
 
 #include <dali/internal/common/core-impl.h>
 #include <dali/internal/common/message.h>
+#include <dali/internal/common/thread-pool.h>
+#include <dali/internal/common/trace-impl.h>
 
 #include <dali/internal/event/common/notification-manager.h>
 #include <dali/internal/event/common/property-notification-impl.h>
@@ -58,6 +60,7 @@
 #include <dali/internal/update/rendering/scene-graph-texture-set.h>
 #include <dali/internal/update/render-tasks/scene-graph-camera.h>
 
+#include <dali/internal/render/common/performance-monitor.h>
 #include <dali/internal/render/common/render-instruction-container.h>
 #include <dali/internal/render/common/render-manager.h>
 #include <dali/internal/render/queue/render-queue.h>
@@ -130,6 +133,7 @@ struct UpdateManager::Impl
   : renderMessageDispatcher( renderManager, renderQueue, sceneGraphBuffers ),
     notificationManager( notificationManager ),
     transformManager(),
+    threadPool(),
     animationFinishedNotifier( animationFinishedNotifier ),
     propertyNotifier( propertyNotifier ),
     shaderSaver( NULL ),
@@ -211,6 +215,7 @@ struct UpdateManager::Impl
   RenderMessageDispatcher             renderMessageDispatcher;       ///< Used for passing messages to the render-thread
   NotificationManager&                notificationManager;           ///< Queues notification messages for the event-thread.
   TransformManager                    transformManager;              ///< Used to update the transformation matrices of the nodes
+  ThreadPool                          threadPool;                    ///< Worker threads used to parallelise the update
   CompleteNotificationInterface&      animationFinishedNotifier;     ///< Provides notification to applications when animations are finished.
   PropertyNotifier&                   propertyNotifier;              ///< Provides notification to applications when properties are modified.
   ShaderSaver*                        shaderSaver;                   ///< Saves shader binaries.
@@ -653,6 +658,8 @@ bool UpdateManager::FlushQueue()
 
 void UpdateManager::ResetProperties( BufferIndex bufferIndex )
 {
+  DALI_TRACE_SCOPE( RESET_PROPERTIES );
+
   // Clear the "animations finished" flag; This should be set if any (previously playing) animation is stopped
   mImpl->animationFinishedDuringUpdate = false;
 
@@ -726,6 +733,8 @@ bool UpdateManager::ProcessGestures( BufferIndex bufferIndex, unsigned int lastV
 
 void UpdateManager::Animate( BufferIndex bufferIndex, float elapsedSeconds )
 {
+  DALI_TRACE_SCOPE( ANIMATE );
+
   AnimationContainer &animations = mImpl->animations;
   AnimationIter iter = animations.Begin();
   bool animationLooped = false;
@@ -846,6 +855,8 @@ void UpdateManager::ForwardCompiledShadersToEventThread()
 
 void UpdateManager::UpdateRenderers( BufferIndex bufferIndex )
 {
+  DALI_TRACE_SCOPE( UPDATE_RENDERERS );
+
   const OwnerContainer<Renderer*>& rendererContainer( mImpl->renderers.GetObjectContainer() );
   unsigned int rendererCount( rendererContainer.Size() );
   for( unsigned int i(0); i<rendererCount; ++i )
@@ -859,6 +870,8 @@ void UpdateManager::UpdateRenderers( BufferIndex bufferIndex )
 
 void UpdateManager::UpdateNodes( BufferIndex bufferIndex )
 {
+  DALI_TRACE_SCOPE( UPDATE_NODES );
+
   mImpl->nodeDirtyFlags = NothingFlag;
 
   if ( !mImpl->root )
@@ -866,17 +879,21 @@ void UpdateManager::UpdateNodes( BufferIndex bufferIndex )
     return;
   }
 
+  ThreadPool* threadPool = ( mImpl->threadPool.GetWorkerCount() > 0u ) ? &mImpl->threadPool : NULL;
+
   // Prepare resources, update shaders, for each node
   // And add the renderers to the sorted layers. Start from root, which is also a layer
   mImpl->nodeDirtyFlags = UpdateNodeTree( *( mImpl->root ),
                                           bufferIndex,
-                                          mImpl->renderQueue );
+                                          mImpl->renderQueue,
+                                          threadPool );
 
   if ( mImpl->systemLevelRoot )
   {
     mImpl->nodeDirtyFlags |= UpdateNodeTree( *( mImpl->systemLevelRoot ),
                                              bufferIndex,
-                                             mImpl->renderQueue );
+                                             mImpl->renderQueue,
+                                             threadPool );
   }
 }
 
@@ -884,6 +901,8 @@ unsigned int UpdateManager::Update( float elapsedSeconds,
                                     unsigned int lastVSyncTimeMilliseconds,
                                     unsigned int nextVSyncTimeMilliseconds )
 {
+  DALI_TRACE_SCOPE( UPDATE );
+
   const BufferIndex bufferIndex = mSceneGraphBuffers.GetUpdateBufferIndex();
 
   //Clear nodes/resources which were previously discarded
@@ -904,8 +923,10 @@ unsigned int UpdateManager::Update( float elapsedSeconds,
   if( updateScene || mImpl->previousUpdateScene )
   {
     //Reset properties from the previous update
+    PERF_MONITOR_START( PerformanceMonitor::RESET_PROPERTIES );
     ResetProperties( bufferIndex );
     mImpl->transformManager.ResetToBaseValue();
+    PERF_MONITOR_END( PerformanceMonitor::RESET_PROPERTIES );
   }
 
   //Process the queued scene messages
@@ -920,10 +941,14 @@ unsigned int UpdateManager::Update( float elapsedSeconds,
   if( updateScene || mImpl->previousUpdateScene )
   {
     //Animate
+    PERF_MONITOR_START( PerformanceMonitor::ANIMATE_NODES );
     Animate( bufferIndex, elapsedSeconds );
+    PERF_MONITOR_END( PerformanceMonitor::ANIMATE_NODES );
 
     //Constraint custom objects
+    PERF_MONITOR_START( PerformanceMonitor::APPLY_CONSTRAINTS );
     ConstrainCustomObjects( bufferIndex );
+    PERF_MONITOR_END( PerformanceMonitor::APPLY_CONSTRAINTS );
 
     //Clear the lists of renderers from the previous update
     for( size_t i(0); i<mImpl->sortedLayers.size(); ++i )
@@ -938,14 +963,20 @@ unsigned int UpdateManager::Update( float elapsedSeconds,
 
     //Update node hierarchy, apply constraints and perform sorting / culling.
     //This will populate each Layer with a list of renderers which are ready.
+    PERF_MONITOR_START( PerformanceMonitor::UPDATE_NODES );
     UpdateNodes( bufferIndex );
+    PERF_MONITOR_END( PerformanceMonitor::UPDATE_NODES );
 
     //Apply constraints to RenderTasks, shaders
+    PERF_MONITOR_START( PerformanceMonitor::APPLY_CONSTRAINTS );
     ConstrainRenderTasks( bufferIndex );
     ConstrainShaders( bufferIndex );
+    PERF_MONITOR_END( PerformanceMonitor::APPLY_CONSTRAINTS );
 
     //Update renderers and apply constraints
+    PERF_MONITOR_START( PerformanceMonitor::PREPARE_RENDERABLES );
     UpdateRenderers( bufferIndex );
+    PERF_MONITOR_END( PerformanceMonitor::PREPARE_RENDERABLES );
 
     //Update the trnasformations of all the nodes
     mImpl->transformManager.Update();
@@ -958,6 +989,7 @@ unsigned int UpdateManager::Update( float elapsedSeconds,
     mImpl->renderInstructions.ResetAndReserve( bufferIndex,
                                                mImpl->taskList.GetTasks().Count() + mImpl->systemLevelTaskList.GetTasks().Count() );
 
+    PERF_MONITOR_START( PerformanceMonitor::PROCESS_RENDER_TASKS );
     if ( NULL != mImpl->root )
     {
       mImpl->renderTaskProcessor.Process( bufferIndex,
@@ -976,6 +1008,7 @@ unsigned int UpdateManager::Update( float elapsedSeconds,
                                           mImpl->renderInstructions );
       }
     }
+    PERF_MONITOR_END( PerformanceMonitor::PROCESS_RENDER_TASKS );
   }
 
   // check the countdown and notify (note, at the moment this is only done for normal tasks, not for systemlevel tasks)
@@ -1082,6 +1115,17 @@ void UpdateManager::SetDefaultSurfaceRect( const Rect<int>& rect )
   new (slot) DerivedType( &mImpl->renderManager,  &RenderManager::SetDefaultSurfaceRect, rect );
 }
 
+void UpdateManager::EnableParallelShaderCompilation( bool enable )
+{
+  typedef MessageValue1< RenderManager, bool > DerivedType;
+
+  // Reserve some memory inside the render queue
+  unsigned int* slot = mImpl->renderQueue.ReserveMessageSlot( mSceneGraphBuffers.GetUpdateBufferIndex(), sizeof( DerivedType ) );
+
+  // Construct message in the render queue memory; note that delete should not be called on the return value
+  new (slot) DerivedType( &mImpl->renderManager, &RenderManager::EnableParallelShaderCompilation, enable );
+}
+
 void UpdateManager::KeepRendering( float durationSeconds )
 {
   mImpl->keepRenderingSeconds = std::max( mImpl->keepRenderingSeconds, durationSeconds );
@@ -1100,6 +1144,12 @@ void UpdateManager::SetLayerDepths( const SortedLayerPointers& layers, bool syst
   }
 }
 
+void UpdateManager::SetWorkerThreadCount( unsigned int count )
+{
+  mImpl->threadPool.Initialize( count );
+  mImpl->transformManager.SetThreadPool( ( count > 0u ) ? &mImpl->threadPool : NULL );
+}
+
 void UpdateManager::SetShaderSaver( ShaderSaver& upstream )
 {
   mImpl->shaderSaver = &upstream;
@@ -1197,6 +1247,18 @@ void UpdateManager::SetPropertyBufferData( Render::PropertyBuffer* propertyBuffe
   new (slot) DerivedType( &mImpl->renderManager, &RenderManager::SetPropertyBufferData, propertyBuffer, data, size );
 }
 
+void UpdateManager::SetPropertyBufferDataRange( Render::PropertyBuffer* propertyBuffer, Dali::Vector<char>* data, size_t offset )
+{
+  // Message has ownership of the data while in transit from update -> render
+  typedef MessageValue3< RenderManager, Render::PropertyBuffer*, OwnerPointer< Dali::Vector<char> >, size_t > DerivedType;
+
+  // Reserve some memory inside the render queue
+  unsigned int* slot = mImpl->renderQueue.ReserveMessageSlot( mSceneGraphBuffers.GetUpdateBufferIndex(), sizeof( DerivedType ) );
+
+  // Construct message in the render queue memory; note that delete should not be called on the return value
+  new (slot) DerivedType( &mImpl->renderManager, &RenderManager::SetPropertyBufferDataRange, propertyBuffer, data, offset );
+}
+
 void UpdateManager::AddGeometry( Render::Geometry* geometry )
 {
   // Message has ownership of format while in transit from update -> render
@@ -1233,7 +1295,18 @@ void UpdateManager::SetGeometryType( Render::Geometry* geometry, unsigned int ge
 
 void UpdateManager::SetIndexBuffer( Render::Geometry* geometry, Dali::Vector<unsigned short>& indices )
 {
-  typedef IndexBufferMessage< RenderManager > DerivedType;
+  typedef IndexBufferMessage< RenderManager, unsigned short > DerivedType;
+
+  // Reserve some memory inside the render queue
+  unsigned int* slot = mImpl->renderQueue.ReserveMessageSlot( mSceneGraphBuffers.GetUpdateBufferIndex(), sizeof( DerivedType ) );
+
+  // Construct message in the render queue memory; note that delete should not be called on the return value
+  new (slot) DerivedType( &mImpl->renderManager, geometry, indices );
+}
+
+void UpdateManager::SetIndexBuffer( Render::Geometry* geometry, Dali::Vector<uint32_t>& indices )
+{
+  typedef IndexBufferMessage< RenderManager, uint32_t > DerivedType;
 
   // Reserve some memory inside the render queue
   unsigned int* slot = mImpl->renderQueue.ReserveMessageSlot( mSceneGraphBuffers.GetUpdateBufferIndex(), sizeof( DerivedType ) );
@@ -1298,6 +1371,17 @@ void UpdateManager::UploadTexture( Render::Texture* texture, PixelDataPtr pixelD
   new (slot) DerivedType( &mImpl->renderManager, &RenderManager::UploadTexture, texture, pixelData, params );
 }
 
+void UpdateManager::RespecifyTexture( Render::Texture* texture, Pixel::Format format, unsigned int width, unsigned int height )
+{
+  typedef MessageValue4< RenderManager, Render::Texture*, Pixel::Format, unsigned int, unsigned int > DerivedType;
+
+  // Reserve some memory inside the render queue
+  unsigned int* slot = mImpl->renderQueue.ReserveMessageSlot( mSceneGraphBuffers.GetUpdateBufferIndex(), sizeof( DerivedType ) );
+
+  // Construct message in the render queue memory; note that delete should not be called on the return value
+  new (slot) DerivedType( &mImpl->renderManager, &RenderManager::RespecifyTexture, texture, format, width, height );
+}
+
 void UpdateManager::GenerateMipmaps( Render::Texture* texture )
 {
   typedef MessageValue1< RenderManager, Render::Texture* > DerivedType;
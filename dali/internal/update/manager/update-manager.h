@@ -428,6 +428,15 @@ public:
    */
   void SetPropertyBufferData(Render::PropertyBuffer* propertyBuffer, Dali::Vector<char>* data, size_t size);
 
+  /**
+   * Updates a range of the data of an existing property buffer
+   * @param[in] propertyBuffer The property buffer.
+   * @param[in] data The new data of the range
+   * @param[in] offset The offset of the range in bytes
+   * @post Sends a message to RenderManager to update the range of the property buffer.
+   */
+  void SetPropertyBufferDataRange(Render::PropertyBuffer* propertyBuffer, Dali::Vector<char>* data, size_t offset);
+
   /**
    * Adds a geometry to the RenderManager
    * @param[in] geometry The geometry to add
@@ -457,6 +466,13 @@ public:
    */
   void SetIndexBuffer( Render::Geometry* geometry, Dali::Vector<unsigned short>& indices );
 
+  /**
+   * Sets the 32 bit index buffer to be used by a geometry
+   * @param[in] geometry The geometry
+   * @param[in] indices A vector containing the indices for the geometry
+   */
+  void SetIndexBuffer( Render::Geometry* geometry, Dali::Vector<uint32_t>& indices );
+
   /**
    * Adds a vertex buffer to a geomtry
    * @param[in] geometry The geometry
@@ -493,6 +509,15 @@ public:
    */
   void UploadTexture( Render::Texture* texture, PixelDataPtr pixelData, const Texture::UploadParams& params );
 
+  /**
+   * Changes the format and size of a texture owned by the RenderManager
+   * @param[in] texture The texture
+   * @param[in] format The new format of the pixel data
+   * @param[in] width The new width of the texture
+   * @param[in] height The new height of the texture
+   */
+  void RespecifyTexture( Render::Texture* texture, Pixel::Format format, unsigned int width, unsigned int height );
+
   /**
    * Generates mipmaps for a texture owned by the RenderManager
    * @param[in] texture The texture
@@ -545,6 +570,11 @@ public:
    */
   void SetDefaultSurfaceRect( const Rect<int>& rect );
 
+  /**
+   * @copydoc Dali::Integration::Core::EnableParallelShaderCompilation()
+   */
+  void EnableParallelShaderCompilation( bool enable );
+
   /**
    * @copydoc Dali::Stage::KeepRendering()
    */
@@ -557,6 +587,12 @@ public:
    */
   void SetLayerDepths( const std::vector< Layer* >& layers, bool systemLevel );
 
+  /**
+   * Sets the number of worker threads used to parallelise the update.
+   * @param[in] count The number of worker threads; zero updates on the update-thread only
+   */
+  void SetWorkerThreadCount( unsigned int count );
+
 private:
 
   // Undefined
@@ -907,6 +943,17 @@ inline void SetDefaultSurfaceRectMessage( UpdateManager& manager, const Rect<int
   new (slot) LocalType( &manager, &UpdateManager::SetDefaultSurfaceRect, rect );
 }
 
+inline void EnableParallelShaderCompilationMessage( UpdateManager& manager, bool enable )
+{
+  typedef MessageValue1< UpdateManager, bool > LocalType;
+
+  // Reserve some memory inside the message queue
+  unsigned int* slot = manager.ReserveMessageSlot( sizeof( LocalType ) );
+
+  // Construct message in the message queue memory; note that delete should not be called on the return value
+  new (slot) LocalType( &manager, &UpdateManager::EnableParallelShaderCompilation, enable );
+}
+
 inline void KeepRenderingMessage( UpdateManager& manager, float durationSeconds )
 {
   typedef MessageValue1< UpdateManager, float > LocalType;
@@ -918,6 +965,17 @@ inline void KeepRenderingMessage( UpdateManager& manager, float durationSeconds
   new (slot) LocalType( &manager, &UpdateManager::KeepRendering, durationSeconds );
 }
 
+inline void SetWorkerThreadCountMessage( UpdateManager& manager, unsigned int count )
+{
+  typedef MessageValue1< UpdateManager, unsigned int > LocalType;
+
+  // Reserve some memory inside the message queue
+  unsigned int* slot = manager.ReserveMessageSlot( sizeof( LocalType ) );
+
+  // Construct message in the message queue memory; note that delete should not be called on the return value
+  new (slot) LocalType( &manager, &UpdateManager::SetWorkerThreadCount, count );
+}
+
 /**
  * Create a message for setting the depth of a layer
  * @param[in] manager The update manager
@@ -1096,6 +1154,18 @@ inline void SetPropertyBufferData( UpdateManager& manager, Render::PropertyBuffe
   new (slot) LocalType( &manager, &UpdateManager::SetPropertyBufferData, &propertyBuffer, data, size );
 }
 
+inline void SetPropertyBufferDataRange( UpdateManager& manager, Render::PropertyBuffer& propertyBuffer, Vector<char>* data, size_t offset )
+{
+  // Message has ownership of PropertyBuffer data while in transit from event -> update
+  typedef MessageValue3< UpdateManager, Render::PropertyBuffer*, OwnerPointer< Vector<char> >, size_t  > LocalType;
+
+  // Reserve some memory inside the message queue
+  unsigned int* slot = manager.ReserveMessageSlot( sizeof( LocalType ) );
+
+  // Construct message in the message queue memory; note that delete should not be called on the return value
+  new (slot) LocalType( &manager, &UpdateManager::SetPropertyBufferDataRange, &propertyBuffer, data, offset );
+}
+
 inline void AddGeometry( UpdateManager& manager, Render::Geometry& geometry )
 {
   // Message has ownership of Geometry while in transit from event -> update
@@ -1142,7 +1212,7 @@ inline void RemoveVertexBufferMessage( UpdateManager& manager, Render::Geometry&
 }
 
 // Custom message type for SetIndexBuffer() used to move data with Vector::Swap()
-template< typename T >
+template< typename T, typename IndexType >
 class IndexBufferMessage : public MessageBase
 {
 public:
@@ -1150,7 +1220,7 @@ public:
   /**
    * Constructor which does a Vector::Swap()
    */
-  IndexBufferMessage( T* manager, Render::Geometry* geometry, Dali::Vector<unsigned short>& indices )
+  IndexBufferMessage( T* manager, Render::Geometry* geometry, Dali::Vector<IndexType>& indices )
   : MessageBase(),
     mManager( manager ),
     mRenderGeometry( geometry )
@@ -1178,12 +1248,23 @@ private:
 
   T* mManager;
   Render::Geometry* mRenderGeometry;
-  Dali::Vector<unsigned short> mIndices;
+  Dali::Vector<IndexType> mIndices;
 };
 
 inline void SetIndexBufferMessage( UpdateManager& manager, Render::Geometry& geometry, Dali::Vector<unsigned short>& indices )
 {
-  typedef IndexBufferMessage< UpdateManager > LocalType;
+  typedef IndexBufferMessage< UpdateManager, unsigned short > LocalType;
+
+  // Reserve some memory inside the message queue
+  unsigned int* slot = manager.ReserveMessageSlot( sizeof( LocalType ) );
+
+  // Construct message in the message queue memory; note that delete should not be called on the return value
+  new (slot) LocalType( &manager, &geometry, indices );
+}
+
+inline void SetIndexBufferMessage( UpdateManager& manager, Render::Geometry& geometry, Dali::Vector<uint32_t>& indices )
+{
+  typedef IndexBufferMessage< UpdateManager, uint32_t > LocalType;
 
   // Reserve some memory inside the message queue
   unsigned int* slot = manager.ReserveMessageSlot( sizeof( LocalType ) );
@@ -1237,6 +1318,17 @@ inline void UploadTextureMessage( UpdateManager& manager, Render::Texture& textu
   new (slot) LocalType( &manager, &UpdateManager::UploadTexture, &texture, pixelData, params );
 }
 
+inline void RespecifyTextureMessage( UpdateManager& manager, Render::Texture& texture, Pixel::Format format, unsigned int width, unsigned int height )
+{
+  typedef MessageValue4< UpdateManager, Render::Texture*, Pixel::Format, unsigned int, unsigned int > LocalType;
+
+  // Reserve some memory inside the message queue
+  unsigned int* slot = manager.ReserveMessageSlot( sizeof( LocalType ) );
+
+  // Construct message in the message queue memory; note that delete should not be called on the return value
+  new (slot) LocalType( &manager, &UpdateManager::RespecifyTexture, &texture, format, width, height );
+}
+
 inline void GenerateMipmapsMessage( UpdateManager& manager, Render::Texture& texture )
 {
   typedef MessageValue1< UpdateManager, Render::Texture*  > LocalType;
@@ -33,11 +33,33 @@ namespace SceneGraph
 {
 
 class Node;
+class Renderer;
 
 typedef Dali::Vector< Node* > NodeContainer;
 typedef NodeContainer::Iterator NodeIter;
 typedef NodeContainer::ConstIterator NodeConstIter;
 
+/**
+ * Pair of node-renderer
+ */
+struct Renderable
+{
+  Renderable()
+  : mNode( 0 ),
+    mRenderer( 0 )
+  {}
+
+  Renderable( Node* node, Renderer* renderer )
+  : mNode( node ),
+    mRenderer( renderer )
+  {}
+
+  Node* mNode;
+  Renderer* mRenderer;
+};
+
+typedef Dali::Vector< Renderable > RenderableContainer;
+
 } // namespace SceneGraph
 
 } // namespace Internal
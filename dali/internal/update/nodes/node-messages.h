@@ -106,6 +106,7 @@ public:
   virtual void Process( BufferIndex updateBufferIndex )
   {
     (mProperty->*mMemberFunction)( updateBufferIndex, mParam );
+    mNode->SetSubtreeDirty();
   }
 
 private:
@@ -187,6 +188,7 @@ public:
   virtual void Process( BufferIndex updateBufferIndex )
   {
     (mProperty->*mMemberFunction)( updateBufferIndex, mParam );
+    mNode->SetSubtreeDirty();
   }
 
 private:
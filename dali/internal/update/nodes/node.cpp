@@ -100,8 +100,11 @@ Node::Node()
   mChildren(),
   mClippingDepth( 0u ),
   mDepthIndex( 0u ),
+  mSubtreeSize( 1u ),
   mRegenerateUniformMap( 0 ),
   mDirtyFlags( AllFlags ),
+  mSubtreeDirtyFrames( SubtreeDirtyFrames ),
+  mSubtreeConstrained( false ),
   mDrawMode( DrawMode::NORMAL ),
   mColorMode( DEFAULT_COLOR_MODE ),
   mClippingMode( ClippingMode::DISABLED ),
@@ -171,12 +174,14 @@ void Node::AddUniformMapping( UniformPropertyMapping* map )
 {
   PropertyOwner::AddUniformMapping( map );
   mRegenerateUniformMap = 2;
+  SetSubtreeDirty();
 }
 
 void Node::RemoveUniformMapping( const std::string& uniformName )
 {
   PropertyOwner::RemoveUniformMapping( uniformName );
   mRegenerateUniformMap = 2;
+  SetSubtreeDirty();
 }
 
 void Node::PrepareRender( BufferIndex bufferIndex )
@@ -221,6 +226,11 @@ void Node::ConnectChild( Node* childNode )
 
   // Everything should be reinherited when reconnected to scene-graph
   childNode->SetAllDirtyFlags();
+  childNode->SetSubtreeDirty();
+  if( childNode->IsSubtreeConstrained() )
+  {
+    SetSubtreeConstrained();
+  }
 
   // Add the node to the end of the child list.
   mChildren.PushBack( childNode );
@@ -270,7 +280,7 @@ void Node::AddRenderer( Renderer* renderer )
   // in the next update as world transform is not computed if node has no renderers.
   if( rendererCount == 0 )
   {
-    mDirtyFlags |= TransformFlag;
+    SetDirtyFlag( TransformFlag );
   }
 
   mRenderer.PushBack( renderer );
@@ -317,6 +327,37 @@ void Node::ResetDefaultProperties( BufferIndex updateBufferIndex )
   mDirtyFlags = NothingFlag;
 }
 
+void Node::SetSubtreeDirty()
+{
+  mSubtreeDirtyFrames = SubtreeDirtyFrames;
+
+  // An ancestor is flagged for at least as many frames as its descendants, so stop at the first one fully flagged
+  for( Node* parent = mParent; parent != NULL && parent->mSubtreeDirtyFrames != SubtreeDirtyFrames; parent = parent->mParent )
+  {
+    parent->mSubtreeDirtyFrames = SubtreeDirtyFrames;
+  }
+}
+
+void Node::SetSubtreeConstrained()
+{
+  mSubtreeConstrained = true;
+
+  for( Node* parent = mParent; parent != NULL && !parent->mSubtreeConstrained; parent = parent->mParent )
+  {
+    parent->mSubtreeConstrained = true;
+  }
+}
+
+void Node::OnPropertiesModified()
+{
+  SetSubtreeDirty();
+
+  if( !GetConstraints().Empty() )
+  {
+    SetSubtreeConstrained();
+  }
+}
+
 void Node::SetParent( Node& parentNode )
 {
   DALI_ASSERT_ALWAYS(this != &parentNode);
@@ -83,6 +83,11 @@ static const int InheritedDirtyFlags = TransformFlag | VisibleFlag | ColorFlag |
 // Flags which require the scene renderable lists to be updated
 static const int RenderableUpdateFlags = TransformFlag | SortModifierFlag | ChildDeletedFlag;
 
+/**
+ * The number of frames for which a changed node is updated, so that both of its buffers are refreshed
+ */
+static const unsigned int SubtreeDirtyFrames = 2u;
+
 /**
  * Node is the base class for all nodes in the Scene Graph.
  *
@@ -312,6 +317,7 @@ public:
   void SetDirtyFlag(NodePropertyFlags flag)
   {
     mDirtyFlags |= flag;
+    SetSubtreeDirty();
   }
 
   /**
@@ -322,6 +328,67 @@ public:
     mDirtyFlags = AllFlags;
   }
 
+  /**
+   * Flag that the node has to be updated in this frame and the next.
+   * The ancestors of the node are flagged too, so that the subtrees which are not flagged can be skipped.
+   */
+  void SetSubtreeDirty();
+
+  /**
+   * Query whether the node, or one of its descendants, has to be updated.
+   * @return True if the subtree is dirty
+   */
+  bool IsSubtreeDirty() const
+  {
+    return mSubtreeDirtyFrames != 0u;
+  }
+
+  /**
+   * Retrieve the number of frames for which the node, or one of its descendants, has to be updated.
+   * @return The number of frames
+   */
+  unsigned int GetSubtreeDirtyFrames() const
+  {
+    return mSubtreeDirtyFrames;
+  }
+
+  /**
+   * Flag that the node has constraints.
+   * The ancestors of the node are flagged too, so that the subtrees which are not flagged can be updated in parallel.
+   */
+  void SetSubtreeConstrained();
+
+  /**
+   * Query whether the node, or one of its descendants, may have constraints.
+   * @return True if the subtree is constrained
+   */
+  bool IsSubtreeConstrained() const
+  {
+    return mSubtreeConstrained;
+  }
+
+  /**
+   * Retrieve the number of nodes of the subtree which were updated, the last time the node was updated.
+   * @return The number of nodes
+   */
+  uint32_t GetSubtreeSize() const
+  {
+    return mSubtreeSize;
+  }
+
+  /**
+   * Set the state of the subtree; this is called once the node and its children have been updated.
+   * @param[in] dirtyFrames The number of frames for which the node, or one of its descendants, has to be updated, at most SubtreeDirtyFrames
+   * @param[in] size The number of nodes of the subtree which were updated
+   * @param[in] constrained Whether the node, or one of its descendants, has constraints
+   */
+  void SetSubtreeState( unsigned int dirtyFrames, uint32_t size, bool constrained )
+  {
+    mSubtreeDirtyFrames = dirtyFrames;
+    mSubtreeSize = size;
+    mSubtreeConstrained = constrained;
+  }
+
   /**
    * Query whether a node is dirty.
    * @return The dirty flags
@@ -617,6 +684,21 @@ public:
     return Vector4::ZERO;
   }
 
+  /**
+   * Retrieve the bounding sphere of the node and all of its descendants.
+   * Not const, as the transform manager merges the spheres of every node the first time one is needed after an update.
+   * @return A vector4 describing the bounding sphere. XYZ is the center and W is the radius
+   */
+  const Vector4& GetSubtreeBoundingSphere()
+  {
+    if( mTransformId != INVALID_TRANSFORM_ID )
+    {
+      return mTransformManager->GetSubtreeBoundingSphere( mTransformId );
+    }
+
+    return Vector4::ZERO;
+  }
+
   /**
    * Retrieve world matrix and size of the node
    * @param[out] The local to world matrix of the node
@@ -824,6 +906,11 @@ private:
    */
   virtual void ResetDefaultProperties( BufferIndex updateBufferIndex );
 
+  /**
+   * @copydoc Dali::Internal::SceneGraph::PropertyOwner::OnPropertiesModified()
+   */
+  virtual void OnPropertiesModified();
+
   /**
    * Recursive helper to disconnect a Node and its children.
    * Disconnected Nodes have no parent or children.
@@ -869,10 +956,13 @@ protected:
   uint32_t                           mClippingDepth;          ///< The number of clipping nodes deep this node is
 
   uint32_t                           mDepthIndex;             ///< Depth index of the node
+  uint32_t                           mSubtreeSize;            ///< The number of nodes of the subtree updated, the last time the node was updated
 
   // flags, compressed to bitfield
   unsigned int                       mRegenerateUniformMap:2; ///< Indicate if the uniform map has to be regenerated this frame
   int                                mDirtyFlags:8;           ///< A composite set of flags for each of the Node properties
+  unsigned int                       mSubtreeDirtyFrames:2;   ///< The number of frames for which the node or one of its descendants has to be updated
+  bool                               mSubtreeConstrained:1;   ///< True if the node or one of its descendants may have constraints
   DrawMode::Type                     mDrawMode:2;             ///< How the Node and its children should be drawn
   ColorMode                          mColorMode:2;            ///< Determines whether mWorldColor is inherited, 2 bits is enough
   ClippingMode::Type                 mClippingMode:2;         ///< The clipping mode of this node
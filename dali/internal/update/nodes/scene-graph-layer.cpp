@@ -45,14 +45,11 @@ Layer::Layer()
   mBehavior( Dali::Layer::LAYER_2D ),
   mIsClipping( false ),
   mDepthTestDisabled( true ),
-  mIsDefaultSortFunction( true )
+  mIsDefaultSortFunction( true ),
+  mHierarchicalCulling( false )
 {
   // set a flag the node to say this is a layer
   mIsLayer = true;
-
-  // layer starts off dirty
-  mAllChildTransformsClean[ 0 ] = false;
-  mAllChildTransformsClean[ 1 ] = false;
 }
 
 Layer::~Layer()
@@ -73,9 +70,6 @@ void Layer::SetSortFunction( Dali::Layer::SortFunctionType function )
       mIsDefaultSortFunction = true;
     }
 
-    // changing the sort function makes the layer dirty
-    mAllChildTransformsClean[ 0 ] = false;
-    mAllChildTransformsClean[ 1 ] = false;
     mSortFunction = function;
   }
 }
@@ -105,6 +99,11 @@ bool Layer::IsDepthTestDisabled() const
   return mDepthTestDisabled;
 }
 
+void Layer::SetHierarchicalCulling( bool enabled )
+{
+  mHierarchicalCulling = enabled;
+}
+
 void Layer::ClearRenderables()
 {
   colorRenderables.Clear();
@@ -39,27 +39,6 @@ namespace SceneGraph
 {
 class Camera;
 
-/**
- * Pair of node-renderer
- */
-struct Renderable
-{
-  Renderable()
-  : mNode( 0 ),
-    mRenderer( 0 )
-  {}
-
-  Renderable( Node* node, Renderer* renderer )
-  : mNode( node ),
-    mRenderer( renderer )
-  {}
-
-  Node* mNode;
-  Renderer* mRenderer;
-};
-
-typedef Dali::Vector< Renderable > RenderableContainer;
-
 /**
  * Layers have a "depth" relative to all other layers in the scene-graph.
  * Non-layer child nodes are considered part of the layer.
@@ -163,26 +142,29 @@ public:
   bool IsDepthTestDisabled() const;
 
   /**
-   * Enables the reuse of the model view matrices of all renderers for this layer
-   * @param[in] updateBufferIndex The current update buffer index.
-   * @param value to set
+   * Sets whether the renderers of the layer are culled a subtree at a time.
+   * @param[in] enabled True to enable hierarchical culling
    */
-  void SetReuseRenderers( BufferIndex updateBufferIndex, bool value )
+  void SetHierarchicalCulling( bool enabled );
+
+  /**
+   * Query whether the renderers of the layer are culled a subtree at a time.
+   * @return True if hierarchical culling is enabled
+   */
+  bool IsHierarchicalCulling() const
   {
-    mAllChildTransformsClean[ updateBufferIndex ] = value;
+    return mHierarchicalCulling;
   }
 
   /**
-   * Checks if it is ok to reuse renderers. Renderers can be reused if ModelView transform for all the renderers
-   * has not changed from previous use.
+   * Checks if it is ok to reuse render items. The items of the renderers whose node has not moved can be reused
+   * if the camera used to render the layer has not changed since the items were calculated.
    * @param[in] camera A pointer to the camera that we want to use to render the list.
-   * @return True if all children transforms have been clean for two consecutive frames and the camera we are going
-   * to use is the same than the one used before ( Otherwise View transform will be different )
-   *
+   * @return True if the camera we are going to use is the same than the one used before ( Otherwise View transform will be different )
    */
   bool CanReuseRenderers( Camera* camera )
   {
-    bool bReturn( mAllChildTransformsClean[ 0 ] && mAllChildTransformsClean[ 1 ] && camera == mLastCamera );
+    bool bReturn( camera == mLastCamera );
     mLastCamera = camera;
 
     return bReturn;
@@ -234,12 +216,10 @@ private:
 
   Dali::Layer::Behavior mBehavior;    ///< The behavior of the layer
 
-  bool mAllChildTransformsClean[ 2 ]; ///< True if all child nodes transforms are clean,
-                                      ///  double buffered as we need two clean frames before we can reuse N-1 for N+1
-                                      ///  this allows us to cache render items when layer is "static"
   bool mIsClipping:1;                 ///< True when clipping is enabled
   bool mDepthTestDisabled:1;          ///< Whether depth test is disabled.
   bool mIsDefaultSortFunction:1;      ///< whether the default depth sort function is used
+  bool mHierarchicalCulling:1;        ///< Whether the renderers are culled a subtree at a time
 
 };
 
@@ -330,6 +310,22 @@ inline void SetDepthTestDisabledMessage( EventThreadServices& eventThreadService
   new (slot) LocalType( &layer, &Layer::SetDepthTestDisabled, disable );
 }
 
+/**
+ * Create a message for enabling/disabling hierarchical culling.
+ * @param[in] layer The layer
+ * @param[in] enabled True if hierarchical culling is enabled
+ */
+inline void SetHierarchicalCullingMessage( EventThreadServices& eventThreadServices, const Layer& layer, bool enabled )
+{
+  typedef MessageValue1< Layer, bool > LocalType;
+
+  // Reserve some memory inside the message queue
+  unsigned int* slot = eventThreadServices.ReserveMessageSlot( sizeof( LocalType ) );
+
+  // Construct message in the message queue memory; note that delete should not be called on the return value
+  new (slot) LocalType( &layer, &Layer::SetHierarchicalCulling, enabled );
+}
+
 } // namespace SceneGraph
 
 // Template specialisation for OwnerPointer<Layer>, because delete is protected
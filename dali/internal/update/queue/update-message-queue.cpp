@@ -24,6 +24,7 @@
 #include <dali/integration-api/render-controller.h>
 #include <dali/internal/common/message.h>
 #include <dali/internal/common/message-buffer.h>
+#include <dali/internal/common/trace-impl.h>
 #include <dali/internal/render/common/performance-monitor.h>
 
 using std::vector;
@@ -243,6 +244,8 @@ bool MessageQueue::FlushQueue()
 
 void MessageQueue::ProcessMessages( BufferIndex updateBufferIndex )
 {
+  DALI_TRACE_SCOPE( PROCESS_MESSAGES );
+
   PERF_MONITOR_START(PerformanceMonitor::PROCESS_MESSAGES);
 
   // queueMutex must be locked whilst accessing queue
@@ -20,6 +20,11 @@
 
 // EXTERNAL INCLUDES
 #include <stdint.h>
+#include <cstring>
+
+#if defined( __SSE2__ ) && !defined( __ARM_NEON__ )
+#include <emmintrin.h>
+#endif
 
 // INTERNAL INCLUDES
 #include <dali/integration-api/debug.h>
@@ -31,6 +36,17 @@ namespace // unnamed namespace
 {
 const unsigned int UPDATE_COUNT        = 2u;  // Update projection or view matrix this many frames after a change
 const unsigned int COPY_PREVIOUS_MATRIX = 1u; // Copy view or projection matrix from previous frame
+
+/**
+ * Checks whether a double buffered matrix has a different value than in the previous frame
+ * @param[in] matrix The matrix
+ * @param[in] updateBufferIndex The current update buffer index
+ * @return True if the value has changed
+ */
+bool MatrixChanged( const Dali::Internal::SceneGraph::InheritedMatrix& matrix, Dali::Internal::BufferIndex updateBufferIndex )
+{
+  return memcmp( matrix[ updateBufferIndex ].AsFloat(), matrix[ updateBufferIndex ? 0 : 1 ].AsFloat(), sizeof( float ) * 16u ) != 0;
+}
 }
 
 namespace Dali
@@ -154,6 +170,7 @@ const Vector3 Camera::DEFAULT_TARGET_POSITION( 0.0f, 0.0f, 0.0f );
 Camera::Camera()
 : mUpdateViewFlag( UPDATE_COUNT ),
   mUpdateProjectionFlag( UPDATE_COUNT ),
+  mMatricesChangedFlag( UPDATE_COUNT ),
   mType( DEFAULT_TYPE ),
   mProjectionMode( DEFAULT_MODE ),
   mInvertYAxis( DEFAULT_INVERT_Y_AXIS ),
@@ -321,11 +338,23 @@ void Camera::Update( BufferIndex updateBufferIndex, const Node& owningNode )
     mInverseViewProjection[updateBufferIndex] = mInverseViewProjection[updateBufferIndex ? 0 : 1];
     mFrustum[ updateBufferIndex ] = mFrustum[ updateBufferIndex ? 0 : 1 ];
   }
+
+  // A recalculated matrix often has the same value, e.g. when an unrelated part of the scene moves.
+  // Only an actual change stops the render items of the previous frames being reused
+  if( ( viewUpdateCount == UPDATE_COUNT && MatrixChanged( mViewMatrix, updateBufferIndex ) ) ||
+      ( projectionUpdateCount == UPDATE_COUNT && MatrixChanged( mProjectionMatrix, updateBufferIndex ) ) )
+  {
+    mMatricesChangedFlag = UPDATE_COUNT;
+  }
+  else if( 0u != mMatricesChangedFlag )
+  {
+    --mMatricesChangedFlag;
+  }
 }
 
 bool Camera::ViewMatrixUpdated()
 {
-  return 0u != mUpdateViewFlag;
+  return 0u != mMatricesChangedFlag;
 }
 
 unsigned int Camera::UpdateViewMatrix( BufferIndex updateBufferIndex, const Node& owningNode )
@@ -452,6 +481,57 @@ bool Camera::CheckSphereInFrustum( BufferIndex bufferIndex, const Vector3& origi
   return true;
 }
 
+void Camera::CheckSpheresInFrustum( BufferIndex bufferIndex, const Vector4* spheres, unsigned int count, bool* inside )
+{
+  unsigned int index = 0u;
+
+#if defined( __SSE2__ ) && !defined( __ARM_NEON__ )
+
+  // Four spheres are checked against each plane at once, one per lane
+  const FrustumPlanes& planes = mFrustum[ bufferIndex ];
+  __m128 normalX[ 6 ], normalY[ 6 ], normalZ[ 6 ], distance[ 6 ];
+  for ( uint32_t i = 0; i < 6; ++i )
+  {
+    normalX[ i ] = _mm_set1_ps( planes.mPlanes[ i ].mNormal.x );
+    normalY[ i ] = _mm_set1_ps( planes.mPlanes[ i ].mNormal.y );
+    normalZ[ i ] = _mm_set1_ps( planes.mPlanes[ i ].mNormal.z );
+    distance[ i ] = _mm_set1_ps( planes.mPlanes[ i ].mDistance );
+  }
+
+  for ( ; index + 4u <= count; index += 4u )
+  {
+    __m128 x = _mm_loadu_ps( spheres[ index ].AsFloat() );
+    __m128 y = _mm_loadu_ps( spheres[ index + 1u ].AsFloat() );
+    __m128 z = _mm_loadu_ps( spheres[ index + 2u ].AsFloat() );
+    __m128 radius = _mm_loadu_ps( spheres[ index + 3u ].AsFloat() );
+    _MM_TRANSPOSE4_PS( x, y, z, radius );
+    const __m128 negativeRadius = _mm_sub_ps( _mm_setzero_ps(), radius );
+
+    // The operations are done in the same order as in CheckSphereInFrustum() so the results are identical
+    __m128 outside = _mm_setzero_ps();
+    for ( uint32_t i = 0; i < 6; ++i )
+    {
+      __m128 dot = _mm_add_ps( _mm_mul_ps( normalX[ i ], x ), _mm_mul_ps( normalY[ i ], y ) );
+      dot = _mm_add_ps( dot, _mm_mul_ps( normalZ[ i ], z ) );
+      outside = _mm_or_ps( outside, _mm_cmplt_ps( _mm_add_ps( distance[ i ], dot ), negativeRadius ) );
+    }
+
+    const int outsideMask = _mm_movemask_ps( outside );
+    inside[ index ]      = ( outsideMask & 1 ) == 0;
+    inside[ index + 1u ] = ( outsideMask & 2 ) == 0;
+    inside[ index + 2u ] = ( outsideMask & 4 ) == 0;
+    inside[ index + 3u ] = ( outsideMask & 8 ) == 0;
+  }
+
+#endif // __SSE2__
+
+  for ( ; index < count; ++index )
+  {
+    const Vector4& sphere = spheres[ index ];
+    inside[ index ] = CheckSphereInFrustum( bufferIndex, Vector3( sphere ), sphere.w );
+  }
+}
+
 bool Camera::CheckAABBInFrustum( BufferIndex bufferIndex, const Vector3& origin, const Vector3& halfExtents )
 {
   const FrustumPlanes& planes = mFrustum[ bufferIndex ];
@@ -176,6 +176,17 @@ public:
    */
   bool CheckSphereInFrustum( BufferIndex bufferIndex, const Vector3& origin, float radius );
 
+  /**
+   * @brief Check to see which of a batch of spheres lie within the view frustum.
+   *
+   * Gives the same results as CheckSphereInFrustum() for each sphere, but several spheres are checked at once.
+   * @param bufferIndex The buffer to read from.
+   * @param spheres The spheres to check. XYZ is the world position of the center and W is the radius in world scale.
+   * @param count The number of spheres.
+   * @param[out] inside An array of count results; each is false if the sphere lies outside of the frustum.
+   */
+  void CheckSpheresInFrustum( BufferIndex bufferIndex, const Vector4* spheres, unsigned int count, bool* inside );
+
   /**
    * @brief Check to see if a bounding box lies within the view frustum.
    *
@@ -224,7 +235,7 @@ public:
   void Update( BufferIndex updateBufferIndex, const Node& owningNode );
 
   /**
-   * @return true if the view matrix of camera is updated this or the previous frame
+   * @return true if the view or projection matrix of camera has changed this or the previous frame
    */
   bool ViewMatrixUpdated();
 
@@ -268,6 +279,7 @@ private:
 
   unsigned int                  mUpdateViewFlag;       ///< This is non-zero if the view matrix requires an update
   unsigned int                  mUpdateProjectionFlag; ///< This is non-zero if the projection matrix requires an update
+  unsigned int                  mMatricesChangedFlag;  ///< This is non-zero if the view or projection matrix has changed this or the previous frame
 
 public:  // PROPERTIES
   Dali::Camera::Type            mType;                 // Non-animatable
@@ -336,7 +336,7 @@ public:
   void PrepareRenderInstruction( RenderInstruction& instruction, BufferIndex updateBufferIndex );
 
   /**
-   * @return true if the view matrix has been updated during this or last frame
+   * @return true if the view or projection matrix has changed during this or last frame
    */
   bool ViewMatrixUpdated();
 
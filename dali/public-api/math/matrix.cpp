@@ -23,6 +23,14 @@
 #include <cstring> // for memcpy
 #include <ostream>
 
+#if defined( __SSE2__ ) && !defined( __ARM_NEON__ )
+#include <emmintrin.h>
+#endif
+
+#if defined( __AVX__ ) && !defined( __ARM_NEON__ )
+#include <immintrin.h>
+#endif
+
 // INTERNAL INCLUDES
 #include <dali/public-api/common/dali-common.h>
 #include <dali/public-api/math/vector3.h>
@@ -77,6 +85,49 @@ void Convert( float*& m, const Dali::Quaternion& rotation )
   m[14]= 0.0f;
   m[15]= 1.0f;
 }
+
+#if defined( __SSE2__ ) && !defined( __ARM_NEON__ )
+
+/**
+ * Helper to broadcast one element of a column to all four lanes
+ */
+#define SSE_SPLAT( column, index ) _mm_shuffle_ps( column, column, _MM_SHUFFLE( index, index, index, index ) )
+
+/**
+ * Helper to pick lanes of a quaternion, the first argument ends up in lane 0
+ */
+#define SSE_SWIZZLE( vector, lane0, lane1, lane2 ) _mm_shuffle_ps( vector, vector, _MM_SHUFFLE( 3, lane2, lane1, lane0 ) )
+
+/**
+ * Mask with all the bits set in the given lanes
+ */
+inline __m128 LaneMask( int lane0, int lane1, int lane2, int lane3 )
+{
+  return _mm_castsi128_ps( _mm_setr_epi32( lane0, lane1, lane2, lane3 ) );
+}
+
+/**
+ * Calculates one column of the scaled rotation matrix of a quaternion, i.e. for the first column
+ * scale * ( 1 - 2( yy + zz ), 2( xy + wz ), 2( xz - wy ), 0 ).
+ * The operations are done in the same order as the scalar code so the results are identical.
+ * @param[in] products The first products of each term, e.g. ( yy, xy, xz )
+ * @param[in] otherProducts The second products of each term, e.g. ( zz, wz, wy )
+ * @param[in] negate Sign mask for the terms which are subtracted
+ * @param[in] diagonal Mask of the lane which is on the diagonal
+ * @param[in] scale The scale of this column
+ */
+inline __m128 RotationColumn( __m128 products, __m128 otherProducts, __m128 negate, __m128 diagonal, float scale )
+{
+  const __m128 sum = _mm_add_ps( products, _mm_xor_ps( otherProducts, negate ) );
+  const __m128 doubled = _mm_mul_ps( _mm_set1_ps( 2.0f ), sum );
+  const __m128 fromOne = _mm_sub_ps( _mm_set1_ps( 1.0f ), doubled );
+  const __m128 column = _mm_or_ps( _mm_and_ps( diagonal, fromOne ), _mm_andnot_ps( diagonal, doubled ) );
+
+  // Clear the w lane of the column
+  return _mm_and_ps( _mm_mul_ps( _mm_set1_ps( scale ), column ), LaneMask( -1, -1, -1, 0 ) );
+}
+
+#endif // __SSE2__
 }
 
 namespace Dali
@@ -274,6 +325,46 @@ void Matrix::Multiply( Matrix& result, const Matrix& lhs, const Matrix& rhs )
 
 #ifndef  __ARM_NEON__
 
+#if defined( __AVX__ )
+
+  // Two columns of the result per iteration, each 128 bit half of a register holds one column.
+  // All of rhs is loaded before anything is stored, so result may be either of the inputs.
+  const __m256 row0 = _mm256_broadcast_ps( reinterpret_cast< const __m128* >( rhsPtr ) );
+  const __m256 row1 = _mm256_broadcast_ps( reinterpret_cast< const __m128* >( rhsPtr + ROW1_OFFSET ) );
+  const __m256 row2 = _mm256_broadcast_ps( reinterpret_cast< const __m128* >( rhsPtr + ROW2_OFFSET ) );
+  const __m256 row3 = _mm256_broadcast_ps( reinterpret_cast< const __m128* >( rhsPtr + ROW3_OFFSET ) );
+
+  for( int i=0; i < 16; i += 8 )
+  {
+    const __m256 columns = _mm256_loadu_ps( lhsPtr + i );
+    __m256 value = _mm256_mul_ps( _mm256_permute_ps( columns, 0x00 ), row0 );
+    value = _mm256_add_ps( value, _mm256_mul_ps( _mm256_permute_ps( columns, 0x55 ), row1 ) );
+    value = _mm256_add_ps( value, _mm256_mul_ps( _mm256_permute_ps( columns, 0xAA ), row2 ) );
+    value = _mm256_add_ps( value, _mm256_mul_ps( _mm256_permute_ps( columns, 0xFF ), row3 ) );
+    _mm256_storeu_ps( temp + i, value );
+  }
+
+#elif defined( __SSE2__ )
+
+  // Same order of operations as the scalar code below, so the results are identical.
+  // All of rhs is loaded before anything is stored, so result may be either of the inputs.
+  const __m128 row0 = _mm_loadu_ps( rhsPtr );
+  const __m128 row1 = _mm_loadu_ps( rhsPtr + ROW1_OFFSET );
+  const __m128 row2 = _mm_loadu_ps( rhsPtr + ROW2_OFFSET );
+  const __m128 row3 = _mm_loadu_ps( rhsPtr + ROW3_OFFSET );
+
+  for( int i=0; i < 16; i += 4 )
+  {
+    const __m128 column = _mm_loadu_ps( lhsPtr + i );
+    __m128 value = _mm_mul_ps( SSE_SPLAT( column, 0 ), row0 );
+    value = _mm_add_ps( value, _mm_mul_ps( SSE_SPLAT( column, 1 ), row1 ) );
+    value = _mm_add_ps( value, _mm_mul_ps( SSE_SPLAT( column, 2 ), row2 ) );
+    value = _mm_add_ps( value, _mm_mul_ps( SSE_SPLAT( column, 3 ), row3 ) );
+    _mm_storeu_ps( temp + i, value );
+  }
+
+#else
+
   for( int i=0; i < 4; i++ )
   {
     // i<<2 gives the first vector / column
@@ -306,6 +397,8 @@ void Matrix::Multiply( Matrix& result, const Matrix& lhs, const Matrix& rhs )
                  (value3 * rhsPtr[15]);
   }
 
+#endif
+
 #else
 
   // 64 32bit registers,
@@ -360,6 +453,29 @@ void Matrix::Multiply( Matrix& result, const Matrix& lhs, const Quaternion& rhs
 
 #ifndef  __ARM_NEON__
 
+#if defined( __SSE2__ )
+
+  // Same order of operations as the scalar code below, so the results are identical
+  const __m128 row0 = _mm_loadu_ps( rhsPtr );
+  const __m128 row1 = _mm_loadu_ps( rhsPtr + ROW1_OFFSET );
+  const __m128 row2 = _mm_loadu_ps( rhsPtr + ROW2_OFFSET );
+  const __m128 xyzMask = LaneMask( -1, -1, -1, 0 );
+  const __m128 wMask = LaneMask( 0, 0, 0, -1 );
+
+  for( int i=0; i < 16; i += 4 )
+  {
+    const __m128 column = _mm_loadu_ps( lhsPtr + i );
+    __m128 value = _mm_mul_ps( SSE_SPLAT( column, 0 ), row0 );
+    value = _mm_add_ps( value, _mm_mul_ps( SSE_SPLAT( column, 1 ), row1 ) );
+    value = _mm_add_ps( value, _mm_mul_ps( SSE_SPLAT( column, 2 ), row2 ) );
+
+    // x, y & z get 0.0f added, w becomes 0.0f + lhsPtr[i+3]
+    value = _mm_add_ps( _mm_and_ps( value, xyzMask ), _mm_and_ps( column, wMask ) );
+    _mm_storeu_ps( temp + i, value );
+  }
+
+#else
+
   for( int i=0; i < 4; i++ )
   {
     // i<<2 gives the first vector / column
@@ -392,6 +508,8 @@ void Matrix::Multiply( Matrix& result, const Matrix& lhs, const Quaternion& rhs
                  (value3); // rhsPtr[15] is 1.0f
   }
 
+#endif
+
 #else
 
   // 64 32bit registers,
@@ -433,11 +551,25 @@ Vector4 Matrix::operator*(const Vector4& rhs) const
 
 #ifndef  __ARM_NEON__
 
+#if defined( __SSE2__ )
+
+  // Same order of operations as the scalar code below, so the results are identical
+  const __m128 vector = _mm_loadu_ps( rhs.AsFloat() );
+  __m128 value = _mm_mul_ps( SSE_SPLAT( vector, 0 ), _mm_loadu_ps( mMatrix ) );
+  value = _mm_add_ps( value, _mm_mul_ps( SSE_SPLAT( vector, 1 ), _mm_loadu_ps( mMatrix + ROW1_OFFSET ) ) );
+  value = _mm_add_ps( value, _mm_mul_ps( SSE_SPLAT( vector, 2 ), _mm_loadu_ps( mMatrix + ROW2_OFFSET ) ) );
+  value = _mm_add_ps( value, _mm_mul_ps( SSE_SPLAT( vector, 3 ), _mm_loadu_ps( mMatrix + ROW3_OFFSET ) ) );
+  _mm_storeu_ps( temp.AsFloat(), value );
+
+#else
+
   temp.x = rhs.x * mMatrix[0] + rhs.y * mMatrix[4] + rhs.z * mMatrix[8]  +  rhs.w * mMatrix[12];
   temp.y = rhs.x * mMatrix[1] + rhs.y * mMatrix[5] + rhs.z * mMatrix[9]  +  rhs.w * mMatrix[13];
   temp.z = rhs.x * mMatrix[2] + rhs.y * mMatrix[6] + rhs.z * mMatrix[10] +  rhs.w * mMatrix[14];
   temp.w = rhs.x * mMatrix[3] + rhs.y * mMatrix[7] + rhs.z * mMatrix[11] +  rhs.w * mMatrix[15];
 
+#endif
+
 #else
 
   // 64 32bit registers,
@@ -573,6 +705,35 @@ void Matrix::SetTransformComponents(const Vector3&    scale,
     MATH_INCREASE_COUNTER(PerformanceMonitor::MATRIX_MULTIPLYS);
     MATH_INCREASE_BY(PerformanceMonitor::FLOAT_POINT_MULTIPLY,27); // 27 = 9+18
 
+#if defined( __SSE2__ ) && !defined( __ARM_NEON__ )
+
+    const __m128 quaternion = _mm_loadu_ps( rotation.mVector.AsFloat() ); // x, y, z, w
+    const __m128 signBit = _mm_set1_ps( -0.0f );
+
+    // ( yy + zz ), ( xy + wz ), ( xz - wy )
+    const __m128 column0 = RotationColumn( _mm_mul_ps( SSE_SWIZZLE( quaternion, 1, 0, 0 ), SSE_SWIZZLE( quaternion, 1, 1, 2 ) ),
+                                           _mm_mul_ps( SSE_SWIZZLE( quaternion, 2, 3, 3 ), SSE_SWIZZLE( quaternion, 2, 2, 1 ) ),
+                                           _mm_and_ps( signBit, LaneMask( 0, 0, -1, 0 ) ),
+                                           LaneMask( -1, 0, 0, 0 ), scale.x );
+
+    // ( xy - wz ), ( xx + zz ), ( yz + wx )
+    const __m128 column1 = RotationColumn( _mm_mul_ps( SSE_SWIZZLE( quaternion, 0, 0, 1 ), SSE_SWIZZLE( quaternion, 1, 0, 2 ) ),
+                                           _mm_mul_ps( SSE_SWIZZLE( quaternion, 3, 2, 3 ), SSE_SWIZZLE( quaternion, 2, 2, 0 ) ),
+                                           _mm_and_ps( signBit, LaneMask( -1, 0, 0, 0 ) ),
+                                           LaneMask( 0, -1, 0, 0 ), scale.y );
+
+    // ( xz + wy ), ( yz - wx ), ( xx + yy )
+    const __m128 column2 = RotationColumn( _mm_mul_ps( SSE_SWIZZLE( quaternion, 0, 1, 0 ), SSE_SWIZZLE( quaternion, 2, 2, 0 ) ),
+                                           _mm_mul_ps( SSE_SWIZZLE( quaternion, 3, 3, 1 ), SSE_SWIZZLE( quaternion, 1, 0, 1 ) ),
+                                           _mm_and_ps( signBit, LaneMask( 0, -1, 0, 0 ) ),
+                                           LaneMask( 0, 0, -1, 0 ), scale.z );
+
+    _mm_storeu_ps( mMatrix, column0 );
+    _mm_storeu_ps( mMatrix + ROW1_OFFSET, column1 );
+    _mm_storeu_ps( mMatrix + ROW2_OFFSET, column2 );
+
+#else
+
     const float xx = rotation.mVector.x * rotation.mVector.x;
     const float yy = rotation.mVector.y * rotation.mVector.y;
     const float zz = rotation.mVector.z * rotation.mVector.z;
@@ -597,6 +758,8 @@ void Matrix::SetTransformComponents(const Vector3&    scale,
     mMatrix[9] = (scale.z * (       2.0f * (yz - wx)));
     mMatrix[10]= (scale.z * (1.0f - 2.0f * (xx + yy)));
     mMatrix[11]= 0.0f;
+
+#endif
   }
   // apply translation
   mMatrix[12] = translation.x;
@@ -22,6 +22,7 @@
 #include <dali/integration-api/debug.h>
 
 // INTERNAL INCLUDES
+#include <dali/public-api/common/dali-vector.h>
 #include <dali/public-api/common/vector-wrapper.h>
 
 namespace Dali
@@ -34,6 +35,183 @@ typedef std::vector< StringValuePair > StringValueContainer;
 typedef std::pair< Property::Index, Property::Value > IndexValuePair;
 typedef std::vector< IndexValuePair > IndexValueContainer;
 
+const std::size_t HASH_INDEX_THRESHOLD = 16u; ///< Containers with fewer entries are searched linearly
+
+/*
+ * djb2 (http://www.cse.yorku.ca/~oz/hash.html), as used by CalculateHash()
+ */
+inline std::size_t HashKey( const char* key )
+{
+  std::size_t hash = 5381;
+  while( int c = *key++ )
+  {
+    hash = hash * 33 + c;
+  }
+  return hash;
+}
+
+inline std::size_t HashKey( const std::string& key )
+{
+  return HashKey( key.c_str() );
+}
+
+inline std::size_t HashKey( Property::Index key )
+{
+  return static_cast< std::size_t >( key ) * 2654435761u; // Knuth's multiplicative hash
+}
+
+inline bool KeyEquals( const std::string& key, const char* otherKey )
+{
+  return key == otherKey;
+}
+
+inline bool KeyEquals( const std::string& key, const std::string& otherKey )
+{
+  return key == otherKey;
+}
+
+inline bool KeyEquals( Property::Index key, Property::Index otherKey )
+{
+  return key == otherKey;
+}
+
+/**
+ * Hash table of the positions of the keys in a container, for finding keys in large maps.
+ *
+ * The table is updated whenever entries are appended, once the container reaches HASH_INDEX_THRESHOLD entries,
+ * so searching never modifies it and concurrent const lookups are safe. Entries are only ever appended to a
+ * container, so an update just adds the new entries; only the first entry with a key is indexed, as that is
+ * the one a linear search would find. Containers that are not fully indexed are searched linearly.
+ * The key of every entry found through the table is compared with the searched key, so an entry whose key
+ * was changed after it was indexed is never returned for its old key.
+ * The table uses open addressing with linear probing; each slot holds a position plus one, or zero when empty.
+ */
+class HashIndex
+{
+public:
+
+  HashIndex()
+  : mSlots(),
+    mIndexedCount( 0u )
+  {
+  }
+
+  /**
+   * Forget the indexed entries, e.g. after the keys of the container have changed
+   */
+  void Reset()
+  {
+    mSlots.Clear();
+    mIndexedCount = 0u;
+  }
+
+  /**
+   * Find the first entry with a key.
+   * @param[in] container The container to search
+   * @param[in] key The key to find
+   * @return The position of the entry, or the size of the container if the key is not found
+   */
+  template< typename Container, typename Key >
+  std::size_t Find( const Container& container, const Key& key ) const
+  {
+    const std::size_t count = container.size();
+    if( !IsIndexed( container ) )
+    {
+      return FindLinear( container, key );
+    }
+
+    const std::size_t mask = mSlots.Count() - 1u;
+    for( std::size_t slot = HashKey( key ) & mask; mSlots[slot] != 0u; slot = ( slot + 1u ) & mask )
+    {
+      const std::size_t position = mSlots[slot] - 1u;
+      if( KeyEquals( container[position].first, key ) )
+      {
+        return position;
+      }
+    }
+    return count;
+  }
+
+  /**
+   * Whether every entry of a container is in the table
+   * @param[in] container The container
+   * @return True if the container is searched through the table
+   */
+  template< typename Container >
+  bool IsIndexed( const Container& container ) const
+  {
+    return !mSlots.Empty() && ( mIndexedCount == container.size() );
+  }
+
+  /**
+   * Find the first entry with a key without using the table.
+   * @param[in] container The container to search
+   * @param[in] key The key to find
+   * @return The position of the entry, or the size of the container if the key is not found
+   */
+  template< typename Container, typename Key >
+  static std::size_t FindLinear( const Container& container, const Key& key )
+  {
+    const std::size_t count = container.size();
+    for( std::size_t position = 0u; position < count; ++position )
+    {
+      if( KeyEquals( container[position].first, key ) )
+      {
+        return position;
+      }
+    }
+    return count;
+  }
+
+  /**
+   * Index the entries appended since the last update; rebuilds the table when it is more than half full.
+   * @param[in] container The container to index
+   */
+  template< typename Container >
+  void Update( const Container& container )
+  {
+    const std::size_t count = container.size();
+    if( count < HASH_INDEX_THRESHOLD )
+    {
+      return;
+    }
+
+    if( count * 2u > mSlots.Count() )
+    {
+      std::size_t capacity = HASH_INDEX_THRESHOLD * 2u;
+      while( capacity < count * 2u )
+      {
+        capacity *= 2u;
+      }
+      mSlots.Clear();
+      mSlots.Resize( capacity, 0u );
+      mIndexedCount = 0u;
+    }
+
+    const std::size_t mask = mSlots.Count() - 1u;
+    for( ; mIndexedCount < count; ++mIndexedCount )
+    {
+      std::size_t slot = HashKey( container[mIndexedCount].first ) & mask;
+      for( ; mSlots[slot] != 0u; slot = ( slot + 1u ) & mask )
+      {
+        if( KeyEquals( container[ mSlots[slot] - 1u ].first, container[mIndexedCount].first ) )
+        {
+          break; // Duplicate key, the first entry stays indexed
+        }
+      }
+      if( mSlots[slot] == 0u )
+      {
+        mSlots[slot] = static_cast< unsigned int >( mIndexedCount + 1u );
+      }
+    }
+  }
+
+private:
+
+  Dali::Vector< unsigned int > mSlots;  ///< Positions plus one, or zero for an empty slot
+  std::size_t mIndexedCount;            ///< Number of entries of the container in the table
+};
+
 }; // unnamed namespace
 
 
@@ -41,6 +219,34 @@ struct Property::Map::Impl
 {
   StringValueContainer mStringValueContainer;
   IndexValueContainer mIndexValueContainer;
+  HashIndex mStringIndex;  ///< Index of mStringValueContainer, updated when entries are added
+  HashIndex mIndexIndex;   ///< Index of mIndexValueContainer, updated when entries are added
+
+  /**
+   * Index the entries added to the containers since the last update
+   */
+  void UpdateIndices()
+  {
+    mStringIndex.Update( mStringValueContainer );
+    mIndexIndex.Update( mIndexValueContainer );
+  }
+
+  Property::Value* FindString( const char* key )
+  {
+    std::size_t position = mStringIndex.Find( mStringValueContainer, key );
+    if( ( position == mStringValueContainer.size() ) && mStringIndex.IsIndexed( mStringValueContainer ) )
+    {
+      // The deprecated GetPair() can change a string key after it was indexed, so check the keys before reporting a miss
+      position = HashIndex::FindLinear( mStringValueContainer, key );
+    }
+    return ( position < mStringValueContainer.size() ) ? &mStringValueContainer[position].second : NULL;
+  }
+
+  Property::Value* FindIndex( Property::Index key )
+  {
+    const std::size_t position = mIndexIndex.Find( mIndexValueContainer, key );
+    return ( position < mIndexValueContainer.size() ) ? &mIndexValueContainer[position].second : NULL;
+  }
 };
 
 Property::Map::Map()
@@ -53,6 +259,7 @@ Property::Map::Map( const Property::Map& other )
 {
   mImpl->mStringValueContainer = other.mImpl->mStringValueContainer;
   mImpl->mIndexValueContainer = other.mImpl->mIndexValueContainer;
+  mImpl->UpdateIndices();
 }
 
 Property::Map::~Map()
@@ -73,18 +280,41 @@ bool Property::Map::Empty() const
 void Property::Map::Insert( const char* key, const Value& value )
 {
   mImpl->mStringValueContainer.push_back( std::make_pair( key, value ) );
+  mImpl->mStringIndex.Update( mImpl->mStringValueContainer );
 }
 
 void Property::Map::Insert( const std::string& key, const Value& value )
 {
   mImpl->mStringValueContainer.push_back( std::make_pair( key, value ) );
+  mImpl->mStringIndex.Update( mImpl->mStringValueContainer );
 }
 
 void Property::Map::Insert( Property::Index key, const Value& value )
 {
   mImpl->mIndexValueContainer.push_back( std::make_pair( key, value ) );
+  mImpl->mIndexIndex.Update( mImpl->mIndexValueContainer );
+}
+
+#ifdef _CPP11
+void Property::Map::Insert( const char* key, Value&& value )
+{
+  mImpl->mStringValueContainer.emplace_back( key, std::move( value ) );
+  mImpl->mStringIndex.Update( mImpl->mStringValueContainer );
 }
 
+void Property::Map::Insert( const std::string& key, Value&& value )
+{
+  mImpl->mStringValueContainer.emplace_back( key, std::move( value ) );
+  mImpl->mStringIndex.Update( mImpl->mStringValueContainer );
+}
+
+void Property::Map::Insert( Property::Index key, Value&& value )
+{
+  mImpl->mIndexValueContainer.emplace_back( key, std::move( value ) );
+  mImpl->mIndexIndex.Update( mImpl->mIndexValueContainer );
+}
+#endif
+
 Property::Value& Property::Map::GetValue( SizeType position ) const
 {
   SizeType numStringKeys = mImpl->mStringValueContainer.size();
@@ -163,14 +393,7 @@ KeyValuePair Property::Map::GetKeyValue( SizeType position ) const
 
 Property::Value* Property::Map::Find( const char* key ) const
 {
-  for ( StringValueContainer::iterator iter = mImpl->mStringValueContainer.begin(), endIter = mImpl->mStringValueContainer.end(); iter != endIter; ++iter )
-  {
-    if ( iter->first == key )
-    {
-      return &iter->second;
-    }
-  }
-  return NULL; // Not found
+  return mImpl->FindString( key );
 }
 
 Property::Value* Property::Map::Find( const std::string& key ) const
@@ -180,14 +403,7 @@ Property::Value* Property::Map::Find( const std::string& key ) const
 
 Property::Value* Property::Map::Find( Property::Index key ) const
 {
-  for ( IndexValueContainer::iterator iter = mImpl->mIndexValueContainer.begin(), endIter = mImpl->mIndexValueContainer.end(); iter != endIter; ++iter )
-  {
-    if ( iter->first == key )
-    {
-      return &iter->second;
-    }
-  }
-  return NULL; // Not found
+  return mImpl->FindIndex( key );
 }
 
 Property::Value* Property::Map::Find( Property::Index indexKey, const std::string& stringKey ) const
@@ -202,32 +418,48 @@ Property::Value* Property::Map::Find( Property::Index indexKey, const std::strin
 
 Property::Value* Property::Map::Find( const std::string& key, Property::Type type ) const
 {
-  for ( StringValueContainer::iterator iter = mImpl->mStringValueContainer.begin(), endIter = mImpl->mStringValueContainer.end(); iter != endIter; ++iter )
+  // The first entry with the key usually has the type, otherwise search for a later duplicate
+  Property::Value* value = mImpl->FindString( key.c_str() );
+  if( value && ( value->GetType() != type ) )
   {
-    if( (iter->second.GetType() == type) && (iter->first == key) )
+    value = NULL;
+    for ( StringValueContainer::iterator iter = mImpl->mStringValueContainer.begin(), endIter = mImpl->mStringValueContainer.end(); iter != endIter; ++iter )
     {
-      return &iter->second;
+      if( (iter->second.GetType() == type) && (iter->first == key) )
+      {
+        value = &iter->second;
+        break;
+      }
     }
   }
-  return NULL; // Not found
+  return value;
 }
 
 Property::Value* Property::Map::Find( Property::Index key, Property::Type type ) const
 {
-  for ( IndexValueContainer::iterator iter = mImpl->mIndexValueContainer.begin(), endIter = mImpl->mIndexValueContainer.end(); iter != endIter; ++iter )
+  // The first entry with the key usually has the type, otherwise search for a later duplicate
+  Property::Value* value = mImpl->FindIndex( key );
+  if( value && ( value->GetType() != type ) )
   {
-    if( (iter->second.GetType() == type) && (iter->first == key) )
+    value = NULL;
+    for ( IndexValueContainer::iterator iter = mImpl->mIndexValueContainer.begin(), endIter = mImpl->mIndexValueContainer.end(); iter != endIter; ++iter )
     {
-      return &iter->second;
+      if( (iter->second.GetType() == type) && (iter->first == key) )
+      {
+        value = &iter->second;
+        break;
+      }
     }
   }
-  return NULL; // Not found
+  return value;
 }
 
 void Property::Map::Clear()
 {
   mImpl->mStringValueContainer.clear();
   mImpl->mIndexValueContainer.clear();
+  mImpl->mStringIndex.Reset();
+  mImpl->mIndexIndex.Reset();
 }
 
 void Property::Map::Merge( const Property::Map& from )
@@ -257,57 +489,49 @@ void Property::Map::Merge( const Property::Map& from )
 
 const Property::Value& Property::Map::operator[]( const std::string& key ) const
 {
-  for ( StringValueContainer::const_iterator iter = mImpl->mStringValueContainer.begin(), endIter = mImpl->mStringValueContainer.end(); iter != endIter; ++iter )
+  Property::Value* value = mImpl->FindString( key.c_str() );
+  if( !value )
   {
-    if ( iter->first == key )
-    {
-      return iter->second;
-    }
+    DALI_ASSERT_ALWAYS( ! "Invalid Key" );
   }
-
-  DALI_ASSERT_ALWAYS( ! "Invalid Key" );
+  return *value;
 }
 
 Property::Value& Property::Map::operator[]( const std::string& key )
 {
-  for ( StringValueContainer::iterator iter = mImpl->mStringValueContainer.begin(), endIter = mImpl->mStringValueContainer.end(); iter != endIter; ++iter )
+  Property::Value* value = mImpl->FindString( key.c_str() );
+  if( value )
   {
-    if ( iter->first == key )
-    {
-      return iter->second;
-    }
+    return *value;
   }
 
   // Create and return reference to new value
   mImpl->mStringValueContainer.push_back( std::make_pair( key, Property::Value() ) );
+  mImpl->mStringIndex.Update( mImpl->mStringValueContainer );
   return (mImpl->mStringValueContainer.end() - 1)->second;
 }
 
 const Property::Value& Property::Map::operator[]( Property::Index key ) const
 {
-  for ( IndexValueContainer::const_iterator iter = mImpl->mIndexValueContainer.begin(), endIter = mImpl->mIndexValueContainer.end(); iter != endIter; ++iter )
+  Property::Value* value = mImpl->FindIndex( key );
+  if( !value )
   {
-    if ( iter->first == key )
-    {
-      return iter->second;
-    }
+    DALI_ASSERT_ALWAYS( ! "Invalid Key" );
   }
-
-  DALI_ASSERT_ALWAYS( ! "Invalid Key" );
+  return *value;
 }
 
 Property::Value& Property::Map::operator[]( Property::Index key )
 {
-  for ( IndexValueContainer::iterator iter = mImpl->mIndexValueContainer.begin(), endIter = mImpl->mIndexValueContainer.end(); iter != endIter; ++iter )
+  Property::Value* value = mImpl->FindIndex( key );
+  if( value )
   {
-    if ( iter->first == key )
-    {
-      return iter->second;
-    }
+    return *value;
   }
 
   // Create and return reference to new value
   mImpl->mIndexValueContainer.push_back( std::make_pair( key, Property::Value() ) );
+  mImpl->mIndexIndex.Update( mImpl->mIndexValueContainer );
   return (mImpl->mIndexValueContainer.end() - 1)->second;
 }
 
@@ -319,6 +543,7 @@ Property::Map& Property::Map::operator=( const Property::Map& other )
     mImpl = new Impl;
     mImpl->mStringValueContainer = other.mImpl->mStringValueContainer;
     mImpl->mIndexValueContainer = other.mImpl->mIndexValueContainer;
+    mImpl->UpdateIndices();
   }
   return *this;
 }
@@ -21,6 +21,7 @@
 // EXTERNAL INCLUDES
 #include <string>
 #include <sstream>
+#include <utility>
 
 // INTERNAL INCLUDES
 #include <dali/public-api/common/dali-common.h>
@@ -114,6 +115,38 @@ public:
    */
   void Insert( Property::Index key, const Value& value );
 
+#ifdef _CPP11
+  /**
+   * @brief Moves the key-value pair into the Map, with the key type as string.
+   *
+   * Nested Maps and Arrays are moved rather than copied. Does not check for duplicates.
+   * @SINCE_1_2.32
+   * @param[in] key The key to insert
+   * @param[in] value The value to move into the Map
+   */
+  void Insert( const char* key, Value&& value );
+
+  /**
+   * @brief Moves the key-value pair into the Map, with the key type as string.
+   *
+   * Nested Maps and Arrays are moved rather than copied. Does not check for duplicates.
+   * @SINCE_1_2.32
+   * @param[in] key The key to insert
+   * @param[in] value The value to move into the Map
+   */
+  void Insert( const std::string& key, Value&& value );
+
+  /**
+   * @brief Moves the key-value pair into the Map, with the key type as index.
+   *
+   * Nested Maps and Arrays are moved rather than copied. Does not check for duplicates.
+   * @SINCE_1_2.32
+   * @param[in] key The key to insert
+   * @param[in] value The value to move into the Map
+   */
+  void Insert( Property::Index key, Value&& value );
+#endif
+
 
   /**
    * @brief Inserts the key-value pair in the Map, with the key type as string.
@@ -161,6 +194,53 @@ public:
     return *this;
   }
 
+#ifdef _CPP11
+  /**
+   * @brief Moves the key-value pair into the Map, with the key type as string.
+   *
+   * Does not check for duplicates
+   * @SINCE_1_2.32
+   * @param key to insert
+   * @param value to move into the Map
+   * @return a reference to this object
+   */
+  inline Property::Map& Add( const char* key, Value&& value )
+  {
+    Insert( key, std::move( value ) );
+    return *this;
+  }
+
+  /**
+   * @brief Moves the key-value pair into the Map, with the key type as string.
+   *
+   * Does not check for duplicates
+   * @SINCE_1_2.32
+   * @param key to insert
+   * @param value to move into the Map
+   * @return a reference to this object
+   */
+  inline Property::Map& Add( const std::string& key, Value&& value )
+  {
+    Insert( key, std::move( value ) );
+    return *this;
+  }
+
+  /**
+   * @brief Moves the key-value pair into the Map, with the key type as index.
+   *
+   * Does not check for duplicates
+   * @SINCE_1_2.32
+   * @param key to insert
+   * @param value to move into the Map
+   * @return a reference to this object
+   */
+  inline Property::Map& Add( Property::Index key, Value&& value )
+  {
+    Insert( key, std::move( value ) );
+    return *this;
+  }
+#endif
+
   /**
    * @brief Retrieves the value at the specified position.
    *
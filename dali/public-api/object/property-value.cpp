@@ -19,6 +19,7 @@
 #include <dali/public-api/object/property-value.h>
 
 // EXTERNAL INCLUDES
+#include <cstring> // for memcpy
 #include <ostream>
 
 // INTERNAL INCLUDES
@@ -34,6 +35,7 @@
 #include <dali/public-api/object/property-map.h>
 #include <dali/public-api/object/property-array.h>
 #include <dali/public-api/object/property-types.h>
+#include <dali/public-api/common/compile-time-assert.h>
 #include <dali/integration-api/debug.h>
 
 namespace Dali
@@ -50,356 +52,330 @@ inline bool IsIntegerType( Property::Type type )
 }
 }
 
+/**
+ * Helpers to construct, access and release the storage of a value.
+ * Vector2, Vector3, Vector4, Rect<int> and AngleAxis are copied in and out of the inline storage with memcpy,
+ * so the floats are never read through a pointer to another type. They are trivially destructible, so are never destroyed.
+ */
 struct Property::Value::Impl
 {
-  Impl()
-  : type( Property::NONE ),
-    integerValue( 0 )
-  { }
-
-  Impl( bool booleanValue )
-  : type( Property::BOOLEAN ),
-    integerValue( booleanValue )
-  { }
-
-  Impl( float floatValue )
-  : type( Property::FLOAT ),
-    floatValue( floatValue )
-  { }
-
-  Impl( int integerValue )
-  : type( Property::INTEGER ),
-    integerValue( integerValue )
-  { }
-
-  Impl( const Vector2& vectorValue )
-  : type( Property::VECTOR2 ),
-    vector2Value( new Vector2( vectorValue ) )
-  { }
-
-  Impl( const Vector3& vectorValue )
-  : type( Property::VECTOR3 ),
-    vector3Value( new Vector3( vectorValue ) )
-  { }
-
-  Impl( const Vector4& vectorValue )
-  : type( Property::VECTOR4 ),
-    vector4Value( new Vector4( vectorValue ) )
-  { }
-
-  Impl( const Matrix3& matrixValue )
-  : type( Property::MATRIX3 ),
-    matrix3Value( new Matrix3( matrixValue ) )
-  {
-  }
-
-  Impl( const Matrix& matrixValue )
-  : type( Property::MATRIX ),
-    matrixValue( new Matrix( matrixValue ) )
+  template< typename T >
+  static T Inline( const Property::Value& value )
   {
+    DALI_COMPILE_TIME_ASSERT( sizeof( T ) <= sizeof( value.mStorage.inlineValue ) );
+    T inlineValue;
+    memcpy( static_cast< void* >( &inlineValue ), value.mStorage.inlineValue, sizeof( T ) );
+    return inlineValue;
   }
 
-  Impl( const AngleAxis& angleAxisValue )
-  : type( Property::ROTATION ),
-    angleAxisValue( new AngleAxis(angleAxisValue) )
+  template< typename T >
+  static T& Heap( const Property::Value& value )
   {
+    return *static_cast< T* >( value.mStorage.heapValue );
   }
 
-  Impl( const Quaternion& quaternionValue )
-  : type( Property::ROTATION ),
-    angleAxisValue( new AngleAxis() )
+  template< typename T >
+  static void ConstructInline( Property::Value& value, Property::Type type, const T& initialValue )
   {
-    quaternionValue.ToAxisAngle( angleAxisValue->axis, angleAxisValue->angle );
+    DALI_COMPILE_TIME_ASSERT( sizeof( T ) <= sizeof( value.mStorage.inlineValue ) );
+    memcpy( value.mStorage.inlineValue, static_cast< const void* >( &initialValue ), sizeof( T ) );
+    value.mType = type;
+    value.mEmpty = false;
   }
 
-  Impl(const std::string& stringValue)
-  : type( Property::STRING ),
-    stringValue( new std::string( stringValue ) )
-  {
-  }
-
-  Impl( const Rect<int>& rectValue )
-  : type( Property::RECTANGLE ),
-    rectValue( new Rect<int>( rectValue ) )
-  {
-  }
-
-  Impl( const Property::Array& arrayValue )
-  : type( Property::ARRAY ),
-    arrayValue( new Property::Array( arrayValue ) )
-  {
-  }
-
-  Impl( const Property::Map& mapValue )
-  : type( Property::MAP ),
-    mapValue( new Property::Map( mapValue ) )
+  template< typename T >
+  static void ConstructHeap( Property::Value& value, Property::Type type, const T& initialValue )
   {
+    value.mStorage.heapValue = new T( initialValue );
+    value.mType = type;
+    value.mEmpty = false;
   }
 
   /**
-   * Destructor, takes care of releasing the dynamically allocated types
+   * Construct a copy of another value; the storage must not hold an allocated value.
    */
-  ~Impl()
+  static void ConstructCopy( Property::Value& value, const Property::Value& other )
   {
-    switch( type )
+    switch( other.mType )
     {
-      case Property::NONE :             // FALLTHROUGH
-      case Property::BOOLEAN :          // FALLTHROUGH
-      case Property::FLOAT :            // FALLTHROUGH
-      case Property::INTEGER :
+      case Property::MATRIX3:
       {
-        break; // nothing to do
+        ConstructHeap( value, Property::MATRIX3, Heap< Matrix3 >( other ) );
+        break;
       }
-      case Property::VECTOR2 :
+      case Property::MATRIX:
       {
-        delete vector2Value;
+        ConstructHeap( value, Property::MATRIX, Heap< Matrix >( other ) );
         break;
       }
-      case Property::VECTOR3:
+      case Property::STRING:
       {
-        delete vector3Value;
+        ConstructHeap( value, Property::STRING, Heap< std::string >( other ) );
         break;
       }
-      case Property::VECTOR4:
+      case Property::ARRAY:
       {
-        delete vector4Value;
+        ConstructHeap( value, Property::ARRAY, Heap< Property::Array >( other ) );
         break;
       }
-      case Property::MATRIX3:
+      case Property::MAP:
       {
-        delete matrix3Value;
+        ConstructHeap( value, Property::MAP, Heap< Property::Map >( other ) );
         break;
       }
-      case Property::MATRIX:
+      case Property::NONE:              // FALLTHROUGH
+      case Property::BOOLEAN:           // FALLTHROUGH
+      case Property::FLOAT:             // FALLTHROUGH
+      case Property::INTEGER:           // FALLTHROUGH
+      case Property::VECTOR2:           // FALLTHROUGH
+      case Property::VECTOR3:           // FALLTHROUGH
+      case Property::VECTOR4:           // FALLTHROUGH
+      case Property::RECTANGLE:         // FALLTHROUGH
+      case Property::ROTATION:
       {
-        delete matrixValue;
+        // inline types are trivially copyable
+        value.mStorage = other.mStorage;
+        value.mType = other.mType;
+        value.mEmpty = other.mEmpty;
         break;
       }
-      case Property::RECTANGLE:
+    }
+  }
+
+  /**
+   * Releases the allocated value, if any, and leaves the value empty
+   */
+  static void Release( Property::Value& value )
+  {
+    switch( value.mType )
+    {
+      case Property::NONE :             // FALLTHROUGH
+      case Property::BOOLEAN :          // FALLTHROUGH
+      case Property::FLOAT :            // FALLTHROUGH
+      case Property::INTEGER :          // FALLTHROUGH
+      case Property::VECTOR2 :          // FALLTHROUGH
+      case Property::VECTOR3 :          // FALLTHROUGH
+      case Property::VECTOR4 :          // FALLTHROUGH
+      case Property::RECTANGLE :        // FALLTHROUGH
+      case Property::ROTATION :
+      {
+        break; // nothing to do
+      }
+      case Property::MATRIX3:
       {
-        delete rectValue;
+        delete &Heap< Matrix3 >( value );
         break;
       }
-      case Property::ROTATION:
+      case Property::MATRIX:
       {
-        delete angleAxisValue;
+        delete &Heap< Matrix >( value );
         break;
       }
       case Property::STRING:
       {
-        delete stringValue;
+        delete &Heap< std::string >( value );
         break;
       }
       case Property::ARRAY:
       {
-        delete arrayValue;
+        delete &Heap< Property::Array >( value );
         break;
       }
       case Property::MAP:
       {
-        delete mapValue;
+        delete &Heap< Property::Map >( value );
         break;
       }
     }
+    value.mStorage.heapValue = NULL;
+    value.mType = Property::NONE;
+    value.mEmpty = true;
   }
-
-public: // Data
-
-  Type type;
-  union
-  {
-    int integerValue;
-    float floatValue;
-    // must use pointers for any class value pre c++ 11
-    Vector2* vector2Value;
-    Vector3* vector3Value;
-    Vector4* vector4Value;
-    Matrix3* matrix3Value;
-    Matrix* matrixValue;
-    AngleAxis* angleAxisValue;
-    std::string* stringValue;
-    Rect<int>* rectValue;
-    Property::Array* arrayValue;
-    Property::Map* mapValue;
-  };
-
-private:
-
-  Impl( const Impl& ); ///< Undefined
-  Impl& operator=( const Impl& ); ///< Undefined
 };
 
 Property::Value::Value()
-: mImpl( NULL )
+: mType( Property::NONE ),
+  mEmpty( true )
 {
+  mStorage.heapValue = NULL;
 }
 
 Property::Value::Value( bool booleanValue )
-: mImpl( new Impl( booleanValue ) )
+: mType( Property::BOOLEAN ),
+  mEmpty( false )
 {
+  mStorage.integerValue = booleanValue;
 }
 
 Property::Value::Value( float floatValue )
-: mImpl( new Impl( floatValue ) )
+: mType( Property::FLOAT ),
+  mEmpty( false )
 {
+  mStorage.floatValue = floatValue;
 }
 
 Property::Value::Value( int integerValue )
-: mImpl( new Impl( integerValue ) )
+: mType( Property::INTEGER ),
+  mEmpty( false )
 {
+  mStorage.integerValue = integerValue;
 }
 
 Property::Value::Value( const Vector2& vectorValue )
-: mImpl( new Impl( vectorValue ) )
 {
+  Impl::ConstructInline( *this, Property::VECTOR2, vectorValue );
 }
 
 Property::Value::Value( const Vector3& vectorValue )
-: mImpl( new Impl( vectorValue ) )
 {
+  Impl::ConstructInline( *this, Property::VECTOR3, vectorValue );
 }
 
 Property::Value::Value( const Vector4& vectorValue )
-: mImpl( new Impl( vectorValue ) )
 {
+  Impl::ConstructInline( *this, Property::VECTOR4, vectorValue );
 }
 
 Property::Value::Value( const Matrix3& matrixValue )
-: mImpl( new Impl( matrixValue ) )
 {
+  Impl::ConstructHeap( *this, Property::MATRIX3, matrixValue );
 }
 
 Property::Value::Value( const Matrix& matrixValue )
-: mImpl( new Impl( matrixValue ) )
 {
+  Impl::ConstructHeap( *this, Property::MATRIX, matrixValue );
 }
 
 Property::Value::Value( const Rect<int>& rectValue )
-: mImpl( new Impl( rectValue ) )
 {
+  Impl::ConstructInline( *this, Property::RECTANGLE, rectValue );
 }
 
 Property::Value::Value( const AngleAxis& angleAxisValue )
-: mImpl( new Impl( angleAxisValue ) )
 {
+  Impl::ConstructInline( *this, Property::ROTATION, angleAxisValue );
 }
 
 Property::Value::Value( const Quaternion& quaternionValue )
-: mImpl( new Impl( quaternionValue ) )
 {
+  AngleAxis angleAxisValue;
+  quaternionValue.ToAxisAngle( angleAxisValue.axis, angleAxisValue.angle );
+  Impl::ConstructInline( *this, Property::ROTATION, angleAxisValue );
 }
 
 Property::Value::Value( const std::string& stringValue )
-: mImpl( new Impl( stringValue ) )
 {
+  Impl::ConstructHeap( *this, Property::STRING, stringValue );
 }
 
 Property::Value::Value( const char* stringValue )
-: mImpl( NULL )
 {
   if( stringValue ) // string constructor is undefined with NULL pointer
   {
-    mImpl = new Impl( std::string(stringValue) );
+    Impl::ConstructHeap( *this, Property::STRING, std::string( stringValue ) );
   }
   else
   {
-    mImpl = new Impl( std::string() );
+    Impl::ConstructHeap( *this, Property::STRING, std::string() );
   }
 }
 
 Property::Value::Value( Property::Array& arrayValue )
-: mImpl( new Impl( arrayValue ) )
 {
+  Impl::ConstructHeap( *this, Property::ARRAY, arrayValue );
 }
 
 Property::Value::Value( Property::Map& mapValue )
-: mImpl( new Impl( mapValue ) )
 {
+  Impl::ConstructHeap( *this, Property::MAP, mapValue );
 }
 
 Property::Value::Value( Type type )
-: mImpl( NULL )
+: mType( Property::NONE ),
+  mEmpty( false )
 {
+  mStorage.heapValue = NULL;
+
   switch (type)
   {
     case Property::BOOLEAN:
     {
-      mImpl = new Impl( false );
+      mType = Property::BOOLEAN;
+      mStorage.integerValue = false;
       break;
     }
     case Property::FLOAT:
     {
-      mImpl = new Impl( 0.f );
+      mType = Property::FLOAT;
+      mStorage.floatValue = 0.f;
       break;
     }
     case Property::INTEGER:
     {
-      mImpl = new Impl( 0 );
+      mType = Property::INTEGER;
+      mStorage.integerValue = 0;
       break;
     }
     case Property::VECTOR2:
     {
-      mImpl = new Impl( Vector2::ZERO );
+      Impl::ConstructInline( *this, Property::VECTOR2, Vector2::ZERO );
       break;
     }
     case Property::VECTOR3:
     {
-      mImpl = new Impl( Vector3::ZERO );
+      Impl::ConstructInline( *this, Property::VECTOR3, Vector3::ZERO );
       break;
     }
     case Property::VECTOR4:
     {
-      mImpl = new Impl( Vector4::ZERO );
+      Impl::ConstructInline( *this, Property::VECTOR4, Vector4::ZERO );
       break;
     }
     case Property::RECTANGLE:
     {
-      mImpl = new Impl( Rect<int>(0,0,0,0) );
+      Impl::ConstructInline( *this, Property::RECTANGLE, Rect<int>(0,0,0,0) );
       break;
     }
     case Property::ROTATION:
     {
-      mImpl = new Impl( AngleAxis() );
+      Impl::ConstructInline( *this, Property::ROTATION, AngleAxis() );
       break;
     }
     case Property::STRING:
     {
-      mImpl = new Impl( std::string() );
+      Impl::ConstructHeap( *this, Property::STRING, std::string() );
       break;
     }
     case Property::MATRIX:
     {
-      mImpl = new Impl( Matrix() );
+      Impl::ConstructHeap( *this, Property::MATRIX, Matrix() );
       break;
     }
     case Property::MATRIX3:
     {
-      mImpl = new Impl( Matrix3() );
+      Impl::ConstructHeap( *this, Property::MATRIX3, Matrix3() );
       break;
     }
     case Property::ARRAY:
     {
-      mImpl = new Impl( Property::Array() );
+      Impl::ConstructHeap( *this, Property::ARRAY, Property::Array() );
       break;
     }
     case Property::MAP:
     {
-      mImpl = new Impl( Property::Map() );
+      Impl::ConstructHeap( *this, Property::MAP, Property::Map() );
       break;
     }
     case Property::NONE:
     {
-      mImpl = new Impl();
       break;
     }
   }
 }
 
 Property::Value::Value( const Property::Value& value )
-: mImpl( NULL )
 {
-  // reuse assignment operator
-  operator=( value );
+  Impl::ConstructCopy( *this, value );
 }
 
 Property::Value& Property::Value::operator=( const Property::Value& value )
@@ -409,191 +385,107 @@ Property::Value& Property::Value::operator=( const Property::Value& value )
     // skip self assignment
     return *this;
   }
-  // if we are assigned an empty value, just drop impl
-  if( !value.mImpl )
-  {
-    delete mImpl;
-    mImpl = NULL;
-    return *this;
-  }
-  // first check if the type is the same, no need to change impl, just assign
-  if( mImpl && ( mImpl->type == value.mImpl->type ) )
+
+  // if the type is the same, reuse the allocated value
+  if( ( mType == value.mType ) && !mEmpty && !value.mEmpty )
   {
-    switch( mImpl->type )
+    switch( mType )
     {
-      case Property::BOOLEAN:
-      {
-        mImpl->integerValue = value.mImpl->integerValue;
-        break;
-      }
-      case Property::FLOAT:
-      {
-        mImpl->floatValue = value.mImpl->floatValue;
-        break;
-      }
-      case Property::INTEGER:
-      {
-        mImpl->integerValue = value.mImpl->integerValue;
-        break;
-      }
-      case Property::VECTOR2:
-      {
-        *mImpl->vector2Value = *value.mImpl->vector2Value; // type cannot change in mImpl so vector is allocated
-        break;
-      }
-      case Property::VECTOR3:
-      {
-        *mImpl->vector3Value = *value.mImpl->vector3Value; // type cannot change in mImpl so vector is allocated
-        break;
-      }
-      case Property::VECTOR4:
-      {
-        *mImpl->vector4Value = *value.mImpl->vector4Value; // type cannot change in mImpl so vector is allocated
-        break;
-      }
-      case Property::RECTANGLE:
-      {
-        *mImpl->rectValue = *value.mImpl->rectValue; // type cannot change in mImpl so rect is allocated
-        break;
-      }
-      case Property::ROTATION:
-      {
-        *mImpl->angleAxisValue = *value.mImpl->angleAxisValue; // type cannot change in mImpl so quaternion is allocated
-        break;
-      }
-      case Property::STRING:
+      case Property::MATRIX3:
       {
-        *mImpl->stringValue = *value.mImpl->stringValue; // type cannot change in mImpl so string is allocated
+        Impl::Heap< Matrix3 >( *this ) = Impl::Heap< Matrix3 >( value );
         break;
       }
       case Property::MATRIX:
       {
-        *mImpl->matrixValue = *value.mImpl->matrixValue; // type cannot change in mImpl so matrix is allocated
+        Impl::Heap< Matrix >( *this ) = Impl::Heap< Matrix >( value );
         break;
       }
-      case Property::MATRIX3:
+      case Property::STRING:
       {
-        *mImpl->matrix3Value = *value.mImpl->matrix3Value; // type cannot change in mImpl so matrix is allocated
+        Impl::Heap< std::string >( *this ) = Impl::Heap< std::string >( value );
         break;
       }
       case Property::ARRAY:
       {
-        *mImpl->arrayValue = *value.mImpl->arrayValue; // type cannot change in mImpl so array is allocated
+        Impl::Heap< Property::Array >( *this ) = Impl::Heap< Property::Array >( value );
         break;
       }
       case Property::MAP:
       {
-        *mImpl->mapValue = *value.mImpl->mapValue; // type cannot change in mImpl so map is allocated
-        break;
-      }
-      case Property::NONE:
-      { // mImpl will be NULL, there's no way to get to this case
-      }
-    }
-  }
-  else
-  {
-    // different type, release old impl and create new
-    Impl* newImpl( NULL );
-    switch ( value.mImpl->type )
-    {
-      case Property::BOOLEAN:
-      {
-        newImpl = new Impl( bool( value.mImpl->integerValue ) );
-        break;
-      }
-      case Property::FLOAT:
-      {
-        newImpl = new Impl( value.mImpl->floatValue );
-        break;
-      }
-      case Property::INTEGER:
-      {
-        newImpl = new Impl( value.mImpl->integerValue );
-        break;
-      }
-      case Property::VECTOR2:
-      {
-        newImpl = new Impl( *value.mImpl->vector2Value ); // type cannot change in mImpl so vector is allocated
-        break;
-      }
-      case Property::VECTOR3:
-      {
-        newImpl = new Impl( *value.mImpl->vector3Value ); // type cannot change in mImpl so vector is allocated
-        break;
-      }
-      case Property::VECTOR4:
-      {
-        newImpl = new Impl( *value.mImpl->vector4Value ); // type cannot change in mImpl so vector is allocated
-        break;
-      }
-      case Property::RECTANGLE:
-      {
-        newImpl = new Impl( *value.mImpl->rectValue ); // type cannot change in mImpl so rect is allocated
+        Impl::Heap< Property::Map >( *this ) = Impl::Heap< Property::Map >( value );
         break;
       }
+      case Property::NONE:              // FALLTHROUGH
+      case Property::BOOLEAN:           // FALLTHROUGH
+      case Property::FLOAT:             // FALLTHROUGH
+      case Property::INTEGER:           // FALLTHROUGH
+      case Property::VECTOR2:           // FALLTHROUGH
+      case Property::VECTOR3:           // FALLTHROUGH
+      case Property::VECTOR4:           // FALLTHROUGH
+      case Property::RECTANGLE:         // FALLTHROUGH
       case Property::ROTATION:
       {
-        newImpl = new Impl( *value.mImpl->angleAxisValue ); // type cannot change in mImpl so quaternion is allocated
-        break;
-      }
-      case Property::MATRIX3:
-      {
-        newImpl = new Impl( *value.mImpl->matrix3Value ); // type cannot change in mImpl so matrix is allocated
-        break;
-      }
-      case Property::MATRIX:
-      {
-        newImpl = new Impl( *value.mImpl->matrixValue ); // type cannot change in mImpl so matrix is allocated
-        break;
-      }
-      case Property::STRING:
-      {
-        newImpl = new Impl( *value.mImpl->stringValue ); // type cannot change in mImpl so string is allocated
-        break;
-      }
-      case Property::ARRAY:
-      {
-        newImpl = new Impl( *value.mImpl->arrayValue ); // type cannot change in mImpl so array is allocated
-        break;
-      }
-      case Property::MAP:
-      {
-        newImpl = new Impl( *value.mImpl->mapValue ); // type cannot change in mImpl so map is allocated
+        mStorage = value.mStorage;
         break;
       }
-      case Property::NONE:
-      { // NULL value will be used for "empty" value
-      }
     }
-    delete mImpl;
-    mImpl = newImpl;
+  }
+  else
+  {
+    // different type, release the old value and copy the new one
+    Impl::Release( *this );
+    Impl::ConstructCopy( *this, value );
   }
 
   return *this;
 }
 
-Property::Value::~Value()
+#ifdef _CPP11
+Property::Value::Value( Property::Value&& value ) noexcept
+: mStorage( value.mStorage ),
+  mType( value.mType ),
+  mEmpty( value.mEmpty )
 {
-  delete mImpl;
+  // the allocated value, if any, now belongs to this
+  value.mStorage.heapValue = NULL;
+  value.mType = Property::NONE;
+  value.mEmpty = true;
 }
 
-Property::Type Property::Value::GetType() const
+Property::Value& Property::Value::operator=( Property::Value&& value ) noexcept
 {
-  Property::Type type( Property::NONE );
-  if( mImpl )
+  if( this != &value )
   {
-    type = mImpl->type;
+    Impl::Release( *this );
+    mStorage = value.mStorage;
+    mType = value.mType;
+    mEmpty = value.mEmpty;
+
+    value.mStorage.heapValue = NULL;
+    value.mType = Property::NONE;
+    value.mEmpty = true;
   }
-  return type;
+  return *this;
+}
+#endif
+
+Property::Value::~Value()
+{
+  Impl::Release( *this );
+}
+
+Property::Type Property::Value::GetType() const
+{
+  return mType;
 }
 
 bool Property::Value::Get( bool& booleanValue ) const
 {
   bool converted = false;
-  if( mImpl && IsIntegerType( mImpl->type ) )
+  if( IsIntegerType( mType ) )
   {
-    booleanValue = mImpl->integerValue;
+    booleanValue = mStorage.integerValue;
     converted = true;
   }
   return converted;
@@ -602,18 +494,15 @@ bool Property::Value::Get( bool& booleanValue ) const
 bool Property::Value::Get( float& floatValue ) const
 {
   bool converted = false;
-  if( mImpl )
+  if( mType == FLOAT )
   {
-    if( mImpl->type == FLOAT )
-    {
-      floatValue = mImpl->floatValue;
-      converted = true;
-    }
-    else if( IsIntegerType( mImpl->type ) )
-    {
-      floatValue = static_cast< float >( mImpl->integerValue );
-      converted = true;
-    }
+    floatValue = mStorage.floatValue;
+    converted = true;
+  }
+  else if( IsIntegerType( mType ) )
+  {
+    floatValue = static_cast< float >( mStorage.integerValue );
+    converted = true;
   }
   return converted;
 }
@@ -621,18 +510,15 @@ bool Property::Value::Get( float& floatValue ) const
 bool Property::Value::Get( int& integerValue ) const
 {
   bool converted = false;
-  if( mImpl )
+  if( IsIntegerType( mType ) )
   {
-    if( IsIntegerType( mImpl->type ) )
-    {
-      integerValue = mImpl->integerValue;
-      converted = true;
-    }
-    else if( mImpl->type == FLOAT )
-    {
-      integerValue = static_cast< int >( mImpl->floatValue );
-      converted = true;
-    }
+    integerValue = mStorage.integerValue;
+    converted = true;
+  }
+  else if( mType == FLOAT )
+  {
+    integerValue = static_cast< int >( mStorage.floatValue );
+    converted = true;
   }
   return converted;
 }
@@ -640,14 +526,10 @@ bool Property::Value::Get( int& integerValue ) const
 bool Property::Value::Get( Vector2& vectorValue ) const
 {
   bool converted = false;
-  if( mImpl )
+  if( mType == VECTOR2 || mType == VECTOR3 || mType == VECTOR4 )
   {
-    // type cannot change in mImpl so vector is allocated
-    if( mImpl->type == VECTOR2 || mImpl->type == VECTOR3 || mImpl->type == VECTOR4 )
-    {
-      vectorValue = *(mImpl->vector2Value); // if Vector3 or 4 only x and y are assigned
-      converted = true;
-    }
+    vectorValue = Impl::Inline< Vector2 >( *this ); // if Vector3 or 4 only x and y are assigned
+    converted = true;
   }
   return converted;
 }
@@ -655,19 +537,15 @@ bool Property::Value::Get( Vector2& vectorValue ) const
 bool Property::Value::Get( Vector3& vectorValue ) const
 {
   bool converted = false;
-  if( mImpl )
+  if ( mType == VECTOR3 || mType == VECTOR4 )
   {
-    // type cannot change in mImpl so vector is allocated
-    if ( mImpl->type == VECTOR3 || mImpl->type == VECTOR4 )
-    {
-      vectorValue = *(mImpl->vector3Value); // if Vector4 only x,y,z are assigned
-      converted = true;
-    }
-    else if( mImpl->type == VECTOR2 )
-    {
-      vectorValue = *(mImpl->vector2Value);
-      converted = true;
-    }
+    vectorValue = Impl::Inline< Vector3 >( *this ); // if Vector4 only x,y,z are assigned
+    converted = true;
+  }
+  else if( mType == VECTOR2 )
+  {
+    vectorValue = Impl::Inline< Vector2 >( *this );
+    converted = true;
   }
   return converted;
 }
@@ -675,23 +553,20 @@ bool Property::Value::Get( Vector3& vectorValue ) const
 bool Property::Value::Get( Vector4& vectorValue ) const
 {
   bool converted = false;
-  if( mImpl )
+  if( mType == VECTOR4 )
   {
-    if( mImpl->type == VECTOR4 ) // type cannot change in mImpl so vector is allocated
-    {
-      vectorValue = *(mImpl->vector4Value);
-      converted = true;
-    }
-    else if( mImpl->type == VECTOR2 )
-    {
-      vectorValue = *(mImpl->vector2Value);
-      converted = true;
-    }
-    else if( mImpl->type == VECTOR3 )
-    {
-      vectorValue = *(mImpl->vector3Value);
-      converted = true;
-    }
+    vectorValue = Impl::Inline< Vector4 >( *this );
+    converted = true;
+  }
+  else if( mType == VECTOR2 )
+  {
+    vectorValue = Impl::Inline< Vector2 >( *this );
+    converted = true;
+  }
+  else if( mType == VECTOR3 )
+  {
+    vectorValue = Impl::Inline< Vector3 >( *this );
+    converted = true;
   }
   return converted;
 }
@@ -699,9 +574,9 @@ bool Property::Value::Get( Vector4& vectorValue ) const
 bool Property::Value::Get( Matrix3& matrixValue ) const
 {
   bool converted = false;
-  if( mImpl && (mImpl->type == MATRIX3) ) // type cannot change in mImpl so matrix is allocated
+  if( mType == MATRIX3 ) // type cannot change so matrix is allocated
   {
-    matrixValue = *(mImpl->matrix3Value);
+    matrixValue = Impl::Heap< Matrix3 >( *this );
     converted = true;
   }
   return converted;
@@ -710,9 +585,9 @@ bool Property::Value::Get( Matrix3& matrixValue ) const
 bool Property::Value::Get( Matrix& matrixValue ) const
 {
   bool converted = false;
-  if( mImpl && (mImpl->type == MATRIX) ) // type cannot change in mImpl so matrix is allocated
+  if( mType == MATRIX ) // type cannot change so matrix is allocated
   {
-    matrixValue = *(mImpl->matrixValue);
+    matrixValue = Impl::Heap< Matrix >( *this );
     converted = true;
   }
   return converted;
@@ -721,9 +596,9 @@ bool Property::Value::Get( Matrix& matrixValue ) const
 bool Property::Value::Get( Rect<int>& rectValue ) const
 {
   bool converted = false;
-  if( mImpl && (mImpl->type == RECTANGLE) ) // type cannot change in mImpl so rect is allocated
+  if( mType == RECTANGLE )
   {
-    rectValue = *(mImpl->rectValue);
+    rectValue = Impl::Inline< Rect<int> >( *this );
     converted = true;
   }
   return converted;
@@ -732,9 +607,9 @@ bool Property::Value::Get( Rect<int>& rectValue ) const
 bool Property::Value::Get( AngleAxis& angleAxisValue ) const
 {
   bool converted = false;
-  if( mImpl && (mImpl->type == ROTATION) ) // type cannot change in mImpl so angleAxis is allocated
+  if( mType == ROTATION )
   {
-    angleAxisValue = *(mImpl->angleAxisValue);
+    angleAxisValue = Impl::Inline< AngleAxis >( *this );
     converted = true;
   }
   return converted;
@@ -743,9 +618,10 @@ bool Property::Value::Get( AngleAxis& angleAxisValue ) const
 bool Property::Value::Get( Quaternion& quaternionValue ) const
 {
   bool converted = false;
-  if( mImpl && (mImpl->type == ROTATION) ) // type cannot change in mImpl so angleAxis is allocated
+  if( mType == ROTATION )
   {
-    quaternionValue = Quaternion(mImpl->angleAxisValue->angle, mImpl->angleAxisValue->axis );
+    const AngleAxis angleAxisValue = Impl::Inline< AngleAxis >( *this );
+    quaternionValue = Quaternion( angleAxisValue.angle, angleAxisValue.axis );
     converted = true;
   }
   return converted;
@@ -754,9 +630,9 @@ bool Property::Value::Get( Quaternion& quaternionValue ) const
 bool Property::Value::Get( std::string& stringValue ) const
 {
   bool converted = false;
-  if( mImpl && (mImpl->type == STRING) ) // type cannot change in mImpl so string is allocated
+  if( mType == STRING ) // type cannot change so string is allocated
   {
-    stringValue.assign( *(mImpl->stringValue) );
+    stringValue.assign( Impl::Heap< std::string >( *this ) );
     converted = true;
   }
   return converted;
@@ -765,9 +641,9 @@ bool Property::Value::Get( std::string& stringValue ) const
 bool Property::Value::Get( Property::Array& arrayValue ) const
 {
   bool converted = false;
-  if( mImpl && (mImpl->type == ARRAY) ) // type cannot change in mImpl so array is allocated
+  if( mType == ARRAY ) // type cannot change so array is allocated
   {
-    arrayValue = *(mImpl->arrayValue);
+    arrayValue = Impl::Heap< Property::Array >( *this );
     converted = true;
   }
   return converted;
@@ -776,9 +652,9 @@ bool Property::Value::Get( Property::Array& arrayValue ) const
 bool Property::Value::Get( Property::Map& mapValue ) const
 {
   bool converted = false;
-  if( mImpl && (mImpl->type == MAP) ) // type cannot change in mImpl so map is allocated
+  if( mType == MAP ) // type cannot change so map is allocated
   {
-    mapValue = *(mImpl->mapValue);
+    mapValue = Impl::Heap< Property::Map >( *this );
     converted = true;
   }
   return converted;
@@ -787,9 +663,9 @@ bool Property::Value::Get( Property::Map& mapValue ) const
 Property::Array* Property::Value::GetArray() const
 {
   Property::Array* array = NULL;
-  if( mImpl && (mImpl->type == ARRAY) ) // type cannot change in mImpl so array is allocated
+  if( mType == ARRAY ) // type cannot change so array is allocated
   {
-    array = mImpl->arrayValue;
+    array = &Impl::Heap< Property::Array >( *this );
   }
   return array;
 }
@@ -797,74 +673,72 @@ Property::Array* Property::Value::GetArray() const
 Property::Map* Property::Value::GetMap() const
 {
   Property::Map* map = NULL;
-  if( mImpl && (mImpl->type == MAP) ) // type cannot change in mImpl so map is allocated
+  if( mType == MAP ) // type cannot change so map is allocated
   {
-    map = mImpl->mapValue;
+    map = &Impl::Heap< Property::Map >( *this );
   }
   return map;
 }
 
 std::ostream& operator<<( std::ostream& stream, const Property::Value& value )
 {
-  if( value.mImpl )
+  if( !value.mEmpty )
   {
-    const Property::Value::Impl& impl( *value.mImpl );
-
-    switch( impl.type )
+    switch( value.mType )
     {
       case Dali::Property::BOOLEAN:
       {
-        stream << impl.integerValue;
+        stream << value.mStorage.integerValue;
         break;
       }
       case Dali::Property::FLOAT:
       {
-        stream << impl.floatValue;
+        stream << value.mStorage.floatValue;
         break;
       }
       case Dali::Property::INTEGER:
       {
-         stream << impl.integerValue;
+         stream << value.mStorage.integerValue;
          break;
       }
       case Dali::Property::VECTOR2:
       {
-        stream << *impl.vector2Value;
+        stream << Property::Value::Impl::Inline< Vector2 >( value );
         break;
       }
       case Dali::Property::VECTOR3:
       {
-        stream << *impl.vector3Value;
+        stream << Property::Value::Impl::Inline< Vector3 >( value );
         break;
       }
       case Dali::Property::VECTOR4:
       {
-        stream << *impl.vector4Value;
+        stream << Property::Value::Impl::Inline< Vector4 >( value );
         break;
       }
       case Dali::Property::MATRIX3:
       {
-        stream << *impl.matrix3Value;
+        stream << Property::Value::Impl::Heap< Matrix3 >( value );
         break;
       }
       case Dali::Property::MATRIX:
       {
-        stream << *impl.matrixValue;
+        stream << Property::Value::Impl::Heap< Matrix >( value );
         break;
       }
       case Dali::Property::RECTANGLE:
       {
-        stream << *impl.rectValue;
+        stream << Property::Value::Impl::Inline< Rect<int> >( value );
         break;
       }
       case Dali::Property::ROTATION:
       {
-        stream << *impl.angleAxisValue;
+        stream << Property::Value::Impl::Inline< AngleAxis >( value );
         break;
       }
       case Dali::Property::STRING:
       {
-        stream << *impl.stringValue;
+        stream << Property::Value::Impl::Heap< std::string >( value );
         break;
       }
       case Dali::Property::ARRAY:
@@ -201,6 +201,27 @@ public:
    */
   Value& operator=( const Value& value );
 
+#ifdef _CPP11
+  /**
+   * @brief Move constructor.
+   *
+   * The moved-from value is left empty.
+   * @SINCE_1_2.32
+   * @param[in] value The property value to move from
+   */
+  Value( Value&& value ) noexcept;
+
+  /**
+   * @brief Move assignment operator.
+   *
+   * The moved-from value is left empty.
+   * @SINCE_1_2.32
+   * @param[in] value The property value to move from
+   * @return a reference to this
+   */
+  Value& operator=( Value&& value ) noexcept;
+#endif
+
   /**
    * @brief Non-virtual destructor.
    *
@@ -398,7 +419,24 @@ public:
 private:
 
   struct DALI_INTERNAL Impl;
-  Impl* mImpl; ///< Pointer to the implementation
+
+  /**
+   * @brief Storage for the value.
+   *
+   * Values no larger than a Vector4 are stored inline; Matrix3, Matrix, std::string,
+   * Property::Array and Property::Map are allocated.
+   */
+  union Storage
+  {
+    int   integerValue;
+    float floatValue;
+    float inlineValue[4]; ///< Vector2, Vector3, Vector4, Rect<int> or AngleAxis
+    void* heapValue;      ///< The allocated value
+  };
+
+  Storage mStorage; ///< The value
+  Type    mType;    ///< The type of the value
+  bool    mEmpty;   ///< Whether the value was default constructed, in which case the type is NONE
 
 };
 
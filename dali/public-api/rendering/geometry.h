@@ -138,6 +138,7 @@ public:
   /**
    * @brief Sets a the index data to be used as a source of indices for the geometry
    * Setting this buffer will cause the geometry to be rendered using indices.
+   * The indices are 16 bit, so they can address at most 65536 vertices.
    * To unset call SetIndexBuffer with a null pointer or count 0.
    *
    * @SINCE_1_1.43
@@ -74,6 +74,10 @@ public:
 
   /**
    * @brief Hints for rendering.
+   *
+   * A shader using INSTANCED declares the per-instance attributes "aInstanceModelView" (mat4),
+   * "aInstanceColor" (vec4) and "aInstanceSize" (vec3), and uses them instead of the uModelView,
+   * uColor and uSize uniforms. Any other uniform is taken from the first renderer drawn in each instanced draw call.
    * @SINCE_1_1.45
    */
   struct Hint
@@ -87,6 +91,7 @@ public:
       NONE                     = 0x00, ///< No hints                                                                          @SINCE_1_1.45
       OUTPUT_IS_TRANSPARENT    = 0x01, ///< Might generate transparent alpha from opaque inputs                               @SINCE_1_1.45
       MODIFIES_GEOMETRY        = 0x02, ///< Might change position of vertices, this option disables any culling optimizations @SINCE_1_1.45
+      INSTANCED                = 0x04, ///< Reads the model-view matrix, color and size from per-instance attributes, so renderers sharing geometry, shader and textures can be drawn together @SINCE_1_2.32
     };
   };
 